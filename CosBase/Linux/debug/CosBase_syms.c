@@ -0,0 +1,978 @@
+/*
+ * -----------------------------
+ * COS symbols
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cossym
+ * Sun Oct 18 12:21:38 UTC 2026
+ * -----------------------------
+ */
+
+extern struct Any cos_c_Any;
+extern struct Any cos_c_AutoRelease;
+extern struct Any cos_c_Behavior;
+extern struct Any cos_c_Class;
+extern struct Any cos_c_ExBadAlloc;
+extern struct Any cos_c_ExBadArity;
+extern struct Any cos_c_ExBadAssert;
+extern struct Any cos_c_ExBadCast;
+extern struct Any cos_c_ExBadDomain;
+extern struct Any cos_c_ExBadFormat;
+extern struct Any cos_c_ExBadMessage;
+extern struct Any cos_c_ExBadMode;
+extern struct Any cos_c_ExBadPredicate;
+extern struct Any cos_c_ExBadProperty;
+extern struct Any cos_c_ExBadRange;
+extern struct Any cos_c_ExBadSize;
+extern struct Any cos_c_ExBadType;
+extern struct Any cos_c_ExBadValue;
+extern struct Any cos_c_ExErrno;
+extern struct Any cos_c_ExNotFound;
+extern struct Any cos_c_ExNotImplemented;
+extern struct Any cos_c_ExNotSupported;
+extern struct Any cos_c_ExOverflow;
+extern struct Any cos_c_ExSignal;
+extern struct Any cos_c_ExUnderflow;
+extern struct Any cos_c_Exception;
+extern struct Any cos_c_False;
+extern struct Any cos_c_G_Accessor;
+extern struct Any cos_c_G_getAt;
+extern struct Any cos_c_G_getAtIdx;
+extern struct Any cos_c_G_getAtKey;
+extern struct Any cos_c_G_putAt;
+extern struct Any cos_c_G_putAtIdx;
+extern struct Any cos_c_G_putAtKey;
+extern struct Any cos_c_Generic;
+extern struct Any cos_c_MetaClass;
+extern struct Any cos_c_MetaDocStr;
+extern struct Any cos_c_Method;
+extern struct Any cos_c_Method1;
+extern struct Any cos_c_Method2;
+extern struct Any cos_c_Method3;
+extern struct Any cos_c_Method4;
+extern struct Any cos_c_Method5;
+extern struct Any cos_c_Nil;
+extern struct Any cos_c_Null;
+extern struct Any cos_c_Object;
+extern struct Any cos_c_P_class;
+extern struct Any cos_c_P_superClass;
+extern struct Any cos_c_Predicate;
+extern struct Any cos_c_PropMetaClass;
+extern struct Any cos_c_Property;
+extern struct Any cos_c_Proxy;
+extern struct Any cos_c_Region;
+extern struct Any cos_c_True;
+extern struct Any cos_c_TrueFalse;
+extern struct Any cos_c_mAny;
+extern struct Any cos_c_mAutoRelease;
+extern struct Any cos_c_mBehavior;
+extern struct Any cos_c_mClass;
+extern struct Any cos_c_mExBadAlloc;
+extern struct Any cos_c_mExBadArity;
+extern struct Any cos_c_mExBadAssert;
+extern struct Any cos_c_mExBadCast;
+extern struct Any cos_c_mExBadDomain;
+extern struct Any cos_c_mExBadFormat;
+extern struct Any cos_c_mExBadMessage;
+extern struct Any cos_c_mExBadMode;
+extern struct Any cos_c_mExBadPredicate;
+extern struct Any cos_c_mExBadProperty;
+extern struct Any cos_c_mExBadRange;
+extern struct Any cos_c_mExBadSize;
+extern struct Any cos_c_mExBadType;
+extern struct Any cos_c_mExBadValue;
+extern struct Any cos_c_mExErrno;
+extern struct Any cos_c_mExNotFound;
+extern struct Any cos_c_mExNotImplemented;
+extern struct Any cos_c_mExNotSupported;
+extern struct Any cos_c_mExOverflow;
+extern struct Any cos_c_mExSignal;
+extern struct Any cos_c_mExUnderflow;
+extern struct Any cos_c_mException;
+extern struct Any cos_c_mFalse;
+extern struct Any cos_c_mG_Accessor;
+extern struct Any cos_c_mG_getAt;
+extern struct Any cos_c_mG_getAtIdx;
+extern struct Any cos_c_mG_getAtKey;
+extern struct Any cos_c_mG_putAt;
+extern struct Any cos_c_mG_putAtIdx;
+extern struct Any cos_c_mG_putAtKey;
+extern struct Any cos_c_mGeneric;
+extern struct Any cos_c_mMetaClass;
+extern struct Any cos_c_mMetaDocStr;
+extern struct Any cos_c_mMethod;
+extern struct Any cos_c_mMethod1;
+extern struct Any cos_c_mMethod2;
+extern struct Any cos_c_mMethod3;
+extern struct Any cos_c_mMethod4;
+extern struct Any cos_c_mMethod5;
+extern struct Any cos_c_mNil;
+extern struct Any cos_c_mNull;
+extern struct Any cos_c_mObject;
+extern struct Any cos_c_mP_class;
+extern struct Any cos_c_mP_superClass;
+extern struct Any cos_c_mPredicate;
+extern struct Any cos_c_mPropMetaClass;
+extern struct Any cos_c_mProperty;
+extern struct Any cos_c_mProxy;
+extern struct Any cos_c_mRegion;
+extern struct Any cos_c_mTrue;
+extern struct Any cos_c_mTrueFalse;
+extern struct Any cos_c_pmAny;
+extern struct Any cos_c_pmAutoRelease;
+extern struct Any cos_c_pmBehavior;
+extern struct Any cos_c_pmClass;
+extern struct Any cos_c_pmExBadAlloc;
+extern struct Any cos_c_pmExBadArity;
+extern struct Any cos_c_pmExBadAssert;
+extern struct Any cos_c_pmExBadCast;
+extern struct Any cos_c_pmExBadDomain;
+extern struct Any cos_c_pmExBadFormat;
+extern struct Any cos_c_pmExBadMessage;
+extern struct Any cos_c_pmExBadMode;
+extern struct Any cos_c_pmExBadPredicate;
+extern struct Any cos_c_pmExBadProperty;
+extern struct Any cos_c_pmExBadRange;
+extern struct Any cos_c_pmExBadSize;
+extern struct Any cos_c_pmExBadType;
+extern struct Any cos_c_pmExBadValue;
+extern struct Any cos_c_pmExErrno;
+extern struct Any cos_c_pmExNotFound;
+extern struct Any cos_c_pmExNotImplemented;
+extern struct Any cos_c_pmExNotSupported;
+extern struct Any cos_c_pmExOverflow;
+extern struct Any cos_c_pmExSignal;
+extern struct Any cos_c_pmExUnderflow;
+extern struct Any cos_c_pmException;
+extern struct Any cos_c_pmFalse;
+extern struct Any cos_c_pmG_Accessor;
+extern struct Any cos_c_pmG_getAt;
+extern struct Any cos_c_pmG_getAtIdx;
+extern struct Any cos_c_pmG_getAtKey;
+extern struct Any cos_c_pmG_putAt;
+extern struct Any cos_c_pmG_putAtIdx;
+extern struct Any cos_c_pmG_putAtKey;
+extern struct Any cos_c_pmGeneric;
+extern struct Any cos_c_pmMetaClass;
+extern struct Any cos_c_pmMetaDocStr;
+extern struct Any cos_c_pmMethod;
+extern struct Any cos_c_pmMethod1;
+extern struct Any cos_c_pmMethod2;
+extern struct Any cos_c_pmMethod3;
+extern struct Any cos_c_pmMethod4;
+extern struct Any cos_c_pmMethod5;
+extern struct Any cos_c_pmNil;
+extern struct Any cos_c_pmNull;
+extern struct Any cos_c_pmObject;
+extern struct Any cos_c_pmP_class;
+extern struct Any cos_c_pmP_superClass;
+extern struct Any cos_c_pmPredicate;
+extern struct Any cos_c_pmPropMetaClass;
+extern struct Any cos_c_pmProperty;
+extern struct Any cos_c_pmProxy;
+extern struct Any cos_c_pmRegion;
+extern struct Any cos_c_pmTrue;
+extern struct Any cos_c_pmTrueFalse;
+extern struct Any cos_g_galloc;
+extern struct Any cos_g_gallocWithSize;
+extern struct Any cos_g_gassign;
+extern struct Any cos_g_gautoRelease;
+extern struct Any cos_g_gbool;
+extern struct Any cos_g_gchr;
+extern struct Any cos_g_gchrAt;
+extern struct Any cos_g_gchrPtr;
+extern struct Any cos_g_gclass;
+extern struct Any cos_g_gclassName;
+extern struct Any cos_g_gclear;
+extern struct Any cos_g_gclone;
+extern struct Any cos_g_gcopy;
+extern struct Any cos_g_gcpx;
+extern struct Any cos_g_gcpxAt;
+extern struct Any cos_g_gcpxPtr;
+extern struct Any cos_g_gdealloc;
+extern struct Any cos_g_gdeinit;
+extern struct Any cos_g_gdeinitialize;
+extern struct Any cos_g_gfct;
+extern struct Any cos_g_gflt;
+extern struct Any cos_g_gfltAt;
+extern struct Any cos_g_gfltPtr;
+extern struct Any cos_g_ggetAt;
+extern struct Any cos_g_ggetAtIdx;
+extern struct Any cos_g_ggetAtKey;
+extern struct Any cos_g_gidx;
+extern struct Any cos_g_ginit;
+extern struct Any cos_g_ginitWith;
+extern struct Any cos_g_ginitWith2;
+extern struct Any cos_g_ginitWith3;
+extern struct Any cos_g_ginitWith4;
+extern struct Any cos_g_ginitWithChr;
+extern struct Any cos_g_ginitWithChrPtr;
+extern struct Any cos_g_ginitWithCpx;
+extern struct Any cos_g_ginitWithCpxPtr;
+extern struct Any cos_g_ginitWithFlt;
+extern struct Any cos_g_ginitWithFltPtr;
+extern struct Any cos_g_ginitWithInt;
+extern struct Any cos_g_ginitWithIntPtr;
+extern struct Any cos_g_ginitWithLng;
+extern struct Any cos_g_ginitWithLngPtr;
+extern struct Any cos_g_ginitWithLoc;
+extern struct Any cos_g_ginitWithObj;
+extern struct Any cos_g_ginitWithObj2;
+extern struct Any cos_g_ginitWithObj3;
+extern struct Any cos_g_ginitWithObj4;
+extern struct Any cos_g_ginitWithObj5;
+extern struct Any cos_g_ginitWithObjPtr;
+extern struct Any cos_g_ginitWithObjStr;
+extern struct Any cos_g_ginitWithSht;
+extern struct Any cos_g_ginitWithShtPtr;
+extern struct Any cos_g_ginitWithStr;
+extern struct Any cos_g_ginitWithVaArg;
+extern struct Any cos_g_ginitWithVaLst;
+extern struct Any cos_g_ginitWithVoidPtr;
+extern struct Any cos_g_ginitialize;
+extern struct Any cos_g_ginstancesUnderstandMessage1;
+extern struct Any cos_g_ginstancesUnderstandMessage2;
+extern struct Any cos_g_ginstancesUnderstandMessage3;
+extern struct Any cos_g_ginstancesUnderstandMessage4;
+extern struct Any cos_g_ginstancesUnderstandMessage5;
+extern struct Any cos_g_gint;
+extern struct Any cos_g_gintAt;
+extern struct Any cos_g_gintPtr;
+extern struct Any cos_g_ginvariant;
+extern struct Any cos_g_gisInstanceOf;
+extern struct Any cos_g_gisKindOf;
+extern struct Any cos_g_gisNil;
+extern struct Any cos_g_gisNull;
+extern struct Any cos_g_glng;
+extern struct Any cos_g_glngAt;
+extern struct Any cos_g_glngPtr;
+extern struct Any cos_g_gnew;
+extern struct Any cos_g_gnewWith;
+extern struct Any cos_g_gnewWith2;
+extern struct Any cos_g_gnewWith3;
+extern struct Any cos_g_gnewWith4;
+extern struct Any cos_g_gnewWithStr;
+extern struct Any cos_g_gobj;
+extern struct Any cos_g_gobjPtr;
+extern struct Any cos_g_gptr;
+extern struct Any cos_g_gputAt;
+extern struct Any cos_g_gputAtIdx;
+extern struct Any cos_g_gputAtKey;
+extern struct Any cos_g_grelease;
+extern struct Any cos_g_gretain;
+extern struct Any cos_g_gretainCount;
+extern struct Any cos_g_gsht;
+extern struct Any cos_g_gshtAt;
+extern struct Any cos_g_gshtPtr;
+extern struct Any cos_g_gsize;
+extern struct Any cos_g_gstr;
+extern struct Any cos_g_gstride;
+extern struct Any cos_g_gsuperClass;
+extern struct Any cos_g_gswap;
+extern struct Any cos_g_gthrow;
+extern struct Any cos_g_gunderstandMessage1;
+extern struct Any cos_g_gunderstandMessage2;
+extern struct Any cos_g_gunderstandMessage3;
+extern struct Any cos_g_gunderstandMessage4;
+extern struct Any cos_g_gunderstandMessage5;
+extern struct Any cos_g_gunrecognizedMessage1;
+extern struct Any cos_g_gunrecognizedMessage2;
+extern struct Any cos_g_gunrecognizedMessage3;
+extern struct Any cos_g_gunrecognizedMessage4;
+extern struct Any cos_g_gunrecognizedMessage5;
+extern struct Any cos_m_galloc__mAny;
+extern struct Any cos_m_gallocWithSize__mAny;
+extern struct Any cos_m_gautoRelease__Any;
+extern struct Any cos_m_gautoRelease__AutoRelease;
+extern struct Any cos_m_gautoRelease__Class;
+extern struct Any cos_m_gclass__Any;
+extern struct Any cos_m_gclassName__Any;
+extern struct Any cos_m_gclone__Any;
+extern struct Any cos_m_gclone__mNil;
+extern struct Any cos_m_gcopy__Any;
+extern struct Any cos_m_gcopy__mNil;
+extern struct Any cos_m_gdealloc__Any;
+extern struct Any cos_m_gdeinit__AutoRelease;
+extern struct Any cos_m_gdeinit__Exception;
+extern struct Any cos_m_gdeinit__Proxy;
+extern struct Any cos_m_gdeinit__Region;
+extern struct Any cos_m_gdeinitialize__pmAutoRelease;
+extern struct Any cos_m_gdeinitialize__pmException;
+extern struct Any cos_m_ggetAt__Any__mP_class;
+extern struct Any cos_m_ggetAt__Class__mP_superClass;
+extern struct Any cos_m_ginit__AutoRelease;
+extern struct Any cos_m_ginit__Exception;
+extern struct Any cos_m_ginit__Region;
+extern struct Any cos_m_ginitWith__Proxy__Object;
+extern struct Any cos_m_ginitWithInt__ExErrno;
+extern struct Any cos_m_ginitWithInt__ExSignal;
+extern struct Any cos_m_ginitWithObj__Exception;
+extern struct Any cos_m_ginitWithObjStr__Exception;
+extern struct Any cos_m_ginitWithStr__Exception;
+extern struct Any cos_m_ginitialize__pmAutoRelease;
+extern struct Any cos_m_ginstancesUnderstandMessage1__Class;
+extern struct Any cos_m_ginstancesUnderstandMessage2__Class__Class;
+extern struct Any cos_m_ginstancesUnderstandMessage3__Class__Class__Class;
+extern struct Any cos_m_ginstancesUnderstandMessage4__Class__Class__Class__Class;
+extern struct Any cos_m_ginstancesUnderstandMessage5__Class__Class__Class__Class__Class;
+extern struct Any cos_m_gint__ExErrno;
+extern struct Any cos_m_gint__ExSignal;
+extern struct Any cos_m_gisInstanceOf__Any__Class;
+extern struct Any cos_m_gisKindOf__Any__Class;
+extern struct Any cos_m_gisNil__Any;
+extern struct Any cos_m_gisNil__pmNil;
+extern struct Any cos_m_gisNull__Object;
+extern struct Any cos_m_gisNull__pmNull;
+extern struct Any cos_m_gnew__mObject;
+extern struct Any cos_m_gnewWith__mObject__Object;
+extern struct Any cos_m_gnewWith2__mObject__Object__Object;
+extern struct Any cos_m_gnewWith3__mObject__Object__Object__Object;
+extern struct Any cos_m_gnewWith4__mObject__Object__Object__Object__Object;
+extern struct Any cos_m_gnewWithStr__mObject;
+extern struct Any cos_m_gobj__Exception;
+extern struct Any cos_m_grelease__Any;
+extern struct Any cos_m_grelease__AutoRelease;
+extern struct Any cos_m_grelease__Class;
+extern struct Any cos_m_gretain__Any;
+extern struct Any cos_m_gretain__AutoRelease;
+extern struct Any cos_m_gretain__Class;
+extern struct Any cos_m_gretainCount__Any;
+extern struct Any cos_m_gsize__AutoRelease;
+extern struct Any cos_m_gsize__Class;
+extern struct Any cos_m_gstr__Class;
+extern struct Any cos_m_gstr__Exception;
+extern struct Any cos_m_gstr__Generic;
+extern struct Any cos_m_gsuperClass__Class;
+extern struct Any cos_m_gthrow__Object;
+extern struct Any cos_m_gunderstandMessage1__Any;
+extern struct Any cos_m_gunderstandMessage1__Proxy;
+extern struct Any cos_m_gunderstandMessage2__Any__Any;
+extern struct Any cos_m_gunderstandMessage2__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage2__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage2__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage3__Any__Any__Any;
+extern struct Any cos_m_gunderstandMessage3__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage3__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage3__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage3__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage3__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage3__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage3__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Any__Any__Any__Any;
+extern struct Any cos_m_gunderstandMessage4__Object__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Object__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage4__Object__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Object__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage4__Object__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Object__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage4__Object__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Object__Object__Object;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage4__Proxy__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Any__Any__Any__Any__Any;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Object__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Object__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Object__Proxy__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Object__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Object__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Object__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Object__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Object__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Object__Proxy__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Object__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Object__Proxy;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Proxy__Object;
+extern struct Any cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage1__Any;
+extern struct Any cos_m_gunrecognizedMessage1__Proxy;
+extern struct Any cos_m_gunrecognizedMessage1__mNull;
+extern struct Any cos_m_gunrecognizedMessage2__Any__Any;
+extern struct Any cos_m_gunrecognizedMessage2__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage2__Object__mNull;
+extern struct Any cos_m_gunrecognizedMessage2__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage2__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage2__mNull__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Any__Any__Any;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Object__mNull;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage3__Object__mNull__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage3__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage3__mNull__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Any__Any__Any__Any;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Object__mNull;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__mNull__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Object__mNull__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Proxy__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage4__mNull__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Any__Any__Any__Any__Any;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Object__mNull;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__mNull__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__mNull__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Object__mNull__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Object__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Proxy__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Proxy__Proxy;
+extern struct Any cos_m_gunrecognizedMessage5__mNull__Object__Object__Object__Object;
+
+static struct Any* symtbl[] = {
+  &cos_c_Any,
+  &cos_c_AutoRelease,
+  &cos_c_Behavior,
+  &cos_c_Class,
+  &cos_c_ExBadAlloc,
+  &cos_c_ExBadArity,
+  &cos_c_ExBadAssert,
+  &cos_c_ExBadCast,
+  &cos_c_ExBadDomain,
+  &cos_c_ExBadFormat,
+  &cos_c_ExBadMessage,
+  &cos_c_ExBadMode,
+  &cos_c_ExBadPredicate,
+  &cos_c_ExBadProperty,
+  &cos_c_ExBadRange,
+  &cos_c_ExBadSize,
+  &cos_c_ExBadType,
+  &cos_c_ExBadValue,
+  &cos_c_ExErrno,
+  &cos_c_ExNotFound,
+  &cos_c_ExNotImplemented,
+  &cos_c_ExNotSupported,
+  &cos_c_ExOverflow,
+  &cos_c_ExSignal,
+  &cos_c_ExUnderflow,
+  &cos_c_Exception,
+  &cos_c_False,
+  &cos_c_G_Accessor,
+  &cos_c_G_getAt,
+  &cos_c_G_getAtIdx,
+  &cos_c_G_getAtKey,
+  &cos_c_G_putAt,
+  &cos_c_G_putAtIdx,
+  &cos_c_G_putAtKey,
+  &cos_c_Generic,
+  &cos_c_MetaClass,
+  &cos_c_MetaDocStr,
+  &cos_c_Method,
+  &cos_c_Method1,
+  &cos_c_Method2,
+  &cos_c_Method3,
+  &cos_c_Method4,
+  &cos_c_Method5,
+  &cos_c_Nil,
+  &cos_c_Null,
+  &cos_c_Object,
+  &cos_c_P_class,
+  &cos_c_P_superClass,
+  &cos_c_Predicate,
+  &cos_c_PropMetaClass,
+  &cos_c_Property,
+  &cos_c_Proxy,
+  &cos_c_Region,
+  &cos_c_True,
+  &cos_c_TrueFalse,
+  &cos_c_mAny,
+  &cos_c_mAutoRelease,
+  &cos_c_mBehavior,
+  &cos_c_mClass,
+  &cos_c_mExBadAlloc,
+  &cos_c_mExBadArity,
+  &cos_c_mExBadAssert,
+  &cos_c_mExBadCast,
+  &cos_c_mExBadDomain,
+  &cos_c_mExBadFormat,
+  &cos_c_mExBadMessage,
+  &cos_c_mExBadMode,
+  &cos_c_mExBadPredicate,
+  &cos_c_mExBadProperty,
+  &cos_c_mExBadRange,
+  &cos_c_mExBadSize,
+  &cos_c_mExBadType,
+  &cos_c_mExBadValue,
+  &cos_c_mExErrno,
+  &cos_c_mExNotFound,
+  &cos_c_mExNotImplemented,
+  &cos_c_mExNotSupported,
+  &cos_c_mExOverflow,
+  &cos_c_mExSignal,
+  &cos_c_mExUnderflow,
+  &cos_c_mException,
+  &cos_c_mFalse,
+  &cos_c_mG_Accessor,
+  &cos_c_mG_getAt,
+  &cos_c_mG_getAtIdx,
+  &cos_c_mG_getAtKey,
+  &cos_c_mG_putAt,
+  &cos_c_mG_putAtIdx,
+  &cos_c_mG_putAtKey,
+  &cos_c_mGeneric,
+  &cos_c_mMetaClass,
+  &cos_c_mMetaDocStr,
+  &cos_c_mMethod,
+  &cos_c_mMethod1,
+  &cos_c_mMethod2,
+  &cos_c_mMethod3,
+  &cos_c_mMethod4,
+  &cos_c_mMethod5,
+  &cos_c_mNil,
+  &cos_c_mNull,
+  &cos_c_mObject,
+  &cos_c_mP_class,
+  &cos_c_mP_superClass,
+  &cos_c_mPredicate,
+  &cos_c_mPropMetaClass,
+  &cos_c_mProperty,
+  &cos_c_mProxy,
+  &cos_c_mRegion,
+  &cos_c_mTrue,
+  &cos_c_mTrueFalse,
+  &cos_c_pmAny,
+  &cos_c_pmAutoRelease,
+  &cos_c_pmBehavior,
+  &cos_c_pmClass,
+  &cos_c_pmExBadAlloc,
+  &cos_c_pmExBadArity,
+  &cos_c_pmExBadAssert,
+  &cos_c_pmExBadCast,
+  &cos_c_pmExBadDomain,
+  &cos_c_pmExBadFormat,
+  &cos_c_pmExBadMessage,
+  &cos_c_pmExBadMode,
+  &cos_c_pmExBadPredicate,
+  &cos_c_pmExBadProperty,
+  &cos_c_pmExBadRange,
+  &cos_c_pmExBadSize,
+  &cos_c_pmExBadType,
+  &cos_c_pmExBadValue,
+  &cos_c_pmExErrno,
+  &cos_c_pmExNotFound,
+  &cos_c_pmExNotImplemented,
+  &cos_c_pmExNotSupported,
+  &cos_c_pmExOverflow,
+  &cos_c_pmExSignal,
+  &cos_c_pmExUnderflow,
+  &cos_c_pmException,
+  &cos_c_pmFalse,
+  &cos_c_pmG_Accessor,
+  &cos_c_pmG_getAt,
+  &cos_c_pmG_getAtIdx,
+  &cos_c_pmG_getAtKey,
+  &cos_c_pmG_putAt,
+  &cos_c_pmG_putAtIdx,
+  &cos_c_pmG_putAtKey,
+  &cos_c_pmGeneric,
+  &cos_c_pmMetaClass,
+  &cos_c_pmMetaDocStr,
+  &cos_c_pmMethod,
+  &cos_c_pmMethod1,
+  &cos_c_pmMethod2,
+  &cos_c_pmMethod3,
+  &cos_c_pmMethod4,
+  &cos_c_pmMethod5,
+  &cos_c_pmNil,
+  &cos_c_pmNull,
+  &cos_c_pmObject,
+  &cos_c_pmP_class,
+  &cos_c_pmP_superClass,
+  &cos_c_pmPredicate,
+  &cos_c_pmPropMetaClass,
+  &cos_c_pmProperty,
+  &cos_c_pmProxy,
+  &cos_c_pmRegion,
+  &cos_c_pmTrue,
+  &cos_c_pmTrueFalse,
+  &cos_g_galloc,
+  &cos_g_gallocWithSize,
+  &cos_g_gassign,
+  &cos_g_gautoRelease,
+  &cos_g_gbool,
+  &cos_g_gchr,
+  &cos_g_gchrAt,
+  &cos_g_gchrPtr,
+  &cos_g_gclass,
+  &cos_g_gclassName,
+  &cos_g_gclear,
+  &cos_g_gclone,
+  &cos_g_gcopy,
+  &cos_g_gcpx,
+  &cos_g_gcpxAt,
+  &cos_g_gcpxPtr,
+  &cos_g_gdealloc,
+  &cos_g_gdeinit,
+  &cos_g_gdeinitialize,
+  &cos_g_gfct,
+  &cos_g_gflt,
+  &cos_g_gfltAt,
+  &cos_g_gfltPtr,
+  &cos_g_ggetAt,
+  &cos_g_ggetAtIdx,
+  &cos_g_ggetAtKey,
+  &cos_g_gidx,
+  &cos_g_ginit,
+  &cos_g_ginitWith,
+  &cos_g_ginitWith2,
+  &cos_g_ginitWith3,
+  &cos_g_ginitWith4,
+  &cos_g_ginitWithChr,
+  &cos_g_ginitWithChrPtr,
+  &cos_g_ginitWithCpx,
+  &cos_g_ginitWithCpxPtr,
+  &cos_g_ginitWithFlt,
+  &cos_g_ginitWithFltPtr,
+  &cos_g_ginitWithInt,
+  &cos_g_ginitWithIntPtr,
+  &cos_g_ginitWithLng,
+  &cos_g_ginitWithLngPtr,
+  &cos_g_ginitWithLoc,
+  &cos_g_ginitWithObj,
+  &cos_g_ginitWithObj2,
+  &cos_g_ginitWithObj3,
+  &cos_g_ginitWithObj4,
+  &cos_g_ginitWithObj5,
+  &cos_g_ginitWithObjPtr,
+  &cos_g_ginitWithObjStr,
+  &cos_g_ginitWithSht,
+  &cos_g_ginitWithShtPtr,
+  &cos_g_ginitWithStr,
+  &cos_g_ginitWithVaArg,
+  &cos_g_ginitWithVaLst,
+  &cos_g_ginitWithVoidPtr,
+  &cos_g_ginitialize,
+  &cos_g_ginstancesUnderstandMessage1,
+  &cos_g_ginstancesUnderstandMessage2,
+  &cos_g_ginstancesUnderstandMessage3,
+  &cos_g_ginstancesUnderstandMessage4,
+  &cos_g_ginstancesUnderstandMessage5,
+  &cos_g_gint,
+  &cos_g_gintAt,
+  &cos_g_gintPtr,
+  &cos_g_ginvariant,
+  &cos_g_gisInstanceOf,
+  &cos_g_gisKindOf,
+  &cos_g_gisNil,
+  &cos_g_gisNull,
+  &cos_g_glng,
+  &cos_g_glngAt,
+  &cos_g_glngPtr,
+  &cos_g_gnew,
+  &cos_g_gnewWith,
+  &cos_g_gnewWith2,
+  &cos_g_gnewWith3,
+  &cos_g_gnewWith4,
+  &cos_g_gnewWithStr,
+  &cos_g_gobj,
+  &cos_g_gobjPtr,
+  &cos_g_gptr,
+  &cos_g_gputAt,
+  &cos_g_gputAtIdx,
+  &cos_g_gputAtKey,
+  &cos_g_grelease,
+  &cos_g_gretain,
+  &cos_g_gretainCount,
+  &cos_g_gsht,
+  &cos_g_gshtAt,
+  &cos_g_gshtPtr,
+  &cos_g_gsize,
+  &cos_g_gstr,
+  &cos_g_gstride,
+  &cos_g_gsuperClass,
+  &cos_g_gswap,
+  &cos_g_gthrow,
+  &cos_g_gunderstandMessage1,
+  &cos_g_gunderstandMessage2,
+  &cos_g_gunderstandMessage3,
+  &cos_g_gunderstandMessage4,
+  &cos_g_gunderstandMessage5,
+  &cos_g_gunrecognizedMessage1,
+  &cos_g_gunrecognizedMessage2,
+  &cos_g_gunrecognizedMessage3,
+  &cos_g_gunrecognizedMessage4,
+  &cos_g_gunrecognizedMessage5,
+  &cos_m_galloc__mAny,
+  &cos_m_gallocWithSize__mAny,
+  &cos_m_gautoRelease__Any,
+  &cos_m_gautoRelease__AutoRelease,
+  &cos_m_gautoRelease__Class,
+  &cos_m_gclass__Any,
+  &cos_m_gclassName__Any,
+  &cos_m_gclone__Any,
+  &cos_m_gclone__mNil,
+  &cos_m_gcopy__Any,
+  &cos_m_gcopy__mNil,
+  &cos_m_gdealloc__Any,
+  &cos_m_gdeinit__AutoRelease,
+  &cos_m_gdeinit__Exception,
+  &cos_m_gdeinit__Proxy,
+  &cos_m_gdeinit__Region,
+  &cos_m_gdeinitialize__pmAutoRelease,
+  &cos_m_gdeinitialize__pmException,
+  &cos_m_ggetAt__Any__mP_class,
+  &cos_m_ggetAt__Class__mP_superClass,
+  &cos_m_ginit__AutoRelease,
+  &cos_m_ginit__Exception,
+  &cos_m_ginit__Region,
+  &cos_m_ginitWith__Proxy__Object,
+  &cos_m_ginitWithInt__ExErrno,
+  &cos_m_ginitWithInt__ExSignal,
+  &cos_m_ginitWithObj__Exception,
+  &cos_m_ginitWithObjStr__Exception,
+  &cos_m_ginitWithStr__Exception,
+  &cos_m_ginitialize__pmAutoRelease,
+  &cos_m_ginstancesUnderstandMessage1__Class,
+  &cos_m_ginstancesUnderstandMessage2__Class__Class,
+  &cos_m_ginstancesUnderstandMessage3__Class__Class__Class,
+  &cos_m_ginstancesUnderstandMessage4__Class__Class__Class__Class,
+  &cos_m_ginstancesUnderstandMessage5__Class__Class__Class__Class__Class,
+  &cos_m_gint__ExErrno,
+  &cos_m_gint__ExSignal,
+  &cos_m_gisInstanceOf__Any__Class,
+  &cos_m_gisKindOf__Any__Class,
+  &cos_m_gisNil__Any,
+  &cos_m_gisNil__pmNil,
+  &cos_m_gisNull__Object,
+  &cos_m_gisNull__pmNull,
+  &cos_m_gnew__mObject,
+  &cos_m_gnewWith__mObject__Object,
+  &cos_m_gnewWith2__mObject__Object__Object,
+  &cos_m_gnewWith3__mObject__Object__Object__Object,
+  &cos_m_gnewWith4__mObject__Object__Object__Object__Object,
+  &cos_m_gnewWithStr__mObject,
+  &cos_m_gobj__Exception,
+  &cos_m_grelease__Any,
+  &cos_m_grelease__AutoRelease,
+  &cos_m_grelease__Class,
+  &cos_m_gretain__Any,
+  &cos_m_gretain__AutoRelease,
+  &cos_m_gretain__Class,
+  &cos_m_gretainCount__Any,
+  &cos_m_gsize__AutoRelease,
+  &cos_m_gsize__Class,
+  &cos_m_gstr__Class,
+  &cos_m_gstr__Exception,
+  &cos_m_gstr__Generic,
+  &cos_m_gsuperClass__Class,
+  &cos_m_gthrow__Object,
+  &cos_m_gunderstandMessage1__Any,
+  &cos_m_gunderstandMessage1__Proxy,
+  &cos_m_gunderstandMessage2__Any__Any,
+  &cos_m_gunderstandMessage2__Object__Proxy,
+  &cos_m_gunderstandMessage2__Proxy__Object,
+  &cos_m_gunderstandMessage2__Proxy__Proxy,
+  &cos_m_gunderstandMessage3__Any__Any__Any,
+  &cos_m_gunderstandMessage3__Object__Object__Proxy,
+  &cos_m_gunderstandMessage3__Object__Proxy__Object,
+  &cos_m_gunderstandMessage3__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage3__Proxy__Object__Object,
+  &cos_m_gunderstandMessage3__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage3__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage3__Proxy__Proxy__Proxy,
+  &cos_m_gunderstandMessage4__Any__Any__Any__Any,
+  &cos_m_gunderstandMessage4__Object__Object__Object__Proxy,
+  &cos_m_gunderstandMessage4__Object__Object__Proxy__Object,
+  &cos_m_gunderstandMessage4__Object__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage4__Object__Proxy__Object__Object,
+  &cos_m_gunderstandMessage4__Object__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage4__Object__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage4__Object__Proxy__Proxy__Proxy,
+  &cos_m_gunderstandMessage4__Proxy__Object__Object__Object,
+  &cos_m_gunderstandMessage4__Proxy__Object__Object__Proxy,
+  &cos_m_gunderstandMessage4__Proxy__Object__Proxy__Object,
+  &cos_m_gunderstandMessage4__Proxy__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage4__Proxy__Proxy__Object__Object,
+  &cos_m_gunderstandMessage4__Proxy__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage4__Proxy__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage4__Proxy__Proxy__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Any__Any__Any__Any__Any,
+  &cos_m_gunderstandMessage5__Object__Object__Object__Object__Proxy,
+  &cos_m_gunderstandMessage5__Object__Object__Object__Proxy__Object,
+  &cos_m_gunderstandMessage5__Object__Object__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Object__Object__Proxy__Object__Object,
+  &cos_m_gunderstandMessage5__Object__Object__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage5__Object__Object__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage5__Object__Object__Proxy__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Object__Proxy__Object__Object__Object,
+  &cos_m_gunderstandMessage5__Object__Proxy__Object__Object__Proxy,
+  &cos_m_gunderstandMessage5__Object__Proxy__Object__Proxy__Object,
+  &cos_m_gunderstandMessage5__Object__Proxy__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Object__Proxy__Proxy__Object__Object,
+  &cos_m_gunderstandMessage5__Object__Proxy__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage5__Object__Proxy__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage5__Object__Proxy__Proxy__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Object__Object__Object__Object,
+  &cos_m_gunderstandMessage5__Proxy__Object__Object__Object__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Object__Object__Proxy__Object,
+  &cos_m_gunderstandMessage5__Proxy__Object__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Object__Proxy__Object__Object,
+  &cos_m_gunderstandMessage5__Proxy__Object__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Object__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage5__Proxy__Object__Proxy__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Object__Object__Object,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Object__Object__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Object__Proxy__Object,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Object__Proxy__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Object__Object,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Object__Proxy,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Proxy__Object,
+  &cos_m_gunderstandMessage5__Proxy__Proxy__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage1__Any,
+  &cos_m_gunrecognizedMessage1__Proxy,
+  &cos_m_gunrecognizedMessage1__mNull,
+  &cos_m_gunrecognizedMessage2__Any__Any,
+  &cos_m_gunrecognizedMessage2__Object__Proxy,
+  &cos_m_gunrecognizedMessage2__Object__mNull,
+  &cos_m_gunrecognizedMessage2__Proxy__Object,
+  &cos_m_gunrecognizedMessage2__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage2__mNull__Object,
+  &cos_m_gunrecognizedMessage3__Any__Any__Any,
+  &cos_m_gunrecognizedMessage3__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage3__Object__Object__mNull,
+  &cos_m_gunrecognizedMessage3__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage3__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage3__Object__mNull__Object,
+  &cos_m_gunrecognizedMessage3__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage3__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage3__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage3__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage3__mNull__Object__Object,
+  &cos_m_gunrecognizedMessage4__Any__Any__Any__Any,
+  &cos_m_gunrecognizedMessage4__Object__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage4__Object__Object__Object__mNull,
+  &cos_m_gunrecognizedMessage4__Object__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage4__Object__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage4__Object__Object__mNull__Object,
+  &cos_m_gunrecognizedMessage4__Object__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage4__Object__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage4__Object__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage4__Object__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage4__Object__mNull__Object__Object,
+  &cos_m_gunrecognizedMessage4__Proxy__Object__Object__Object,
+  &cos_m_gunrecognizedMessage4__Proxy__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage4__Proxy__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage4__Proxy__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage4__Proxy__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage4__Proxy__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage4__Proxy__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage4__Proxy__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage4__mNull__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Any__Any__Any__Any__Any,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Object__mNull,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__mNull__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Object__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Object__mNull__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Object__Proxy__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Object__mNull__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Object__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Object__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Object__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Object__Proxy,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Proxy__Object,
+  &cos_m_gunrecognizedMessage5__Proxy__Proxy__Proxy__Proxy__Proxy,
+  &cos_m_gunrecognizedMessage5__mNull__Object__Object__Object__Object,
+  0
+};
+
+void cos_symbol_register(struct Any**, const char*);
+
+
+void cos_symbol_initCosBase(void);
+void cos_symbol_initCosBase(void)
+{
+   static int done = 0;
+   
+   if (!done) {
+     done = 1;
+     cos_symbol_register(symtbl,"CosBase");
+   }
+}
@@ -0,0 +1,126 @@
+/*
+ * -----------------------------
+ * COS generics
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosgen
+ * Sun Oct 18 12:21:54 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Object.h>
+
+#include "cos/gen/accessor.h"
+#include "cos/gen/init.h"
+#include "cos/gen/message.h"
+#include "cos/gen/object.h"
+#include "cos/gen/value.h"
+
+
+makgeneric(OBJ, (G_getAt)ggetAt, _1, at);
+makgeneric(OBJ, (G_getAtIdx)ggetAtIdx, _1, (I32)idx);
+makgeneric(OBJ, (G_getAtKey)ggetAtKey, _1, (STR)key);
+makgeneric(OBJ, (G_putAt)gputAt, _1, at, what);
+makgeneric(OBJ, (G_putAtIdx)gputAtIdx, _1, (I32)idx, what);
+makgeneric(OBJ, (G_putAtKey)gputAtKey, _1, (STR)key, what);
+makgeneric(OBJ, galloc, _1);
+makgeneric(OBJ, gallocWithSize, _1, (size_t)extra);
+makgeneric(OBJ, gassign, _1, _2);
+makgeneric(OBJ, gautoRelease, _1);
+makgeneric(BOOL, gbool, _1);
+makgeneric(I32, gchr, _1);
+makgeneric(I32, gchrAt, _1, at);
+makgeneric(I8*, gchrPtr, _1);
+makgeneric(OBJ, gclass, _1);
+makgeneric(STR, gclassName, _1);
+makgeneric(OBJ, gclear, _1);
+makgeneric(OBJ, gclone, _1);
+makgeneric(OBJ, gcopy, _1);
+makgeneric(C64, gcpx, _1);
+makgeneric(C64, gcpxAt, _1, at);
+makgeneric(C64*, gcpxPtr, _1);
+makgeneric(void, gdealloc, _1);
+makgeneric(OBJ, gdeinit, _1);
+makgeneric(void, gdeinitialize, _1);
+makgeneric(FCT, gfct, _1);
+makgeneric(F64, gflt, _1);
+makgeneric(F64, gfltAt, _1, at);
+makgeneric(F64*, gfltPtr, _1);
+makgeneric(I32, gidx, _1);
+makgeneric(OBJ, ginit, _1);
+makgeneric(OBJ, ginitWith, _1, _2);
+makgeneric(OBJ, ginitWith2, _1, _2, _3);
+makgeneric(OBJ, ginitWith3, _1, _2, _3, _4);
+makgeneric(OBJ, ginitWith4, _1, _2, _3, _4, _5);
+makgeneric(OBJ, ginitWithChr, _1, (I32)val);
+makgeneric(OBJ, ginitWithChrPtr, _1, (I8*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithCpx, _1, (C64)val);
+makgeneric(OBJ, ginitWithCpxPtr, _1, (C64*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithFlt, _1, (F64)val);
+makgeneric(OBJ, ginitWithFltPtr, _1, (F64*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithInt, _1, (I32)val);
+makgeneric(OBJ, ginitWithIntPtr, _1, (I32*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithLng, _1, (I64)val);
+makgeneric(OBJ, ginitWithLngPtr, _1, (I64*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithLoc, _1, _2, (STR)file, (int)line);
+makgeneric(OBJ, ginitWithObj, _1, (OBJ)obj);
+makgeneric(OBJ, ginitWithObj2, _1, (OBJ)obj, (OBJ)obj2);
+makgeneric(OBJ, ginitWithObj3, _1, (OBJ)obj, (OBJ)obj2, (OBJ)obj3);
+makgeneric(OBJ, ginitWithObj4, _1, (OBJ)obj, (OBJ)obj2, (OBJ)obj3, (OBJ)obj4);
+makgeneric(OBJ, ginitWithObj5, _1, (OBJ)obj, (OBJ)obj2, (OBJ)obj3, (OBJ)obj4, (OBJ)obj5);
+makgeneric(OBJ, ginitWithObjPtr, _1, (OBJ*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithObjStr, _1, (OBJ)obj, (STR)str);
+makgeneric(OBJ, ginitWithSht, _1, (I32)val);
+makgeneric(OBJ, ginitWithShtPtr, _1, (I16*)ref, (U32)size, (I32)stride);
+makgeneric(OBJ, ginitWithStr, _1, (STR)str);
+makgenericv(OBJ, ginitWithVaArg, _1, ...);
+makgeneric(OBJ, ginitWithVaLst, _1, (va_list)va);
+makgeneric(OBJ, ginitWithVoidPtr, _1, (void*)ref, (U32)size, (I32)stride, (size_t)esize);
+makgeneric(void, ginitialize, _1);
+makgeneric(OBJ, ginstancesUnderstandMessage1, _1, (SEL)sel);
+makgeneric(OBJ, ginstancesUnderstandMessage2, _1, _2, (SEL)sel);
+makgeneric(OBJ, ginstancesUnderstandMessage3, _1, _2, _3, (SEL)sel);
+makgeneric(OBJ, ginstancesUnderstandMessage4, _1, _2, _3, _4, (SEL)sel);
+makgeneric(OBJ, ginstancesUnderstandMessage5, _1, _2, _3, _4, _5, (SEL)sel);
+makgeneric(I32, gint, _1);
+makgeneric(I32, gintAt, _1, at);
+makgeneric(I32*, gintPtr, _1);
+makgeneric(void, ginvariant, _1, (STR)file, (int)line);
+makgeneric(OBJ, gisInstanceOf, _1, _2);
+makgeneric(OBJ, gisKindOf, _1, _2);
+makgeneric(OBJ, gisNil, _1);
+makgeneric(OBJ, gisNull, _1);
+makgeneric(I64, glng, _1);
+makgeneric(I64, glngAt, _1, at);
+makgeneric(I64*, glngPtr, _1);
+makgeneric(OBJ, gnew, _1);
+makgeneric(OBJ, gnewWith, _1, _2);
+makgeneric(OBJ, gnewWith2, _1, _2, _3);
+makgeneric(OBJ, gnewWith3, _1, _2, _3, _4);
+makgeneric(OBJ, gnewWith4, _1, _2, _3, _4, _5);
+makgeneric(OBJ, gnewWithStr, _1, (STR)str);
+makgeneric(OBJ, gobj, _1);
+makgeneric(OBJ*, gobjPtr, _1);
+makgeneric(void*, gptr, _1);
+makgeneric(void, grelease, _1);
+makgeneric(OBJ, gretain, _1);
+makgeneric(U32, gretainCount, _1);
+makgeneric(I32, gsht, _1);
+makgeneric(I32, gshtAt, _1, at);
+makgeneric(I16*, gshtPtr, _1);
+makgeneric(U32, gsize, _1);
+makgeneric(STR, gstr, _1);
+makgeneric(I32, gstride, _1);
+makgeneric(OBJ, gsuperClass, _1);
+makgeneric(OBJ, gswap, _1, _2);
+makgeneric(void, gthrow, _1, (STR)file, (int)line);
+makgeneric(OBJ, gunderstandMessage1, _1, (SEL)sel);
+makgeneric(OBJ, gunderstandMessage2, _1, _2, (SEL)sel);
+makgeneric(OBJ, gunderstandMessage3, _1, _2, _3, (SEL)sel);
+makgeneric(OBJ, gunderstandMessage4, _1, _2, _3, _4, (SEL)sel);
+makgeneric(OBJ, gunderstandMessage5, _1, _2, _3, _4, _5, (SEL)sel);
+makgeneric(void, gunrecognizedMessage1, _1);
+makgeneric(void, gunrecognizedMessage2, _1, _2);
+makgeneric(void, gunrecognizedMessage3, _1, _2, _3);
+makgeneric(void, gunrecognizedMessage4, _1, _2, _3, _4);
+makgeneric(void, gunrecognizedMessage5, _1, _2, _3, _4, _5);
@@ -0,0 +1,17 @@
+/*
+ * -----------------------------
+ * COS properties
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosprp
+ * Sun Oct 18 12:21:55 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Property.h>
+
+#include "cos/prp/object.h"
+
+
+makproperty(class);
+makproperty(superClass);
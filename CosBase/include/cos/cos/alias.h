@@ -111,7 +111,7 @@ COS_PP_SEP(COS_PP_MAP(CS,COS_ALS_CLS)) \
 extern struct COS_PP_CAT(Method,C) COS_MTH_NAME(NAME,CS); \
 struct COS_PP_CAT(Method,C) COS_MTH_NAME(ALIAS,CS) = { \
    /* encode tag into rc */ \
-  {{{ 0, cos_tag_alias }}, \
+  {{{ 0, COS_RC_INIT(cos_tag_alias) }}, \
    /* location */ \
    __LINE__, __FILE__, \
    /* reference to generic */ \
@@ -146,6 +146,15 @@
 #define COS_RC_UNIT     ((I32) 1)
 #define COS_RC_INVALID  ((I32)0xDEADC0DE)
 
+// reference counting owner (see COS_OBJECT_RC_BIASED)
+#if COS_OBJECT_RC == COS_OBJECT_RC_BIASED
+#define COS_RC_FIELDS   U32 _tid;
+#define COS_RC_INIT(rc) rc, 0
+#else
+#define COS_RC_FIELDS
+#define COS_RC_INIT(rc) rc
+#endif
+
 // mangled names: <sym-name>_<cls1-name>[_..._<cls5-name>]
 #define COS_SYM_NAME(NAME,CS) \
         COS_PP_CAT3(NAME,__,COS_PP_CAT(COS_SYM_NAME_,COS_PP_NARG CS) CS)
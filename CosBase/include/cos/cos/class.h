@@ -167,7 +167,8 @@
                COS_PCL_MSPE(NAME) = 0 }; \
         struct NAME { \
           U32 _id; \
-          I32 _rc;
+          I32 _rc; \
+          COS_RC_FIELDS
 
 #define COS_CLS_DEF_N(NAME,SUPER) \
         COS_CLS_DEF_DCL(NAME); \
@@ -230,7 +231,7 @@ COS_CLS_COMPMAK(NAME,&COS_CLS_NAME(SUPER),&COS_MCL_NAME(SUPER))
 #define COS_CLS_COMPMAK(NAME,SUPER_REF,META_SUPER_REF) \
 struct Class COS_MCL_NAME(NAME) = { /* metaclass */ \
   /* Object id must be zero (init) => encode tag into rc */ \
-  {{{ 0, cos_tag_mclass }}, \
+  {{{ 0, COS_RC_INIT(cos_tag_mclass) }}, \
   /* encode rank into id */ \
    (U32)COS_MCL_RANK(NAME) << COS_ID_RNKSHT, \
   /* location */ \
@@ -248,7 +249,7 @@ struct Class COS_MCL_NAME(NAME) = { /* metaclass */ \
 }; \
 struct Class COS_PCL_NAME(NAME) = { /* property metaclass */ \
   /* Object id must be zero (init) => encode tag into rc */ \
-  {{{ 0, cos_tag_pclass }}, \
+  {{{ 0, COS_RC_INIT(cos_tag_pclass) }}, \
   /* encode rank into id */ \
    (U32)COS_PCL_RANK(NAME) << COS_ID_RNKSHT, \
   /* location */ \
@@ -266,7 +267,7 @@ struct Class COS_PCL_NAME(NAME) = { /* property metaclass */ \
 }; \
 struct Class COS_CLS_NAME(NAME) = { /* class */ \
   /* Object id must be zero (init) => encode tag into rc */ \
-  {{{ 0, cos_tag_class }}, \
+  {{{ 0, COS_RC_INIT(cos_tag_class) }}, \
   /* encode rank into id */ \
    (U32)COS_CLS_RANK(NAME) << COS_ID_RNKSHT, \
   /* location */ \
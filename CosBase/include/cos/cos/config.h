@@ -59,6 +59,56 @@
 #define COS_FAST_MESSAGE 9 // always inline first level lookup
 #endif
 
+#define COS_METHOD_CACHE_CHAIN 0 // chained cells (two loads per lookup)
+#define COS_METHOD_CACHE_PACK  1 // slots packed in lines of 64 bytes
+
+#ifndef COS_METHOD_CACHE_LAYOUT // dispatcher cache layout (see cos/cos/dispatch.h)
+#define COS_METHOD_CACHE_LAYOUT COS_METHOD_CACHE_CHAIN
+#endif
+
+#define COS_METHOD_HKEY_ADD 0 // additive keys (fast, weak on multi-methods)
+#define COS_METHOD_HKEY_MIX 1 // multiplicative keys with xor-shift mixing
+
+#ifndef COS_METHOD_HKEY // dispatcher cache keys (see cos/cos/dispatch.h)
+#define COS_METHOD_HKEY COS_METHOD_HKEY_ADD
+#endif
+
+#define COS_OBJECT_RC_PLAIN  0 // plain counter (objects owned by one thread)
+#define COS_OBJECT_RC_ATOMIC 1 // atomic counter (objects shared by threads)
+#define COS_OBJECT_RC_BIASED 2 // plain counter for the owner thread until shared
+
+#ifndef COS_OBJECT_RC // reference counting (see cos/cos/cosapi.h)
+#define COS_OBJECT_RC COS_OBJECT_RC_PLAIN
+#endif
+
+#if COS_OBJECT_RC != COS_OBJECT_RC_PLAIN && !defined(__GNUC__)
+#error "COS: COS_OBJECT_RC requires GCC atomic builtins"
+#endif
+
+#if COS_OBJECT_RC == COS_OBJECT_RC_BIASED && (defined(_OPENMP) || !COS_HAS_TLS)
+#error "COS: COS_OBJECT_RC_BIASED requires thread local storage"
+#endif
+
+#ifndef COS_METHOD_SHARED // process-wide dispatch table (see cos_dispatchN.c)
+#define COS_METHOD_SHARED 0 // 1 = probe a shared table on thread cache miss
+#endif
+
+#if COS_METHOD_SHARED && !defined(__GNUC__)
+#error "COS: COS_METHOD_SHARED requires GCC atomic builtins"
+#endif
+
+#ifndef COS_EXCEPTION_SIGMASK // TRY context saving (see cos/cos/exception.h)
+#define COS_EXCEPTION_SIGMASK 1 // 0 = don't save the signal mask on TRY entry
+#endif
+
+#ifndef COS_METHOD_PROFILE_SAMPLE // profiler timing period (see cos/cos/method.h)
+#define COS_METHOD_PROFILE_SAMPLE 64 // time one call out of 64 per thread, 0 = none
+#endif
+
+#ifndef COS_METHOD_CACHE_REHASH // dispatcher cache growth (see cos_dispatchN.c)
+#define COS_METHOD_CACHE_REHASH 1 // move cells on growth, 0 = flush the cache
+#endif
+
 /* NOTE-CONF: C99 dialect
    define missing C99 keywords here or with 'configure'
 */
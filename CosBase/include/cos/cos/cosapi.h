@@ -30,6 +30,7 @@ void   cos_init(void);
 void   cos_deinit(void);
 double cos_initDuration(void);   // in second.
 double cos_deinitDuration(void); // in second.
+STR    cos_initPhase(U32,double*); // name and duration, 0 past the last phase
 
 BOOL cos_object_isKindOf(OBJ,const struct Class*);
 BOOL cos_object_changeClass(OBJ,const struct Class*);
@@ -67,6 +68,15 @@ BOOL   cos_method_understand3(SEL,U32,U32,U32);
 BOOL   cos_method_understand4(SEL,U32,U32,U32,U32);
 BOOL   cos_method_understand5(SEL,U32,U32,U32,U32,U32);
 */
+// batched send (one lookup per run of receivers of the same classes)
+U32    cos_method_send1(SEL,U32,OBJ const*,I32,void*,OBJ*,I32);
+U32    cos_method_send2(SEL,U32,OBJ const*,I32,OBJ const*,I32,void*,OBJ*,I32);
+U32    cos_method_send3(SEL,U32,OBJ const*,I32,OBJ const*,I32,OBJ const*,I32,
+                        void*,OBJ*,I32);
+U32    cos_method_send4(SEL,U32,OBJ const*,I32,OBJ const*,I32,OBJ const*,I32,
+                        OBJ const*,I32,void*,OBJ*,I32);
+U32    cos_method_send5(SEL,U32,OBJ const*,I32,OBJ const*,I32,OBJ const*,I32,
+                        OBJ const*,I32,OBJ const*,I32,void*,OBJ*,I32);
 char*  cos_method_name(const struct Method*,char*,U32);
 char*  cos_method_call(SEL,OBJ*,char*,U32);
 char*  cos_method_callName(const struct Method*,OBJ*,char*,U32);
@@ -101,6 +111,8 @@ void   cos_functor_overflow(void);
 void   cos_functor_underflow(void) __attribute__((__noreturn__));
 void   cos_functor_clearContext(void);
 
+// module loading is not thread safe: other threads can run on their caches,
+// but must not resolve new messages (cache misses) during the load
 void   cos_module_load(STR*); // null terminated array of module names
 
 /* NOTE-INFO: loggers
@@ -143,7 +155,7 @@ int  cos_logmsg_setLevel(int lvl); // return previous level
    for classes deriving from Object (or at equivalent level)
 */
 #define cos_object_auto(cls) \
-  {{ COS_CLS_NAME(cls).Behavior.id, COS_RC_AUTO }}
+  {{ COS_CLS_NAME(cls).Behavior.id, COS_RC_INIT(COS_RC_AUTO) }}
 
 /***********************************************************
  * Implementation
@@ -152,11 +164,74 @@ int  cos_logmsg_setLevel(int lvl); // return previous level
 // COS symbols init
 void cos_symbol_init(void);
 void cos_symbol_register(struct Any**, STR tag);
+void cos_symbol_load(void); // init symbols registered after cos_init
 
-// next-method
+// next-method (nextClear requires a quiescent system)
 void cos_method_nextClear(void);
 void cos_method_nextInit(FCT*,SEL,U32,U32,struct Class* const*);
 
+#if COS_OBJECT_RC == COS_OBJECT_RC_BIASED
+// biased reference counting
+U32  cos_thread_initId(void);
+void cos_object_rcNotOwner(OBJ);
+#endif
+
+// shared dispatch table (not thread safe)
+void cos_method_clearShared(void);
+void cos_method_syncShared(U32 gen);
+#if COS_METHOD_SHARED
+void cos_method_clearShared1(void);
+void cos_method_clearShared2(void);
+void cos_method_clearShared3(void);
+void cos_method_clearShared4(void);
+void cos_method_clearShared5(void);
+void cos_method_syncShared1(U32);
+void cos_method_syncShared2(U32);
+void cos_method_syncShared3(U32);
+void cos_method_syncShared4(U32);
+void cos_method_syncShared5(U32);
+#endif
+
+// dispatch caches generation (bumped when loaded modules add methods)
+extern U32 cos_method_generation_;
+U32  cos_method_stamp(U32 idg); // generation of the last methods added
+void cos_method_syncCache1(struct cos_method_cache1*);
+void cos_method_syncCache2(struct cos_method_cache2*);
+void cos_method_syncCache3(struct cos_method_cache3*);
+void cos_method_syncCache4(struct cos_method_cache4*);
+void cos_method_syncCache5(struct cos_method_cache5*);
+
+// call-site caches generation (bumped by loads and cos_method_clearCaches)
+extern U32 cos_method_siteGeneration_;
+
+// call-site caches miss (see cos/cos/dispatch.h)
+IMP1 cos_method_siteLookup1_(struct cos_method_site1*,SEL,U32);
+IMP2 cos_method_siteLookup2_(struct cos_method_site2*,SEL,U32,U32);
+IMP3 cos_method_siteLookup3_(struct cos_method_site3*,SEL,U32,U32,U32);
+IMP4 cos_method_siteLookup4_(struct cos_method_site4*,SEL,U32,U32,U32,U32);
+IMP5 cos_method_siteLookup5_(struct cos_method_site5*,SEL,U32,U32,U32,U32,U32);
+
+// method profile (see COS_METHOD_PROFILE)
+struct cos_method_profile* cos_method_profile_init(void);
+void cos_method_profileInit   (U32*,const struct Method*);
+void cos_method_profileEnlarge(struct cos_method_profile*,U32);
+BOOL cos_method_getProfile    (const struct Method*,U64*,U64*);
+void cos_method_clearProfile  (void);
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+// 2nd level dispatch (probe the line)
+IMP1 cos_method_fastLookup1_(struct cos_method_slot1*restrict,SEL,U32);
+IMP2 cos_method_fastLookup2_(struct cos_method_slot2*restrict,SEL,U32,U32);
+IMP3 cos_method_fastLookup3_(struct cos_method_slot3*restrict,SEL,U32,U32,U32);
+IMP4 cos_method_fastLookup4_(struct cos_method_slot4*restrict,SEL,U32,U32,U32,U32);
+IMP5 cos_method_fastLookup5_(struct cos_method_slot5*restrict,SEL,U32,U32,U32,U32,U32);
+
+BOOL cos_method_understand1_(struct cos_method_slot1*restrict,SEL,U32);
+BOOL cos_method_understand2_(struct cos_method_slot2*restrict,SEL,U32,U32);
+BOOL cos_method_understand3_(struct cos_method_slot3*restrict,SEL,U32,U32,U32);
+BOOL cos_method_understand4_(struct cos_method_slot4*restrict,SEL,U32,U32,U32,U32);
+BOOL cos_method_understand5_(struct cos_method_slot5*restrict,SEL,U32,U32,U32,U32,U32);
+#else
 // 2nd and 3rd levels dispatch
 IMP1 cos_method_fastLookup1_(struct cos_method_slot1*restrict*restrict,SEL,U32);
 IMP2 cos_method_fastLookup2_(struct cos_method_slot2*restrict*restrict,SEL,U32,U32);
@@ -169,6 +244,7 @@ BOOL cos_method_understand2_(struct cos_method_slot2*restrict*restrict,SEL,U32,U
 BOOL cos_method_understand3_(struct cos_method_slot3*restrict*restrict,SEL,U32,U32,U32);
 BOOL cos_method_understand4_(struct cos_method_slot4*restrict*restrict,SEL,U32,U32,U32,U32);
 BOOL cos_method_understand5_(struct cos_method_slot5*restrict*restrict,SEL,U32,U32,U32,U32,U32);
+#endif
 
 // logger message level (not thread safe)
 extern int cos_logmsg_level_;
@@ -201,7 +277,12 @@ cos_method_cache1(void)
 #ifdef _OPENMP
 #pragma omp threadprivate(cos_method_cache1_)
 #endif
-  return &cos_method_cache1_;
+  struct cos_method_cache1 *cache = &cos_method_cache1_;
+
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache1(cache);
+
+  return cache;
   COS_UNUSED(cos_method_cache1);
 }
 
@@ -212,7 +293,12 @@ cos_method_cache2(void)
 #ifdef _OPENMP
 #pragma omp threadprivate(cos_method_cache2_)
 #endif
-  return &cos_method_cache2_;
+  struct cos_method_cache2 *cache = &cos_method_cache2_;
+
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache2(cache);
+
+  return cache;
   COS_UNUSED(cos_method_cache2);
 }
 
@@ -223,7 +309,12 @@ cos_method_cache3(void)
 #ifdef _OPENMP
 #pragma omp threadprivate(cos_method_cache3_)
 #endif
-  return &cos_method_cache3_;
+  struct cos_method_cache3 *cache = &cos_method_cache3_;
+
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache3(cache);
+
+  return cache;
   COS_UNUSED(cos_method_cache3);
 }
 
@@ -234,7 +325,12 @@ cos_method_cache4(void)
 #ifdef _OPENMP
 #pragma omp threadprivate(cos_method_cache4_)
 #endif
-  return &cos_method_cache4_;
+  struct cos_method_cache4 *cache = &cos_method_cache4_;
+
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache4(cache);
+
+  return cache;
   COS_UNUSED(cos_method_cache4);
 }
 
@@ -245,10 +341,26 @@ cos_method_cache5(void)
 #ifdef _OPENMP
 #pragma omp threadprivate(cos_method_cache5_)
 #endif
-  return &cos_method_cache5_;
+  struct cos_method_cache5 *cache = &cos_method_cache5_;
+
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache5(cache);
+
+  return cache;
   COS_UNUSED(cos_method_cache5);
 }
 
+static cos_inline struct cos_method_profile*
+cos_method_profile(void)
+{
+  extern __thread struct cos_method_profile *cos_method_profile_;
+#ifdef _OPENMP
+#pragma omp threadprivate(cos_method_profile_)
+#endif
+  return cos_method_profile_ ? cos_method_profile_ : cos_method_profile_init();
+  COS_UNUSED(cos_method_profile);
+}
+
 static cos_inline struct cos_exception_context*
 cos_exception_context(void)
 {
@@ -260,6 +372,59 @@ cos_exception_context(void)
   COS_UNUSED(cos_exception_context);
 }
 
+static cos_inline void
+cos_exception_enterContext(struct cos_exception_context *cxt)
+{
+  extern __thread struct cos_exception_context *cos_exception_cxt_;
+#ifdef _OPENMP
+#pragma omp threadprivate(cos_exception_cxt_)
+#endif
+  struct cos_functor_context *fcxt = cos_functor_context();
+  struct cos_exception_context **top = &cos_exception_cxt_; // one TLS load
+
+  cxt->prv   = *top;
+  cxt->top   = top;
+  cxt->stk   = 0;
+  cxt->unstk = 0;
+  cxt->ex    = 0;
+  cxt->fss   = fcxt->top - fcxt->stk;
+  *top = cxt;
+
+  COS_UNUSED(cos_exception_enterContext);
+}
+
+static cos_inline void
+cos_exception_leaveContext(struct cos_exception_context *cxt)
+{
+  *cxt->top = cxt->prv;
+
+  if ((cxt->tag & cos_tag_throw) || cxt->ex)
+    cos_exception_deinitContext(cxt); // rethrow or release
+
+  COS_UNUSED(cos_exception_leaveContext);
+}
+
+static cos_inline struct Region*
+cos_region(void)
+{
+  extern __thread struct Region *cos_region_;
+#ifdef _OPENMP
+#pragma omp threadprivate(cos_region_)
+#endif
+  return cos_region_;
+  COS_UNUSED(cos_region);
+}
+
+#if COS_OBJECT_RC == COS_OBJECT_RC_BIASED
+static cos_inline U32
+cos_thread_id(void)
+{
+  extern __thread U32 cos_thread_id_;
+  return cos_thread_id_ ? cos_thread_id_ : cos_thread_initId();
+  COS_UNUSED(cos_thread_id);
+}
+#endif
+
 #else // !defined(_OPENMP) && !COS_HAS_TLS && COS_HAS_POSIX -----------------
 
 #if COS_HAS_POSIX
@@ -267,6 +432,7 @@ cos_exception_context(void)
 #endif
 
 struct cos_exception_context* cos_exception_context   (void);
+struct Region*                cos_region              (void);
 struct cos_functor_context*   cos_functor_context_init(void);
 struct cos_method_cache1*     cos_method_cache1_init  (void);
 struct cos_method_cache2*     cos_method_cache2_init  (void);
@@ -300,6 +466,9 @@ cos_method_cache1(void)
       !(cache = pthread_getspecific(cos_method_cache1_key)))
     cache = cos_method_cache1_init();
 
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache1(cache);
+
   return cache;
   COS_UNUSED(cos_method_cache1);
 }
@@ -315,6 +484,9 @@ cos_method_cache2(void)
       !(cache = pthread_getspecific(cos_method_cache2_key)))
     cache = cos_method_cache2_init();
 
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache2(cache);
+
   return cache;
   COS_UNUSED(cos_method_cache2);
 }
@@ -330,6 +502,9 @@ cos_method_cache3(void)
       !(cache = pthread_getspecific(cos_method_cache3_key)))
     cache = cos_method_cache3_init();
 
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache3(cache);
+
   return cache;
   COS_UNUSED(cos_method_cache3);
 }
@@ -345,6 +520,9 @@ cos_method_cache4(void)
       !(cache = pthread_getspecific(cos_method_cache4_key)))
     cache = cos_method_cache4_init();
 
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache4(cache);
+
   return cache;
   COS_UNUSED(cos_method_cache4);
 }
@@ -360,12 +538,92 @@ cos_method_cache5(void)
       !(cache = pthread_getspecific(cos_method_cache5_key)))
     cache = cos_method_cache5_init();
 
+  if (cache->gen != cos_method_generation_)
+    cos_method_syncCache5(cache);
+
   return cache;
   COS_UNUSED(cos_method_cache5);
 }
 
+static cos_inline struct cos_method_profile*
+cos_method_profile(void)
+{
+  struct cos_method_profile *prf;
+  extern int cos_method_profile_key_init;
+  extern pthread_key_t cos_method_profile_key;
+
+  if (! cos_method_profile_key_init ||
+      !(prf = pthread_getspecific(cos_method_profile_key)))
+    prf = cos_method_profile_init();
+
+  return prf;
+  COS_UNUSED(cos_method_profile);
+}
+
+static cos_inline void
+cos_exception_enterContext(struct cos_exception_context *cxt)
+{
+  cos_exception_initContext(cxt);
+  COS_UNUSED(cos_exception_enterContext);
+}
+
+static cos_inline void
+cos_exception_leaveContext(struct cos_exception_context *cxt)
+{
+  cos_exception_deinitContext(cxt);
+  COS_UNUSED(cos_exception_leaveContext);
+}
+
 #endif // ------------------------------------------------
 
+// allocation in the current region of the thread (see Region in AutoRelease.c)
+void* cos_region_alloc(struct Region*,size_t);
+
+static cos_inline U64
+cos_method_cycles(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  return __builtin_ia32_rdtsc();
+#else
+  return 0; // no cycle counter, calls are counted but not timed
+#endif
+  COS_UNUSED(cos_method_cycles);
+}
+
+static cos_inline U64
+cos_method_profileEnter(U32 *id, const struct Method *mth)
+{
+  struct cos_method_profile *prf = cos_method_profile();
+
+  if (!*id)
+    cos_method_profileInit(id, mth);
+
+  if (*id >= prf->n)
+    cos_method_profileEnlarge(prf, *id);
+
+  prf->cnt[*id]++;
+
+#if COS_METHOD_PROFILE_SAMPLE
+  if (!prf->tck--) {
+    prf->tck = COS_METHOD_PROFILE_SAMPLE-1;
+    return cos_method_cycles();
+  }
+#endif
+
+  return 0;
+  COS_UNUSED(cos_method_profileEnter);
+}
+
+static cos_inline void
+cos_method_profileLeave(U32 id, U64 t0)
+{
+  if (t0) {
+    struct cos_method_profile *prf = cos_method_profile();
+    prf->cyc[id] += (cos_method_cycles()-t0) * COS_METHOD_PROFILE_SAMPLE;
+  }
+  COS_UNUSED(cos_method_profileLeave);
+}
+
 static cos_inline OBJ
 cos_ident(OBJ obj)
 {
@@ -396,6 +654,21 @@ cos_object_setIdAuto(OBJ res, OBJ obj)
   COS_UNUSED(cos_object_setIdAuto);
 }
 
+/* NOTE-INFO: reference counting modes (see COS_OBJECT_RC)
+   - PLAIN : the counter is a plain integer, objects are owned by one thread.
+   - ATOMIC: the counter is updated with atomics (relaxed increment,
+             acq_rel decrement), objects can be retained/released by any
+             thread.
+   - BIASED: the thread allocating the object (the owner) updates a plain
+             counter until cos_object_share is called, then all threads
+             use atomics. Retaining/releasing an object not shared from
+             another thread than its owner aborts.
+   cos_object_decRcLast drops one reference and returns YES if it was
+   the last one (rc >= COS_RC_UNIT), the caller being in charge of the
+   deallocation.
+*/
+#if COS_OBJECT_RC == COS_OBJECT_RC_PLAIN // ---------------------------------
+
 static cos_inline I32
 cos_object_rc(OBJ obj)
 {
@@ -424,6 +697,161 @@ cos_object_decRc(OBJ obj)
   COS_UNUSED(cos_object_decRc);
 }
 
+static cos_inline BOOL
+cos_object_decRcLast(OBJ obj)
+{
+  struct Any *any = (struct Any*)obj;
+
+  if (any->_rc > COS_RC_UNIT)
+    return any->_rc--, COS_NO;
+
+  return COS_YES;
+  COS_UNUSED(cos_object_decRcLast);
+}
+
+static cos_inline OBJ
+cos_object_share(OBJ obj)
+{
+  return obj;
+  COS_UNUSED(cos_object_share);
+}
+
+#elif COS_OBJECT_RC == COS_OBJECT_RC_ATOMIC // ------------------------------
+
+static cos_inline I32
+cos_object_rc(OBJ obj)
+{
+  return __atomic_load_n(&((struct Any*)obj)->_rc, __ATOMIC_RELAXED);
+  COS_UNUSED(cos_object_rc);
+}
+
+static cos_inline OBJ
+cos_object_setRc(OBJ obj, I32 rc)
+{
+  __atomic_store_n(&((struct Any*)obj)->_rc, rc, __ATOMIC_RELAXED);
+  return obj;
+  COS_UNUSED(cos_object_setRc);
+}
+
+static cos_inline OBJ
+cos_object_incRc(OBJ obj)
+{
+  __atomic_fetch_add(&((struct Any*)obj)->_rc, 1, __ATOMIC_RELAXED);
+  return obj;
+  COS_UNUSED(cos_object_incRc);
+}
+
+static cos_inline OBJ
+cos_object_decRc(OBJ obj)
+{
+  __atomic_fetch_sub(&((struct Any*)obj)->_rc, 1, __ATOMIC_ACQ_REL);
+  return obj;
+  COS_UNUSED(cos_object_decRc);
+}
+
+static cos_inline BOOL
+cos_object_decRcLast(OBJ obj)
+{
+  return __atomic_sub_fetch(&((struct Any*)obj)->_rc, 1, __ATOMIC_ACQ_REL)
+         == COS_RC_AUTO;
+  COS_UNUSED(cos_object_decRcLast);
+}
+
+static cos_inline OBJ
+cos_object_share(OBJ obj)
+{
+  return obj;
+  COS_UNUSED(cos_object_share);
+}
+
+#else // COS_OBJECT_RC == COS_OBJECT_RC_BIASED ------------------------------
+
+static cos_inline I32
+cos_object_rc(OBJ obj)
+{
+  return __atomic_load_n(&((struct Any*)obj)->_rc, __ATOMIC_RELAXED);
+  COS_UNUSED(cos_object_rc);
+}
+
+static cos_inline OBJ
+cos_object_setRc(OBJ obj, I32 rc)
+{
+  struct Any *any = (struct Any*)obj;
+
+  any->_tid = rc >= COS_RC_UNIT ? cos_thread_id() : 0;
+  __atomic_store_n(&any->_rc, rc, __ATOMIC_RELAXED);
+  return obj;
+  COS_UNUSED(cos_object_setRc);
+}
+
+static cos_inline OBJ
+cos_object_incRc(OBJ obj)
+{
+  struct Any *any = (struct Any*)obj;
+
+  if (any->_tid == cos_thread_id()) // owner
+    __atomic_store_n(&any->_rc, any->_rc+1, __ATOMIC_RELAXED);
+  else if (!any->_tid) // shared
+    __atomic_fetch_add(&any->_rc, 1, __ATOMIC_RELAXED);
+  else
+    cos_object_rcNotOwner(obj);
+
+  return obj;
+  COS_UNUSED(cos_object_incRc);
+}
+
+static cos_inline OBJ
+cos_object_decRc(OBJ obj)
+{
+  struct Any *any = (struct Any*)obj;
+
+  if (any->_tid == cos_thread_id()) // owner
+    __atomic_store_n(&any->_rc, any->_rc-1, __ATOMIC_RELAXED);
+  else if (!any->_tid) // shared
+    __atomic_fetch_sub(&any->_rc, 1, __ATOMIC_ACQ_REL);
+  else
+    cos_object_rcNotOwner(obj);
+
+  return obj;
+  COS_UNUSED(cos_object_decRc);
+}
+
+static cos_inline BOOL
+cos_object_decRcLast(OBJ obj)
+{
+  struct Any *any = (struct Any*)obj;
+
+  if (any->_tid == cos_thread_id()) { // owner
+    if (any->_rc > COS_RC_UNIT) {
+      __atomic_store_n(&any->_rc, any->_rc-1, __ATOMIC_RELAXED);
+      return COS_NO;
+    }
+    return COS_YES;
+  }
+
+  if (!any->_tid) // shared
+    return __atomic_sub_fetch(&any->_rc, 1, __ATOMIC_ACQ_REL) == COS_RC_AUTO;
+
+  cos_object_rcNotOwner(obj);
+  return COS_NO;
+  COS_UNUSED(cos_object_decRcLast);
+}
+
+// must be called by the owner before the object is seen by other threads
+static cos_inline OBJ
+cos_object_share(OBJ obj)
+{
+  struct Any *any = (struct Any*)obj;
+
+  if (any->_tid == cos_thread_id())
+    __atomic_store_n(&any->_tid, 0, __ATOMIC_RELEASE);
+
+  return obj;
+  COS_UNUSED(cos_object_share);
+}
+
+#endif // COS_OBJECT_RC ------------------------------------------------------
+
 static cos_inline struct Class*
 cos_object_class(OBJ obj)
 {
@@ -219,6 +219,7 @@ struct cos_functor_context {
 // exception context
 struct cos_exception_context {
   struct cos_exception_context *prv;
+  struct cos_exception_context **top; // thread slot (TLS only)
   struct cos_exception_protect *stk;
   BOOL unstk;
   volatile OBJ    ex;
@@ -242,35 +243,184 @@ struct cos_exception_extendedProtect {
   FCTV         fct;
 };
 
+// method profile (one record per thread, see cos/cos/method.h)
+struct cos_method_profile {
+  U64 *cnt; // calls, indexed by method profile id
+  U64 *cyc; // sampled cycles, indexed by method profile id
+  U32  n;   // capacity
+  U32  tck; // calls before the next timed call
+  struct cos_method_profile *nxt;
+};
+
+// call-site caches (one per thread and call site, see cos/cos/dispatch.h)
+struct cos_method_site1 {
+  U32 gen, idg, id1;
+  IMP1 fct;
+};
+
+struct cos_method_site2 {
+  U32 gen, idg, id1, id2;
+  IMP2 fct;
+};
+
+struct cos_method_site3 {
+  U32 gen, idg, id1, id2, id3;
+  IMP3 fct;
+};
+
+struct cos_method_site4 {
+  U32 gen, idg, id1, id2, id3, id4;
+  IMP4 fct;
+};
+
+struct cos_method_site5 {
+  U32 gen, idg, id1, id2, id3, id4, id5;
+  IMP5 fct;
+};
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+
+// dispatch caches (lines of packed slots)
+struct cos_method_cache1 {
+  struct cos_method_line1 *line;
+  void *mem;
+  U32 msk, mis, mis2;
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
+};
+
+struct cos_method_cache2 {
+  struct cos_method_line2 *line;
+  void *mem;
+  U32 msk, mis, mis2;
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
+};
+
+struct cos_method_cache3 {
+  struct cos_method_line3 *line;
+  void *mem;
+  U32 msk, mis, mis2;
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
+};
+
+struct cos_method_cache4 {
+  struct cos_method_line4 *line;
+  void *mem;
+  U32 msk, mis, mis2;
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
+};
+
+struct cos_method_cache5 {
+  struct cos_method_line5 *line;
+  void *mem;
+  U32 msk, mis, mis2;
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
+};
+
+// dispatch slots
+struct cos_method_slot1 {
+  U32 idg, id1;
+  IMP1 fct;
+};
+
+struct cos_method_slot2 {
+  U32 idg, id1, id2;
+  IMP2 fct;
+};
+
+struct cos_method_slot3 {
+  U32 idg, id1, id2, id3;
+  IMP3 fct;
+};
+
+struct cos_method_slot4 {
+  U32 idg, id1, id2, id3, id4;
+  IMP4 fct;
+};
+
+struct cos_method_slot5 {
+  U32 idg, id1, id2, id3, id4, id5;
+  IMP5 fct;
+};
+
+// number of slots per line (power of 2)
+#define COS_METHOD_LINE(n) \
+  (64/(n) >= 8 ? 8 : 64/(n) >= 4 ? 4 : 64/(n) >= 2 ? 2 : 1)
+
+enum {
+  COS_METHOD_LINE1 = COS_METHOD_LINE(sizeof(struct cos_method_slot1)),
+  COS_METHOD_LINE2 = COS_METHOD_LINE(sizeof(struct cos_method_slot2)),
+  COS_METHOD_LINE3 = COS_METHOD_LINE(sizeof(struct cos_method_slot3)),
+  COS_METHOD_LINE4 = COS_METHOD_LINE(sizeof(struct cos_method_slot4)),
+  COS_METHOD_LINE5 = COS_METHOD_LINE(sizeof(struct cos_method_slot5))
+};
+
+// dispatch lines (one cache line each)
+struct cos_method_line1 {
+  struct cos_method_slot1 cel[COS_METHOD_LINE1];
+} __attribute__((aligned(64)));
+
+struct cos_method_line2 {
+  struct cos_method_slot2 cel[COS_METHOD_LINE2];
+} __attribute__((aligned(64)));
+
+struct cos_method_line3 {
+  struct cos_method_slot3 cel[COS_METHOD_LINE3];
+} __attribute__((aligned(64)));
+
+struct cos_method_line4 {
+  struct cos_method_slot4 cel[COS_METHOD_LINE4];
+} __attribute__((aligned(64)));
+
+struct cos_method_line5 {
+  struct cos_method_slot5 cel[COS_METHOD_LINE5];
+} __attribute__((aligned(64)));
+
+#else // COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_CHAIN
+
 // dispatch caches
 struct cos_method_cache1 {
   struct cos_method_slot1 **slot;
+  struct cos_method_slot1  *cel;
   U32 msk, mis, mis2;
-  char _[64-sizeof(void*)-3*sizeof(U32)];
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
 };
 
 struct cos_method_cache2 {
   struct cos_method_slot2 **slot;
+  struct cos_method_slot2  *cel;
   U32 msk, mis, mis2;
-  char _[64-sizeof(void*)-3*sizeof(U32)];
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
 };
 
 struct cos_method_cache3 {
   struct cos_method_slot3 **slot;
+  struct cos_method_slot3  *cel;
   U32 msk, mis, mis2;
-  char _[64-sizeof(void*)-3*sizeof(U32)];
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
 };
 
 struct cos_method_cache4 {
   struct cos_method_slot4 **slot;
+  struct cos_method_slot4  *cel;
   U32 msk, mis, mis2;
-  char _[64-sizeof(void*)-3*sizeof(U32)];
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
 };
 
 struct cos_method_cache5 {
   struct cos_method_slot5 **slot;
+  struct cos_method_slot5  *cel;
   U32 msk, mis, mis2;
-  char _[64-sizeof(void*)-3*sizeof(U32)];
+  U32 cnt, cap, rhs, shr, gen;
+  char _[64-2*sizeof(void*)-8*sizeof(U32)];
 };
 
 // dispatch slots
@@ -304,4 +454,6 @@ struct cos_method_slot5 {
   struct cos_method_slot5 *nxt;
 };
 
+#endif // COS_METHOD_CACHE_LAYOUT
+
 #endif // COS_COS_COSDEF_H
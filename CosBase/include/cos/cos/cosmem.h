@@ -35,11 +35,28 @@
 
   Information:
   - parameters ending with an underscope can be null.
-  - cos_mem_free does not free the memory, it just returns it to the pool.
+  - cos_mem_free does not free the memory, it just returns it to the pool
+    of the thread which allocated it. Memory freed by another thread is
+    queued to the owner (lock-free) and reclaimed on its next pool miss.
   - cos_mem_xxx_n are ~50% faster, but objects must have the SAME cos_mem_size.
   - cos_mem_alloc_n returns the number of objects effectively allocated.
   - cos_mem_collect does free the unused memory of the thread specific pool.
   - cos_mem_collect and cos_mem_unused can be called for a specific cos_mem_size.
+  - cos_mem_remote returns the size of the memory queued by other threads
+    and not yet reclaimed, and counts the nodes received from/sent to other
+    threads.
+  - the pool of a thread is collected when the thread exits.
+  - cos_mem_sampler calls hook_ (or records the call site if hook_ is null)
+    every period allocations of a thread, period 0 stops the sampling. The
+    site is the return address of the function which called the allocator.
+  - cos_mem_stats (see cos/debug.h) dumps the statistics of all threads per
+    size class (power of 2 of the node size) and the sampled sites.
+  - nodes of a region (see Region) are marked in their slot and ignored by
+    cos_mem_free, they are freed all at once with their region.
+    cos_mem_realloc moves them to the pool of the thread.
+  - small nodes (up to ~4kB) are carved by batch from 64kB chunks (slabs)
+    when their slot is empty. cos_mem_collect returns the chunks whose nodes
+    are all unused to the system, other nodes of these slots stay in the pool.
 
   Errors:
   - cos_mem_free_n on objects of different cos_mem_size is undefined.
@@ -66,6 +83,10 @@ static void   cos_mem_free_n   (void *ptr_[], int n);
 // tuning
 extern size_t cos_mem_unused   (int *count_,   size_t *only_);
 extern size_t cos_mem_collect  (int *percent_, size_t *only_);
+extern size_t cos_mem_remote   (size_t *recv_, size_t *sent_);
+
+// statistics (COS_MEM_STAT)
+extern void   cos_mem_sampler  (unsigned period, void (*hook_)(void *ptr, size_t size, void *site));
 
 // --- configuration -----------------------------------------------------------
 
@@ -74,6 +95,33 @@ extern size_t cos_mem_collect  (int *percent_, size_t *only_);
 #define COS_MEM_AS_DEFAULT 1
 #endif
 
+// set COS_MEM_REMOTE to 0 to return memory to the pool of the freeing thread.
+#ifndef COS_MEM_REMOTE
+#ifdef __GNUC__
+#define COS_MEM_REMOTE 1
+#else
+#define COS_MEM_REMOTE 0
+#endif
+#endif
+
+// set COS_MEM_SLAB to 0 to allocate small nodes one by one with malloc.
+#ifndef COS_MEM_SLAB
+#if COS_HAS_POSIX && defined(__GNUC__)
+#define COS_MEM_SLAB 1
+#else
+#define COS_MEM_SLAB 0
+#endif
+#endif
+
+// set COS_MEM_STAT to 1 to count allocations per thread and size class.
+#ifndef COS_MEM_STAT
+#define COS_MEM_STAT 0
+#endif
+
+#if COS_MEM_STAT && !defined(__GNUC__)
+#error "COS: COS_MEM_STAT requires GCC builtins"
+#endif
+
 // --- inline implementation ---------------------------------------------------
 
 #include <string.h>
@@ -87,6 +135,7 @@ union cos_mem_node_ {
 
   struct {
     unsigned slot;
+    unsigned owner;
     union {
       long   n, *np;
       size_t s, *sp;
@@ -105,18 +154,56 @@ enum {
   cos_mem_node_size_ = offsetof(union cos_mem_node_, used.data),
   cos_mem_slot_size_ = sizeof(struct cos_mem_slot_),
   cos_mem_slot_max_  = (1<<16)/cos_mem_slot_size_, // max pool size:     ~64kB/thread
+  cos_mem_owner_max_ = 1024,                         // max owner threads
+  cos_mem_chunk_size_ = 1<<16,                       // slab chunk size:   64kB
+  cos_mem_slab_max_  = COS_MEM_SLAB ? cos_mem_chunk_size_/16/cos_mem_node_size_ : 0, // slab slots: ~4kB
+  cos_mem_class_max_ = 15,                           // size classes (stats)
+};
+
+// statistics (per size class)
+struct cos_mem_stat_ {
+  size_t alloc, free;  // nodes allocated/freed
+  size_t miss;         // allocations from the system (malloc or chunk)
+  size_t cached, peak; // bytes in the pool and high-water mark
 };
 
 // memory pool
 struct cos_mem_pool_ {
   size_t size;
+  size_t sent, recv; // nodes freed to/by other threads
+  unsigned owner;    // owner tag, 0 = not yet initialized
+  unsigned serial;   // serial of the thread for its chunks, 0 = none
+  unsigned spares;   // number of spare chunks
+  void    *spare;    // empty slab chunks kept for reuse
+#if COS_MEM_STAT
+  unsigned sample;   // allocations since the last sample
+  struct cos_mem_pool_ *next; // registered pools, 0 = not registered
+  struct cos_mem_stat_ stat[cos_mem_class_max_];
+#endif
   struct cos_mem_slot_ slot[cos_mem_slot_max_];
 };
 
+// nodes freed by other threads (per owner, one cache line each)
+struct cos_mem_remote_ {
+  union cos_mem_node_ *list;
+  char _[64-sizeof(void*)];
+};
+
 // pool (per thread)
-extern struct cos_mem_pool_ cos_mem_pool_;
+extern __thread struct cos_mem_pool_ cos_mem_pool_;
+// remote lists (per owner)
+extern struct cos_mem_remote_ cos_mem_remote_[cos_mem_owner_max_];
 // max unused memory (per thread), default ~32MB
 extern size_t cos_mem_pool_max_;
+// sampling period (all threads), 0 = no sampling
+extern unsigned cos_mem_sample_period_;
+
+// out-of-line helpers
+extern int  cos_mem_drain_  (void);
+extern int  cos_mem_carve_  (unsigned slot);
+extern void cos_mem_sendto_ (union cos_mem_node_ *ptr);
+extern void cos_mem_sample_ (void *ptr, size_t size);
+extern void cos_mem_missed_ (unsigned slot, unsigned cnt);
 
 #ifdef _OPENMP
 #pragma omp threadprivate (cos_mem_pool_)
@@ -147,13 +234,98 @@ unsigned cos_mem_get_slot_ (size_t size)
   return (size + cos_mem_node_size_-1) / cos_mem_node_size_;
 }
 
-ATT __attribute__((pure))
-void* cos_mem_node_init_ (union cos_mem_node_ *ptr, unsigned slot)
+ATT
+void* cos_mem_node_init_ (union cos_mem_node_ *ptr, unsigned slot, unsigned owner)
 {
-    ptr->used.slot = slot;
+    ptr->used.slot  = slot;
+    ptr->used.owner = owner;
     return ptr->used.data;
 }
 
+// node allocated by another thread (tag 0 = no owner)
+ATT __attribute__((pure))
+int cos_mem_is_remote_ (union cos_mem_node_ *ptr, struct cos_mem_pool_ *pool)
+{
+#if COS_MEM_REMOTE
+  return ptr->used.owner != pool->owner && ptr->used.owner;
+#else
+  return (void)ptr, (void)pool, 0;
+#endif
+}
+
+// node allocated in a region (see Region)
+ATT __attribute__((const))
+int cos_mem_is_region_ (unsigned slot)
+{
+  return slot > ~0u >> 1;
+}
+
+ATT
+void* cos_mem_region_init_ (void *ptr, size_t size)
+{
+  return cos_mem_node_init_((union cos_mem_node_*)ptr, cos_mem_get_slot_(size) | ~(~0u >> 1), 0);
+}
+
+// node carved from a chunk
+ATT __attribute__((const))
+int cos_mem_is_slab_ (unsigned slot)
+{
+  return !cos_mem_is_region_(slot) && slot < cos_mem_slab_max_;
+}
+
+// size class of slot
+ATT __attribute__((const))
+unsigned cos_mem_get_class_ (unsigned slot)
+{
+#if COS_MEM_STAT
+  unsigned cls = slot ? CHAR_BIT*sizeof slot - __builtin_clz(slot) : 0;
+  return cls < cos_mem_class_max_ ? cls : cos_mem_class_max_-1;
+#else
+  return (void)slot, 0;
+#endif
+}
+
+// count allocated/freed nodes and nodes moved to (>0) or from (<0) the pool
+ATT
+void cos_mem_stat_ (struct cos_mem_pool_ *pool, unsigned slot, size_t alloc, size_t freed, long cached)
+{
+#if COS_MEM_STAT
+  struct cos_mem_stat_ *stat = pool->stat + cos_mem_get_class_(slot);
+
+  stat->alloc  += alloc;
+  stat->free   += freed;
+  stat->cached += cached*(long)(slot*cos_mem_node_size_);
+  if (cached > 0 && stat->cached > stat->peak) stat->peak = stat->cached;
+#else
+  (void)pool, (void)slot, (void)alloc, (void)freed, (void)cached;
+#endif
+}
+
+// sample allocation sites
+ATT
+void* cos_mem_sampled_ (struct cos_mem_pool_ *pool, void *ptr, size_t size)
+{
+#if COS_MEM_STAT
+  if (cos_mem_sample_period_ && ++pool->sample >= cos_mem_sample_period_)
+    cos_mem_sample_(ptr, size);
+#else
+  (void)pool, (void)size;
+#endif
+  return ptr;
+}
+
+// reclaim nodes freed by other threads, or carve a new chunk
+ATT
+int cos_mem_refill_ (struct cos_mem_slot_ *pptr, unsigned slot)
+{
+#if COS_MEM_REMOTE
+  if (cos_mem_drain_() && pptr->list) return 1;
+#else
+  (void)pptr;
+#endif
+  return cos_mem_is_slab_(slot) && cos_mem_carve_(slot);
+}
+
 // -- allocator
 
 ATT __attribute__((malloc))
@@ -164,16 +336,20 @@ void* cos_mem_alloc (size_t size)
   struct cos_mem_slot_ *restrict pptr = pool->slot+slot;
   union  cos_mem_node_ *ptr;
 
-  if (slot < cos_mem_slot_max_ && pptr->list) {
+  if (slot < cos_mem_slot_max_ && (pptr->list || cos_mem_refill_(pptr, slot))) {
     pool->size -= slot*cos_mem_node_size_;
+    cos_mem_stat_(pool, slot, 1, 0, -1);
     ptr = pptr->list, pptr->list = ptr->free.next;
   }
+  else if (cos_mem_is_slab_(slot)) // small nodes live only in chunks
+    return 0;
   else {
     if (pool->size > cos_mem_pool_max_) cos_mem_collect(0,0);
     ptr = (union cos_mem_node_*)malloc((slot+1) * cos_mem_node_size_);
     if (!ptr) return 0;
+    if (COS_MEM_STAT) cos_mem_missed_(slot, 1);
   }
-  return cos_mem_node_init_(ptr, slot);
+  return cos_mem_sampled_(pool, cos_mem_node_init_(ptr, slot, pool->owner), size);
 }
 
 ATT __attribute__((malloc))
@@ -193,11 +369,26 @@ void* cos_mem_realloc (void* ptr_, size_t size)
 {
   unsigned slot = cos_mem_get_slot_(size);
   union cos_mem_node_ *ptr = ptr_ ? cos_mem_get_base_(ptr_) : (union cos_mem_node_*)ptr_;
+
+  if (ptr && ptr->used.slot == slot)
+    return ptr_;
+
+  // slab and region nodes cannot be resized by the system
+  if (!ptr || cos_mem_is_region_(ptr->used.slot) ||
+      cos_mem_is_slab_(ptr->used.slot) || cos_mem_is_slab_(slot)) {
+    void *new_ = cos_mem_alloc(size);
+    if (!new_ || !ptr) return new_;
+
+    size_t old = cos_mem_size(ptr_);
+    memcpy(new_, ptr_, old < size ? old : size);
+    cos_mem_free(ptr_);
+    return new_;
+  }
+
   ptr = (union cos_mem_node_*)realloc(ptr, (slot+1) * cos_mem_node_size_);
   if (!ptr) return 0;
 
-  ptr->used.slot = slot;
-  return ptr->used.data;
+  return cos_mem_node_init_(ptr, slot, cos_mem_pool_.owner);
 }
 
 ATT
@@ -211,10 +402,18 @@ void cos_mem_free (void* ptr_)
   if (slot < cos_mem_slot_max_) {
     struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
     struct cos_mem_slot_ *restrict pptr = pool->slot+slot;
+    if (cos_mem_is_remote_(ptr, pool)) {
+      cos_mem_sendto_(ptr);
+      return;
+    }
     pool->size += slot*cos_mem_node_size_;
+    cos_mem_stat_(pool, slot, 0, 1, 1);
     ptr->free.next = pptr->list, pptr->list = ptr;
   }
-  else free(ptr);
+  else if (!cos_mem_is_region_(slot)) {
+    cos_mem_stat_(&cos_mem_pool_, slot, 0, 1, 0);
+    free(ptr);
+  }
 }
 
 // -- allocator, array versions
@@ -230,25 +429,34 @@ int cos_mem_alloc_n (void* ptr_[], int n, size_t size)
     struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
     struct cos_mem_slot_ *restrict pptr = pool->slot+slot;
 
-    for (; i < n && pptr->list; i++) {
-      ptr = pptr->list, pptr->list = ptr->free.next;
-      ptr_[i] = cos_mem_node_init_(ptr, slot);
-    }
+    do
+      for (; i < n && pptr->list; i++) {
+        ptr = pptr->list, pptr->list = ptr->free.next;
+        ptr_[i] = cos_mem_node_init_(ptr, slot, pool->owner);
+      }
+    while (i < n && cos_mem_refill_(pptr, slot));
 
     pool->size -= i*slot*cos_mem_node_size_;
+    cos_mem_stat_(pool, slot, i, 0, -i);
     if (i < n && pool->size > cos_mem_pool_max_) cos_mem_collect(0,0);
 
-    for (; i < n; i++) {
-      ptr = (union cos_mem_node_*)malloc((slot+1) * cos_mem_node_size_);
-      if (ptr) ptr_[i] = cos_mem_node_init_(ptr, slot);
-      else break;
+    if (!cos_mem_is_slab_(slot)) { // small nodes live only in chunks
+      int j = i;
+
+      for (; i < n; i++) {
+        ptr = (union cos_mem_node_*)malloc((slot+1) * cos_mem_node_size_);
+        if (ptr) ptr_[i] = cos_mem_node_init_(ptr, slot, pool->owner);
+        else break;
+      }
+      if (COS_MEM_STAT && i > j) cos_mem_missed_(slot, i-j);
     }
   } else {
     for (; i < n; i++) {
       ptr = (union cos_mem_node_*)malloc((slot+1) * cos_mem_node_size_);
-      if (ptr) ptr_[i] = cos_mem_node_init_(ptr, slot);
+      if (ptr) ptr_[i] = cos_mem_node_init_(ptr, slot, 0);
       else break;
     }
+    if (COS_MEM_STAT && i > 0) cos_mem_missed_(slot, i);
   }
   return i;
 }
@@ -262,16 +470,22 @@ void cos_mem_free_n (void* ptr_[], int n)
     if (slot < cos_mem_slot_max_) {
       struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
       struct cos_mem_slot_ *restrict pptr = pool->slot+slot;
-      int i = n;
+      int i = 0;
 
       while (n--) {
         union cos_mem_node_ *ptr = cos_mem_get_base_(ptr_[n]);
-        ptr->free.next = pptr->list, pptr->list = ptr;
+        if (cos_mem_is_remote_(ptr, pool))
+          cos_mem_sendto_(ptr);
+        else
+          ptr->free.next = pptr->list, pptr->list = ptr, i++;
       }
       pool->size += i*slot*cos_mem_node_size_;
+      cos_mem_stat_(pool, slot, 0, i, i);
     }
-    else
+    else if (!cos_mem_is_region_(slot)) {
+      cos_mem_stat_(&cos_mem_pool_, slot, 0, n, 0);
       while (n--) free(cos_mem_get_base_(ptr_[n]));
+    }
   }
 }
 
@@ -280,7 +494,7 @@ void cos_mem_free_n (void* ptr_[], int n)
 ATT __attribute__((pure))
 size_t cos_mem_size (void* ptr_)
 {
-  return ptr_ ? cos_mem_get_base_(ptr_)->used.slot * cos_mem_node_size_ : 0;
+  return ptr_ ? (cos_mem_get_base_(ptr_)->used.slot & ~0u >> 1) * cos_mem_node_size_ : 0;
 }
 
 #undef ATT
@@ -24,6 +24,69 @@
 #error "COS: use <cos/cos/cos.h> instead of <cos/cos/dispatch.h>"
 #endif
 
+#if COS_METHOD_HKEY == COS_METHOD_HKEY_MIX
+
+// --------------------------------------------------
+
+/* NOTE-INFO: multiplicative keys
+   each id is multiplied by a distinct odd constant (no commutative
+   collision) and the sum is mixed by xor-shift to spread high bits into
+   the low bits selected by the cache mask.
+*/
+static cos_inline U32
+cos_method_hmix(U32 key)
+{
+  key ^= key >> 15;
+  key *= 0x2C1B3C6DU;
+  key ^= key >> 12;
+  return key;
+  COS_UNUSED(cos_method_hmix);
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey1(U32 idg, U32 id1)
+{
+  return cos_method_hmix(idg*0x9E3779B1U +id1*0x85EBCA77U);
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey2(U32 idg, U32 id1, U32 id2)
+{
+  return cos_method_hmix(idg*0x9E3779B1U +id1*0x85EBCA77U +id2*0xC2B2AE3DU);
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey3(U32 idg, U32 id1, U32 id2, U32 id3)
+{
+  return cos_method_hmix(idg*0x9E3779B1U +id1*0x85EBCA77U +id2*0xC2B2AE3DU +id3*0x27D4EB2FU);
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey4(U32 idg, U32 id1, U32 id2, U32 id3, U32 id4)
+{
+  return cos_method_hmix(idg*0x9E3779B1U +id1*0x85EBCA77U +id2*0xC2B2AE3DU
+                        +id3*0x27D4EB2FU +id4*0x165667B1U);
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey5(U32 idg, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
+{
+  return cos_method_hmix(idg*0x9E3779B1U +id1*0x85EBCA77U +id2*0xC2B2AE3DU
+                        +id3*0x27D4EB2FU +id4*0x165667B1U +id5*0x61C88647U);
+}
+
+#else // COS_METHOD_HKEY == COS_METHOD_HKEY_ADD
+
 // --------------------------------------------------
 
 static cos_inline U32
@@ -32,6 +95,236 @@ cos_method_hkey1(U32 idg, U32 id1)
   return idg +id1;
 }
 
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey2(U32 idg, U32 id1, U32 id2)
+{
+  return idg +id1 -id2/2;
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey3(U32 idg, U32 id1, U32 id2, U32 id3)
+{
+  return idg +id1 -id2/2 +id3*2;
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey4(U32 idg, U32 id1, U32 id2, U32 id3, U32 id4)
+{
+  return idg +id1 -id2/2 +id3*2 -id4/4;
+}
+
+// --------------------------------------------------
+
+static cos_inline U32
+cos_method_hkey5(U32 idg, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
+{
+  return idg +id1 -id2/2 +id3*2 -id4/4 +id5*4;
+}
+
+#endif // COS_METHOD_HKEY
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+
+// --------------------------------------------------
+
+static cos_inline IMP1
+cos_method_fastLookup1(SEL restrict _sel, U32 id1)
+{
+  U32 key = cos_method_hkey1(_sel->Behavior.id,id1);
+  struct cos_method_cache1 *restrict cache = cos_method_cache1();
+  struct cos_method_slot1 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1
+    ? slot->fct
+    : cos_method_fastLookup1_(slot,_sel,id1);
+
+  COS_UNUSED(cos_method_fastLookup1);
+}
+
+static cos_inline BOOL
+cos_method_understand1(SEL restrict _sel, U32 id1)
+{
+  U32 key = cos_method_hkey1(_sel->Behavior.id,id1);
+  struct cos_method_cache1 *restrict cache = cos_method_cache1();
+  struct cos_method_slot1 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1
+    ? COS_YES
+    : cos_method_understand1_(slot,_sel,id1);
+
+  COS_UNUSED(cos_method_understand1);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP2
+cos_method_fastLookup2(SEL restrict _sel, U32 id1, U32 id2)
+{
+  U32 key = cos_method_hkey2(_sel->Behavior.id,id1,id2);
+  struct cos_method_cache2 *restrict cache = cos_method_cache2();
+  struct cos_method_slot2 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2
+    ? slot->fct
+    : cos_method_fastLookup2_(slot,_sel,id1,id2);
+
+  COS_UNUSED(cos_method_fastLookup2);
+}
+
+static cos_inline BOOL
+cos_method_understand2(SEL restrict _sel, U32 id1, U32 id2)
+{
+  U32 key = cos_method_hkey2(_sel->Behavior.id,id1,id2);
+  struct cos_method_cache2 *restrict cache = cos_method_cache2();
+  struct cos_method_slot2 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2
+    ? COS_YES
+    : cos_method_understand2_(slot,_sel,id1,id2);
+
+  COS_UNUSED(cos_method_understand2);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP3
+cos_method_fastLookup3(SEL restrict _sel, U32 id1, U32 id2, U32 id3)
+{
+  U32 key = cos_method_hkey3(_sel->Behavior.id,id1,id2,id3);
+  struct cos_method_cache3 *restrict cache = cos_method_cache3();
+  struct cos_method_slot3 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2 &&
+                   id3 == slot->id3
+    ? slot->fct
+    : cos_method_fastLookup3_(slot,_sel,id1,id2,id3);
+
+  COS_UNUSED(cos_method_fastLookup3);
+}
+
+static cos_inline BOOL
+cos_method_understand3(SEL restrict _sel, U32 id1, U32 id2, U32 id3)
+{
+  U32 key = cos_method_hkey3(_sel->Behavior.id,id1,id2,id3);
+  struct cos_method_cache3 *restrict cache = cos_method_cache3();
+  struct cos_method_slot3 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2 &&
+                   id3 == slot->id3
+    ? COS_YES
+    : cos_method_understand3_(slot,_sel,id1,id2,id3);
+
+  COS_UNUSED(cos_method_understand3);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP4
+cos_method_fastLookup4(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4)
+{
+  U32 key = cos_method_hkey4(_sel->Behavior.id,id1,id2,id3,id4);
+  struct cos_method_cache4 *restrict cache = cos_method_cache4();
+  struct cos_method_slot4 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2 &&
+                   id3 == slot->id3 &&
+                   id4 == slot->id4
+    ? slot->fct
+    : cos_method_fastLookup4_(slot,_sel,id1,id2,id3,id4);
+
+  COS_UNUSED(cos_method_fastLookup4);
+}
+
+static cos_inline BOOL
+cos_method_understand4(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4)
+{
+  U32 key = cos_method_hkey4(_sel->Behavior.id,id1,id2,id3,id4);
+  struct cos_method_cache4 *restrict cache = cos_method_cache4();
+  struct cos_method_slot4 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2 &&
+                   id3 == slot->id3 &&
+                   id4 == slot->id4
+    ? COS_YES
+    : cos_method_understand4_(slot,_sel,id1,id2,id3,id4);
+
+  COS_UNUSED(cos_method_understand4);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP5
+cos_method_fastLookup5(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
+{
+  U32 key = cos_method_hkey5(_sel->Behavior.id,id1,id2,id3,id4,id5);
+  struct cos_method_cache5 *restrict cache = cos_method_cache5();
+  struct cos_method_slot5 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2 &&
+                   id3 == slot->id3 &&
+                   id4 == slot->id4 &&
+                   id5 == slot->id5
+    ? slot->fct
+    : cos_method_fastLookup5_(slot,_sel,id1,id2,id3,id4,id5);
+
+  COS_UNUSED(cos_method_fastLookup5);
+}
+
+static cos_inline BOOL
+cos_method_understand5(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
+{
+  U32 key = cos_method_hkey5(_sel->Behavior.id,id1,id2,id3,id4,id5);
+  struct cos_method_cache5 *restrict cache = cos_method_cache5();
+  struct cos_method_slot5 *restrict slot = cache->line[key & cache->msk].cel;
+
+  return
+    _sel->Behavior.id  == slot->idg &&
+                   id1 == slot->id1 &&
+                   id2 == slot->id2 &&
+                   id3 == slot->id3 &&
+                   id4 == slot->id4 &&
+                   id5 == slot->id5
+    ? COS_YES
+    : cos_method_understand5_(slot,_sel,id1,id2,id3,id4,id5);
+
+  COS_UNUSED(cos_method_understand5);
+}
+
+#else // COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_CHAIN
+
+// --------------------------------------------------
+
 static cos_inline IMP1
 cos_method_fastLookup1(SEL restrict _sel, U32 id1)
 {
@@ -66,12 +359,6 @@ cos_method_understand1(SEL restrict _sel, U32 id1)
 
 // --------------------------------------------------
 
-static cos_inline U32
-cos_method_hkey2(U32 idg, U32 id1, U32 id2)
-{
-  return idg +id1 -id2/2;
-}
-
 static cos_inline IMP2
 cos_method_fastLookup2(SEL restrict _sel, U32 id1, U32 id2)
 {
@@ -108,12 +395,6 @@ cos_method_understand2(SEL restrict _sel, U32 id1, U32 id2)
 
 // --------------------------------------------------
 
-static cos_inline U32
-cos_method_hkey3(U32 idg, U32 id1, U32 id2, U32 id3)
-{
-  return idg +id1 -id2/2 +id3*2;
-}
-
 static cos_inline IMP3
 cos_method_fastLookup3(SEL restrict _sel, U32 id1, U32 id2, U32 id3)
 {
@@ -152,12 +433,6 @@ cos_method_understand3(SEL restrict _sel, U32 id1, U32 id2, U32 id3)
 
 // --------------------------------------------------
 
-static cos_inline U32
-cos_method_hkey4(U32 idg, U32 id1, U32 id2, U32 id3, U32 id4)
-{
-  return idg +id1 -id2/2 +id3*2 -id4/4;
-}
-
 static cos_inline IMP4
 cos_method_fastLookup4(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4)
 {
@@ -198,12 +473,6 @@ cos_method_understand4(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4)
 
 // --------------------------------------------------
 
-static cos_inline U32
-cos_method_hkey5(U32 idg, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
-{
-  return idg +id1 -id2/2 +id3*2 -id4/4 +id5*4;
-}
-
 static cos_inline IMP5
 cos_method_fastLookup5(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
 {
@@ -244,4 +513,194 @@ cos_method_understand5(SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4, U3
   COS_UNUSED(cos_method_understand5);
 }
 
+#endif // COS_METHOD_CACHE_LAYOUT
+
+/* NOTE-USER: call-site caches
+   COS_SITE_SEND(site,gen,rcv...) sends the message gen(rcv...) like a plain
+   call to the generic, but first checks the per-thread cache site which keeps
+   the receivers classes and the method of the last lookup done there. Sites
+   are declared at block scope with COS_SITE_DCL(site,rank), usually right
+   before a loop sending the same message many times:
+
+     COS_SITE_DCL(eq,2);
+     for (i = 0; i < n; i++)
+       if (COS_SITE_SEND(eq,gisEqual,obj[i],val) == True) break;
+
+   - the generic must have receivers only (no extra argument) and return OBJ.
+   - sites are invalidated by module loads and cos_method_clearCaches.
+   - without TLS sites are ignored and messages use the dispatcher caches.
+*/
+#define COS_SITE_DCL(NAME,RNK) \
+        static __thread struct COS_PP_CAT(cos_method_site,RNK) NAME
+
+#define COS_SITE_SEND(NAME,GEN,...) \
+        COS_PP_CAT(cos_method_siteSend,COS_PP_NARG(__VA_ARGS__)) \
+          (&NAME,genericref(GEN),__VA_ARGS__)
+
+#if defined(_OPENMP) || !COS_HAS_TLS
+#define COS_SITE_CHECK(SITE,CHK) 0
+#else
+#define COS_SITE_CHECK(SITE,CHK) (SITE->gen == cos_method_siteGeneration_ && CHK)
+#endif
+
+// --------------------------------------------------
+
+static cos_inline IMP1
+cos_method_siteLookup1(struct cos_method_site1 *restrict site,
+                       SEL restrict _sel, U32 id1)
+{
+  return
+    COS_SITE_CHECK(site,
+            site->idg == _sel->Behavior.id &&
+            site->id1 == id1)
+    ? site->fct
+    : cos_method_siteLookup1_(site,_sel,id1);
+
+  COS_UNUSED(cos_method_siteLookup1);
+}
+
+static cos_inline OBJ
+cos_method_siteSend1(struct cos_method_site1 *restrict site,
+                     SEL restrict _sel, OBJ _1)
+{
+  IMP1 fct = cos_method_siteLookup1(site,_sel,
+                                    cos_object_id(_1));
+  OBJ _ret;
+
+  fct(_sel,_1,0,&_ret);
+
+  return _ret;
+  COS_UNUSED(cos_method_siteSend1);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP2
+cos_method_siteLookup2(struct cos_method_site2 *restrict site,
+                       SEL restrict _sel, U32 id1, U32 id2)
+{
+  return
+    COS_SITE_CHECK(site,
+            site->idg == _sel->Behavior.id &&
+            site->id1 == id1 &&
+            site->id2 == id2)
+    ? site->fct
+    : cos_method_siteLookup2_(site,_sel,id1,id2);
+
+  COS_UNUSED(cos_method_siteLookup2);
+}
+
+static cos_inline OBJ
+cos_method_siteSend2(struct cos_method_site2 *restrict site,
+                     SEL restrict _sel, OBJ _1, OBJ _2)
+{
+  IMP2 fct = cos_method_siteLookup2(site,_sel,
+                                    cos_object_id(_1),cos_object_id(_2));
+  OBJ _ret;
+
+  fct(_sel,_1,_2,0,&_ret);
+
+  return _ret;
+  COS_UNUSED(cos_method_siteSend2);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP3
+cos_method_siteLookup3(struct cos_method_site3 *restrict site,
+                       SEL restrict _sel, U32 id1, U32 id2, U32 id3)
+{
+  return
+    COS_SITE_CHECK(site,
+            site->idg == _sel->Behavior.id &&
+            site->id1 == id1 &&
+            site->id2 == id2 &&
+            site->id3 == id3)
+    ? site->fct
+    : cos_method_siteLookup3_(site,_sel,id1,id2,id3);
+
+  COS_UNUSED(cos_method_siteLookup3);
+}
+
+static cos_inline OBJ
+cos_method_siteSend3(struct cos_method_site3 *restrict site,
+                     SEL restrict _sel, OBJ _1, OBJ _2, OBJ _3)
+{
+  IMP3 fct = cos_method_siteLookup3(site,_sel,
+                                    cos_object_id(_1),cos_object_id(_2),cos_object_id(_3));
+  OBJ _ret;
+
+  fct(_sel,_1,_2,_3,0,&_ret);
+
+  return _ret;
+  COS_UNUSED(cos_method_siteSend3);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP4
+cos_method_siteLookup4(struct cos_method_site4 *restrict site,
+                       SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4)
+{
+  return
+    COS_SITE_CHECK(site,
+            site->idg == _sel->Behavior.id &&
+            site->id1 == id1 &&
+            site->id2 == id2 &&
+            site->id3 == id3 &&
+            site->id4 == id4)
+    ? site->fct
+    : cos_method_siteLookup4_(site,_sel,id1,id2,id3,id4);
+
+  COS_UNUSED(cos_method_siteLookup4);
+}
+
+static cos_inline OBJ
+cos_method_siteSend4(struct cos_method_site4 *restrict site,
+                     SEL restrict _sel, OBJ _1, OBJ _2, OBJ _3, OBJ _4)
+{
+  IMP4 fct = cos_method_siteLookup4(site,_sel,
+                                    cos_object_id(_1),cos_object_id(_2),cos_object_id(_3),cos_object_id(_4));
+  OBJ _ret;
+
+  fct(_sel,_1,_2,_3,_4,0,&_ret);
+
+  return _ret;
+  COS_UNUSED(cos_method_siteSend4);
+}
+
+// --------------------------------------------------
+
+static cos_inline IMP5
+cos_method_siteLookup5(struct cos_method_site5 *restrict site,
+                       SEL restrict _sel, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
+{
+  return
+    COS_SITE_CHECK(site,
+            site->idg == _sel->Behavior.id &&
+            site->id1 == id1 &&
+            site->id2 == id2 &&
+            site->id3 == id3 &&
+            site->id4 == id4 &&
+            site->id5 == id5)
+    ? site->fct
+    : cos_method_siteLookup5_(site,_sel,id1,id2,id3,id4,id5);
+
+  COS_UNUSED(cos_method_siteLookup5);
+}
+
+static cos_inline OBJ
+cos_method_siteSend5(struct cos_method_site5 *restrict site,
+                     SEL restrict _sel, OBJ _1, OBJ _2, OBJ _3, OBJ _4, OBJ _5)
+{
+  IMP5 fct = cos_method_siteLookup5(site,_sel,
+                                    cos_object_id(_1),cos_object_id(_2),cos_object_id(_3),cos_object_id(_4),cos_object_id(_5));
+  OBJ _ret;
+
+  fct(_sel,_1,_2,_3,_4,_5,0,&_ret);
+
+  return _ret;
+  COS_UNUSED(cos_method_siteSend5);
+}
+
 #endif // COS_COS_DISPATCH_H
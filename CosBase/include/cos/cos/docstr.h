@@ -141,7 +141,7 @@ COS_CLS_END
 
 #define COS_DOC_DEF(TAG,REF,OBJ,...) \
    /* encode tag into rc */ \
-   {{{ 0, cos_tag_docstr }}, \
+   {{{ 0, COS_RC_INIT(cos_tag_docstr) }}, \
    REF, OBJ, 0 /* no doc */ } \
 
 #else
@@ -149,7 +149,7 @@ COS_CLS_END
 #define COS_DOC_DEF(TAG,REF,OBJ,...) \
 struct MetaDocStr COS_DOC_NAME(TAG) = { \
    /* encode tag into rc */ \
-   {{{ 0, cos_tag_docstr }}, \
+   {{{ 0, COS_RC_INIT(cos_tag_docstr) }}, \
    REF, OBJ, #__VA_ARGS__ } \
 }
 
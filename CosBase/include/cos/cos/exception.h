@@ -225,7 +225,7 @@
 #define COS_EX_TRY \
   { \
     struct cos_exception_context _cos_ex_lcxt; \
-    cos_exception_initContext(&_cos_ex_lcxt); \
+    cos_exception_enterContext(&_cos_ex_lcxt); \
     _cos_ex_lcxt.tag = cos_exception_setjmp(_cos_ex_lcxt.buf); \
     if (_cos_ex_lcxt.tag == cos_tag_try) {
 
@@ -252,7 +252,7 @@
 
 #define COS_EX_ENDTRY \
     } \
-    cos_exception_deinitContext(&_cos_ex_lcxt); \
+    cos_exception_leaveContext(&_cos_ex_lcxt); \
   }
 
 // exception local binding
@@ -295,11 +295,23 @@
 #define COS_EX_UNPRT(O) \
         ((void)(cos_exception_context()->stk = COS_PP_CAT3(_cos_ex_prt_,O,_).prv))
 
-// context saving
-#ifdef sigsetjmp
+/* NOTE-INFO: context saving
+   - TRY saves the context with the signal mask (sigsetjmp(buf,1)), which
+     costs one system call per TRY entry.
+   - Define COS_EXCEPTION_SIGMASK to 0 to save the context without the
+     signal mask (sigsetjmp(buf,0)). The signal mask is then restored on the
+     throw path only by the signal handler installed by cos_signal, which
+     unblocks its signal before throwing ExSignal, so the code must not
+     throw from other signal handlers.
+*/
+#if defined(sigsetjmp) && COS_EXCEPTION_SIGMASK
 #define cos_exception_jmpbuf         sigjmp_buf
 #define cos_exception_setjmp(buf)    sigsetjmp (buf,1)
 #define cos_exception_lngjmp(buf,st) siglongjmp(buf,st)
+#elif defined(sigsetjmp)
+#define cos_exception_jmpbuf         sigjmp_buf
+#define cos_exception_setjmp(buf)    sigsetjmp (buf,0)
+#define cos_exception_lngjmp(buf,st) siglongjmp(buf,st)
 #else
 #define cos_exception_jmpbuf         jmp_buf
 #define cos_exception_setjmp(buf)    setjmp (buf)
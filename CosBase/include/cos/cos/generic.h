@@ -417,7 +417,7 @@ static struct cos_generic_arginfo COS_ARG_INFO(NAME)[] = { \
 \
 struct Generic COS_GEN_NAME(NAME) = { \
   /* encode rank into id (temporally) and tag into rc */ \
-  {{{ (U32)C << COS_ID_RNKSHT, cos_tag_generic }}, \
+  {{{ (U32)C << COS_ID_RNKSHT, COS_RC_INIT(cos_tag_generic) }}, \
   /* id must be zero (init) */ \
    0, \
   /* location */ \
@@ -60,6 +60,17 @@
    - COS_METHOD_TRACE is automatically defined if COS_DEBUG is defined
 */
 
+/* NOTE-USER: profiling defmethod
+
+   - defmethod can be profiled both in release and debug mode using
+     #define COS_METHOD_PROFILE // enable  profile
+     #undef  COS_METHOD_PROFILE // disable profile
+   - each thread counts the calls of the profiled methods and the cycles
+     spent in one call out of COS_METHOD_PROFILE_SAMPLE (see cos/cos/config.h)
+   - counters are merged on demand by cos_symbol_showProfile (report) and
+     cos_symbol_exportProfile (tab separated values), see cos/debug.h
+*/
+
 /* method keywords:
  */
 #ifdef  COS_DISABLE_ALL
@@ -237,7 +248,7 @@ static void COS_MTH_MNAME(COS_FCT_NAME(NAME,CS),TAG,T) \
  \
 struct COS_PP_CAT(Method,C) COS_MTH_MNAME(COS_MTH_NAME(NAME,CS),TAG,T) = { \
    /* encode tag into rc */ \
-  {{{ 0, cos_tag_method }}, \
+  {{{ 0, COS_RC_INIT(cos_tag_method) }}, \
    /* location */ \
    __LINE__, __FILE__, \
    /* reference to generic */ \
@@ -283,6 +294,11 @@ static void COS_MTH_MNAME(COS_FCT_NAME(NAME,CS),TAG,T) \
     (struct Method*)&COS_MTH_MNAME(COS_MTH_NAME(NAME,CS),TAG,T); \
   OBJ _cos_mth_objs[C]; \
   int _cos_mth_line = 0;,/* no trace */) \
+  /* profile variables (if requested) */ \
+  COS_PP_IFNDEF(COS_METHOD_PROFILE)( \
+  static U32 _cos_mth_prf_id = 0; \
+  U64 const _cos_mth_prf_t0 = cos_method_profileEnter(&_cos_mth_prf_id, \
+    (struct Method*)&COS_MTH_MNAME(COS_MTH_NAME(NAME,CS),TAG,T));,/* no profile */) \
   /* arguments variables initialization (if any) */ \
   COS_PP_IF(A)(COS_PP_SEP(COS_PP_MAP(AS,COS_MTH_ARG)),/* no arg */) \
   /* trace entering the method (if requested) */ \
@@ -296,6 +312,9 @@ static void COS_MTH_MNAME(COS_FCT_NAME(NAME,CS),TAG,T) \
   COS_CTR_INVARIANT(C) \
   /* trace exiting the method (if requested) */ \
   COS_PP_IFNDEF(COS_METHOD_TRACE)(COS_MTH_TRC(0,C),/* no trace */) \
+  /* profile exiting the method (if requested) */ \
+  COS_PP_IFNDEF(COS_METHOD_PROFILE)( \
+  cos_method_profileLeave(_cos_mth_prf_id,_cos_mth_prf_t0);,/* no profile */) \
   return; \
   /* avoid compiler warning for unused identifiers */ \
   COS_PP_IF(R)(/* use ret */,COS_UNUSED(_ret);) \
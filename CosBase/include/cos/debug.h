@@ -33,6 +33,8 @@ void cos_symbol_showProperties     (FILE*);
 void cos_symbol_showClassProperties(FILE*, int);
 void cos_symbol_showGenerics       (FILE*);
 void cos_symbol_showMethods        (FILE*);
+void cos_symbol_showProfile        (FILE*);
+void cos_symbol_exportProfile      (FILE*);
 
 // in cos/cos_dispatch.c
 void cos_method_statCache1(FILE*);
@@ -40,12 +42,23 @@ void cos_method_statCache2(FILE*);
 void cos_method_statCache3(FILE*);
 void cos_method_statCache4(FILE*);
 void cos_method_statCache5(FILE*);
+void cos_method_statCaches(FILE*);
+#if COS_METHOD_SHARED
+void cos_method_statShared1(FILE*);
+void cos_method_statShared2(FILE*);
+void cos_method_statShared3(FILE*);
+void cos_method_statShared4(FILE*);
+void cos_method_statShared5(FILE*);
+#endif
 void cos_method_showCache1(FILE*);
 void cos_method_showCache2(FILE*);
 void cos_method_showCache3(FILE*);
 void cos_method_showCache4(FILE*);
 void cos_method_showCache5(FILE*);
 
+// in cos/cos_memory.c
+void cos_mem_stats(FILE*);
+
 // in cos/cos_exception.c
 void cos_exception_showProtectionStack(FILE*);
 
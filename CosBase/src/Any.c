@@ -41,14 +41,26 @@ endmethod
 
 // ----- allocator
 
+static cos_inline void*
+alloc(size_t size)
+{
+#if COS_MEM_AS_DEFAULT // region memory is ignored by free (see Region)
+  struct Region *reg = cos_region();
+
+  if (reg) return cos_region_alloc(reg, size);
+#endif
+
+  return malloc(size);
+}
+
 defmethod(OBJ, galloc, mAny)
-  struct Any *obj = malloc(self->isz);
+  struct Any *obj = alloc(self->isz);
 
   if (!obj)
     THROW(ExBadAlloc); // throw the class (no allocation)
 
   obj->_id = cos_class_id(self);
-  obj->_rc = COS_RC_UNIT;
+  cos_object_setRc((OBJ)obj, COS_RC_UNIT);
 
   retmethod( (OBJ)obj );
 endmethod
@@ -60,11 +72,11 @@ defmethod(OBJ, gallocWithSize, mAny, (size_t)extra)
   if (size - extra != self->isz)
     THROW(gnewWithStr(ExOverflow, "extra size is too large"));
 
-  if (!(obj = malloc(size)))
+  if (!(obj = alloc(size)))
     THROW(ExBadAlloc); // throw the class (no allocation)
 
   obj->_id = cos_class_id(self);
-  obj->_rc = COS_RC_UNIT;
+  cos_object_setRc((OBJ)obj, COS_RC_UNIT);
 
   retmethod( (OBJ)obj );
 endmethod
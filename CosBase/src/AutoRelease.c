@@ -25,19 +25,33 @@
 #include <string.h>
 
 /* NOTE-CONF: AutoRelease storage size
- * Init specifies the number of initial slots allocated for
- * autoreleased objects. Rate specifies the rate at which this storage
- * must grow (e.g. 2.0 means double the size each time it is
- * full). Warn specifies the thresthold for warning about the number of
- * objects autoreleased in a single pool (during expansion only).
+ * Chunk specifies the number of slots of the fixed-size chunks linked
+ * together to store autoreleased objects (about 4kB per chunk). Spare
+ * specifies the number of empty chunks kept per thread for reuse. Warn
+ * specifies the thresthold for warning about the number of objects
+ * autoreleased in a single pool (during expansion only).
  */
-#define COS_AUTORELEASE_INIT 500
-#define COS_AUTORELEASE_RATE 1618     // golden ratio * 1000
-#define COS_AUTORELEASE_WARN 10000000 // 0 = *never*
+#define COS_AUTORELEASE_CHUNK 510
+#define COS_AUTORELEASE_SPARE 8
+#define COS_AUTORELEASE_WARN  10000000 // 0 = *never*
+
+/* NOTE-CONF: Region block size
+ * Size of the blocks allocated by regions, objects larger than a quarter
+ * of this size get their own block.
+ */
+#define COS_REGION_BLOCK 65536
+
+// storage chunk
+struct chunk {
+  struct chunk *prv;
+  OBJ obj[COS_AUTORELEASE_CHUNK];
+};
 
 // private class
 defclass(AutoRelease)
   struct AutoRelease *prv;
+  struct chunk *chk; // current chunk (0 = _stk)
+  U32  cnt;          // number of objects below stk
   OBJ *stk;
   OBJ *top;
   OBJ *end;
@@ -47,16 +61,34 @@ endclass
 
 makclass(AutoRelease);
 
+/* NOTE-USER: Region
+ * A Region is an AutoRelease pool which also provides the memory of the
+ * objects allocated by galloc/gallocWithSize in its thread while it is
+ * the current region (the last one created and not yet released). This
+ * memory is bump allocated, gdealloc of these objects does nothing and
+ * the memory is freed all at once when the region is released, after its
+ * autoreleased objects.
+ * - objects which only own memory of the region need not be released.
+ * - objects must not outlive their region (same as automatic objects).
+ * - requires COS_MEM_AS_DEFAULT, otherwise a Region is an AutoRelease pool.
+ */
+defclass(Region, AutoRelease)
+  struct Region *outer; // previous region
+  char *cur;
+  char *end;
+  void *blk;
+endclass
+
+makclass(Region, AutoRelease);
+
 // -----
 
 useclass(ExBadValue, ExBadAlloc, ExBadMessage);
 
 // -----
 
-STATIC_ASSERT(COS_AUTORELEASE_RATE_must_be_greater_than_3_div_2,
-              COS_AUTORELEASE_RATE >= 1500);
-STATIC_ASSERT(COS_AUTORELEASE_INIT_must_be_greater_than_100,
-              COS_AUTORELEASE_INIT >= 100);
+STATIC_ASSERT(COS_AUTORELEASE_CHUNK_must_be_greater_than_100,
+              COS_AUTORELEASE_CHUNK >= 100);
 STATIC_ASSERT(COS_AUTORELEASE_WARN_is_too_small,
               COS_AUTORELEASE_WARN >= 10000);
 
@@ -85,11 +117,58 @@ pool_set(struct AutoRelease *pool)
   _pool = pool;
 }
 
+__thread struct Region *cos_region_;
+
+static inline void
+region_set(struct Region *reg)
+{
+  cos_region_ = reg;
+}
+
 static void
 _pool_init(void)
 {
 }
 
+static __thread struct chunk *_chunks; // freelist
+static __thread U32 _nchunks;
+#ifdef _OPENMP
+#pragma omp threadprivate(_chunks, _nchunks)
+#endif
+
+static inline struct chunk*
+chunk_get(void)
+{
+  struct chunk *chk = _chunks;
+
+  if (!chk) return malloc(sizeof *chk);
+
+  _chunks = chk->prv, --_nchunks;
+  return chk;
+}
+
+static inline void
+chunk_put(struct chunk *chk)
+{
+  if (_nchunks == COS_AUTORELEASE_SPARE) {
+    free(chk);
+    return;
+  }
+
+  chk->prv = _chunks, _chunks = chk, ++_nchunks;
+}
+
+static void
+chunk_flush(void)
+{
+  struct chunk *chk;
+
+  while ((chk = _chunks))
+    _chunks = chk->prv, free(chk);
+
+  _nchunks = 0;
+}
+
 #else // !defined(_OPENMP) && !COS_HAS_TLS && COS_HAS_POSIX -----------------
 
 static pthread_key_t _pool_key;
@@ -127,41 +206,121 @@ _pool_init(void)
 	ensure( pthread_key_create(&_pool_key, _pool_deinit) == 0 );
 }
 
+struct Region*
+cos_region(void)
+{
+  struct AutoRelease *pool;
+
+  for (pool = pool_get(); pool != &_pool0; pool = pool->prv)
+    if (cos_object_isa((OBJ)pool, classref(Region)))
+      return (struct Region*)pool;
+
+  return 0;
+}
+
+static void
+region_set(struct Region *reg)
+{
+  COS_UNUSED(reg); // found from the pools
+}
+
+// no thread local freelist
+static inline struct chunk*
+chunk_get(void)
+{
+  return malloc(sizeof(struct chunk));
+}
+
+static inline void
+chunk_put(struct chunk *chk)
+{
+  free(chk);
+}
+
+static void
+chunk_flush(void)
+{
+}
+
 #endif // ------------------------------------------------
 
 static void
 enlarge(struct AutoRelease* p)
 {
-  U32 size = p->top - p->stk;
-  U32 new_size;
-  OBJ *stk;
+  struct chunk *chk = chunk_get();
 
-  if (p->stk == p->_stk) {
-    new_size = COS_AUTORELEASE_INIT;
-    stk = malloc(sizeof *stk * new_size);
-    if (stk) memcpy(stk, p->stk, sizeof *stk * size);
+  if (!chk) THROW(ExBadAlloc);
+
+  p->cnt += p->top - p->stk;
+  if (p->cnt >= COS_AUTORELEASE_WARN &&
+      p->cnt %  COS_AUTORELEASE_WARN < COS_AUTORELEASE_CHUNK) // once per WARN
+    cos_debug("pool at %p hold %u autoreleased objects", (void*)p, p->cnt);
+
+  chk->prv = p->chk;
+  p->chk = chk;
+  p->stk = chk->obj;
+  p->top = chk->obj;
+  p->end = chk->obj + COS_AUTORELEASE_CHUNK;
+}
+
+static void
+shrink(struct AutoRelease* p)
+{
+  struct chunk *chk = p->chk;
+
+  p->chk = chk->prv;
+  chunk_put(chk);
+
+  if (p->chk) {
+    p->stk = p->chk->obj;
+    p->end = p->chk->obj + COS_AUTORELEASE_CHUNK;
   } else {
-    new_size = size * (COS_AUTORELEASE_RATE/1000.0);
-    stk = realloc(p->stk, sizeof *stk * new_size);
-    if (size >= COS_AUTORELEASE_WARN)
-      cos_debug("pool at %p hold %u autoreleased objects", (void*)p, size);
+    p->stk = p->_stk;
+    p->end = p->_stk + COS_ARRLEN(p->_stk);
   }
-  
-  if (!stk) THROW(ExBadAlloc);
 
-  p->stk = stk;
-  p->top = stk + size;
-  p->end = stk + new_size;
+  p->top = p->end; // segments below are full
+  p->cnt -= p->end - p->stk;
 }
 
-static cos_inline void
+/* NOTE-INFO: AutoRelease bulk release
+ * Objects are released in reverse order of their autorelease (deinit of
+ * pools content may rely on it) but the grelease method is looked up in a
+ * small per-drain table indexed by class id and called directly, so only
+ * the lookups are saved (releases are not grouped by class). The method
+ * drops the reference itself (see cos_object_decRcLast). Objects
+ * autoreleased while draining are pushed on top and released in turn.
+ */
+struct release_imp {
+  U32  id;
+  IMP1 fct;
+};
+
+static void
 clear(struct AutoRelease *p)
 {
+  struct release_imp imp[32] = {{0,0}};
+  SEL sel = genericref(grelease);
+
   if (p->tmp)
     grelease(p->tmp), p->tmp = 0;
 
-  while (p->top-- > p->stk)
-    grelease(*p->top);
+  for (;;) {
+    while (p->top > p->stk) {
+      OBJ obj = *--p->top;
+      U32 id = cos_object_id(obj);
+      struct release_imp *cel = imp + (id & (COS_ARRLEN(imp)-1));
+
+      if (cel->id != id || !cel->fct)
+        cel->id = id, cel->fct = cos_method_fastLookup1(sel, id);
+
+      cel->fct(sel, obj, 0, 0);
+    }
+
+    if (!p->chk) break;
+
+    shrink(p);
+  }
 }
 
 static cos_inline OBJ
@@ -206,12 +365,10 @@ defmethod(OBJ, gautoRelease, Any)
 endmethod
 
 defmethod(void, grelease, Any)
-  if (cos_object_rc(_1) > COS_RC_UNIT)
-    cos_object_decRc(_1);
-  
-  else
-  if (cos_object_rc(_1) == COS_RC_UNIT) // take care of cyclic dependencies
-    gdealloc(gdeinit(cos_object_setRc(_1, COS_RC_STATIC)));
+  if (cos_object_rc(_1) >= COS_RC_UNIT) {
+    if (cos_object_decRcLast(_1)) // take care of cyclic dependencies
+      gdealloc(gdeinit(cos_object_setRc(_1, COS_RC_STATIC)));
+  }
 
   else
   if (cos_object_rc(_1) < COS_RC_STATIC) // insensitive to STATIC and AUTO
@@ -250,13 +407,15 @@ endmethod
 // -----
 
 defmethod(U32, gsize, AutoRelease)
-  retmethod(self->top - self->stk);
+  retmethod(self->cnt + (self->top - self->stk));
 endmethod
 
 // -----
 
 defmethod(OBJ, ginit, AutoRelease)
   cos_object_setRc(_1, COS_RC_AUTO); // AutoRelease pools are "linked" to the stack
+  self->chk = 0;
+  self->cnt = 0;
   self->stk = self->_stk;
   self->top = self->_stk;
   self->end = self->_stk + COS_ARRLEN(self->_stk);
@@ -273,19 +432,76 @@ defmethod(OBJ, gdeinit, AutoRelease)
   while ((pool = pool_get()) != self)
     grelease((OBJ)pool);
 
-  // release autoReleased objects
+  // release autoReleased objects (return chunks)
   clear(self);
 
-  // free stack
-  if (self->stk != self->_stk)
-    free(self->stk), self->stk = 0;
-
   // remove from top
   pool_set(self->prv);
 
+  // last pool of the thread, free spare chunks
+  if (self->prv == &_pool0)
+    chunk_flush();
+
   retmethod(_1);
 endmethod
 
+// ----- Region
+
+defmethod(OBJ, ginit, Region)
+  next_method(self);
+  self->outer = cos_region();
+  self->cur = 0;
+  self->end = 0;
+  self->blk = 0;
+  region_set(self);
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gdeinit, Region)
+  void **blk, **nxt;
+
+  // release pools above self and autoreleased objects
+  next_method(self);
+
+  region_set(self->outer);
+
+  // free blocks
+  for (blk = self->blk; blk; blk = nxt)
+    nxt = *blk, free(blk);
+
+  self->blk = 0;
+
+  retmethod(_1);
+endmethod
+
+void*
+cos_region_alloc(struct Region *reg, size_t size)
+{
+  size_t len = (cos_mem_get_slot_(size)+1) * cos_mem_node_size_;
+  void **blk;
+
+  if (len < size) return 0; // overflow
+
+  if ((size_t)(reg->end - reg->cur) >= len) {
+    char *mem = reg->cur;
+    reg->cur += len;
+    return cos_mem_region_init_(mem, size);
+  }
+
+  // large object, own block
+  if (len > COS_REGION_BLOCK/4) {
+    if (!(blk = malloc(sizeof *blk + len))) return 0;
+    *blk = reg->blk, reg->blk = blk;
+    return cos_mem_region_init_(blk+1, size);
+  }
+
+  if (!(blk = malloc(COS_REGION_BLOCK))) return 0;
+  *blk = reg->blk, reg->blk = blk;
+  reg->cur = (char*)(blk+1) + len;
+  reg->end = (char*)blk + COS_REGION_BLOCK;
+  return cos_mem_region_init_(blk+1, size);
+}
+
 // -----
 
 defmethod(void, ginitialize, pmAutoRelease)
@@ -324,12 +540,22 @@ void
 cos_autorelease_showStack(FILE *fp)
 {
   struct AutoRelease *pool = pool_get();
+  struct chunk *chk = pool->chk;
+  OBJ *stk = pool->stk;
   OBJ *top = pool->top;
-  U32 i;
+  U32 i = 0;
 
   if (!fp) fp = stderr;
 
-  for (i=0; top-- > pool->stk; i++)
-    fprintf(fp, "AutoRelease[%4u] = %-25s (%4u refs)\n",
-            i, gclassName(*top), gretainCount(*top));
+  for (;;) {
+    for (; top-- > stk; i++)
+      fprintf(fp, "AutoRelease[%4u] = %-25s (%4u refs)\n",
+              i, gclassName(*top), gretainCount(*top));
+
+    if (!chk) break;
+
+    chk = chk->prv;
+    stk = chk ? chk->obj : pool->_stk;
+    top = chk ? chk->obj + COS_AUTORELEASE_CHUNK : pool->_stk + COS_ARRLEN(pool->_stk);
+  }
 }
@@ -219,6 +219,15 @@ ex_signal(int sig)
     cos_abort("[%d] %s", sig, strsignal(sig));
   }
 
+#if COS_HAS_POSIX && !COS_EXCEPTION_SIGMASK
+  { // TRY doesn't restore the signal mask (see cos/cos/exception.h)
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, sig);
+    sigprocmask(SIG_UNBLOCK, &set, 0);
+  }
+#endif
+
   THROW( ginitWithInt(galloc(ExSignal),sig) );
 }
 
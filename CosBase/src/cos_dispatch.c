@@ -21,6 +21,14 @@
 
 void cos_method_clearCaches(void)
 {
+  // call-site caches are dropped by a new site generation, the other threads
+  // caches are untouched (see cos/cos/dispatch.h)
+#ifdef __GNUC__
+  __atomic_add_fetch(&cos_method_siteGeneration_, 1, __ATOMIC_RELEASE);
+#else
+  cos_method_siteGeneration_ += 1;
+#endif
+
   cos_method_clearCache1();
   cos_method_clearCache2();
   cos_method_clearCache3();
@@ -28,6 +36,30 @@ void cos_method_clearCaches(void)
   cos_method_clearCache5();
 }
 
+void cos_method_clearShared(void)
+{
+#if COS_METHOD_SHARED
+  cos_method_clearShared1();
+  cos_method_clearShared2();
+  cos_method_clearShared3();
+  cos_method_clearShared4();
+  cos_method_clearShared5();
+#endif
+}
+
+void cos_method_syncShared(U32 gen)
+{
+#if COS_METHOD_SHARED
+  cos_method_syncShared1(gen);
+  cos_method_syncShared2(gen);
+  cos_method_syncShared3(gen);
+  cos_method_syncShared4(gen);
+  cos_method_syncShared5(gen);
+#else
+  COS_UNUSED(gen);
+#endif
+}
+
 /*
  * ----------------------------------------------------------------------------
  *  Debug Functions
@@ -38,6 +70,326 @@ void cos_method_clearCaches(void)
 
 static const double shift32 = 4294967296.0;
 
+void
+cos_method_statCaches(FILE *fp)
+{
+  cos_method_statCache1(fp);
+  cos_method_statCache2(fp);
+  cos_method_statCache3(fp);
+  cos_method_statCache4(fp);
+  cos_method_statCache5(fp);
+#if COS_METHOD_SHARED
+  cos_method_statShared1(fp);
+  cos_method_statShared2(fp);
+  cos_method_statShared3(fp);
+  cos_method_statShared4(fp);
+  cos_method_statShared5(fp);
+#endif
+}
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+
+// ----- cache stats
+
+void
+cos_method_statCache1(FILE *fp)
+{
+  struct cos_method_cache1 *cache = cos_method_cache1();
+  F64 miss = cache->mis2*shift32 + cache->mis;
+  U32 i, j, n=0, n1=0, n2=0, n3=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot1 *slot = cache->line[i].cel;
+
+    for (j=0; j < COS_METHOD_LINE1 && slot[j].idg; j++) ;
+
+    n += j, n1 += j > 0, n2 += j > 1, n3 += j > 2;
+  }
+
+  i *= COS_METHOD_LINE1;
+  fprintf(fp,"cache1: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
+}
+
+void
+cos_method_statCache2(FILE *fp)
+{
+  struct cos_method_cache2 *cache = cos_method_cache2();
+  F64 miss = cache->mis2*shift32 + cache->mis;
+  U32 i, j, n=0, n1=0, n2=0, n3=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot2 *slot = cache->line[i].cel;
+
+    for (j=0; j < COS_METHOD_LINE2 && slot[j].idg; j++) ;
+
+    n += j, n1 += j > 0, n2 += j > 1, n3 += j > 2;
+  }
+
+  i *= COS_METHOD_LINE2;
+  fprintf(fp,"cache2: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
+}
+
+void
+cos_method_statCache3(FILE *fp)
+{
+  struct cos_method_cache3 *cache = cos_method_cache3();
+  F64 miss = cache->mis2*shift32 + cache->mis;
+  U32 i, j, n=0, n1=0, n2=0, n3=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot3 *slot = cache->line[i].cel;
+
+    for (j=0; j < COS_METHOD_LINE3 && slot[j].idg; j++) ;
+
+    n += j, n1 += j > 0, n2 += j > 1, n3 += j > 2;
+  }
+
+  i *= COS_METHOD_LINE3;
+  fprintf(fp,"cache3: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
+}
+
+void
+cos_method_statCache4(FILE *fp)
+{
+  struct cos_method_cache4 *cache = cos_method_cache4();
+  F64 miss = cache->mis2*shift32 + cache->mis;
+  U32 i, j, n=0, n1=0, n2=0, n3=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot4 *slot = cache->line[i].cel;
+
+    for (j=0; j < COS_METHOD_LINE4 && slot[j].idg; j++) ;
+
+    n += j, n1 += j > 0, n2 += j > 1, n3 += j > 2;
+  }
+
+  i *= COS_METHOD_LINE4;
+  fprintf(fp,"cache4: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
+}
+
+void
+cos_method_statCache5(FILE *fp)
+{
+  struct cos_method_cache5 *cache = cos_method_cache5();
+  F64 miss = cache->mis2*shift32 + cache->mis;
+  U32 i, j, n=0, n1=0, n2=0, n3=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot5 *slot = cache->line[i].cel;
+
+    for (j=0; j < COS_METHOD_LINE5 && slot[j].idg; j++) ;
+
+    n += j, n1 += j > 0, n2 += j > 1, n3 += j > 2;
+  }
+
+  i *= COS_METHOD_LINE5;
+  fprintf(fp,"cache5: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
+}
+
+// ----- cache content
+
+void
+cos_method_showCache1(FILE *fp)
+{
+  struct cos_method_cache1 *cache = cos_method_cache1();
+  U32 i, n=0, d=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot1 *slot = cache->line[i].cel;
+
+    if (slot->idg) {
+      U32 j=0;
+
+      fprintf(fp, "[%3u]", i);
+
+      do {
+        ++j;
+        fprintf(fp, " %s(%s)",
+                cos_generic_get(slot->idg)->str,
+                cos_class_get  (slot->id1)->str);
+        ++slot;
+      } while (j < COS_METHOD_LINE1 && slot->idg);
+
+      fputc('\n', fp);
+
+      n += j;
+      if (j > d) d = j;
+    }
+  }
+
+  i *= COS_METHOD_LINE1;
+  fprintf(fp,"cache 1: slots=%u, cells=%u, load=%.2f\n, maxdepth=%u",i,n,(double)n/i,d);
+}
+
+void
+cos_method_showCache2(FILE *fp)
+{
+  struct cos_method_cache2 *cache = cos_method_cache2();
+  U32 i, n=0, d=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot2 *slot = cache->line[i].cel;
+
+    if (slot->idg) {
+      U32 j=0;
+
+      fprintf(fp, "[%3u]", i);
+
+      do {
+        ++j;
+        fprintf(fp, " %s(%s,%s)",
+                cos_generic_get(slot->idg)->str,
+                cos_class_get  (slot->id1)->str,
+                cos_class_get  (slot->id2)->str);
+        ++slot;
+      } while (j < COS_METHOD_LINE2 && slot->idg);
+
+      fputc('\n', fp);
+
+      n += j;
+      if (j > d) d = j;
+    }
+  }
+
+  i *= COS_METHOD_LINE2;
+  fprintf(fp,"cache 2: slots=%u, cells=%u, load=%.2f, maxdepth=%u\n",i,n,(double)n/i,d);
+}
+
+void
+cos_method_showCache3(FILE *fp)
+{
+  struct cos_method_cache3 *cache = cos_method_cache3();
+  U32 i, n=0, d=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot3 *slot = cache->line[i].cel;
+
+    if (slot->idg) {
+      U32 j=0;
+
+      fprintf(fp, "[%3u]", i);
+
+      do {
+        ++j;
+        fprintf(fp, " %s(%s,%s,%s)",
+                cos_generic_get(slot->idg)->str,
+                cos_class_get  (slot->id1)->str,
+                cos_class_get  (slot->id2)->str,
+                cos_class_get  (slot->id3)->str);
+        ++slot;
+      } while (j < COS_METHOD_LINE3 && slot->idg);
+
+      fputc('\n', fp);
+
+      n += j;
+      if (j > d) d = j;
+    }
+  }
+
+  i *= COS_METHOD_LINE3;
+  fprintf(fp,"cache 3: slots=%u, cells=%u, load=%.2f, maxdepth=%u\n",i,n,(double)n/i,d);
+}
+
+void
+cos_method_showCache4(FILE *fp)
+{
+  struct cos_method_cache4 *cache = cos_method_cache4();
+  U32 i, n=0, d=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot4 *slot = cache->line[i].cel;
+
+    if (slot->idg) {
+      U32 j=0;
+
+      fprintf(fp, "[%3u]", i);
+
+      do {
+        ++j;
+        fprintf(fp, " %s(%s,%s,%s,%s)",
+                cos_generic_get(slot->idg)->str,
+                cos_class_get  (slot->id1)->str,
+                cos_class_get  (slot->id2)->str,
+                cos_class_get  (slot->id3)->str,
+                cos_class_get  (slot->id4)->str);
+        ++slot;
+      } while (j < COS_METHOD_LINE4 && slot->idg);
+
+      fputc('\n', fp);
+
+      n += j;
+      if (j > d) d = j;
+    }
+  }
+
+  i *= COS_METHOD_LINE4;
+  fprintf(fp,"cache 4: slots=%u, cells=%u, load=%.2f, maxdepth=%u\n",i,n,(double)n/i,d);
+}
+
+void
+cos_method_showCache5(FILE *fp)
+{
+  struct cos_method_cache5 *cache = cos_method_cache5();
+  U32 i, n=0, d=0;
+
+  if (!fp) fp = stderr;
+
+  for (i=0; i <= cache->msk; i++) {
+    struct cos_method_slot5 *slot = cache->line[i].cel;
+
+    if (slot->idg) {
+      U32 j=0;
+
+      fprintf(fp, "[%3u]", i);
+
+      do {
+        ++j;
+        fprintf(fp, " %s(%s,%s,%s,%s,%s)",
+                cos_generic_get(slot->idg)->str,
+                cos_class_get  (slot->id1)->str,
+                cos_class_get  (slot->id2)->str,
+                cos_class_get  (slot->id3)->str,
+                cos_class_get  (slot->id4)->str,
+                cos_class_get  (slot->id5)->str);
+        ++slot;
+      } while (j < COS_METHOD_LINE5 && slot->idg);
+
+      fputc('\n', fp);
+
+      n += j;
+      if (j > d) d = j;
+    }
+  }
+
+  i *= COS_METHOD_LINE5;
+  fprintf(fp,"cache 5: slots=%u, cells=%u, load=%.2f, maxdepth=%u\n",i,n,(double)n/i,d);
+}
+
+#else // COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_CHAIN
+
 // ----- cache stats
 
 void
@@ -62,8 +414,8 @@ cos_method_statCache1(FILE *fp)
   }
 
   n = n1+n2+n3;
-  fprintf(fp,"cache1: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u]\n",
-          i,n,miss,(double)n/i,n1,n2,n3);
+  fprintf(fp,"cache1: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
 }
 
 void
@@ -88,8 +440,8 @@ cos_method_statCache2(FILE *fp)
   }
 
   n = n1+n2+n3;
-  fprintf(fp,"cache2: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u]\n",
-          i,n,miss,(double)n/i,n1,n2,n3);
+  fprintf(fp,"cache2: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
 }
 
 void
@@ -114,8 +466,8 @@ cos_method_statCache3(FILE *fp)
   }
 
   n = n1+n2+n3;
-  fprintf(fp,"cache3: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u]\n",
-          i,n,miss,(double)n/i,n1,n2,n3);
+  fprintf(fp,"cache3: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
 }
 
 void
@@ -140,8 +492,8 @@ cos_method_statCache4(FILE *fp)
   }
 
   n = n1+n2+n3;
-  fprintf(fp,"cache4: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u]\n",
-          i,n,miss,(double)n/i,n1,n2,n3);
+  fprintf(fp,"cache4: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
 }
 
 void
@@ -166,8 +518,8 @@ cos_method_statCache5(FILE *fp)
   }
 
   n = n1+n2+n3;
-  fprintf(fp,"cache5: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u]\n",
-          i,n,miss,(double)n/i,n1,n2,n3);
+  fprintf(fp,"cache5: slots=%6u, cells=%4u, miss=%g, load=%.2f, depth=[%u,%u,%u], rehash=%u, shared=%u\n",
+          i,n,miss,(double)n/i,n1,n2,n3,cache->rhs,cache->shr);
 }
 
 // ----- cache content
@@ -203,7 +555,7 @@ cos_method_showCache1(FILE *fp)
     }
   }
 
-  fprintf(fp,"cache 1: slots=%u, cells=%u, load=%.2f\n, maxdepth=%u",i,n,(double)n/i,d);
+  fprintf(fp,"cache 1: slots=%u, cells=%u, load=%.2f, maxdepth=%u\n",i,n,(double)n/i,d);
 }
 
 void
@@ -351,3 +703,5 @@ cos_method_showCache5(FILE *fp)
 
   fprintf(fp,"cache 5: slots=%u, cells=%u, load=%.2f, maxdepth=%u\n",i,n,(double)n/i,d);
 }
+
+#endif // COS_METHOD_CACHE_LAYOUT
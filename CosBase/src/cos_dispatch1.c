@@ -19,14 +19,21 @@
 
 #include <cos/Object.h>
 #include <cos/gen/message.h>
+#include <cos/debug.h>
 
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 
 /* NOTE-CONF: Method dispatcher cache max slots (Method lookup)
  * The slots specifies the maximum number of entries for each cache.
  * This number must be of the form 2^n > 512.
  * Number of slots increase upon collision until maxslot is reached.
  * The maxdepth (e.g. memory) of each slot is fixed to 3.
+ * Cells are allocated from one arena per cache and moved into the larger
+ * table when the cache grows (see COS_METHOD_CACHE_REHASH).
+ * With COS_METHOD_CACHE_PACK, slots are packed in lines of 64 bytes probed
+ * linearly and the maxdepth is the number of slots per line.
  */
 
 #ifndef COS_METHOD_MAXSLOT1
@@ -43,13 +50,19 @@ STATIC_ASSERT(COS_METHOD_CACHE1_must_have_a_size_of_64_bytes,
 
 static void init(SEL,OBJ,void*,void*);
 
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+static struct cos_method_line1 cache_empty[1] = {{{ { 0,0,init } }}};
+#define CACHE_EMPTY cache_empty
+#else
 static struct cos_method_slot1 sentinel = { 0,0,init,&sentinel };
 static struct cos_method_slot1 *cache_empty = &sentinel;
+#define CACHE_EMPTY (&cache_empty)
+#endif
 
 #if defined(_OPENMP) || COS_HAS_TLS || !COS_HAS_POSIX // --------------------
 
 __thread struct cos_method_cache1 cos_method_cache1_
-  __attribute__((aligned(64))) = { &cache_empty, 0, 0, 0, {0} };
+  __attribute__((aligned(64))) = { CACHE_EMPTY, 0, 0, 0, 0, 0, 0, 0, 0, 0, {0} };
 
 #else // !defined(_OPENMP) && !COS_HAS_TLS && COS_HAS_POSIX -----------------
       
@@ -75,10 +88,21 @@ cos_method_cache1_init(void)
   if (!(cache = malloc(sizeof *cache)))
 	  cos_abort("out of memory while creating dispatcher cache1");
 
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+  cache->line = cache_empty;
+  cache->mem  = 0;
+#else
   cache->slot = &cache_empty;
+  cache->cel  = 0;
+#endif
 	cache->msk  = 0;
 	cache->mis  = 0;
 	cache->mis2 = 0;
+  cache->cnt  = 0;
+  cache->cap  = 0;
+  cache->rhs  = 0;
+  cache->shr  = 0;
+  cache->gen  = 0;
 
   if ( pthread_setspecific(cos_method_cache1_key, cache) )
 	  cos_abort("unable to initialize dispatcher cache1");
@@ -95,56 +119,526 @@ init(SEL _sel, OBJ _1, void *_arg, void *_ret)
   forward_message(_1);
 }
 
-static inline U32
-first_cell(struct cos_method_slot1 **slot)
+#if COS_METHOD_SHARED // --------------------------------------------------
+
+/* NOTE-INFO: shared dispatch table
+ * Process-wide table of the methods resolved by all threads, probed on a
+ * thread cache miss before cos_method_get1 (the binary search). Readers
+ * are lock-free: a writer claims an empty cell with a CAS on idg, stores
+ * the ids and publishes fct with a release store, so a reader seeing fct
+ * also sees the ids. cos_method_syncShared1 unpublishes the cells of
+ * the reloaded generics and rebuilds the table without them (no dead
+ * cells). The table is doubled or rebuilt by one writer at a time and a
+ * publication racing with the copy is republished into the new table.
+ * Old tables are retired until cos_method_clearShared1, as readers may
+ * still probe them. Growth stops at COS_METHOD_SHARED_MAXSLOT1.
+ */
+
+#ifndef COS_METHOD_SHARED_MAXSLOT1
+#define COS_METHOD_SHARED_MAXSLOT1 65536
+#endif
+
+STATIC_ASSERT(COS_METHOD_SHARED_MAXSLOT1_must_be_a_pow2_greater_than_512,
+              COS_METHOD_SHARED_MAXSLOT1 > 512 &&
+              (COS_METHOD_SHARED_MAXSLOT1 & (COS_METHOD_SHARED_MAXSLOT1-1)) == 0);
+
+struct shared_cell1 {
+  U32  idg, id1;
+  IMP1 fct;
+};
+
+struct shared_table1 {
+  struct shared_table1 *old; // retired table
+  U32 msk, cnt;
+  struct shared_cell1 cel[];
+};
+
+static struct shared_table1 *shared_table;
+static U32                   shared_grow;
+
+static IMP1
+shared_get(U32 idg, U32 id1)
 {
-  struct cos_method_slot1 *sl = *slot;
-  U32 n = 0;
+  struct shared_table1 *tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+  U32 i, k;
+
+  if (tbl) {
+    k = cos_method_hkey1(idg,id1);
 
-  while (sl != &sentinel) {
-    if (sl < *slot) *slot = sl;
-    sl = sl->nxt, ++n;
+    for (i = 0; i <= tbl->msk; i++, k++) {
+      struct shared_cell1 *cel = tbl->cel + (k & tbl->msk);
+      U32 cid = __atomic_load_n(&cel->idg, __ATOMIC_ACQUIRE);
+
+      if (!cid) break;
+
+      if (cid == idg) {
+        IMP1 fct = __atomic_load_n(&cel->fct, __ATOMIC_ACQUIRE);
+        if (fct && cel->id1 == id1)
+          return fct;
+      }
+    }
   }
 
-  return n;
+  return 0;
 }
 
 static void
-enlarge_slot(struct cos_method_slot1 **slot)
+shared_copy(struct shared_table1 *tbl, U32 n)
 {
-  U32 i, n = first_cell(slot);
+  struct shared_table1 *new;
+  U32 i;
 
-  *slot = realloc(n ? *slot : 0, (n+1) * sizeof **slot);
-  if (!*slot)
+  new = calloc(1, sizeof *new + n * sizeof *new->cel);
+  if (!new)
     cos_abort("method1_lookup: out of memory");
 
-  for (i = 0; i < (n+1); i++) {
-    (*slot)[i].nxt = *slot+i+1; // Ok: see C99 6.5.6-8
-    (*slot)[i].fct = init;
-    (*slot)[i].idg = 0;
-    (*slot)[i].id1 = 0;
+  new->old = tbl;
+  new->msk = n-1;
+
+  // copy live cells (new is not visible yet)
+  if (tbl)
+    for (i = 0; i <= tbl->msk; i++) {
+      struct shared_cell1 *src = tbl->cel + i, *dst;
+      IMP1 fct = __atomic_load_n(&src->fct, __ATOMIC_SEQ_CST);
+      U32 k;
+
+      if (!fct) continue;
+
+      k = cos_method_hkey1(src->idg,src->id1);
+      for (dst = new->cel + (k & (n-1)); dst->idg; dst = new->cel + (++k & (n-1))) ;
+
+      dst->idg = src->idg;
+      dst->id1 = src->id1;
+      dst->fct = fct;
+      new->cnt++;
+    }
+
+  __atomic_store_n(&shared_table, new, __ATOMIC_SEQ_CST);
+}
+
+static void
+shared_enlarge(struct shared_table1 *tbl)
+{
+  // one writer at a time, others skip
+  if (__atomic_exchange_n(&shared_grow, 1, __ATOMIC_SEQ_CST))
+    return;
+
+  if (tbl == __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE))
+    shared_copy(tbl, tbl ? (tbl->msk+1)*2 : 512);
+
+  __atomic_store_n(&shared_grow, 0, __ATOMIC_SEQ_CST);
+}
+
+static void
+shared_put(U32 idg, U32 id1, IMP1 fct)
+{
+  struct shared_table1 *tbl;
+  U32 i, k, cnt;
+
+retry:
+  tbl = __atomic_load_n(&shared_table, __ATOMIC_SEQ_CST);
+
+  // keep load below 1/2 until SHARED_MAXSLOT is reached
+  cnt = tbl ? __atomic_load_n(&tbl->cnt, __ATOMIC_RELAXED) : 0;
+  if (!tbl || (cnt*2 > tbl->msk && tbl->msk < COS_METHOD_SHARED_MAXSLOT1-1)) {
+    shared_enlarge(tbl);
+    tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+    if (!tbl) return;
+    cnt = __atomic_load_n(&tbl->cnt, __ATOMIC_RELAXED);
+  }
+
+  // table is full, keep probes short
+  if (cnt*4 > tbl->msk*3)
+    return;
+
+  k = cos_method_hkey1(idg,id1);
+
+  for (i = 0; i <= tbl->msk; i++, k++) {
+    struct shared_cell1 *cel = tbl->cel + (k & tbl->msk);
+    U32 cid = 0;
+
+    if (__atomic_compare_exchange_n(&cel->idg, &cid, idg, 0,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      cel->id1 = id1;
+      __atomic_store_n(&cel->fct, fct, __ATOMIC_SEQ_CST);
+      __atomic_add_fetch(&tbl->cnt, 1, __ATOMIC_RELAXED);
+      goto published;
+    }
+
+    // already published by another thread
+    if (cid == idg && __atomic_load_n(&cel->fct, __ATOMIC_ACQUIRE) &&
+        cel->id1 == id1)
+      return;
   }
+  return;
 
-  (*slot)[n].nxt = &sentinel;
+published:
+  // a copy may have missed the cell, republish it into the new table
+  while (__atomic_load_n(&shared_grow, __ATOMIC_SEQ_CST)) ;
+  if (tbl != __atomic_load_n(&shared_table, __ATOMIC_SEQ_CST))
+    goto retry;
 }
 
+static IMP1
+get_method(SEL _sel, U32 id1)
+{
+  IMP1 fct = shared_get(_sel->Behavior.id,id1);
+
+  if (fct)
+    cos_method_cache1()->shr++;
+
+  else {
+    fct = cos_method_get1(_sel,id1);
+    if (fct)
+      shared_put(_sel->Behavior.id,id1,fct);
+  }
+
+  return fct;
+}
+
+void
+cos_method_clearShared1(void)
+{
+  struct shared_table1 *tbl, *old;
+
+  tbl = __atomic_exchange_n(&shared_table, 0, __ATOMIC_ACQ_REL);
+
+  for (; tbl; tbl = old)
+    old = tbl->old, free(tbl);
+}
+
+void
+cos_method_syncShared1(U32 gen)
+{
+  struct shared_table1 *tbl;
+  U32 i, n = 0;
+
+  // one writer at a time, wait for a running growth
+  while (__atomic_exchange_n(&shared_grow, 1, __ATOMIC_SEQ_CST)) ;
+
+  tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+
+  if (tbl) {
+    // unpublish the cells of generics which gained methods since gen
+    for (i = 0; i <= tbl->msk; i++) {
+      struct shared_cell1 *cel = tbl->cel + i;
+      U32 idg = __atomic_load_n(&cel->idg, __ATOMIC_ACQUIRE);
+
+      if (idg && cos_method_stamp(idg) > gen &&
+          __atomic_exchange_n(&cel->fct, 0, __ATOMIC_SEQ_CST))
+        n++;
+    }
+
+    // rebuild the table without the dead cells
+    if (n)
+      shared_copy(tbl, tbl->msk+1);
+  }
+
+  __atomic_store_n(&shared_grow, 0, __ATOMIC_SEQ_CST);
+}
+
+void
+cos_method_statShared1(FILE *fp)
+{
+  struct shared_table1 *tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+  U32 n = 0;
+
+  if (!fp) fp = stderr;
+
+  if (tbl) {
+    struct shared_table1 *old;
+    for (old = tbl->old; old; old = old->old) n++;
+  }
+
+  fprintf(fp, "shared1: slots=%6u, cells=%5u, retired=%u\n",
+          tbl ? tbl->msk+1 : 0, tbl ? tbl->cnt : 0, n);
+}
+
+#else
+
+#define get_method(...) cos_method_get1(__VA_ARGS__)
+
+#endif // ------------------------------------------------
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK // -------------------
+
 static void
-enlarge_cache(void)
+enlarge_cache(struct cos_method_cache1 *cache)
+{
+  struct cos_method_line1 *line;
+  void *mem;
+  U32 n;
+
+  n = cache->msk ? (cache->msk+1)*2 : 512/COS_METHOD_LINE1;
+
+  // lines must be aligned on cache line
+  mem = malloc(n * sizeof *line + 63);
+  if (!mem)
+    cos_abort("method1_lookup: out of memory");
+
+  line = (void*)(((size_t)mem + 63) & ~(size_t)63);
+  memset(line, 0, n * sizeof *line);
+
+  if (cache->line != cache_empty) {
+#if COS_METHOD_CACHE_REHASH
+    U32 i;
+
+    // move live slots into the new lines (order is kept)
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot1 *cel = cache->line[i].cel;
+      U32 j, k;
+
+      for (j = 0; j < COS_METHOD_LINE1 && cel[j].idg; j++) {
+        struct cos_method_slot1 *dst =
+          line[cos_method_hkey1(cel[j].idg,cel[j].id1) & (n-1)].cel;
+
+        for (k = 0; dst[k].idg; k++) ;
+        dst[k] = cel[j];
+      }
+    }
+    if (cache->cnt) cache->rhs++;
+#else
+    // forget all slots (flush)
+    cache->cnt = 0;
+#endif
+    free(cache->mem);
+  }
+
+  cache->line = line;
+  cache->mem  = mem;
+  cache->msk  = n-1;
+  cache->cap  = n*COS_METHOD_LINE1;
+}
+
+static struct cos_method_slot1*
+load_method(SEL _sel, U32 id1, BOOL load)
+{
+  struct cos_method_cache1 *cache;
+  struct cos_method_slot1 *slot;
+  IMP1 fct;
+  U32 key;
+
+  // search method
+  fct = get_method(_sel,id1);
+  if (!fct) {
+    if (!load) return 0;
+    fct = cos_method_get1(genericref(gunrecognizedMessage1),id1);
+    if (!fct)
+      cos_abort("method1_lookup: %s not found for class %s",
+                "gunrecognizedMessage1", cos_class_get(id1)->str);
+  }
+
+  // get line
+  key   = cos_method_hkey1(_sel->Behavior.id,id1);
+  cache = cos_method_cache1();
+  slot  = cache->line[key & cache->msk].cel;
+
+  // get slot (grow at most once per miss and only above half load)
+  if (cache->line == cache_empty ||
+      (slot[COS_METHOD_LINE1-1].idg && cache->cnt*2 > cache->msk &&
+       cache->msk < COS_METHOD_MAXSLOT1/COS_METHOD_LINE1-1)) {
+    // try to ensure O(1) until MAXSLOT is reached, collisions replace the oldest slot
+    enlarge_cache(cache);
+    slot = cache->line[key & cache->msk].cel;
+  }
+
+  if (!slot[COS_METHOD_LINE1-1].idg)
+    cache->cnt++;
+  else
+    // line is full (last slot is forgotten)
+    if (!++cache->mis) cache->mis2++;
+
+  // most recent slot first
+  memmove(slot+1, slot, (COS_METHOD_LINE1-1) * sizeof *slot);
+
+  // load fct in the cache
+  slot->fct = fct;
+  slot->idg = _sel->Behavior.id;
+  slot->id1 = id1;
+
+  return slot;
+}
+
+#define CACHE_GET_SLOT() \
+  U32 key = cos_method_hkey1(_sel->Behavior.id,id1); \
+  struct cos_method_cache1 *restrict cache = cos_method_cache1(); \
+  struct cos_method_slot1 *restrict slot = cache->line[key & cache->msk].cel;
+
+#define CACHE_MTH_LOAD(LOAD) \
+  slot = load_method(_sel,id1,LOAD);
+
+#define CACHE_TST_LINE(I) \
+  for (i = I; i < COS_METHOD_LINE1; i++) \
+    if (_sel->Behavior.id  == slot[i].idg && \
+                       id1 == slot[i].id1) { \
+      slot += i; \
+      goto ret; \
+    }
+
+IMP1
+cos_method_lookup1(SEL restrict _sel,
+                   U32 id1)
+{
+  U32 i;
+  CACHE_GET_SLOT();
+
+  CACHE_TST_LINE(0);
+  CACHE_MTH_LOAD(YES);
+
+ ret:
+  return slot->fct;
+}
+
+IMP1
+cos_method_fastLookup1_(struct cos_method_slot1 *restrict slot,
+                        SEL restrict _sel,
+                        U32 id1)
+{
+  U32 i;
+
+  CACHE_TST_LINE(1);
+  CACHE_MTH_LOAD(YES);
+
+ ret:
+  return slot->fct;
+}
+
+BOOL
+cos_method_understand1_(struct cos_method_slot1 *restrict slot,
+                        SEL restrict _sel,
+                        U32 id1)
+{
+  U32 i;
+
+  CACHE_TST_LINE(1);
+  CACHE_MTH_LOAD(NO);
+
+ ret:
+  return slot != 0;
+}
+
+void
+cos_method_clearCache1(void)
 {
   struct cos_method_cache1 *cache = cos_method_cache1();
+
+  if (cache->line != cache_empty) {
+    free(cache->mem);
+    cache->line = cache_empty;
+    cache->mem  = 0;
+    cache->msk  = 0;
+    cache->mis  = 0;
+    cache->mis2 = 0;
+    cache->cnt  = 0;
+    cache->cap  = 0;
+    cache->rhs  = 0;
+    cache->shr  = 0;
+  }
+}
+
+void
+cos_method_syncCache1(struct cos_method_cache1 *cache)
+{
+  U32 gen = cos_method_generation_;
+  U32 i, j, k;
+
+  // drop the slots of generics which gained methods (lines stay packed)
+  if (cache->line != cache_empty)
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot1 *cel = cache->line[i].cel;
+
+      for (j = k = 0; j < COS_METHOD_LINE1 && cel[j].idg; j++)
+        if (cos_method_stamp(cel[j].idg) <= cache->gen)
+          cel[k++] = cel[j];
+
+      memset(cel+k, 0, (j-k) * sizeof *cel);
+      cache->cnt -= j-k;
+    }
+
+  cache->gen = gen;
+}
+
+#else // COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_CHAIN ----------------
+
+static void
+enlarge_arena(struct cos_method_cache1 *cache)
+{
+  struct cos_method_slot1 *cel;
+  U32 i, n;
+
+  n = cache->cap ? cache->cap*2 : cache->msk+1;
+
+  cel = malloc(n * sizeof *cel);
+  if (!cel)
+    cos_abort("method1_lookup: out of memory");
+
+  if (cache->cnt) {
+    memcpy(cel, cache->cel, cache->cnt * sizeof *cel);
+
+    // relocate links into the new arena
+    for (i = 0; i < cache->cnt; i++)
+      if (cel[i].nxt != &sentinel)
+        cel[i].nxt = cel + (cel[i].nxt - cache->cel);
+
+    for (i = 0; i <= cache->msk; i++)
+      if (cache->slot[i] != &sentinel)
+        cache->slot[i] = cel + (cache->slot[i] - cache->cel);
+  }
+
+  free(cache->cel);
+  cache->cel = cel;
+  cache->cap = n;
+}
+
+static void
+enlarge_slot(struct cos_method_cache1 *cache, struct cos_method_slot1 **slot)
+{
+  struct cos_method_slot1 *cel;
+
+  if (cache->cnt == cache->cap)
+    enlarge_arena(cache);
+
+  cel = cache->cel + cache->cnt++;
+  cel->nxt = *slot;
+  *slot = cel;
+}
+
+static void
+enlarge_cache(struct cos_method_cache1 *cache)
+{
+  struct cos_method_slot1 **slot;
   U32 i, n;
 
   n = cache->msk ? (cache->msk+1)*2 : 512;
-  cos_method_clearCache1();
 
-  cache->slot = malloc(n * sizeof *cache->slot);
-  if (!cache->slot)
+  slot = malloc(n * sizeof *slot);
+  if (!slot)
     cos_abort("method1_lookup: out of memory");
 
   for (i = 0; i < n; i++)
-    cache->slot[i] = &sentinel;
+    slot[i] = &sentinel;
 
-  cache->msk = n-1;
+  if (cache->slot != &cache_empty) {
+#if COS_METHOD_CACHE_REHASH
+    // move live cells into the new slots
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot1 *cel = cache->slot[i], *nxt;
+
+      for (; cel != &sentinel; cel = nxt) {
+        U32 key = cos_method_hkey1(cel->idg,cel->id1) & (n-1);
+        nxt = cel->nxt, cel->nxt = slot[key], slot[key] = cel;
+      }
+    }
+    if (cache->cnt) cache->rhs++;
+#else
+    // forget all cells (flush)
+    cache->cnt = 0;
+#endif
+    free(cache->slot);
+  }
+
+  cache->slot = slot;
+  cache->msk  = n-1;
 }
 
 static struct cos_method_slot1**
@@ -156,7 +650,7 @@ load_method(SEL _sel, U32 id1, BOOL load)
   U32 key;
 
   // search method
-  fct = cos_method_get1(_sel,id1);
+  fct = get_method(_sel,id1);
   if (!fct) {
     if (!load) return 0;
     fct = cos_method_get1(genericref(gunrecognizedMessage1),id1);
@@ -170,32 +664,24 @@ load_method(SEL _sel, U32 id1, BOOL load)
 	cache = cos_method_cache1();
   slot  = cache->slot + (key & cache->msk);
 
-  // get cell
-  if (cache->msk < COS_METHOD_MAXSLOT1-1) {
-    if (*slot != &sentinel || slot == &cache_empty) {
-      // try to ensure O(1) until MAXSLOT is reached
-      enlarge_cache();
-      slot = cache->slot + (key & cache->msk);
-    }
-    // allocate 1st cell
-    enlarge_slot(slot);
-
-  } else {
-    // 1st cell is never free
-    if ((*slot)->nxt->fct == 0) {
-      // 2nd cell exists and is not used
-      struct cos_method_slot1 *tmp = *slot;
-      *slot = tmp->nxt, tmp->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
-
-    } else if ((*slot)->nxt->nxt != &sentinel) {
-      // 3rd cell exists and may be used (previous is forgotten)
-      struct cos_method_slot1 *tmp = *slot;
-      *slot = tmp->nxt->nxt, tmp->nxt->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
-      if (!++cache->mis) cache->mis2++;
-
-    } else
-      // allocate one more cell
-      enlarge_slot(slot);
+  // get cell (grow at most once per miss and only above half load)
+  if (slot == &cache_empty ||
+      (*slot != &sentinel && cache->cnt*2 > cache->msk &&
+       cache->msk < COS_METHOD_MAXSLOT1-1)) {
+    // try to ensure O(1) until MAXSLOT is reached, collisions are chained
+    enlarge_cache(cache);
+    slot = cache->slot + (key & cache->msk);
+  }
+
+  if ((*slot)->nxt->nxt == &sentinel)
+    // less than 3 cells, allocate one more cell
+    enlarge_slot(cache,slot);
+
+  else {
+    // 3rd cell exists and is used (previous is forgotten)
+    struct cos_method_slot1 *tmp = *slot;
+    *slot = tmp->nxt->nxt, tmp->nxt->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
+    if (!++cache->mis) cache->mis2++;
   }
 
   // load fct in the cache
@@ -278,21 +764,121 @@ cos_method_understand1_(struct cos_method_slot1 *restrict*restrict slot,
 void
 cos_method_clearCache1(void)
 {
-	struct cos_method_cache1 *cache = cos_method_cache1();
-  U32 i;
+  struct cos_method_cache1 *cache = cos_method_cache1();
 
   if (cache->slot != &cache_empty) {
-    for (i = 0; i <= cache->msk; i++) {
-      struct cos_method_slot1 **slot = cache->slot+i;
-
-      if (*slot != &sentinel)
-        first_cell(slot), free(*slot);
-    }
-
     free(cache->slot);
+    free(cache->cel);
     cache->slot = &cache_empty;
+    cache->cel  = 0;
     cache->msk  = 0;
     cache->mis  = 0;
     cache->mis2 = 0;
+    cache->cnt  = 0;
+    cache->cap  = 0;
+    cache->rhs  = 0;
+    cache->shr  = 0;
   }
 }
+
+void
+cos_method_syncCache1(struct cos_method_cache1 *cache)
+{
+  U32 gen = cos_method_generation_;
+  struct cos_method_slot1 *cel, *old, **dst;
+  U32 i, n = 0;
+
+  // drop the cells of generics which gained methods (compact the arena)
+  if (cache->cnt) {
+    cel = malloc(cache->cap * sizeof *cel);
+    if (!cel)
+      cos_abort("method1_lookup: out of memory");
+
+    for (i = 0; i <= cache->msk; i++) {
+      dst = cache->slot + i;
+      for (old = *dst; old != &sentinel; old = old->nxt)
+        if (old->idg && cos_method_stamp(old->idg) <= cache->gen)
+          cel[n] = *old, *dst = cel+n, dst = &cel[n++].nxt;
+      *dst = &sentinel;
+    }
+
+    free(cache->cel);
+    cache->cel = cel;
+    cache->cnt = n;
+  }
+
+  cache->gen = gen;
+}
+
+#endif // ------------------------------------------------
+
+// ----- call-site cache
+
+/* NOTE-INFO: call-site cache
+ * Called on site miss (see cos/cos/dispatch.h). The signature of the generic
+ * is checked here once per miss, the site is refilled from the thread cache
+ * and stamped with the site generation read before the lookup, such that a
+ * module loaded meanwhile invalidates it. Sites are not shared without TLS.
+ */
+
+IMP1
+cos_method_siteLookup1_(struct cos_method_site1 *site, SEL _sel, U32 id1)
+{
+  U32  gen = cos_method_siteGeneration_;
+  IMP1 fct;
+
+  if (COS_GEN_RNK(_sel) != 1 || COS_GEN_NARG(_sel) || COS_GEN_VARG(_sel) ||
+      !COS_GEN_ORET(_sel))
+    cos_abort("method1_lookup: %s is not a message of 1 receiver(s) returning OBJ",
+              _sel->str);
+
+  fct = cos_method_fastLookup1(_sel, id1);
+
+#if defined(_OPENMP) || !COS_HAS_TLS
+  COS_UNUSED(site,gen);
+#else
+  site->gen = gen;
+  site->idg = _sel->Behavior.id;
+  site->id1 = id1;
+  site->fct = fct;
+#endif
+
+  return fct;
+}
+
+// ----- batched send
+
+/* NOTE-INFO: batched send
+ * res[i] = sel(rcv1[i],..,arg) for i in [0,n), strides count OBJs. Methods
+ * are looked up once per run of receivers with the same classes, which
+ * makes homogeneous collections pay one lookup. The generic must return
+ * void or OBJ, res can be null to discard the returned values.
+ * Returns the number of lookups.
+ */
+
+U32
+cos_method_send1(SEL _sel, U32 n,
+                 OBJ const *rcv1, I32 rcv1_s,
+                 void *_arg, OBJ *res, I32 res_s)
+{
+  U32 id1 = 0, run = 0;
+  IMP1 fct = 0;
+  OBJ _1, ret = 0;
+
+  for (; n; n--) {
+    _1 = *rcv1;
+
+    if (cos_object_id(_1) != id1) {
+      id1 = cos_object_id(_1);
+      fct = cos_method_fastLookup1(_sel, id1);
+      ++run;
+    }
+
+    fct(_sel, _1, _arg, res ? res : &ret);
+
+    rcv1 += rcv1_s;
+    if (res) res += res_s;
+  }
+
+  return run;
+}
@@ -19,14 +19,21 @@
 
 #include <cos/Object.h>
 #include <cos/gen/message.h>
+#include <cos/debug.h>
 
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 
 /* NOTE-CONF: Method dispatcher cache max slots (Method lookup)
  * The slots specifies the maximum number of entries for each cache.
  * This number must be of the form 2^n > 512.
  * Number of slots increase upon collision until maxslot is reached.
  * The maxdepth (e.g. memory) of each slot is fixed to 3.
+ * Cells are allocated from one arena per cache and moved into the larger
+ * table when the cache grows (see COS_METHOD_CACHE_REHASH).
+ * With COS_METHOD_CACHE_PACK, slots are packed in lines of 64 bytes probed
+ * linearly and the maxdepth is the number of slots per line.
  */
 
 #ifndef COS_METHOD_MAXSLOT2
@@ -43,13 +50,19 @@ STATIC_ASSERT(COS_METHOD_CACHE2_must_have_a_size_of_64_bytes,
 
 static void init(SEL,OBJ,OBJ,void*,void*);
 
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+static struct cos_method_line2 cache_empty[1] = {{{ { 0,0,0,init } }}};
+#define CACHE_EMPTY cache_empty
+#else
 static struct cos_method_slot2 sentinel = { 0,0,0,init,&sentinel };
 static struct cos_method_slot2 *cache_empty = &sentinel;
+#define CACHE_EMPTY (&cache_empty)
+#endif
 
 #if defined(_OPENMP) || COS_HAS_TLS || !COS_HAS_POSIX // --------------------
 
 __thread struct cos_method_cache2 cos_method_cache2_
-  __attribute__((aligned(64))) = { &cache_empty, 0, 0, 0, {0} };
+  __attribute__((aligned(64))) = { CACHE_EMPTY, 0, 0, 0, 0, 0, 0, 0, 0, 0, {0} };
 
 #else // !defined(_OPENMP) && !COS_HAS_TLS && COS_HAS_POSIX -----------------
 
@@ -75,10 +88,21 @@ cos_method_cache2_init(void)
   if (!(cache = malloc(sizeof *cache)))
 	  cos_abort("out of memory while creating dispatcher cache2");
 
-	cache->slot = &cache_empty;
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+  cache->line = cache_empty;
+  cache->mem  = 0;
+#else
+  cache->slot = &cache_empty;
+  cache->cel  = 0;
+#endif
 	cache->msk  = 0;
 	cache->mis  = 0;
 	cache->mis2 = 0;
+  cache->cnt  = 0;
+  cache->cap  = 0;
+  cache->rhs  = 0;
+  cache->shr  = 0;
+  cache->gen  = 0;
 
   if ( pthread_setspecific(cos_method_cache2_key, cache) )
 	  cos_abort("unable to initialize dispatcher cache2");
@@ -95,57 +119,532 @@ init(SEL _sel, OBJ _1, OBJ _2, void *_arg, void *_ret)
   forward_message(_1,_2);
 }
 
-static inline U32
-first_cell(struct cos_method_slot2 **slot)
+#if COS_METHOD_SHARED // --------------------------------------------------
+
+/* NOTE-INFO: shared dispatch table
+ * Process-wide table of the methods resolved by all threads, probed on a
+ * thread cache miss before cos_method_get2 (the binary search). Readers
+ * are lock-free: a writer claims an empty cell with a CAS on idg, stores
+ * the ids and publishes fct with a release store, so a reader seeing fct
+ * also sees the ids. cos_method_syncShared2 unpublishes the cells of
+ * the reloaded generics and rebuilds the table without them (no dead
+ * cells). The table is doubled or rebuilt by one writer at a time and a
+ * publication racing with the copy is republished into the new table.
+ * Old tables are retired until cos_method_clearShared2, as readers may
+ * still probe them. Growth stops at COS_METHOD_SHARED_MAXSLOT2.
+ */
+
+#ifndef COS_METHOD_SHARED_MAXSLOT2
+#define COS_METHOD_SHARED_MAXSLOT2 65536
+#endif
+
+STATIC_ASSERT(COS_METHOD_SHARED_MAXSLOT2_must_be_a_pow2_greater_than_512,
+              COS_METHOD_SHARED_MAXSLOT2 > 512 &&
+              (COS_METHOD_SHARED_MAXSLOT2 & (COS_METHOD_SHARED_MAXSLOT2-1)) == 0);
+
+struct shared_cell2 {
+  U32  idg, id1, id2;
+  IMP2 fct;
+};
+
+struct shared_table2 {
+  struct shared_table2 *old; // retired table
+  U32 msk, cnt;
+  struct shared_cell2 cel[];
+};
+
+static struct shared_table2 *shared_table;
+static U32                   shared_grow;
+
+static IMP2
+shared_get(U32 idg, U32 id1, U32 id2)
+{
+  struct shared_table2 *tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+  U32 i, k;
+
+  if (tbl) {
+    k = cos_method_hkey2(idg,id1,id2);
+
+    for (i = 0; i <= tbl->msk; i++, k++) {
+      struct shared_cell2 *cel = tbl->cel + (k & tbl->msk);
+      U32 cid = __atomic_load_n(&cel->idg, __ATOMIC_ACQUIRE);
+
+      if (!cid) break;
+
+      if (cid == idg) {
+        IMP2 fct = __atomic_load_n(&cel->fct, __ATOMIC_ACQUIRE);
+        if (fct && cel->id1 == id1 &&
+                   cel->id2 == id2)
+          return fct;
+      }
+    }
+  }
+
+  return 0;
+}
+
+static void
+shared_copy(struct shared_table2 *tbl, U32 n)
+{
+  struct shared_table2 *new;
+  U32 i;
+
+  new = calloc(1, sizeof *new + n * sizeof *new->cel);
+  if (!new)
+    cos_abort("method2_lookup: out of memory");
+
+  new->old = tbl;
+  new->msk = n-1;
+
+  // copy live cells (new is not visible yet)
+  if (tbl)
+    for (i = 0; i <= tbl->msk; i++) {
+      struct shared_cell2 *src = tbl->cel + i, *dst;
+      IMP2 fct = __atomic_load_n(&src->fct, __ATOMIC_SEQ_CST);
+      U32 k;
+
+      if (!fct) continue;
+
+      k = cos_method_hkey2(src->idg,src->id1,src->id2);
+      for (dst = new->cel + (k & (n-1)); dst->idg; dst = new->cel + (++k & (n-1))) ;
+
+      dst->idg = src->idg;
+      dst->id1 = src->id1;
+      dst->id2 = src->id2;
+      dst->fct = fct;
+      new->cnt++;
+    }
+
+  __atomic_store_n(&shared_table, new, __ATOMIC_SEQ_CST);
+}
+
+static void
+shared_enlarge(struct shared_table2 *tbl)
+{
+  // one writer at a time, others skip
+  if (__atomic_exchange_n(&shared_grow, 1, __ATOMIC_SEQ_CST))
+    return;
+
+  if (tbl == __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE))
+    shared_copy(tbl, tbl ? (tbl->msk+1)*2 : 512);
+
+  __atomic_store_n(&shared_grow, 0, __ATOMIC_SEQ_CST);
+}
+
+static void
+shared_put(U32 idg, U32 id1, U32 id2, IMP2 fct)
+{
+  struct shared_table2 *tbl;
+  U32 i, k, cnt;
+
+retry:
+  tbl = __atomic_load_n(&shared_table, __ATOMIC_SEQ_CST);
+
+  // keep load below 1/2 until SHARED_MAXSLOT is reached
+  cnt = tbl ? __atomic_load_n(&tbl->cnt, __ATOMIC_RELAXED) : 0;
+  if (!tbl || (cnt*2 > tbl->msk && tbl->msk < COS_METHOD_SHARED_MAXSLOT2-1)) {
+    shared_enlarge(tbl);
+    tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+    if (!tbl) return;
+    cnt = __atomic_load_n(&tbl->cnt, __ATOMIC_RELAXED);
+  }
+
+  // table is full, keep probes short
+  if (cnt*4 > tbl->msk*3)
+    return;
+
+  k = cos_method_hkey2(idg,id1,id2);
+
+  for (i = 0; i <= tbl->msk; i++, k++) {
+    struct shared_cell2 *cel = tbl->cel + (k & tbl->msk);
+    U32 cid = 0;
+
+    if (__atomic_compare_exchange_n(&cel->idg, &cid, idg, 0,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      cel->id1 = id1;
+      cel->id2 = id2;
+      __atomic_store_n(&cel->fct, fct, __ATOMIC_SEQ_CST);
+      __atomic_add_fetch(&tbl->cnt, 1, __ATOMIC_RELAXED);
+      goto published;
+    }
+
+    // already published by another thread
+    if (cid == idg && __atomic_load_n(&cel->fct, __ATOMIC_ACQUIRE) &&
+        cel->id1 == id1 &&
+        cel->id2 == id2)
+      return;
+  }
+  return;
+
+published:
+  // a copy may have missed the cell, republish it into the new table
+  while (__atomic_load_n(&shared_grow, __ATOMIC_SEQ_CST)) ;
+  if (tbl != __atomic_load_n(&shared_table, __ATOMIC_SEQ_CST))
+    goto retry;
+}
+
+static IMP2
+get_method(SEL _sel, U32 id1, U32 id2)
+{
+  IMP2 fct = shared_get(_sel->Behavior.id,id1,id2);
+
+  if (fct)
+    cos_method_cache2()->shr++;
+
+  else {
+    fct = cos_method_get2(_sel,id1,id2);
+    if (fct)
+      shared_put(_sel->Behavior.id,id1,id2,fct);
+  }
+
+  return fct;
+}
+
+void
+cos_method_clearShared2(void)
+{
+  struct shared_table2 *tbl, *old;
+
+  tbl = __atomic_exchange_n(&shared_table, 0, __ATOMIC_ACQ_REL);
+
+  for (; tbl; tbl = old)
+    old = tbl->old, free(tbl);
+}
+
+void
+cos_method_syncShared2(U32 gen)
 {
-  struct cos_method_slot2 *sl = *slot;
+  struct shared_table2 *tbl;
+  U32 i, n = 0;
+
+  // one writer at a time, wait for a running growth
+  while (__atomic_exchange_n(&shared_grow, 1, __ATOMIC_SEQ_CST)) ;
+
+  tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+
+  if (tbl) {
+    // unpublish the cells of generics which gained methods since gen
+    for (i = 0; i <= tbl->msk; i++) {
+      struct shared_cell2 *cel = tbl->cel + i;
+      U32 idg = __atomic_load_n(&cel->idg, __ATOMIC_ACQUIRE);
+
+      if (idg && cos_method_stamp(idg) > gen &&
+          __atomic_exchange_n(&cel->fct, 0, __ATOMIC_SEQ_CST))
+        n++;
+    }
+
+    // rebuild the table without the dead cells
+    if (n)
+      shared_copy(tbl, tbl->msk+1);
+  }
+
+  __atomic_store_n(&shared_grow, 0, __ATOMIC_SEQ_CST);
+}
+
+void
+cos_method_statShared2(FILE *fp)
+{
+  struct shared_table2 *tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
   U32 n = 0;
 
-  while (sl != &sentinel) {
-    if (sl < *slot) *slot = sl;
-    sl = sl->nxt, ++n;
+  if (!fp) fp = stderr;
+
+  if (tbl) {
+    struct shared_table2 *old;
+    for (old = tbl->old; old; old = old->old) n++;
+  }
+
+  fprintf(fp, "shared2: slots=%6u, cells=%5u, retired=%u\n",
+          tbl ? tbl->msk+1 : 0, tbl ? tbl->cnt : 0, n);
+}
+
+#else
+
+#define get_method(...) cos_method_get2(__VA_ARGS__)
+
+#endif // ------------------------------------------------
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK // -------------------
+
+static void
+enlarge_cache(struct cos_method_cache2 *cache)
+{
+  struct cos_method_line2 *line;
+  void *mem;
+  U32 n;
+
+  n = cache->msk ? (cache->msk+1)*2 : 512/COS_METHOD_LINE2;
+
+  // lines must be aligned on cache line
+  mem = malloc(n * sizeof *line + 63);
+  if (!mem)
+    cos_abort("method2_lookup: out of memory");
+
+  line = (void*)(((size_t)mem + 63) & ~(size_t)63);
+  memset(line, 0, n * sizeof *line);
+
+  if (cache->line != cache_empty) {
+#if COS_METHOD_CACHE_REHASH
+    U32 i;
+
+    // move live slots into the new lines (order is kept)
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot2 *cel = cache->line[i].cel;
+      U32 j, k;
+
+      for (j = 0; j < COS_METHOD_LINE2 && cel[j].idg; j++) {
+        struct cos_method_slot2 *dst =
+          line[cos_method_hkey2(cel[j].idg,cel[j].id1,cel[j].id2) & (n-1)].cel;
+
+        for (k = 0; dst[k].idg; k++) ;
+        dst[k] = cel[j];
+      }
+    }
+    if (cache->cnt) cache->rhs++;
+#else
+    // forget all slots (flush)
+    cache->cnt = 0;
+#endif
+    free(cache->mem);
+  }
+
+  cache->line = line;
+  cache->mem  = mem;
+  cache->msk  = n-1;
+  cache->cap  = n*COS_METHOD_LINE2;
+}
+
+static struct cos_method_slot2*
+load_method(SEL _sel, U32 id1, U32 id2, BOOL load)
+{
+  struct cos_method_cache2 *cache;
+  struct cos_method_slot2 *slot;
+  IMP2 fct;
+  U32 key;
+
+  fct = get_method(_sel,id1,id2);
+  if (!fct) {
+    if (!load) return 0;
+    fct = cos_method_get2(genericref(gunrecognizedMessage2), id1, id2);
+    if (!fct)
+      cos_abort("method2_lookup: %s not found for classes (%s,%s)",
+                "gunrecognizedMessage2",
+                cos_class_get(id1)->str, cos_class_get(id2)->str);
+  }
+
+  // get line
+  key   = cos_method_hkey2(_sel->Behavior.id,id1,id2);
+  cache = cos_method_cache2();
+  slot  = cache->line[key & cache->msk].cel;
+
+  // get slot (grow at most once per miss and only above half load)
+  if (cache->line == cache_empty ||
+      (slot[COS_METHOD_LINE2-1].idg && cache->cnt*2 > cache->msk &&
+       cache->msk < COS_METHOD_MAXSLOT2/COS_METHOD_LINE2-1)) {
+    // try to ensure O(1) until MAXSLOT is reached, collisions replace the oldest slot
+    enlarge_cache(cache);
+    slot = cache->line[key & cache->msk].cel;
+  }
+
+  if (!slot[COS_METHOD_LINE2-1].idg)
+    cache->cnt++;
+  else
+    // line is full (last slot is forgotten)
+    if (!++cache->mis) cache->mis2++;
+
+  // most recent slot first
+  memmove(slot+1, slot, (COS_METHOD_LINE2-1) * sizeof *slot);
+
+  // load fct in the cache
+  slot->fct = fct;
+  slot->idg = _sel->Behavior.id;
+  slot->id1 = id1;
+  slot->id2 = id2;
+
+  return slot;
+}
+
+#define CACHE_GET_SLOT() \
+  U32 key = cos_method_hkey2(_sel->Behavior.id,id1,id2); \
+  struct cos_method_cache2 *restrict cache = cos_method_cache2(); \
+  struct cos_method_slot2 *restrict slot = cache->line[key & cache->msk].cel;
+
+#define CACHE_MTH_LOAD(LOAD) \
+  slot = load_method(_sel,id1,id2,LOAD);
+
+#define CACHE_TST_LINE(I) \
+  for (i = I; i < COS_METHOD_LINE2; i++) \
+    if (_sel->Behavior.id  == slot[i].idg && \
+                       id1 == slot[i].id1 && \
+                       id2 == slot[i].id2) { \
+      slot += i; \
+      goto ret; \
+    }
+
+IMP2
+cos_method_lookup2(SEL restrict _sel,
+                   U32 id1, U32 id2)
+{
+  U32 i;
+  CACHE_GET_SLOT();
+
+  CACHE_TST_LINE(0);
+  CACHE_MTH_LOAD(YES);
+
+ ret:
+  return slot->fct;
+}
+
+IMP2
+cos_method_fastLookup2_(struct cos_method_slot2 *restrict slot,
+                        SEL restrict _sel,
+                        U32 id1, U32 id2)
+{
+  U32 i;
+
+  CACHE_TST_LINE(1);
+  CACHE_MTH_LOAD(YES);
+
+ ret:
+  return slot->fct;
+}
+
+BOOL
+cos_method_understand2_(struct cos_method_slot2 *restrict slot,
+                        SEL restrict _sel,
+                        U32 id1, U32 id2)
+{
+  U32 i;
+
+  CACHE_TST_LINE(1);
+  CACHE_MTH_LOAD(NO);
+
+ ret:
+  return slot != 0;
+}
+
+void
+cos_method_clearCache2(void)
+{
+  struct cos_method_cache2 *cache = cos_method_cache2();
+
+  if (cache->line != cache_empty) {
+    free(cache->mem);
+    cache->line = cache_empty;
+    cache->mem  = 0;
+    cache->msk  = 0;
+    cache->mis  = 0;
+    cache->mis2 = 0;
+    cache->cnt  = 0;
+    cache->cap  = 0;
+    cache->rhs  = 0;
+    cache->shr  = 0;
   }
+}
+
+void
+cos_method_syncCache2(struct cos_method_cache2 *cache)
+{
+  U32 gen = cos_method_generation_;
+  U32 i, j, k;
+
+  // drop the slots of generics which gained methods (lines stay packed)
+  if (cache->line != cache_empty)
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot2 *cel = cache->line[i].cel;
+
+      for (j = k = 0; j < COS_METHOD_LINE2 && cel[j].idg; j++)
+        if (cos_method_stamp(cel[j].idg) <= cache->gen)
+          cel[k++] = cel[j];
 
-  return n;
+      memset(cel+k, 0, (j-k) * sizeof *cel);
+      cache->cnt -= j-k;
+    }
+
+  cache->gen = gen;
 }
 
+#else // COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_CHAIN ----------------
+
 static void
-enlarge_slot(struct cos_method_slot2 **slot)
+enlarge_arena(struct cos_method_cache2 *cache)
 {
-  U32 i, n = first_cell(slot);
+  struct cos_method_slot2 *cel;
+  U32 i, n;
 
-  *slot = realloc(n ? *slot : 0, (n+1) * sizeof **slot);
-  if (!*slot)
+  n = cache->cap ? cache->cap*2 : cache->msk+1;
+
+  cel = malloc(n * sizeof *cel);
+  if (!cel)
     cos_abort("method2_lookup: out of memory");
 
-  for (i = 0; i < n+1; i++) {
-    (*slot)[i].nxt = *slot+i+1; // Ok: see C99 6.5.6-8
-    (*slot)[i].fct = init;
-    (*slot)[i].idg = 0;
-    (*slot)[i].id1 = 0;
-    (*slot)[i].id2 = 0;
+  if (cache->cnt) {
+    memcpy(cel, cache->cel, cache->cnt * sizeof *cel);
+
+    // relocate links into the new arena
+    for (i = 0; i < cache->cnt; i++)
+      if (cel[i].nxt != &sentinel)
+        cel[i].nxt = cel + (cel[i].nxt - cache->cel);
+
+    for (i = 0; i <= cache->msk; i++)
+      if (cache->slot[i] != &sentinel)
+        cache->slot[i] = cel + (cache->slot[i] - cache->cel);
   }
 
-  (*slot)[n].nxt = &sentinel;
+  free(cache->cel);
+  cache->cel = cel;
+  cache->cap = n;
+}
+
+static void
+enlarge_slot(struct cos_method_cache2 *cache, struct cos_method_slot2 **slot)
+{
+  struct cos_method_slot2 *cel;
+
+  if (cache->cnt == cache->cap)
+    enlarge_arena(cache);
+
+  cel = cache->cel + cache->cnt++;
+  cel->nxt = *slot;
+  *slot = cel;
 }
 
 static void
-enlarge_cache(void)
+enlarge_cache(struct cos_method_cache2 *cache)
 {
-	struct cos_method_cache2 *cache = cos_method_cache2();
+  struct cos_method_slot2 **slot;
   U32 i, n;
 
   n = cache->msk ? (cache->msk+1)*2 : 512;
-  cos_method_clearCache2();
 
-  cache->slot = malloc(n * sizeof *cache->slot);
-  if (!cache->slot)
+  slot = malloc(n * sizeof *slot);
+  if (!slot)
     cos_abort("method2_lookup: out of memory");
 
   for (i = 0; i < n; i++)
-    cache->slot[i] = &sentinel;
+    slot[i] = &sentinel;
 
-  cache->msk = n-1;
+  if (cache->slot != &cache_empty) {
+#if COS_METHOD_CACHE_REHASH
+    // move live cells into the new slots
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot2 *cel = cache->slot[i], *nxt;
+
+      for (; cel != &sentinel; cel = nxt) {
+        U32 key = cos_method_hkey2(cel->idg,cel->id1,cel->id2) & (n-1);
+        nxt = cel->nxt, cel->nxt = slot[key], slot[key] = cel;
+      }
+    }
+    if (cache->cnt) cache->rhs++;
+#else
+    // forget all cells (flush)
+    cache->cnt = 0;
+#endif
+    free(cache->slot);
+  }
+
+  cache->slot = slot;
+  cache->msk  = n-1;
 }
 
 static struct cos_method_slot2**
@@ -156,7 +655,7 @@ load_method(SEL _sel, U32 id1, U32 id2, BOOL load)
   IMP2 fct;
   U32 key;
 
-  fct = cos_method_get2(_sel,id1,id2);
+  fct = get_method(_sel,id1,id2);
   if (!fct) {
     if (!load) return 0;
     fct = cos_method_get2(genericref(gunrecognizedMessage2), id1, id2);
@@ -171,32 +670,24 @@ load_method(SEL _sel, U32 id1, U32 id2, BOOL load)
 	cache = cos_method_cache2();
   slot  = cache->slot + (key & cache->msk);
 
-  // get cell
-  if (cache->msk < COS_METHOD_MAXSLOT2-1) {
-    if (*slot != &sentinel || slot == &cache_empty) {
-      // try to ensure O(1) until MAXSLOT is reached
-      enlarge_cache();
-      slot = cache->slot + (key & cache->msk);
-    }
-    // allocate 1st cell
-    enlarge_slot(slot);
-
-  } else {
-    // 1st cell is never free
-    if ((*slot)->nxt->fct == 0) {
-      // 2nd cell exists and is not used
-      struct cos_method_slot2 *tmp = *slot;
-      *slot = tmp->nxt, tmp->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
-
-    } else if ((*slot)->nxt->nxt != &sentinel) {
-      // 3rd cell exists and may be used (then forget)
-      struct cos_method_slot2 *tmp = *slot;
-      *slot = tmp->nxt->nxt, tmp->nxt->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
-      if (!++cache->mis) cache->mis2++;
-
-    } else
-      // allocate one more cell
-      enlarge_slot(slot);
+  // get cell (grow at most once per miss and only above half load)
+  if (slot == &cache_empty ||
+      (*slot != &sentinel && cache->cnt*2 > cache->msk &&
+       cache->msk < COS_METHOD_MAXSLOT2-1)) {
+    // try to ensure O(1) until MAXSLOT is reached, collisions are chained
+    enlarge_cache(cache);
+    slot = cache->slot + (key & cache->msk);
+  }
+
+  if ((*slot)->nxt->nxt == &sentinel)
+    // less than 3 cells, allocate one more cell
+    enlarge_slot(cache,slot);
+
+  else {
+    // 3rd cell exists and is used (previous is forgotten)
+    struct cos_method_slot2 *tmp = *slot;
+    *slot = tmp->nxt->nxt, tmp->nxt->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
+    if (!++cache->mis) cache->mis2++;
   }
 
   // load fct in the cache
@@ -283,21 +774,109 @@ cos_method_understand2_(struct cos_method_slot2 *restrict*restrict slot,
 void
 cos_method_clearCache2(void)
 {
-	struct cos_method_cache2 *cache = cos_method_cache2();
-  U32 i;
+  struct cos_method_cache2 *cache = cos_method_cache2();
 
   if (cache->slot != &cache_empty) {
-    for (i = 0; i <= cache->msk; i++) {
-      struct cos_method_slot2 **slot = cache->slot+i;
-
-      if (*slot != &sentinel)
-        first_cell(slot), free(*slot);
-    }
-
     free(cache->slot);
+    free(cache->cel);
     cache->slot = &cache_empty;
+    cache->cel  = 0;
     cache->msk  = 0;
     cache->mis  = 0;
     cache->mis2 = 0;
+    cache->cnt  = 0;
+    cache->cap  = 0;
+    cache->rhs  = 0;
+    cache->shr  = 0;
   }
 }
+
+void
+cos_method_syncCache2(struct cos_method_cache2 *cache)
+{
+  U32 gen = cos_method_generation_;
+  struct cos_method_slot2 *cel, *old, **dst;
+  U32 i, n = 0;
+
+  // drop the cells of generics which gained methods (compact the arena)
+  if (cache->cnt) {
+    cel = malloc(cache->cap * sizeof *cel);
+    if (!cel)
+      cos_abort("method2_lookup: out of memory");
+
+    for (i = 0; i <= cache->msk; i++) {
+      dst = cache->slot + i;
+      for (old = *dst; old != &sentinel; old = old->nxt)
+        if (old->idg && cos_method_stamp(old->idg) <= cache->gen)
+          cel[n] = *old, *dst = cel+n, dst = &cel[n++].nxt;
+      *dst = &sentinel;
+    }
+
+    free(cache->cel);
+    cache->cel = cel;
+    cache->cnt = n;
+  }
+
+  cache->gen = gen;
+}
+
+#endif // ------------------------------------------------
+
+// ----- call-site cache (see cos_dispatch1.c)
+
+IMP2
+cos_method_siteLookup2_(struct cos_method_site2 *site, SEL _sel, U32 id1, U32 id2)
+{
+  U32  gen = cos_method_siteGeneration_;
+  IMP2 fct;
+
+  if (COS_GEN_RNK(_sel) != 2 || COS_GEN_NARG(_sel) || COS_GEN_VARG(_sel) ||
+      !COS_GEN_ORET(_sel))
+    cos_abort("method2_lookup: %s is not a message of 2 receiver(s) returning OBJ",
+              _sel->str);
+
+  fct = cos_method_fastLookup2(_sel, id1, id2);
+
+#if defined(_OPENMP) || !COS_HAS_TLS
+  COS_UNUSED(site,gen);
+#else
+  site->gen = gen;
+  site->idg = _sel->Behavior.id;
+  site->id1 = id1;
+  site->id2 = id2;
+  site->fct = fct;
+#endif
+
+  return fct;
+}
+
+// ----- batched send (see cos_dispatch1.c)
+
+U32
+cos_method_send2(SEL _sel, U32 n,
+                 OBJ const *rcv1, I32 rcv1_s,
+                 OBJ const *rcv2, I32 rcv2_s,
+                 void *_arg, OBJ *res, I32 res_s)
+{
+  U32 id1 = 0, id2 = 0, run = 0;
+  IMP2 fct = 0;
+  OBJ _1, _2, ret = 0;
+
+  for (; n; n--) {
+    _1 = *rcv1, _2 = *rcv2;
+
+    if (cos_object_id(_1) != id1 ||
+        cos_object_id(_2) != id2) {
+      id1 = cos_object_id(_1), id2 = cos_object_id(_2);
+      fct = cos_method_fastLookup2(_sel, id1, id2);
+      ++run;
+    }
+
+    fct(_sel, _1, _2, _arg, res ? res : &ret);
+
+    rcv1 += rcv1_s, rcv2 += rcv2_s;
+    if (res) res += res_s;
+  }
+
+  return run;
+}
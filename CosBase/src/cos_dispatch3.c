@@ -19,14 +19,21 @@
 
 #include <cos/Object.h>
 #include <cos/gen/message.h>
+#include <cos/debug.h>
 
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
 
 /* NOTE-CONF: Method dispatcher cache max slots (Method lookup)
  * The slots specifies the maximum number of entries for each cache.
  * This number must be of the form 2^n > 512.
  * Number of slots increase upon collision until maxslot is reached.
  * The maxdepth (e.g. memory) of each slot is fixed to 3.
+ * Cells are allocated from one arena per cache and moved into the larger
+ * table when the cache grows (see COS_METHOD_CACHE_REHASH).
+ * With COS_METHOD_CACHE_PACK, slots are packed in lines of 64 bytes probed
+ * linearly and the maxdepth is the number of slots per line.
  */
 
 #ifndef COS_METHOD_MAXSLOT3
@@ -43,13 +50,19 @@ STATIC_ASSERT(COS_METHOD_CACHE3_must_have_a_size_of_64_bytes,
 
 static void init(SEL,OBJ,OBJ,OBJ,void*,void*);
 
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+static struct cos_method_line3 cache_empty[1] = {{{ { 0,0,0,0,init } }}};
+#define CACHE_EMPTY cache_empty
+#else
 static struct cos_method_slot3 sentinel = { 0,0,0,0,init,&sentinel };
 static struct cos_method_slot3 *cache_empty = &sentinel;
+#define CACHE_EMPTY (&cache_empty)
+#endif
 
 #if defined(_OPENMP) || COS_HAS_TLS || !COS_HAS_POSIX // --------------------
 
 __thread struct cos_method_cache3 cos_method_cache3_
-  __attribute__((aligned(64))) = { &cache_empty, 0, 0, 0, {0} };
+  __attribute__((aligned(64))) = { CACHE_EMPTY, 0, 0, 0, 0, 0, 0, 0, 0, 0, {0} };
 
 #else // !defined(_OPENMP) && !COS_HAS_TLS && COS_HAS_POSIX -----------------
 
@@ -75,10 +88,21 @@ cos_method_cache3_init(void)
   if (!(cache = malloc(sizeof *cache)))
 	  cos_abort("out of memory while creating dispatcher cache3");
 
-	cache->slot = &cache_empty;
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK
+  cache->line = cache_empty;
+  cache->mem  = 0;
+#else
+  cache->slot = &cache_empty;
+  cache->cel  = 0;
+#endif
 	cache->msk  = 0;
 	cache->mis  = 0;
 	cache->mis2 = 0;
+  cache->cnt  = 0;
+  cache->cap  = 0;
+  cache->rhs  = 0;
+  cache->shr  = 0;
+  cache->gen  = 0;
 
   if ( pthread_setspecific(cos_method_cache3_key, cache) )
 	  cos_abort("unable to initialize dispatcher cache3");
@@ -95,58 +119,539 @@ init(SEL _sel, OBJ _1, OBJ _2, OBJ _3, void *_arg, void *_ret)
   forward_message(_1,_2,_3);
 }
 
-static inline U32
-first_cell(struct cos_method_slot3 **slot)
+#if COS_METHOD_SHARED // --------------------------------------------------
+
+/* NOTE-INFO: shared dispatch table
+ * Process-wide table of the methods resolved by all threads, probed on a
+ * thread cache miss before cos_method_get3 (the binary search). Readers
+ * are lock-free: a writer claims an empty cell with a CAS on idg, stores
+ * the ids and publishes fct with a release store, so a reader seeing fct
+ * also sees the ids. cos_method_syncShared3 unpublishes the cells of
+ * the reloaded generics and rebuilds the table without them (no dead
+ * cells). The table is doubled or rebuilt by one writer at a time and a
+ * publication racing with the copy is republished into the new table.
+ * Old tables are retired until cos_method_clearShared3, as readers may
+ * still probe them. Growth stops at COS_METHOD_SHARED_MAXSLOT3.
+ */
+
+#ifndef COS_METHOD_SHARED_MAXSLOT3
+#define COS_METHOD_SHARED_MAXSLOT3 65536
+#endif
+
+STATIC_ASSERT(COS_METHOD_SHARED_MAXSLOT3_must_be_a_pow2_greater_than_512,
+              COS_METHOD_SHARED_MAXSLOT3 > 512 &&
+              (COS_METHOD_SHARED_MAXSLOT3 & (COS_METHOD_SHARED_MAXSLOT3-1)) == 0);
+
+struct shared_cell3 {
+  U32  idg, id1, id2, id3;
+  IMP3 fct;
+};
+
+struct shared_table3 {
+  struct shared_table3 *old; // retired table
+  U32 msk, cnt;
+  struct shared_cell3 cel[];
+};
+
+static struct shared_table3 *shared_table;
+static U32                   shared_grow;
+
+static IMP3
+shared_get(U32 idg, U32 id1, U32 id2, U32 id3)
+{
+  struct shared_table3 *tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+  U32 i, k;
+
+  if (tbl) {
+    k = cos_method_hkey3(idg,id1,id2,id3);
+
+    for (i = 0; i <= tbl->msk; i++, k++) {
+      struct shared_cell3 *cel = tbl->cel + (k & tbl->msk);
+      U32 cid = __atomic_load_n(&cel->idg, __ATOMIC_ACQUIRE);
+
+      if (!cid) break;
+
+      if (cid == idg) {
+        IMP3 fct = __atomic_load_n(&cel->fct, __ATOMIC_ACQUIRE);
+        if (fct && cel->id1 == id1 &&
+                   cel->id2 == id2 &&
+                   cel->id3 == id3)
+          return fct;
+      }
+    }
+  }
+
+  return 0;
+}
+
+static void
+shared_copy(struct shared_table3 *tbl, U32 n)
+{
+  struct shared_table3 *new;
+  U32 i;
+
+  new = calloc(1, sizeof *new + n * sizeof *new->cel);
+  if (!new)
+    cos_abort("method3_lookup: out of memory");
+
+  new->old = tbl;
+  new->msk = n-1;
+
+  // copy live cells (new is not visible yet)
+  if (tbl)
+    for (i = 0; i <= tbl->msk; i++) {
+      struct shared_cell3 *src = tbl->cel + i, *dst;
+      IMP3 fct = __atomic_load_n(&src->fct, __ATOMIC_SEQ_CST);
+      U32 k;
+
+      if (!fct) continue;
+
+      k = cos_method_hkey3(src->idg,src->id1,src->id2,src->id3);
+      for (dst = new->cel + (k & (n-1)); dst->idg; dst = new->cel + (++k & (n-1))) ;
+
+      dst->idg = src->idg;
+      dst->id1 = src->id1;
+      dst->id2 = src->id2;
+      dst->id3 = src->id3;
+      dst->fct = fct;
+      new->cnt++;
+    }
+
+  __atomic_store_n(&shared_table, new, __ATOMIC_SEQ_CST);
+}
+
+static void
+shared_enlarge(struct shared_table3 *tbl)
+{
+  // one writer at a time, others skip
+  if (__atomic_exchange_n(&shared_grow, 1, __ATOMIC_SEQ_CST))
+    return;
+
+  if (tbl == __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE))
+    shared_copy(tbl, tbl ? (tbl->msk+1)*2 : 512);
+
+  __atomic_store_n(&shared_grow, 0, __ATOMIC_SEQ_CST);
+}
+
+static void
+shared_put(U32 idg, U32 id1, U32 id2, U32 id3, IMP3 fct)
+{
+  struct shared_table3 *tbl;
+  U32 i, k, cnt;
+
+retry:
+  tbl = __atomic_load_n(&shared_table, __ATOMIC_SEQ_CST);
+
+  // keep load below 1/2 until SHARED_MAXSLOT is reached
+  cnt = tbl ? __atomic_load_n(&tbl->cnt, __ATOMIC_RELAXED) : 0;
+  if (!tbl || (cnt*2 > tbl->msk && tbl->msk < COS_METHOD_SHARED_MAXSLOT3-1)) {
+    shared_enlarge(tbl);
+    tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+    if (!tbl) return;
+    cnt = __atomic_load_n(&tbl->cnt, __ATOMIC_RELAXED);
+  }
+
+  // table is full, keep probes short
+  if (cnt*4 > tbl->msk*3)
+    return;
+
+  k = cos_method_hkey3(idg,id1,id2,id3);
+
+  for (i = 0; i <= tbl->msk; i++, k++) {
+    struct shared_cell3 *cel = tbl->cel + (k & tbl->msk);
+    U32 cid = 0;
+
+    if (__atomic_compare_exchange_n(&cel->idg, &cid, idg, 0,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+      cel->id1 = id1;
+      cel->id2 = id2;
+      cel->id3 = id3;
+      __atomic_store_n(&cel->fct, fct, __ATOMIC_SEQ_CST);
+      __atomic_add_fetch(&tbl->cnt, 1, __ATOMIC_RELAXED);
+      goto published;
+    }
+
+    // already published by another thread
+    if (cid == idg && __atomic_load_n(&cel->fct, __ATOMIC_ACQUIRE) &&
+        cel->id1 == id1 &&
+        cel->id2 == id2 &&
+        cel->id3 == id3)
+      return;
+  }
+  return;
+
+published:
+  // a copy may have missed the cell, republish it into the new table
+  while (__atomic_load_n(&shared_grow, __ATOMIC_SEQ_CST)) ;
+  if (tbl != __atomic_load_n(&shared_table, __ATOMIC_SEQ_CST))
+    goto retry;
+}
+
+static IMP3
+get_method(SEL _sel, U32 id1, U32 id2, U32 id3)
+{
+  IMP3 fct = shared_get(_sel->Behavior.id,id1,id2,id3);
+
+  if (fct)
+    cos_method_cache3()->shr++;
+
+  else {
+    fct = cos_method_get3(_sel,id1,id2,id3);
+    if (fct)
+      shared_put(_sel->Behavior.id,id1,id2,id3,fct);
+  }
+
+  return fct;
+}
+
+void
+cos_method_clearShared3(void)
 {
-  struct cos_method_slot3 *sl = *slot;
+  struct shared_table3 *tbl, *old;
+
+  tbl = __atomic_exchange_n(&shared_table, 0, __ATOMIC_ACQ_REL);
+
+  for (; tbl; tbl = old)
+    old = tbl->old, free(tbl);
+}
+
+void
+cos_method_syncShared3(U32 gen)
+{
+  struct shared_table3 *tbl;
+  U32 i, n = 0;
+
+  // one writer at a time, wait for a running growth
+  while (__atomic_exchange_n(&shared_grow, 1, __ATOMIC_SEQ_CST)) ;
+
+  tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
+
+  if (tbl) {
+    // unpublish the cells of generics which gained methods since gen
+    for (i = 0; i <= tbl->msk; i++) {
+      struct shared_cell3 *cel = tbl->cel + i;
+      U32 idg = __atomic_load_n(&cel->idg, __ATOMIC_ACQUIRE);
+
+      if (idg && cos_method_stamp(idg) > gen &&
+          __atomic_exchange_n(&cel->fct, 0, __ATOMIC_SEQ_CST))
+        n++;
+    }
+
+    // rebuild the table without the dead cells
+    if (n)
+      shared_copy(tbl, tbl->msk+1);
+  }
+
+  __atomic_store_n(&shared_grow, 0, __ATOMIC_SEQ_CST);
+}
+
+void
+cos_method_statShared3(FILE *fp)
+{
+  struct shared_table3 *tbl = __atomic_load_n(&shared_table, __ATOMIC_ACQUIRE);
   U32 n = 0;
 
-  while (sl != &sentinel) {
-    if (sl < *slot) *slot = sl;
-    sl = sl->nxt, ++n;
+  if (!fp) fp = stderr;
+
+  if (tbl) {
+    struct shared_table3 *old;
+    for (old = tbl->old; old; old = old->old) n++;
   }
 
-  return n;
+  fprintf(fp, "shared3: slots=%6u, cells=%5u, retired=%u\n",
+          tbl ? tbl->msk+1 : 0, tbl ? tbl->cnt : 0, n);
 }
 
+#else
+
+#define get_method(...) cos_method_get3(__VA_ARGS__)
+
+#endif // ------------------------------------------------
+
+#if COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK // -------------------
+
 static void
-enlarge_slot(struct cos_method_slot3 **slot)
+enlarge_cache(struct cos_method_cache3 *cache)
 {
-  U32 i, n = first_cell(slot);
+  struct cos_method_line3 *line;
+  void *mem;
+  U32 n;
 
-  *slot = realloc(n ? *slot : 0, (n+1) * sizeof **slot);
-  if (!*slot)
+  n = cache->msk ? (cache->msk+1)*2 : 512/COS_METHOD_LINE3;
+
+  // lines must be aligned on cache line
+  mem = malloc(n * sizeof *line + 63);
+  if (!mem)
     cos_abort("method3_lookup: out of memory");
 
-  for (i = 0; i < n+1; i++) {
-    (*slot)[i].nxt = *slot+i+1; // Ok: see C99 6.5.6-8
-    (*slot)[i].fct = init;
-    (*slot)[i].idg = 0;
-    (*slot)[i].id1 = 0;
-    (*slot)[i].id2 = 0;
-    (*slot)[i].id3 = 0;
+  line = (void*)(((size_t)mem + 63) & ~(size_t)63);
+  memset(line, 0, n * sizeof *line);
+
+  if (cache->line != cache_empty) {
+#if COS_METHOD_CACHE_REHASH
+    U32 i;
+
+    // move live slots into the new lines (order is kept)
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot3 *cel = cache->line[i].cel;
+      U32 j, k;
+
+      for (j = 0; j < COS_METHOD_LINE3 && cel[j].idg; j++) {
+        struct cos_method_slot3 *dst =
+          line[cos_method_hkey3(cel[j].idg,cel[j].id1,cel[j].id2,cel[j].id3) & (n-1)].cel;
+
+        for (k = 0; dst[k].idg; k++) ;
+        dst[k] = cel[j];
+      }
+    }
+    if (cache->cnt) cache->rhs++;
+#else
+    // forget all slots (flush)
+    cache->cnt = 0;
+#endif
+    free(cache->mem);
+  }
+
+  cache->line = line;
+  cache->mem  = mem;
+  cache->msk  = n-1;
+  cache->cap  = n*COS_METHOD_LINE3;
+}
+
+static struct cos_method_slot3*
+load_method(SEL _sel, U32 id1, U32 id2, U32 id3, BOOL load)
+{
+  struct cos_method_cache3 *cache;
+  struct cos_method_slot3 *slot;
+  IMP3 fct;
+  U32 key;
+
+  fct = get_method(_sel, id1, id2, id3);
+  if (!fct) {
+    if (!load) return 0;
+    fct = cos_method_get3(genericref(gunrecognizedMessage3), id1, id2, id3);
+    if (!fct)
+      cos_abort("method3_lookup: %s not found for classes (%s,%s,%s)",
+                "gunrecognizedMessage3",
+                cos_class_get(id1)->str, cos_class_get(id2)->str,
+                cos_class_get(id3)->str);
   }
 
-  (*slot)[n].nxt = &sentinel;
+  // get line
+  key   = cos_method_hkey3(_sel->Behavior.id,id1,id2,id3);
+  cache = cos_method_cache3();
+  slot  = cache->line[key & cache->msk].cel;
+
+  // get slot (grow at most once per miss and only above half load)
+  if (cache->line == cache_empty ||
+      (slot[COS_METHOD_LINE3-1].idg && cache->cnt*2 > cache->msk &&
+       cache->msk < COS_METHOD_MAXSLOT3/COS_METHOD_LINE3-1)) {
+    // try to ensure O(1) until MAXSLOT is reached, collisions replace the oldest slot
+    enlarge_cache(cache);
+    slot = cache->line[key & cache->msk].cel;
+  }
+
+  if (!slot[COS_METHOD_LINE3-1].idg)
+    cache->cnt++;
+  else
+    // line is full (last slot is forgotten)
+    if (!++cache->mis) cache->mis2++;
+
+  // most recent slot first
+  memmove(slot+1, slot, (COS_METHOD_LINE3-1) * sizeof *slot);
+
+  // load fct in the cache
+  slot->fct = fct;
+  slot->idg = _sel->Behavior.id;
+  slot->id1 = id1;
+  slot->id2 = id2;
+  slot->id3 = id3;
+
+  return slot;
+}
+
+#define CACHE_GET_SLOT() \
+  U32 key = cos_method_hkey3(_sel->Behavior.id,id1,id2,id3); \
+  struct cos_method_cache3 *restrict cache = cos_method_cache3(); \
+  struct cos_method_slot3 *restrict slot = cache->line[key & cache->msk].cel;
+
+#define CACHE_MTH_LOAD(LOAD) \
+  slot = load_method(_sel,id1,id2,id3,LOAD);
+
+#define CACHE_TST_LINE(I) \
+  for (i = I; i < COS_METHOD_LINE3; i++) \
+    if (_sel->Behavior.id  == slot[i].idg && \
+                       id1 == slot[i].id1 && \
+                       id2 == slot[i].id2 && \
+                       id3 == slot[i].id3) { \
+      slot += i; \
+      goto ret; \
+    }
+
+IMP3
+cos_method_lookup3(SEL restrict _sel,
+                   U32 id1, U32 id2, U32 id3)
+{
+  U32 i;
+  CACHE_GET_SLOT();
+
+  CACHE_TST_LINE(0);
+  CACHE_MTH_LOAD(YES);
+
+ ret:
+  return slot->fct;
+}
+
+IMP3
+cos_method_fastLookup3_(struct cos_method_slot3 *restrict slot,
+                        SEL restrict _sel,
+                        U32 id1, U32 id2, U32 id3)
+{
+  U32 i;
+
+  CACHE_TST_LINE(1);
+  CACHE_MTH_LOAD(YES);
+
+ ret:
+  return slot->fct;
+}
+
+BOOL
+cos_method_understand3_(struct cos_method_slot3 *restrict slot,
+                        SEL restrict _sel,
+                        U32 id1, U32 id2, U32 id3)
+{
+  U32 i;
+
+  CACHE_TST_LINE(1);
+  CACHE_MTH_LOAD(NO);
+
+ ret:
+  return slot != 0;
+}
+
+void
+cos_method_clearCache3(void)
+{
+  struct cos_method_cache3 *cache = cos_method_cache3();
+
+  if (cache->line != cache_empty) {
+    free(cache->mem);
+    cache->line = cache_empty;
+    cache->mem  = 0;
+    cache->msk  = 0;
+    cache->mis  = 0;
+    cache->mis2 = 0;
+    cache->cnt  = 0;
+    cache->cap  = 0;
+    cache->rhs  = 0;
+    cache->shr  = 0;
+  }
+}
+
+void
+cos_method_syncCache3(struct cos_method_cache3 *cache)
+{
+  U32 gen = cos_method_generation_;
+  U32 i, j, k;
+
+  // drop the slots of generics which gained methods (lines stay packed)
+  if (cache->line != cache_empty)
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot3 *cel = cache->line[i].cel;
+
+      for (j = k = 0; j < COS_METHOD_LINE3 && cel[j].idg; j++)
+        if (cos_method_stamp(cel[j].idg) <= cache->gen)
+          cel[k++] = cel[j];
+
+      memset(cel+k, 0, (j-k) * sizeof *cel);
+      cache->cnt -= j-k;
+    }
+
+  cache->gen = gen;
+}
+
+#else // COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_CHAIN ----------------
+
+static void
+enlarge_arena(struct cos_method_cache3 *cache)
+{
+  struct cos_method_slot3 *cel;
+  U32 i, n;
+
+  n = cache->cap ? cache->cap*2 : cache->msk+1;
+
+  cel = malloc(n * sizeof *cel);
+  if (!cel)
+    cos_abort("method3_lookup: out of memory");
+
+  if (cache->cnt) {
+    memcpy(cel, cache->cel, cache->cnt * sizeof *cel);
+
+    // relocate links into the new arena
+    for (i = 0; i < cache->cnt; i++)
+      if (cel[i].nxt != &sentinel)
+        cel[i].nxt = cel + (cel[i].nxt - cache->cel);
+
+    for (i = 0; i <= cache->msk; i++)
+      if (cache->slot[i] != &sentinel)
+        cache->slot[i] = cel + (cache->slot[i] - cache->cel);
+  }
+
+  free(cache->cel);
+  cache->cel = cel;
+  cache->cap = n;
+}
+
+static void
+enlarge_slot(struct cos_method_cache3 *cache, struct cos_method_slot3 **slot)
+{
+  struct cos_method_slot3 *cel;
+
+  if (cache->cnt == cache->cap)
+    enlarge_arena(cache);
+
+  cel = cache->cel + cache->cnt++;
+  cel->nxt = *slot;
+  *slot = cel;
 }
 
 static void
-enlarge_cache(void)
+enlarge_cache(struct cos_method_cache3 *cache)
 {
-	struct cos_method_cache3 *cache = cos_method_cache3();
+  struct cos_method_slot3 **slot;
   U32 i, n;
 
   n = cache->msk ? (cache->msk+1)*2 : 512;
-  cos_method_clearCache3();
 
-  cache->slot = malloc(n * sizeof *cache->slot);
-  if (!cache->slot)
+  slot = malloc(n * sizeof *slot);
+  if (!slot)
     cos_abort("method3_lookup: out of memory");
 
   for (i = 0; i < n; i++)
-    cache->slot[i] = &sentinel;
+    slot[i] = &sentinel;
+
+  if (cache->slot != &cache_empty) {
+#if COS_METHOD_CACHE_REHASH
+    // move live cells into the new slots
+    for (i = 0; i <= cache->msk; i++) {
+      struct cos_method_slot3 *cel = cache->slot[i], *nxt;
 
-  cache->msk = n-1;
+      for (; cel != &sentinel; cel = nxt) {
+        U32 key = cos_method_hkey3(cel->idg,cel->id1,cel->id2,cel->id3) & (n-1);
+        nxt = cel->nxt, cel->nxt = slot[key], slot[key] = cel;
+      }
+    }
+    if (cache->cnt) cache->rhs++;
+#else
+    // forget all cells (flush)
+    cache->cnt = 0;
+#endif
+    free(cache->slot);
+  }
+
+  cache->slot = slot;
+  cache->msk  = n-1;
 }
 
 static struct cos_method_slot3**
@@ -157,7 +662,7 @@ load_method(SEL _sel, U32 id1, U32 id2, U32 id3, BOOL load)
   IMP3 fct;
   U32 key;
 
-  fct = cos_method_get3(_sel, id1, id2, id3);
+  fct = get_method(_sel, id1, id2, id3);
   if (!fct) {
     if (!load) return 0;
     fct = cos_method_get3(genericref(gunrecognizedMessage3), id1, id2, id3);
@@ -173,32 +678,24 @@ load_method(SEL _sel, U32 id1, U32 id2, U32 id3, BOOL load)
 	cache = cos_method_cache3();
   slot  = cache->slot + (key & cache->msk);
 
-  // get cell
-  if (cache->msk < COS_METHOD_MAXSLOT3-1) {
-    if (*slot != &sentinel || slot == &cache_empty) {
-      // try to ensure O(1) until MAXSLOT is reached
-      enlarge_cache();
-      slot = cache->slot + (key & cache->msk);
-    }
-    // allocate 1st cell
-    enlarge_slot(slot);
-
-  } else {
-    // 1st cell is never free
-    if ((*slot)->nxt->fct == 0) {
-      // 2nd cell exists and is not used
-      struct cos_method_slot3 *tmp = *slot;
-      *slot = tmp->nxt, tmp->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
-
-    } else if ((*slot)->nxt->nxt != &sentinel) {
-      // 3rd cell exists and may be used (then forget)
-      struct cos_method_slot3 *tmp = *slot;
-      *slot = tmp->nxt->nxt, tmp->nxt->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
-      if (!++cache->mis) cache->mis2++;
-
-    } else
-      // allocate one more cell
-      enlarge_slot(slot);
+  // get cell (grow at most once per miss and only above half load)
+  if (slot == &cache_empty ||
+      (*slot != &sentinel && cache->cnt*2 > cache->msk &&
+       cache->msk < COS_METHOD_MAXSLOT3-1)) {
+    // try to ensure O(1) until MAXSLOT is reached, collisions are chained
+    enlarge_cache(cache);
+    slot = cache->slot + (key & cache->msk);
+  }
+
+  if ((*slot)->nxt->nxt == &sentinel)
+    // less than 3 cells, allocate one more cell
+    enlarge_slot(cache,slot);
+
+  else {
+    // 3rd cell exists and is used (previous is forgotten)
+    struct cos_method_slot3 *tmp = *slot;
+    *slot = tmp->nxt->nxt, tmp->nxt->nxt = (*slot)->nxt, (*slot)->nxt = tmp;
+    if (!++cache->mis) cache->mis2++;
   }
 
   // load fct in the cache
@@ -289,21 +786,112 @@ cos_method_understand3_(struct cos_method_slot3 *restrict*restrict slot,
 void
 cos_method_clearCache3(void)
 {
-	struct cos_method_cache3 *cache = cos_method_cache3();
-  U32 i;
+  struct cos_method_cache3 *cache = cos_method_cache3();
 
   if (cache->slot != &cache_empty) {
-    for (i = 0; i <= cache->msk; i++) {
-      struct cos_method_slot3 **slot = cache->slot+i;
-
-      if (*slot != &sentinel)
-        first_cell(slot), free(*slot);
-    }
-
     free(cache->slot);
+    free(cache->cel);
     cache->slot = &cache_empty;
+    cache->cel  = 0;
     cache->msk  = 0;
     cache->mis  = 0;
     cache->mis2 = 0;
+    cache->cnt  = 0;
+    cache->cap  = 0;
+    cache->rhs  = 0;
+    cache->shr  = 0;
   }
 }
+
+void
+cos_method_syncCache3(struct cos_method_cache3 *cache)
+{
+  U32 gen = cos_method_generation_;
+  struct cos_method_slot3 *cel, *old, **dst;
+  U32 i, n = 0;
+
+  // drop the cells of generics which gained methods (compact the arena)
+  if (cache->cnt) {
+    cel = malloc(cache->cap * sizeof *cel);
+    if (!cel)
+      cos_abort("method3_lookup: out of memory");
+
+    for (i = 0; i <= cache->msk; i++) {
+      dst = cache->slot + i;
+      for (old = *dst; old != &sentinel; old = old->nxt)
+        if (old->idg && cos_method_stamp(old->idg) <= cache->gen)
+          cel[n] = *old, *dst = cel+n, dst = &cel[n++].nxt;
+      *dst = &sentinel;
+    }
+
+    free(cache->cel);
+    cache->cel = cel;
+    cache->cnt = n;
+  }
+
+  cache->gen = gen;
+}
+
+#endif // ------------------------------------------------
+
+// ----- call-site cache (see cos_dispatch1.c)
+
+IMP3
+cos_method_siteLookup3_(struct cos_method_site3 *site, SEL _sel, U32 id1, U32 id2, U32 id3)
+{
+  U32  gen = cos_method_siteGeneration_;
+  IMP3 fct;
+
+  if (COS_GEN_RNK(_sel) != 3 || COS_GEN_NARG(_sel) || COS_GEN_VARG(_sel) ||
+      !COS_GEN_ORET(_sel))
+    cos_abort("method3_lookup: %s is not a message of 3 receiver(s) returning OBJ",
+              _sel->str);
+
+  fct = cos_method_fastLookup3(_sel, id1, id2, id3);
+
+#if defined(_OPENMP) || !COS_HAS_TLS
+  COS_UNUSED(site,gen);
+#else
+  site->gen = gen;
+  site->idg = _sel->Behavior.id;
+  site->id1 = id1;
+  site->id2 = id2;
+  site->id3 = id3;
+  site->fct = fct;
+#endif
+
+  return fct;
+}
+
+// ----- batched send (see cos_dispatch1.c)
+
+U32
+cos_method_send3(SEL _sel, U32 n,
+                 OBJ const *rcv1, I32 rcv1_s,
+                 OBJ const *rcv2, I32 rcv2_s,
+                 OBJ const *rcv3, I32 rcv3_s,
+                 void *_arg, OBJ *res, I32 res_s)
+{
+  U32 id1 = 0, id2 = 0, id3 = 0, run = 0;
+  IMP3 fct = 0;
+  OBJ _1, _2, _3, ret = 0;
+
+  for (; n; n--) {
+    _1 = *rcv1, _2 = *rcv2, _3 = *rcv3;
+
+    if (cos_object_id(_1) != id1 ||
+        cos_object_id(_2) != id2 ||
+        cos_object_id(_3) != id3) {
+      id1 = cos_object_id(_1), id2 = cos_object_id(_2), id3 = cos_object_id(_3);
+      fct = cos_method_fastLookup3(_sel, id1, id2, id3);
+      ++run;
+    }
+
+    fct(_sel, _1, _2, _3, _arg, res ? res : &ret);
+
+    rcv1 += rcv1_s, rcv2 += rcv2_s, rcv3 += rcv3_s;
+    if (res) res += res_s;
+  }
+
+  return run;
+}
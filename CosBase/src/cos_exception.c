@@ -169,6 +169,7 @@ cos_exception_initContext(struct cos_exception_context *cxt)
   struct cos_functor_context *fcxt = cos_functor_context();
 
   cxt->prv   = cos_exception_context();
+  cxt->top   = 0;
   cxt->stk   = 0;
   cxt->unstk = 0;
   cxt->ex    = 0;
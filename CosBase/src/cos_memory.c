@@ -19,18 +19,38 @@
 
 // --- declarations -----------------------------------------------------------
 
+// for MAP_ANONYMOUS and MADV_DONTNEED
+#define _DEFAULT_SOURCE
+#define _BSD_SOURCE
+
 #include <cos/Object.h>
+#include <cos/debug.h>
+
+#include <stdlib.h>
 
 // --- definitions ------------------------------------------------------------
 
-struct cos_mem_pool_ cos_mem_pool_;
+__thread struct cos_mem_pool_ cos_mem_pool_;
+struct cos_mem_remote_ cos_mem_remote_[cos_mem_owner_max_];
 size_t cos_mem_pool_max_ = 1<<25;
+unsigned cos_mem_sample_period_;
 
 enum {
   static_assert__node_size_must_be_a_power_of_2
     = 1/!(cos_mem_node_size_&(cos_mem_node_size_-1))
 };
 
+// memory collected here must return to the system
+#undef free
+
+#if COS_MEM_REMOTE || COS_MEM_STAT
+static void pool_atexit (void); // see thread exit
+#endif
+
+#if COS_MEM_STAT
+static void stat_register (void); // see statistics
+#endif
+
 size_t __attribute__ ((noinline))
 cos_mem_unused (int *count_, size_t *only_)
 {
@@ -61,6 +81,245 @@ cos_mem_unused (int *count_, size_t *only_)
   return size;
 }
 
+// --- slab chunks ------------------------------------------------------------
+
+#if COS_MEM_SLAB
+
+/* NOTE-INFO: slab chunks
+   Nodes of the slots below cos_mem_slab_max_ are carved by batch from
+   chunks of cos_mem_chunk_size_ bytes aligned on their size, so the chunk
+   header is found by masking the node address. Chunks are mapped by group
+   to save system calls. Nodes keep their header (slot and owner) and the
+   fast path stays a pointer pop. A chunk can only be released by the thread
+   which carved it (nodes can be freed into other pools), when all its nodes
+   are in the pool of this thread. Its nodes are then removed from the slot,
+   its pages are returned to the system with madvise and the chunk is kept
+   for reuse (up to chunk_spare_max), or unmapped. The unused nodes of a
+   thread which exits are handed to the next thread carving the same slot.
+*/
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdint.h>
+
+enum {
+  chunk_head      = 64, // nodes start on the next cache line
+  chunk_batch     = 16, // chunks mapped at once
+  chunk_spare_max = 16, // empty chunks kept per thread
+};
+
+struct chunk {
+  unsigned      slot;   // slot of the nodes
+  unsigned      serial; // serial of the carving thread
+  unsigned      cnt;    // unused nodes (collect of the carving thread only)
+  struct chunk *nxt;    // next spare or empty chunk
+};
+
+#define CHUNK(ptr) \
+  ((struct chunk*)((uintptr_t)(ptr) & ~(uintptr_t)(cos_mem_chunk_size_-1)))
+
+// unused nodes of exited threads (per slot)
+static union cos_mem_node_ *orphan[cos_mem_slab_max_ ? cos_mem_slab_max_ : 1];
+static int orphan_lock;
+
+static cos_inline size_t
+chunk_nodes (unsigned slot)
+{
+  return (cos_mem_chunk_size_ - chunk_head) / ((slot+1)*cos_mem_node_size_);
+}
+
+static struct chunk*
+chunk_new (void)
+{
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+  struct chunk *chk = pool->spare;
+
+  if (!pool->serial) {
+    static unsigned serial = 0;
+    pool->serial = __atomic_add_fetch(&serial, 1, __ATOMIC_RELAXED);
+  }
+
+  if (!chk) {
+    size_t size = cos_mem_chunk_size_, len = (chunk_batch+1)*size;
+    char *beg = mmap(0, len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    char *cur, *end = beg+len;
+
+    if (beg == MAP_FAILED) return 0;
+
+    // align on chunk size
+    cur = (char*)(((uintptr_t)beg + size-1) & ~(uintptr_t)(size-1));
+    if (cur > beg)            munmap(beg, cur-beg);
+    if (cur+chunk_batch*size < end) munmap(cur+chunk_batch*size, end-(cur+chunk_batch*size));
+
+    // new chunks are not touched, they cost no memory until carved
+    for (int i = chunk_batch-1; i >= 0; i--) {
+      chk = (struct chunk*)(cur+i*size);
+      chk->nxt = pool->spare, pool->spare = chk;
+    }
+    pool->spares += chunk_batch;
+  }
+
+  pool->spare = chk->nxt, pool->spares--;
+  return chk;
+}
+
+static void
+chunk_del (struct chunk *chk)
+{
+  static size_t page;
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+
+  if (!page) page = sysconf(_SC_PAGESIZE);
+
+  if (pool->spares < chunk_spare_max) {
+    madvise((char*)chk+page, cos_mem_chunk_size_-page, MADV_DONTNEED);
+    chk->nxt = pool->spare, pool->spare = chk, pool->spares++;
+  } else
+    munmap(chk, cos_mem_chunk_size_);
+}
+
+static size_t
+orphan_adopt (struct cos_mem_slot_ *pptr, unsigned slot)
+{
+  union cos_mem_node_ *ptr, *lst;
+  size_t cnt = 1;
+
+  if (!__atomic_load_n(orphan+slot, __ATOMIC_RELAXED))
+    return 0;
+
+  while (__atomic_exchange_n(&orphan_lock, 1, __ATOMIC_ACQUIRE)) ;
+  lst = orphan[slot], orphan[slot] = 0;
+  __atomic_store_n(&orphan_lock, 0, __ATOMIC_RELEASE);
+
+  if (!lst) return 0;
+
+  for (ptr = lst; ptr->free.next; ptr = ptr->free.next)
+    cnt++;
+
+  ptr->free.next = pptr->list, pptr->list = lst;
+  return cnt;
+}
+
+#if COS_MEM_REMOTE
+static void
+orphan_leave (void)
+{
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+  struct cos_mem_slot_ *restrict pptr = pool->slot;
+  struct chunk *chk;
+
+  for (unsigned slot = 0; slot < cos_mem_slab_max_; slot++, pptr++) {
+    union cos_mem_node_ *ptr = pptr->list;
+    size_t cnt = 1;
+
+    if (!ptr) continue;
+
+    while (ptr->free.next)
+      ptr = ptr->free.next, cnt++;
+
+    while (__atomic_exchange_n(&orphan_lock, 1, __ATOMIC_ACQUIRE)) ;
+    ptr->free.next = orphan[slot], orphan[slot] = pptr->list;
+    __atomic_store_n(&orphan_lock, 0, __ATOMIC_RELEASE);
+
+    pool->size -= cnt*slot*cos_mem_node_size_;
+    cos_mem_stat_(pool, slot, 0, 0, -(long)cnt);
+    pptr->list = 0;
+  }
+
+  while ((chk = pool->spare))
+    pool->spare = chk->nxt, munmap(chk, cos_mem_chunk_size_);
+  pool->spares = 0;
+}
+#endif
+
+int
+cos_mem_carve_ (unsigned slot)
+{
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+  struct cos_mem_slot_ *restrict pptr = pool->slot+slot;
+  size_t size = (slot+1)*cos_mem_node_size_;
+  size_t cnt  = orphan_adopt(pptr, slot);
+
+  if (!cnt) {
+    struct chunk *chk = chunk_new();
+    char *beg;
+
+    if (!chk) return 0;
+
+#if COS_MEM_STAT
+    stat_register();
+    pool->stat[cos_mem_get_class_(slot)].miss++;
+#endif
+
+    chk->slot = slot, chk->serial = pool->serial, chk->cnt = 0;
+    beg = (char*)chk + chunk_head;
+    cnt = chunk_nodes(slot);
+
+    // link in address order for locality
+    for (size_t i = cnt; i-- > 0;) {
+      union cos_mem_node_ *ptr = (union cos_mem_node_*)(void*)(beg + i*size);
+      ptr->free.next = pptr->list, pptr->list = ptr;
+    }
+  }
+
+  pool->size += cnt*slot*cos_mem_node_size_;
+  cos_mem_stat_(pool, slot, 0, 0, cnt);
+  return 1;
+}
+
+// remove the nodes of the empty chunks of a slot, return their number
+static size_t
+slab_collect (struct cos_mem_slot_ *pptr, unsigned slot)
+{
+  unsigned serial = cos_mem_pool_.serial;
+  union cos_mem_node_ *ptr, **pp;
+  struct chunk *chk, *lst = 0;
+  size_t max = chunk_nodes(slot), cnt = 0;
+
+  for (ptr = pptr->list; ptr; ptr = ptr->free.next)
+    if ((chk = CHUNK(ptr))->serial == serial) chk->cnt = 0;
+
+  for (ptr = pptr->list; ptr; ptr = ptr->free.next)
+    if ((chk = CHUNK(ptr))->serial == serial) chk->cnt++;
+
+  for (pp = &pptr->list; (ptr = *pp);) {
+    chk = CHUNK(ptr);
+
+    if (chk->serial != serial || chk->cnt < max) {
+      pp = &ptr->free.next;
+      continue;
+    }
+
+    if (chk->cnt == max) // first node seen, chunk to release
+      chk->cnt++, chk->nxt = lst, lst = chk;
+
+    *pp = ptr->free.next, cnt++;
+  }
+
+  while ((chk = lst))
+    lst = chk->nxt, chunk_del(chk);
+
+  return cnt;
+}
+
+#else
+
+static size_t
+slab_collect (struct cos_mem_slot_ *pptr, unsigned slot)
+{
+  COS_UNUSED(pptr), COS_UNUSED(slot);
+  return 0;
+}
+
+int
+cos_mem_carve_ (unsigned slot)
+{
+  COS_UNUSED(slot);
+  return 0;
+}
+
+#endif
+
 size_t __attribute__ ((noinline)) // avoid bug slowing code with openmp
 cos_mem_collect (int *percent_, size_t *only_)
 {
@@ -77,18 +336,530 @@ cos_mem_collect (int *percent_, size_t *only_)
   size_t size = 0;
 
   for (int slot=end; slot>=start; slot--, pptr--) {
-    int cnt = 0;
+    size_t cnt = 0;
 
-    for (union cos_mem_node_ *nxt, *ptr=pptr->list; ptr; ptr=nxt, cnt++) {
-      nxt = ptr->free.next;
-      free(ptr);
+    if (slot < cos_mem_slab_max_)
+      cnt = slab_collect(pptr, slot);
+    else {
+      for (union cos_mem_node_ *nxt, *ptr=pptr->list; ptr; ptr=nxt, cnt++) {
+        nxt = ptr->free.next;
+        free(ptr);
+      }
+      pptr->list = 0;
     }
 
-    pptr->list = 0;
     size += slot * cnt * cos_mem_node_size_;
+    cos_mem_stat_(pool, slot, 0, 0, -(long)cnt);
     if (size >= threshold) break;
   }
 
   pool->size -= size;
   return size;
 }
+
+// --- cross-thread frees -----------------------------------------------------
+
+#if COS_MEM_REMOTE
+
+/* NOTE-INFO: remote frees
+   A thread gets an owner tag on its first pool miss, stored in the header
+   of the nodes it allocates. A node freed by another thread is pushed (CAS)
+   onto the remote list of its owner, which takes the whole list (exchange)
+   on its next pool miss, so the list is multi-producer single-consumer and
+   free of ABA. The link is stored in the node data since the header keeps
+   the slot, nodes of slot 0 (no data) stay in the freeing thread's pool.
+   When the owner exits, its list is closed (later remote frees go back to
+   the system), its pool is collected and its tag can be reused. Frees
+   running after the exit of the pool (e.g. other TLS destructors) go to
+   the system or to the orphans of their slot, late allocations collect the
+   pool again at the next round of destructors.
+*/
+
+static cos_inline union cos_mem_node_*
+get_next (union cos_mem_node_ *ptr)
+{
+  union cos_mem_node_ *nxt;
+  memcpy(&nxt, ptr->used.data, sizeof nxt);
+  return nxt;
+}
+
+static cos_inline void
+set_next (union cos_mem_node_ *ptr, union cos_mem_node_ *nxt)
+{
+  memcpy(ptr->used.data, &nxt, sizeof nxt);
+}
+
+static union cos_mem_node_ remote_closed;
+#define CLOSED (&remote_closed)
+
+// owner tag of an exited pool
+#define EXITED (~0u)
+
+enum { owner_bits = CHAR_BIT*sizeof(unsigned long) };
+
+// owner tags in use (tag 0 is reserved)
+static unsigned long owner_map[cos_mem_owner_max_/owner_bits] = { 1 };
+
+static void
+push_late (union cos_mem_node_ *ptr)
+{
+#if COS_MEM_SLAB
+  unsigned slot = ptr->used.slot;
+
+  if (cos_mem_is_slab_(slot)) { // adopted by the next thread carving slot
+    while (__atomic_exchange_n(&orphan_lock, 1, __ATOMIC_ACQUIRE)) ;
+    ptr->free.next = orphan[slot], orphan[slot] = ptr;
+    __atomic_store_n(&orphan_lock, 0, __ATOMIC_RELEASE);
+    return;
+  }
+#endif
+  free(ptr);
+}
+
+static void
+push_local (union cos_mem_node_ *ptr)
+{
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+  struct cos_mem_slot_ *restrict pptr = pool->slot+ptr->used.slot;
+
+  if (!pool->owner) cos_mem_drain_(); // collect the pool at thread exit
+
+  if (pool->owner == EXITED) { // the pool will not be collected again
+    push_late(ptr);
+    return;
+  }
+
+  pool->size += ptr->used.slot*cos_mem_node_size_;
+  cos_mem_stat_(pool, ptr->used.slot, 0, 0, 1);
+  ptr->free.next = pptr->list, pptr->list = ptr;
+}
+
+static unsigned
+owner_get (void)
+{
+  for (int i = 0; i < cos_mem_owner_max_/owner_bits; i++) {
+    unsigned long map = __atomic_load_n(owner_map+i, __ATOMIC_RELAXED);
+
+    while (~map) {
+      int bit = __builtin_ctzl(~map);
+
+      if (__atomic_compare_exchange_n(owner_map+i, &map, map | 1UL << bit, 0,
+                                      __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        return i*owner_bits + bit;
+    }
+  }
+
+  return cos_mem_owner_max_; // no more tag, the pool is not owned
+}
+
+static void
+owner_put (unsigned owner)
+{
+  __atomic_fetch_and(owner_map + owner/owner_bits,
+                     ~(1UL << owner%owner_bits), __ATOMIC_RELEASE);
+}
+
+static void
+remote_exit (void)
+{
+  struct cos_mem_pool_ *pool = &cos_mem_pool_;
+  union  cos_mem_node_ *ptr, *nxt;
+
+  if (!pool->owner)
+    return;
+
+  if (pool->owner < cos_mem_owner_max_) {
+    ptr = __atomic_exchange_n(&cos_mem_remote_[pool->owner].list, CLOSED,
+                              __ATOMIC_ACQ_REL);
+
+    for (; ptr; ptr = nxt)
+      nxt = get_next(ptr), push_local(ptr);
+  }
+
+  // also called again for late allocations
+  cos_mem_collect(0,0);
+#if COS_MEM_SLAB
+  orphan_leave();
+#endif
+  if (pool->owner < cos_mem_owner_max_)
+    owner_put(pool->owner);
+  pool->owner = EXITED;
+}
+
+int
+cos_mem_drain_ (void)
+{
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+  union  cos_mem_node_ *ptr, *nxt;
+  size_t cnt = 0;
+
+  if (!pool->owner) {
+    pool->owner = owner_get();
+    if (pool->owner < cos_mem_owner_max_) {
+      // reopen the list of a previous owner
+      __atomic_store_n(&cos_mem_remote_[pool->owner].list, 0, __ATOMIC_RELEASE);
+      pool_atexit();
+    }
+    return 0;
+  }
+
+  if (pool->owner >= cos_mem_owner_max_) {
+    if (pool->owner == EXITED) pool_atexit(); // late allocation, collect again
+    return 0;
+  }
+
+  ptr = __atomic_load_n(&cos_mem_remote_[pool->owner].list, __ATOMIC_RELAXED);
+  if (!ptr || ptr == CLOSED)
+    return 0;
+
+  ptr = __atomic_exchange_n(&cos_mem_remote_[pool->owner].list, 0,
+                            __ATOMIC_ACQUIRE);
+
+  for (; ptr; ptr = nxt, cnt++)
+    nxt = get_next(ptr), push_local(ptr);
+
+  pool->recv += cnt;
+  return 1;
+}
+
+void
+cos_mem_sendto_ (union cos_mem_node_ *ptr)
+{
+  unsigned owner = ptr->used.owner;
+  union cos_mem_node_ *lst;
+
+#if COS_MEM_STAT
+  stat_register();
+  cos_mem_stat_(&cos_mem_pool_, ptr->used.slot, 0, 1, 0);
+#endif
+
+  if (!ptr->used.slot || owner >= cos_mem_owner_max_) {
+    push_local(ptr);
+    return;
+  }
+
+  lst = __atomic_load_n(&cos_mem_remote_[owner].list, __ATOMIC_RELAXED);
+
+  do {
+    if (lst == CLOSED) { // owner has exited
+#if COS_MEM_SLAB
+      if (cos_mem_is_slab_(ptr->used.slot)) push_local(ptr); else
+#endif
+      free(ptr);
+      return;
+    }
+    set_next(ptr, lst);
+  } while (!__atomic_compare_exchange_n(&cos_mem_remote_[owner].list, &lst,
+                                        ptr, 1, __ATOMIC_RELEASE,
+                                                __ATOMIC_RELAXED));
+
+  cos_mem_pool_.sent++;
+}
+
+size_t __attribute__ ((noinline))
+cos_mem_remote (size_t *recv_, size_t *sent_)
+{
+  struct cos_mem_pool_ *restrict pool = &cos_mem_pool_;
+  size_t size = 0;
+
+  if (pool->owner && pool->owner < cos_mem_owner_max_) {
+    union cos_mem_node_ *ptr =
+      __atomic_load_n(&cos_mem_remote_[pool->owner].list, __ATOMIC_ACQUIRE);
+
+    // nodes are only removed by the owner
+    for (; ptr && ptr != CLOSED; ptr = get_next(ptr))
+      size += ptr->used.slot * cos_mem_node_size_;
+  }
+
+  if (recv_) *recv_ = pool->recv;
+  if (sent_) *sent_ = pool->sent;
+  return size;
+}
+
+#else
+
+size_t __attribute__ ((noinline))
+cos_mem_remote (size_t *recv_, size_t *sent_)
+{
+  if (recv_) *recv_ = 0;
+  if (sent_) *sent_ = 0;
+  return 0;
+}
+
+#endif
+
+// --- statistics -------------------------------------------------------------
+
+#if COS_MEM_STAT
+
+/* NOTE-INFO: statistics
+   Each thread counts in its own pool (no atomic), pools are registered on
+   their first miss or remote free and the counters of exited threads are
+   added to stat_done. Counters of running threads are read without
+   synchronization by cos_mem_stats, they are only indicative.
+*/
+
+enum { site_max = 256 }; // sampled sites (power of 2)
+
+static char     stat_end;
+static int      stat_lock;
+static unsigned stat_threads, stat_exited;
+static struct cos_mem_stat_ stat_done[cos_mem_class_max_];
+
+#define STAT_END ((struct cos_mem_pool_*)(void*)&stat_end)
+
+static struct cos_mem_pool_ *stat_pools = STAT_END;
+
+static struct site {
+  void  *site;
+  size_t cnt, size; // samples and bytes
+} site_tbl[site_max];
+
+static void (*sample_hook)(void*, size_t, void*);
+
+static void
+lock (void)
+{
+  while (__atomic_exchange_n(&stat_lock, 1, __ATOMIC_ACQUIRE)) ;
+}
+
+static void
+unlock (void)
+{
+  __atomic_store_n(&stat_lock, 0, __ATOMIC_RELEASE);
+}
+
+static void
+stat_register (void)
+{
+  struct cos_mem_pool_ *pool = &cos_mem_pool_;
+
+  if (pool->next) return;
+
+  lock();
+  pool->next = stat_pools, stat_pools = pool;
+  stat_threads++;
+  unlock();
+
+  pool_atexit();
+}
+
+static void
+stat_add (struct cos_mem_stat_ *sum, struct cos_mem_stat_ *stat)
+{
+  for (int i = 0; i < cos_mem_class_max_; i++) {
+    sum[i].alloc  += stat[i].alloc;
+    sum[i].free   += stat[i].free;
+    sum[i].miss   += stat[i].miss;
+    sum[i].cached += stat[i].cached;
+    sum[i].peak   += stat[i].peak;
+  }
+}
+
+static void
+stat_exit (void)
+{
+  struct cos_mem_pool_ *pool = &cos_mem_pool_, **pp;
+
+  lock();
+  for (pp = &stat_pools; *pp != STAT_END; pp = &(*pp)->next)
+    if (*pp == pool) {
+      *pp = pool->next;
+      stat_add(stat_done, pool->stat);
+      stat_threads--, stat_exited++;
+      break;
+    }
+  unlock();
+
+  pool->next = STAT_END; // do not register again
+}
+
+void
+cos_mem_missed_ (unsigned slot, unsigned cnt)
+{
+  struct cos_mem_stat_ *stat = cos_mem_pool_.stat + cos_mem_get_class_(slot);
+
+  stat_register();
+  stat->alloc += cnt;
+  stat->miss  += cnt;
+}
+
+void __attribute__ ((noinline)) // the return address is the allocation site
+cos_mem_sample_ (void *ptr, size_t size)
+{
+  void *site = __builtin_return_address(0);
+  void (*hook)(void*, size_t, void*) = __atomic_load_n(&sample_hook, __ATOMIC_ACQUIRE);
+  size_t idx = ((uintptr_t)site >> 2) * 2654435761u;
+
+  cos_mem_pool_.sample = 0;
+
+  if (hook) {
+    hook(ptr, size, site);
+    return;
+  }
+
+  // open addressing, sites are never removed
+  for (int i = 0; i < site_max; i++, idx++) {
+    void *cur = 0;
+
+    idx &= site_max-1;
+    if (__atomic_compare_exchange_n(&site_tbl[idx].site, &cur, site, 0,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+        || cur == site) {
+      __atomic_fetch_add(&site_tbl[idx].cnt , 1   , __ATOMIC_RELAXED);
+      __atomic_fetch_add(&site_tbl[idx].size, size, __ATOMIC_RELAXED);
+      return;
+    }
+  }
+}
+
+void
+cos_mem_sampler (unsigned period, void (*hook_)(void *ptr, size_t size, void *site))
+{
+  __atomic_store_n(&sample_hook, hook_, __ATOMIC_RELEASE);
+  __atomic_store_n(&cos_mem_sample_period_, period, __ATOMIC_RELEASE);
+}
+
+static int
+site_cmp (const void *a, const void *b)
+{
+  size_t ca = ((const struct site*)a)->cnt;
+  size_t cb = ((const struct site*)b)->cnt;
+
+  return (ca < cb) - (ca > cb);
+}
+
+void
+cos_mem_stats (FILE *fp)
+{
+  static struct site site[site_max];
+  struct cos_mem_stat_ sum[cos_mem_class_max_], tot = { 0 };
+  unsigned threads, exited;
+  int n = 0;
+
+  if (!fp) fp = stderr;
+
+  lock();
+  memcpy(sum, stat_done, sizeof sum);
+  for (struct cos_mem_pool_ *pool = stat_pools; pool != STAT_END; pool = pool->next)
+    stat_add(sum, pool->stat);
+  threads = stat_threads, exited = stat_exited;
+  unlock();
+
+  fprintf(fp,"memory: threads=%u, exited=%u, pool max=%zu, sampling=%u\n",
+          threads, exited, cos_mem_pool_max_, cos_mem_sample_period_);
+
+  for (int i = 0; i < cos_mem_class_max_; i++) {
+    size_t lo = i ? (size_t)1 << (i-1) : 0, hi = i ? 2*lo-1 : 0;
+
+    tot.alloc  += sum[i].alloc , tot.free += sum[i].free, tot.miss += sum[i].miss;
+    tot.cached += sum[i].cached, tot.peak += sum[i].peak;
+
+    if (!sum[i].alloc && !sum[i].free) continue;
+
+    if (i < cos_mem_class_max_-1)
+      fprintf(fp,"memory[%2d]: size=[%6zu,%6zu], ", i,
+              lo*cos_mem_node_size_, hi*cos_mem_node_size_);
+    else
+      fprintf(fp,"memory[%2d]: size=[%6zu,  more], ", i, lo*cos_mem_node_size_);
+
+    fprintf(fp,"alloc=%zu, free=%zu, miss=%zu, cached=%zu, peak=%zu\n",
+            sum[i].alloc, sum[i].free, sum[i].miss, sum[i].cached, sum[i].peak);
+  }
+
+  fprintf(fp,"memory: alloc=%zu, free=%zu, miss=%zu, cached=%zu, peak<=%zu\n",
+          tot.alloc, tot.free, tot.miss, tot.cached, tot.peak);
+
+  // sampled sites, most frequent first
+  for (int i = 0; i < site_max; i++)
+    if (__atomic_load_n(&site_tbl[i].site, __ATOMIC_RELAXED))
+      site[n].site = site_tbl[i].site,
+      site[n].cnt  = __atomic_load_n(&site_tbl[i].cnt , __ATOMIC_RELAXED),
+      site[n].size = __atomic_load_n(&site_tbl[i].size, __ATOMIC_RELAXED), n++;
+
+  qsort(site, n, sizeof *site, site_cmp);
+
+  for (int i = 0; i < n && i < 16; i++)
+    fprintf(fp,"memory site %p: samples=%zu, bytes=%zu\n",
+            site[i].site, site[i].cnt, site[i].size);
+}
+
+#else
+
+void
+cos_mem_missed_ (unsigned slot, unsigned cnt)
+{
+  COS_UNUSED(slot), COS_UNUSED(cnt);
+}
+
+void
+cos_mem_sample_ (void *ptr, size_t size)
+{
+  COS_UNUSED(ptr), COS_UNUSED(size);
+}
+
+void
+cos_mem_sampler (unsigned period, void (*hook_)(void *ptr, size_t size, void *site))
+{
+  COS_UNUSED(period), COS_UNUSED(hook_);
+}
+
+void
+cos_mem_stats (FILE *fp)
+{
+  if (!fp) fp = stderr;
+
+  fprintf(fp,"memory: pool=%zu, pool max=%zu (statistics disabled, see COS_MEM_STAT)\n",
+          cos_mem_pool_.size, cos_mem_pool_max_);
+}
+
+#endif
+
+// --- thread exit ------------------------------------------------------------
+
+#if COS_MEM_REMOTE || COS_MEM_STAT
+#if COS_HAS_POSIX && (COS_HAS_TLS || defined(_OPENMP))
+
+#include <pthread.h>
+
+static pthread_key_t  pool_key;
+static pthread_once_t pool_key_once = PTHREAD_ONCE_INIT;
+
+static void
+pool_exit (void *pool)
+{
+  COS_UNUSED(pool);
+
+#if COS_MEM_REMOTE
+  remote_exit();
+#endif
+#if COS_MEM_STAT
+  stat_exit();
+#endif
+}
+
+static void
+make_key (void)
+{
+  if ( pthread_key_create(&pool_key, pool_exit) )
+    cos_abort("unable to initialize memory pool key");
+}
+
+static void
+pool_atexit (void)
+{
+  pthread_once(&pool_key_once, make_key);
+
+  if ( pthread_setspecific(pool_key, &cos_mem_pool_) )
+    cos_abort("unable to initialize memory pool");
+}
+
+#else
+
+static void
+pool_atexit (void)
+{
+}
+
+#endif
+#endif
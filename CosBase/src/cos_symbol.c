@@ -35,6 +35,41 @@
 
 enum { MAX_TBL = 100 }; // maximum number of modules (& plug-in)
 
+/* NOTE-CONF: Dispatch tables
+ * Generics with at least COS_METHOD_TABLE_MINMTH methods get a compressed
+ * dispatch table used by cos_method_get1..5 on cache misses, as long as it
+ * holds at most COS_METHOD_TABLE_MAXCEL cells. Other generics are resolved
+ * by scanning their sorted methods.
+ */
+#define COS_METHOD_TABLE_MINMTH 8
+#define COS_METHOD_TABLE_MAXCEL 65536
+
+/* NOTE-INFO: Dispatch tables
+ * The classes specializing the argument k of a generic are its poles. For
+ * each argument, row[k] maps every class (by preorder index of the classes
+ * forest) to its nearest pole (0 = none), poles being numbered in preorder
+ * so the poles below a pole are contiguous. The cells of the N-dimensional
+ * table hold the most specific method of each tuple of poles, so a lookup
+ * costs one probe per argument plus one for the cell.
+ */
+struct dsp {
+  U16 *cel;                 // method index+1, at sum of row[k][cls]*stp[k]
+  U16 *row[COS_GEN_RNKMAX]; // class preorder index -> pole index (shared)
+  U32  stp[COS_GEN_RNKMAX]; // strides
+  U32  ncel;
+};
+
+/* NOTE-INFO: Classes ranges
+ * Classes, meta classes and property meta classes are numbered in preorder
+ * of the classes forest, the classes below a class being numbered within
+ * [pre, pre+len). This makes the subclass test constant-time, it falls back
+ * to the walk of the superclasses while symbols are (re)initialized.
+ */
+struct cls_rng {
+  U32 pre; // preorder index
+  U32 len; // number of classes below (including itself)
+};
+
 static U32          tbl_ini = 0; // index of first table not yet initialized
 static struct Any **tbl_sym[MAX_TBL];
 static void        *tbl_mod[MAX_TBL];
@@ -47,8 +82,14 @@ static struct {
   struct Generic    **gen; // sorted  by name
   struct Method     **mth; // sorted  by gen-name,mth-rank,rnd-rank,cls-name
   struct MetaDocStr **doc; // sorted  by obj-type,obj-name,name
-  FCT               **nxt; // not sorted
-  U32 msk, n_cls, n_prp, n_gen, n_mth, n_doc, n_nxt, m_nxt;
+  struct nxt         *nxt; // lock-free log, not sorted
+  U32               *stp; // indexed by id % msk, generic methods generation
+  struct cls_rng    *rng; // indexed by id % msk, class preorder range
+  struct dsp       **dsp; // indexed by id % msk, generic dispatch table
+  U16              **row; // dispatch tables rows, not sorted
+  U32               *hsh; // dispatch tables rows hash
+  U32 n_row;
+  U32 msk, n_cls, n_prp, n_gen, n_mth, n_doc;
 } sym;
 
 // forward decl
@@ -262,12 +303,56 @@ gen_strcmp(const void *str, const void *_gen)
   return strcmp(str,gen->str);
 }
 
+// -- sorting
+
+/* NOTE-INFO: Presorted symbols
+ * cossym emits the symbols of each module with classes and generics in name
+ * order and methods grouped by generic name, so the symbols stored by
+ * sym_init form few sorted runs (one per module) which are merged instead
+ * of being sorted. Methods are distributed per generic before being sorted,
+ * which avoids comparing the names of their generics.
+ */
+static void
+sym_sort(void **a, U32 n, int (*cmp)(const void*, const void*), void **b)
+{
+  void **src, **dst, **tmp;
+  U32 i, j, k, l, p, q, nrun;
+
+  // already sorted (common case)
+  for (i = 1; i < n && cmp(a+i-1, a+i) <= 0; i++) ;
+  if (i >= n) return;
+
+  // merge pairs of adjacent runs until one is left (stable)
+  src = a, dst = b;
+  do {
+    for (nrun = 0, i = 0; i < n; i = k, nrun++) {
+      for (j = i+1; j < n && cmp(src+j-1, src+j) <= 0; j++) ;
+      for (k = j < n ? j+1 : n; k < n && cmp(src+k-1, src+k) <= 0; k++) ;
+      for (l = i, p = i, q = j; l < k; l++)
+        dst[l] = q >= k || (p < j && cmp(src+p, src+q) <= 0) ? src[p++] : src[q++];
+    }
+    tmp = src, src = dst, dst = tmp;
+  } while (nrun > 1);
+
+  if (src != a)
+    memcpy(a, src, n * sizeof *a);
+}
+
 // -- predicates
 
 static inline BOOL
 cls_isSubOf(const struct Class *cls, const struct Class *ref)
 {
-  U32 ref_id = COS_ID_URK(cos_class_id(ref));
+  U32 ref_id;
+
+  if (sym.rng) {
+    const struct cls_rng *c = sym.rng + (cls->Behavior.id & sym.msk);
+    const struct cls_rng *r = sym.rng + (ref->Behavior.id & sym.msk);
+
+    return c->pre - r->pre < r->len;
+  }
+
+  ref_id = COS_ID_URK(cos_class_id(ref));
   
   // a class is a subclass of itself
   while (cos_class_id(cls) > ref_id)
@@ -357,20 +442,22 @@ static inline void
 bhv_enlarge(U32 msk)
 {
   struct Behavior **bhv = calloc(msk+1, sizeof *bhv);
+  U32 *stp = calloc(msk+1, sizeof *stp);
   U32 i;
 
-  if (!bhv)
+  if (!bhv || !stp)
     cos_abort("out of memory while storing symbols");
 
   if (sym.bhv) {
     for (i = 0; i <= sym.msk; i++) {
       struct Behavior *b = sym.bhv[i];
-      if (b) bhv[b->id & msk] = b;
+      if (b) bhv[b->id & msk] = b, stp[b->id & msk] = sym.stp[i];
     }
     free(sym.bhv);
+    free(sym.stp);
   }
 
-  sym.bhv = bhv, sym.msk = msk;
+  sym.bhv = bhv, sym.stp = stp, sym.msk = msk;
 }
 
 static inline void
@@ -547,33 +634,98 @@ cls_setClassProp(const struct Generic *gen)
 
 // -- next_method management
 
+/* NOTE-INFO: next_method log
+ * Initialized next_method slots are logged to be reset when modules are
+ * loaded. The log is a lock-free stack: threads push the slots they
+ * published, nxt_clear takes the whole log at once and nxt_reset pushes
+ * back the slots of generics which did not gain methods.
+ */
+struct nxt {
+  struct nxt *prv;
+  FCT *fct;
+  U32  idg;
+};
+
+#ifdef __GNUC__
+static U32 nxt_busy; // threads resolving a slot (see cos_method_nextInit)
+#endif
+
+static inline void
+nxt_quiescent(void)
+{
+#ifdef __GNUC__
+  // slots are read without atomic load, no thread may be dispatching
+  if (__atomic_load_n(&nxt_busy, __ATOMIC_ACQUIRE))
+    cos_abort("next_method slots reset while another thread dispatches");
+#endif
+}
+
+static inline void
+nxt_push(struct nxt *nxt)
+{
+#ifdef __GNUC__
+  nxt->prv = __atomic_load_n(&sym.nxt, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n(&sym.nxt, &nxt->prv, nxt, YES,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED)) ;
+#else
+  nxt->prv = sym.nxt, sym.nxt = nxt;
+#endif
+}
+
+static inline struct nxt*
+nxt_take(void)
+{
+#ifdef __GNUC__
+  return __atomic_exchange_n(&sym.nxt, 0, __ATOMIC_ACQUIRE);
+#else
+  struct nxt *nxt = sym.nxt;
+  sym.nxt = 0;
+  return nxt;
+#endif
+}
+
 static inline void
-nxt_enlarge(void)
+nxt_add(FCT *fct, U32 idg)
 {
-  U32 m = sym.m_nxt < 128 ? 128 : sym.m_nxt*2;
-  FCT **nxt = realloc(sym.nxt, m * sizeof *sym.nxt);
+  struct nxt *nxt = malloc(sizeof *nxt);
 
   if (!nxt)
     cos_abort("out of memory during next_method registration");
 
-  sym.nxt = nxt;
-  sym.m_nxt = m;
+  nxt->fct = fct;
+  nxt->idg = idg;
+  nxt_push(nxt);
 }
 
 static inline void
-nxt_add(FCT *fct)
+nxt_clear(void)
 {
-  if (sym.n_nxt == sym.m_nxt)
-    nxt_enlarge();
+  struct nxt *nxt, *prv;
 
-  sym.nxt[sym.n_nxt++] = fct;
+  nxt_quiescent();
+
+  for (nxt = nxt_take(); nxt; nxt = prv) {
+    prv = nxt->prv;
+    *nxt->fct = (FCT)YES;
+    free(nxt);
+  }
 }
 
 static inline void
-nxt_clear(void)
+nxt_reset(U32 gen)
 {
-  while (sym.n_nxt)
-    *sym.nxt[--sym.n_nxt] = (FCT)YES;
+  struct nxt *nxt, *prv;
+
+  nxt_quiescent();
+
+  // reset slots of generics which gained methods since gen
+  for (nxt = nxt_take(); nxt; nxt = prv) {
+    prv = nxt->prv;
+    if (sym.stp[nxt->idg & sym.msk] > gen)
+      *nxt->fct = (FCT)YES, free(nxt);
+    else
+      nxt_push(nxt);
+  }
 }
 
 static inline BOOL
@@ -625,6 +777,302 @@ nxt_init(SEL gen, U32 info, U32 arnd, struct Class *const *cls)
   return 0;
 }
 
+// -- classes ranges management
+
+static void
+cls_clearRange(void)
+{
+  if (sym.rng) free(sym.rng), sym.rng = 0;
+}
+
+static void
+cls_setRange(void)
+{
+  U32 n = 3*sym.n_cls, i, t, r;
+  struct Class **cls;
+  struct cls_rng *rng;
+  U32 *tmp, *par, *kid, *sib, *pre, *end;
+
+  cls_clearRange();
+
+  rng = malloc((sym.msk+1) * sizeof *rng);
+  cls = malloc(n * sizeof *cls + 1);
+  tmp = malloc(5*n * sizeof *tmp + 1);
+
+  if (!rng || !cls || !tmp)
+    cos_abort("out of memory while numbering classes");
+
+  par = tmp, kid = par+n, sib = kid+n, pre = sib+n, end = pre+n;
+
+  // classes, property meta classes and meta classes
+  for (t = i = 0; i < sym.n_cls; i++) {
+    struct Class *pcl = cos_object_class((OBJ)sym.cls[i]);
+    cls[t] = sym.cls[i], rng[cls[t]->Behavior.id & sym.msk].pre = t, ++t;
+    cls[t] = pcl       , rng[cls[t]->Behavior.id & sym.msk].pre = t, ++t;
+    cls[t] = pcl->spr  , rng[cls[t]->Behavior.id & sym.msk].pre = t, ++t;
+  }
+
+  // classes forest
+  for (t = 0; t < n; t++)
+    kid[t] = sib[t] = n;
+
+  for (t = n; t-- > 0; ) {
+    par[t] = cls[t]->spr ? rng[cls[t]->spr->Behavior.id & sym.msk].pre : n;
+    if (par[t] < n) sib[t] = kid[par[t]], kid[par[t]] = t;
+  }
+
+  // preorder numbering
+  for (i = 0, r = 0; r < n; r++) {
+    if (par[r] < n) continue;
+
+    for (t = r;;) {
+      pre[t] = i++;
+      if (kid[t] < n) { t = kid[t]; continue; }
+      while (end[t] = i, t != r && sib[t] == n) t = par[t];
+      if (t == r) break;
+      t = sib[t];
+    }
+  }
+
+  for (t = 0; t < n; t++) {
+    struct cls_rng *c = rng + (cls[t]->Behavior.id & sym.msk);
+    c->pre = pre[t], c->len = end[t]-pre[t];
+  }
+
+  free(tmp);
+  free(cls);
+
+  sym.rng = rng;
+}
+
+// -- dispatch tables management
+
+static inline U32
+cls_pre(const struct Class *cls)
+{
+  return sym.rng[cls->Behavior.id & sym.msk].pre;
+}
+
+static U16*
+dsp_row(U16 *row, U32 n)
+{
+  U32 i, h = 2166136261u; // FNV-1a
+
+  for (i = 0; i < n; i++)
+    h = (h ^ row[i]) * 16777619u;
+
+  // share identical rows
+  for (i = 0; i < sym.n_row; i++)
+    if (sym.hsh[i] == h && !memcmp(sym.row[i], row, n * sizeof *row))
+      return sym.row[i];
+
+  sym.row[sym.n_row] = malloc(n * sizeof *row);
+  if (!sym.row[sym.n_row])
+    cos_abort("out of memory while building dispatch tables");
+
+  memcpy(sym.row[sym.n_row], row, n * sizeof *row);
+  sym.hsh[sym.n_row] = h;
+
+  return sym.row[sym.n_row++];
+}
+
+static void
+dsp_paint(struct dsp *dsp, U32 rnk, const U32 *lo, const U32 *hi, U16 mth)
+{
+  U32 idx[COS_GEN_RNKMAX];
+  U32 off;
+  int k;
+
+  for (k = 0; k < (int)rnk; k++)
+    idx[k] = lo[k];
+
+  for (;;) {
+    for (off = 0, k = 0; k < (int)rnk; k++)
+      off += idx[k] * dsp->stp[k];
+
+    dsp->cel[off] = mth;
+
+    for (k = rnk-1; k >= 0; k--) {
+      if (++idx[k] <= hi[k]) break;
+      idx[k] = lo[k];
+    }
+
+    if (k < 0) break;
+  }
+}
+
+static struct dsp*
+dsp_make(const struct Generic *gen, U32 n, const U32 *par, const U32 *end,
+         U32 *acc, U16 *row)
+{
+  struct Method5 **mth = CAST(struct Method5**, sym.mth)+gen->mth;
+  U32 n_mth = COS_GEN_NMTH(gen);
+  U32 rnk = COS_GEN_RNK(gen);
+  U32 lo[COS_GEN_RNKMAX], hi[COS_GEN_RNKMAX];
+  U32 i, k, np, ncel = 1;
+  struct dsp *dsp;
+
+  if (n_mth >= (U16)-1)
+    return 0;
+
+  for (k = 0; k < rnk; k++) {
+    U32 *cnt = acc + k*(n+1);
+
+    // mark poles
+    memset(row, 0, n * sizeof *row);
+    for (i = 0; i < n_mth; i++)
+      row[cls_pre(mth[i]->cls[k])] = 1;
+
+    // number poles in preorder, other classes get their nearest pole
+    for (np = 0, i = 0; i < n; i++) {
+      cnt[i] = np;
+      row[i] = row[i] ? ++np : par[i] < n ? row[par[i]] : 0;
+    }
+    cnt[n] = np;
+
+    if (np >= (U16)-1 || ncel > COS_METHOD_TABLE_MAXCEL/(np+1))
+      return 0;
+
+    lo[k] = np+1;
+    ncel *= np+1;
+
+    row += n;
+  }
+
+  dsp = malloc(sizeof *dsp);
+  if (!dsp)
+    cos_abort("out of memory while building dispatch tables");
+
+  // rows and strides
+  for (i = 1, k = rnk; k-- > 0; ) {
+    row -= n;
+    dsp->row[k] = dsp_row(row, n);
+    dsp->stp[k] = i, i *= lo[k];
+  }
+
+  dsp->ncel = ncel;
+  dsp->cel  = calloc(ncel, sizeof *dsp->cel);
+  if (!dsp->cel)
+    cos_abort("out of memory while building dispatch tables");
+
+  // paint the poles below each method, most specific methods last
+  for (i = n_mth; i-- > 0; ) {
+    for (k = 0; k < rnk; k++) {
+      U32 pre = cls_pre(mth[i]->cls[k]);
+      lo[k] = dsp->row[k][pre];
+      hi[k] = acc[k*(n+1) + end[pre]];
+    }
+    dsp_paint(dsp, rnk, lo, hi, i+1);
+  }
+
+  return dsp;
+}
+
+static void
+dsp_clear(void)
+{
+  U32 i;
+
+  if (sym.dsp) {
+    for (i = 0; i <= sym.msk; i++)
+      if (sym.dsp[i])
+        free(sym.dsp[i]->cel), free(sym.dsp[i]);
+    free(sym.dsp), sym.dsp = 0;
+  }
+
+  if (sym.row) {
+    for (i = 0; i < sym.n_row; i++)
+      free(sym.row[i]);
+    free(sym.row), sym.row = 0, sym.hsh = 0, sym.n_row = 0;
+  }
+}
+
+static inline BOOL
+dsp_stale(const struct Generic *gen, U32 stp)
+{
+  return !stp || sym.stp[gen->Behavior.id & sym.msk] == stp;
+}
+
+static void
+dsp_init(U32 stp) // rebuild the tables of generics stamped stp (0: all)
+{
+  U32 n = 3*sym.n_cls, n_row = sym.n_row, n_gen = 0, i;
+  struct Class **cls;
+  U32 *tmp, *par, *end, *acc;
+  U16 **rows, *row;
+
+  for (i = 0; i < sym.n_gen; i++)
+    if (dsp_stale(sym.gen[i], stp)) {
+      ++n_gen;
+      if (COS_GEN_NMTH(sym.gen[i]) >= COS_METHOD_TABLE_MINMTH)
+        n_row += COS_GEN_RNK(sym.gen[i]);
+    }
+
+  if (!sym.dsp) {
+    sym.dsp = calloc(sym.msk+1, sizeof *sym.dsp);
+    if (!sym.dsp)
+      cos_abort("out of memory while building dispatch tables");
+  }
+
+  if (!n_gen)
+    return;
+
+  // keep the current rows, they may be shared by unchanged tables
+  rows = malloc(n_row * (sizeof *rows + sizeof *sym.hsh) + 1);
+  if (!rows)
+    cos_abort("out of memory while building dispatch tables");
+
+  if (sym.n_row) {
+    memcpy(rows, sym.row, sym.n_row * sizeof *rows);
+    memcpy(rows + n_row, sym.hsh, sym.n_row * sizeof *sym.hsh);
+  }
+
+  free(sym.row);
+  sym.row = rows;
+  sym.hsh = (U32*)(rows + n_row);
+
+  cls = malloc(n * sizeof *cls + 1);
+  tmp = malloc((2*n + COS_GEN_RNKMAX*(n+1)) * sizeof *tmp);
+  row = malloc(COS_GEN_RNKMAX*n * sizeof *row + 1);
+
+  if (!cls || !tmp || !row)
+    cos_abort("out of memory while building dispatch tables");
+
+  par = tmp, end = par+n, acc = end+n;
+
+  // classes in preorder
+  for (i = 0; i < sym.n_cls; i++) {
+    struct Class *pcl = cos_object_class((OBJ)sym.cls[i]);
+    cls[cls_pre(sym.cls[i])] = sym.cls[i];
+    cls[cls_pre(pcl)]        = pcl;
+    cls[cls_pre(pcl->spr)]   = pcl->spr;
+  }
+
+  for (i = 0; i < n; i++) {
+    par[i] = cls[i]->spr ? cls_pre(cls[i]->spr) : n;
+    end[i] = i + sym.rng[cls[i]->Behavior.id & sym.msk].len;
+  }
+
+  // generics tables
+  for (i = 0; i < sym.n_gen; i++) {
+    struct Generic *gen = sym.gen[i];
+    struct dsp **dsp = sym.dsp + (gen->Behavior.id & sym.msk);
+
+    if (!dsp_stale(gen, stp))
+      continue;
+
+    if (*dsp)
+      free((*dsp)->cel), free(*dsp), *dsp = 0;
+
+    if (COS_GEN_NMTH(gen) >= COS_METHOD_TABLE_MINMTH)
+      *dsp = dsp_make(gen, n, par, end, acc, row);
+  }
+
+  free(row);
+  free(tmp);
+  free(cls);
+}
+
 // -- memory management
 
 static void
@@ -650,14 +1098,111 @@ sym_prepStorage(U32 n_cls, U32 n_gen, U32 n_mth, U32 n_doc)
   }
 }
 
+// -- init phases
+
+enum { phs_scan, phs_store, phs_sort, phs_link, phs_table, phs_init, phs_max };
+
+static const STR init_phsname[phs_max] = {
+  "scan symbols", "store symbols", "sort symbols",
+  "link symbols", "dispatch tables", "classes initialize"
+};
+static double  init_phsdur[phs_max];
+static clock_t init_phsclk;
+
+static inline void
+phs_start(void)
+{
+  init_phsclk = clock();
+}
+
+static inline void
+phs_end(U32 phs)
+{
+  clock_t t = clock();
+  init_phsdur[phs] += (double)(t - init_phsclk) / CLOCKS_PER_SEC;
+  init_phsclk = t;
+}
+
 // -- symbols management
 
+/* NOTE-INFO: Incremental loading
+ * Loaded modules are merged into the sorted symbols, then the generics
+ * gaining methods of already initialized classes are stamped with a new
+ * generation (methods of new classes cannot change resolved methods).
+ * Only their next_method slots, dispatch tables and shared dispatch cells
+ * are reset (all tables are rebuilt if the load adds classes), and each
+ * thread drops their entries from its caches when it sees the new
+ * generation at its next lookup. Loading must not race with cache misses.
+ */
+U32 cos_method_generation_ = 0;
+U32 cos_method_siteGeneration_ = 0;
+
+static BOOL
+gen_stamp(U32 gen)
+{
+  BOOL stamped = NO;
+  U32 t, s, i, n;
+
+  for (t = tbl_ini; t < MAX_TBL && tbl_sym[t]; t++)
+    for (s = 0; tbl_sym[t][s]; s++)
+      if (tbl_sym[t][s]->_rc == cos_tag_method) {
+        struct Method5 *mth = CAST(struct Method5*, tbl_sym[t][s]);
+
+        n = COS_GEN_RNK(mth->Method.gen);
+        for (i = 0; i < n && mth->cls[i]->Behavior.Object.Any._rc == COS_RC_STATIC; i++) ;
+
+        if (i == n) {
+          sym.stp[mth->Method.gen->Behavior.id & sym.msk] = gen;
+          stamped = YES;
+        }
+      }
+
+  return stamped;
+}
+
+static inline U32
+sym_maxCnt(void)
+{
+  U32 n = sym.n_cls;
+
+  if (n < sym.n_gen) n = sym.n_gen;
+  if (n < sym.n_mth) n = sym.n_mth;
+  if (n < sym.n_doc) n = sym.n_doc;
+
+  return n ? n : 1;
+}
+
+static void
+mth_sort(void **tmp)
+{
+  U32 i;
+
+  // check generics' methods counts and set their indexes
+  gen_setMth();
+
+  // distribute methods per generic (index used as cursor)
+  for (i = 0; i < sym.n_mth; i++)
+    tmp[sym.mth[i]->gen->mth++] = sym.mth[i];
+
+  memcpy(sym.mth, tmp, sym.n_mth * sizeof *sym.mth);
+
+  // reset indexes and sort methods per generic
+  gen_setMth();
+
+  for (i = 0; i < sym.n_gen; i++)
+    sym_sort((void**)sym.mth + sym.gen[i]->mth, COS_GEN_NMTH(sym.gen[i]), mth_cmp, tmp);
+}
+
 static void
 sym_init(void)
 {
   static U32 arnd = 0;
   U32 n_cls=0, n_mcl=0, n_pcl=0, n_gen=0, n_mth=0, n_doc=0;
-  U32 t, s;
+  U32 t, s, gen = cos_method_generation_, msk = sym.msk;
+  BOOL stamped = NO;
+  void **tmp;
+
+  phs_start();
 
   // count symbols
   for (t = tbl_ini; t < MAX_TBL && tbl_sym[t]; t++) {
@@ -688,9 +1233,21 @@ sym_init(void)
   if (n_cls != n_mcl || n_cls != n_pcl)
     cos_abort("invalid number of (property) meta classes vs classes");
 
+  phs_end(phs_scan);
+
   // prepare storage for new symbols
   sym_prepStorage(n_cls,n_gen,n_mth,n_doc);
 
+  // invalidate classes ranges and dispatch tables (new classes or slots)
+  if (n_cls || sym.msk != msk) {
+    cls_clearRange();
+    dsp_clear();
+  }
+
+  // stamp generics gaining methods (loaded modules)
+  if (tbl_ini)
+    stamped = gen_stamp(gen+1);
+
   // copy & prepare symbols
   for (t = tbl_ini; t < MAX_TBL && tbl_sym[t]; t++) {
     for (s = 0; tbl_sym[t][s]; s++) {
@@ -783,14 +1340,26 @@ sym_init(void)
     }}
   }
 
-  // sort symbols
-  qsort(sym.cls, sym.n_cls, sizeof *sym.cls, cls_cmp);
-  qsort(sym.gen, sym.n_gen, sizeof *sym.gen, gen_cmp);
-  qsort(sym.mth, sym.n_mth, sizeof *sym.mth, mth_cmp);
-  qsort(sym.doc, sym.n_doc, sizeof *sym.doc, doc_cmp);
+  phs_end(phs_store);
 
-  // set generics' methods indexes
-  gen_setMth();
+  // sort symbols (merge presorted runs)
+  tmp = malloc(sym_maxCnt() * sizeof *tmp);
+  if (!tmp)
+    cos_abort("out of memory while sorting symbols");
+
+  sym_sort((void**)sym.cls, sym.n_cls, cls_cmp, tmp);
+  sym_sort((void**)sym.gen, sym.n_gen, gen_cmp, tmp);
+  sym_sort((void**)sym.doc, sym.n_doc, doc_cmp, tmp);
+
+  // sort methods per generic and set generics' methods indexes
+  mth_sort(tmp);
+  free(tmp);
+
+  phs_end(phs_sort);
+
+  // set classes ranges
+  if (!sym.rng)
+    cls_setRange();
 
   // set property classes
   cls_setProp();
@@ -798,9 +1367,29 @@ sym_init(void)
   // set class properties
   cls_setClassProp(genericref(ggetAt));
   cls_setClassProp(genericref(gputAt));
+
+  phs_end(phs_link);
+
+  // build dispatch tables (only those of stamped generics if still valid)
+  dsp_init(sym.dsp ? gen+1 : 0);
   
-  // clear next-method
-  nxt_clear();
+  // reset next-method and publish the new generation
+  if (!tbl_ini)
+    nxt_clear();
+
+  else if (stamped) {
+    nxt_reset(gen);
+    cos_method_syncShared(gen);
+#ifdef __GNUC__
+    __atomic_store_n(&cos_method_generation_, gen+1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&cos_method_siteGeneration_, 1, __ATOMIC_RELEASE);
+#else
+    cos_method_generation_ = gen+1;
+    cos_method_siteGeneration_ += 1;
+#endif
+  }
+
+  phs_end(phs_table);
   
   // end of module(s) init
   tbl_ini = t;
@@ -811,14 +1400,16 @@ sym_deinit(void)
 {
   nxt_clear();
   mod_clear();
+  dsp_clear();
+  cls_clearRange();
 
   if (sym.bhv) free(sym.bhv), sym.bhv = 0, sym.  msk = 0;
+  if (sym.stp) free(sym.stp), sym.stp = 0;
   if (sym.cls) free(sym.cls), sym.cls = 0, sym.n_cls = 0,
                               sym.prp = 0, sym.n_prp = 0;
   if (sym.gen) free(sym.gen), sym.gen = 0, sym.n_gen = 0;
   if (sym.mth) free(sym.mth), sym.mth = 0, sym.n_mth = 0;
   if (sym.doc) free(sym.doc), sym.doc = 0, sym.n_doc = 0;
-  if (sym.nxt) free(sym.nxt), sym.nxt = 0, sym.n_nxt = 0, sym.m_nxt = 0;
   
   tbl_ini = 0;
 }
@@ -833,6 +1424,8 @@ cls_init(void)
   U32 n_mth = COS_GEN_NMTH(gen);
   U32 i;
 
+  phs_start();
+
   // invoke (prop)meta class ginitialize starting from super classes
   for (i = n_mth; i-- > 0; ) {
     struct Class *cls = ini[i]->cls[0];
@@ -840,6 +1433,8 @@ cls_init(void)
     if (cls_isMetaClass(cls))
       ginitialize((OBJ)cls->cls);
   }
+
+  phs_end(phs_init);
 }
 
 // -- classes deinitialize
@@ -909,6 +1504,7 @@ cos_deinit(void)
 
     cos_functor_clearContext();
     cos_method_clearCaches();
+    cos_method_clearShared();
   }
 }
 
@@ -924,6 +1520,18 @@ cos_deinitDuration(void)
   return deinit_duration;
 }
 
+STR
+cos_initPhase(U32 phase, double *duration)
+{
+  if (phase >= phs_max)
+    return 0;
+
+  if (duration)
+    *duration = init_phsdur[phase];
+
+  return init_phsname[phase];
+}
+
 //  ----- symbol
 
 void
@@ -951,8 +1559,31 @@ cos_symbol_register(struct Any* sym[], STR tag)
   tbl_tag[i] = tag;
 }
 
+void
+cos_symbol_load(void)
+{
+  if (init_done == NO)
+    cos_init();
+  else {
+    double t0, t1;
+
+    t0 = clock();
+    sym_init();
+    cls_init();
+    t1 = clock();
+    
+    init_duration += (t1-t0)/CLOCKS_PER_SEC;
+  }
+}
+
 // ----- generic
 
+U32
+cos_method_stamp(U32 idg)
+{
+  return sym.stp ? sym.stp[idg & sym.msk] : 0;
+}
+
 struct Generic*
 cos_generic_get(U32 id)
 {
@@ -1114,6 +1745,7 @@ IMP1
 cos_method_get1(SEL gen, U32 id1)
 {
   struct Method1 **mth = CAST(struct Method1**, sym.mth)+gen->mth;
+  struct dsp *dsp = sym.dsp ? sym.dsp[gen->Behavior.id & sym.msk] : 0;
   struct Class *cls[1];
   U32 i, n_mth = COS_GEN_NMTH(gen);
   U32 info = COS_MTH_INFO(COS_ID_RNK(id1),0,0,0,0,0);
@@ -1121,6 +1753,11 @@ cos_method_get1(SEL gen, U32 id1)
 
   cls[0] = cos_class_get(id1);
 
+  if (dsp) {
+    i = dsp->cel[dsp->row[0][cls_pre(cls[0])]];
+    return i ? mth[i-1]->fct : 0;
+  }
+
   for (i = 0; i < n_mth; i += n)
     if (info >= mth[i]->Method.info)
       break;
@@ -1141,6 +1778,7 @@ IMP2
 cos_method_get2(SEL gen, U32 id1, U32 id2)
 {
   struct Method2 **mth = CAST(struct Method2**, sym.mth)+gen->mth;
+  struct dsp *dsp = sym.dsp ? sym.dsp[gen->Behavior.id & sym.msk] : 0;
   struct Class *cls[2];
   U32 i, n_mth = COS_GEN_NMTH(gen);
   U32 info = COS_MTH_INFO(COS_ID_RNK(id1),COS_ID_RNK(id2),0,0,0,0);
@@ -1149,6 +1787,12 @@ cos_method_get2(SEL gen, U32 id1, U32 id2)
   cls[0] = cos_class_get(id1);
   cls[1] = cos_class_get(id2);
 
+  if (dsp) {
+    i = dsp->cel[dsp->row[0][cls_pre(cls[0])]*dsp->stp[0] +
+                 dsp->row[1][cls_pre(cls[1])]];
+    return i ? mth[i-1]->fct : 0;
+  }
+
   for (i = 0; i < n_mth; i += n)
     if (info >= mth[i]->Method.info)
       break;
@@ -1169,6 +1813,7 @@ IMP3
 cos_method_get3(SEL gen, U32 id1, U32 id2, U32 id3)
 {
   struct Method3 **mth = CAST(struct Method3**, sym.mth)+gen->mth;
+  struct dsp *dsp = sym.dsp ? sym.dsp[gen->Behavior.id & sym.msk] : 0;
   struct Class *cls[3];
   U32 i, n_mth = COS_GEN_NMTH(gen);
   U32 info = COS_MTH_INFO(COS_ID_RNK(id1),
@@ -1180,6 +1825,13 @@ cos_method_get3(SEL gen, U32 id1, U32 id2, U32 id3)
   cls[1] = cos_class_get(id2);
   cls[2] = cos_class_get(id3);
 
+  if (dsp) {
+    i = dsp->cel[dsp->row[0][cls_pre(cls[0])]*dsp->stp[0] +
+                 dsp->row[1][cls_pre(cls[1])]*dsp->stp[1] +
+                 dsp->row[2][cls_pre(cls[2])]];
+    return i ? mth[i-1]->fct : 0;
+  }
+
   for (i = 0; i < n_mth; i += n)
     if (info >= mth[i]->Method.info)
       break;
@@ -1200,6 +1852,7 @@ IMP4
 cos_method_get4(SEL gen, U32 id1, U32 id2, U32 id3, U32 id4)
 {
   struct Method4 **mth = CAST(struct Method4**, sym.mth)+gen->mth;
+  struct dsp *dsp = sym.dsp ? sym.dsp[gen->Behavior.id & sym.msk] : 0;
   struct Class *cls[4];
   U32 i, n_mth = COS_GEN_NMTH(gen);
   U32 info = COS_MTH_INFO(COS_ID_RNK(id1),
@@ -1213,6 +1866,14 @@ cos_method_get4(SEL gen, U32 id1, U32 id2, U32 id3, U32 id4)
   cls[2] = cos_class_get(id3);
   cls[3] = cos_class_get(id4);
 
+  if (dsp) {
+    i = dsp->cel[dsp->row[0][cls_pre(cls[0])]*dsp->stp[0] +
+                 dsp->row[1][cls_pre(cls[1])]*dsp->stp[1] +
+                 dsp->row[2][cls_pre(cls[2])]*dsp->stp[2] +
+                 dsp->row[3][cls_pre(cls[3])]];
+    return i ? mth[i-1]->fct : 0;
+  }
+
   for (i = 0; i < n_mth; i += n)
     if (info >= mth[i]->Method.info)
       break;
@@ -1233,6 +1894,7 @@ IMP5
 cos_method_get5(SEL gen, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
 {
   struct Method5 **mth = CAST(struct Method5**, sym.mth)+gen->mth;
+  struct dsp *dsp = sym.dsp ? sym.dsp[gen->Behavior.id & sym.msk] : 0;
   struct Class *cls[5];
   U32 i, n_mth = COS_GEN_NMTH(gen);
   U32 info = COS_MTH_INFO(COS_ID_RNK(id1),
@@ -1248,6 +1910,15 @@ cos_method_get5(SEL gen, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
   cls[3] = cos_class_get(id4);
   cls[4] = cos_class_get(id5);
 
+  if (dsp) {
+    i = dsp->cel[dsp->row[0][cls_pre(cls[0])]*dsp->stp[0] +
+                 dsp->row[1][cls_pre(cls[1])]*dsp->stp[1] +
+                 dsp->row[2][cls_pre(cls[2])]*dsp->stp[2] +
+                 dsp->row[3][cls_pre(cls[3])]*dsp->stp[3] +
+                 dsp->row[4][cls_pre(cls[4])]];
+    return i ? mth[i-1]->fct : 0;
+  }
+
   for (i = 0; i < n_mth; i += n)
     if (info >= mth[i]->Method.info)
       break;
@@ -1272,7 +1943,38 @@ cos_method_get5(SEL gen, U32 id1, U32 id2, U32 id3, U32 id4, U32 id5)
 
 // ----- next-method
 
-#if COS_HAS_POSIX
+#if defined(__GNUC__) // -------------------------------------------------
+
+/* NOTE-INFO: next_method initialization
+ * Next methods are resolved without lock and published with a CAS on the
+ * slot, only the thread which wins logs the slot. Threads racing on the
+ * same slot resolve the same next method. Slots are read without atomic
+ * load by next_method, so cos_method_nextClear requires a quiescent system
+ * (no thread inside next_method) and aborts if a thread is resolving a
+ * slot meanwhile.
+ */
+void
+cos_method_nextInit(FCT *fct, SEL gen, U32 rnk, U32 rnd, struct Class* const* cls)
+{
+  FCT nxt, yes = (FCT)YES;
+
+  __atomic_add_fetch(&nxt_busy, 1, __ATOMIC_ACQUIRE);
+
+  nxt = nxt_init(gen,rnk,rnd,cls);
+  if (__atomic_compare_exchange_n(fct, &yes, nxt, NO,
+                                  __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    nxt_add(fct, gen->Behavior.id);
+
+  __atomic_sub_fetch(&nxt_busy, 1, __ATOMIC_RELEASE);
+}
+
+void
+cos_method_nextClear(void)
+{
+  nxt_clear();
+}
+
+#elif COS_HAS_POSIX // ---------------------------------------------------
 
 #include <pthread.h>
 
@@ -1284,7 +1986,7 @@ cos_method_nextInit(FCT *fct, SEL gen, U32 rnk, U32 rnd, struct Class* const* cl
   pthread_mutex_lock(&nxt_lock);
   if (*fct == (FCT)YES) {
     *fct = nxt_init(gen,rnk,rnd,cls);
-    nxt_add(fct);
+    nxt_add(fct, gen->Behavior.id);
   }
   pthread_mutex_unlock(&nxt_lock);
 }
@@ -1297,13 +1999,13 @@ cos_method_nextClear(void)
   pthread_mutex_unlock(&nxt_lock);
 }
 
-#else
+#else // ------------------------------------------------------------------
 
 void
 cos_method_nextInit(FCT *fct, SEL gen, U32 rnk, U32 rnd, struct Class* const* cls)
 {
   *fct = nxt_init(gen,rnk,rnd,cls);
-  nxt_add(fct);
+  nxt_add(fct, gen->Behavior.id);
 }
 
 void
@@ -1312,6 +2014,30 @@ cos_method_nextClear(void)
   nxt_clear();
 }
 
+#endif // ------------------------------------------------------------------
+
+// ----- reference counting
+
+#if COS_OBJECT_RC == COS_OBJECT_RC_BIASED
+
+__thread U32 cos_thread_id_;
+
+U32
+cos_thread_initId(void)
+{
+  static U32 cnt = 0;
+
+  return cos_thread_id_ = __atomic_add_fetch(&cnt, 1, __ATOMIC_RELAXED);
+}
+
+void
+cos_object_rcNotOwner(OBJ obj)
+{
+  cos_abort("reference counting of object %s (%p) from another thread than "
+            "its owner (see cos_object_share)",
+            cos_class_get(cos_object_id(obj))->str, (void*)obj);
+}
+
 #endif
 
 // ----- module
@@ -1363,15 +2089,15 @@ cos_module_load(STR *mod)
       cos_abort("null module name");
 
     // load module
-    sprintf(buf, COS_LIB_PREFIX "%200s%s" COS_LIB_SHEXT, ext, mod[i]);
+    sprintf(buf, COS_LIB_PREFIX "%.200s%s" COS_LIB_SHEXT, mod[i], ext);
     buf[sizeof(buf)-1] = 0;
 
     handle = dlopen(buf, RTLD_LAZY);
     if (!handle)
-      cos_abort("unable to load module %s%s: %s", ext, mod[i], dlerror());
+      cos_abort("unable to load module %s%s: %s", mod[i], ext, dlerror());
 
     // search registration service
-    sprintf(buf, "cos_symbol_init%200s", mod[i]);
+    sprintf(buf, "cos_symbol_init%.200s", mod[i]);
     buf[sizeof(buf)-1] = 0;
     
     { // avoid compiler warning on type-punning
@@ -1380,6 +2106,7 @@ cos_module_load(STR *mod)
       STATIC_ASSERT(function_ptr_are_incompatible_with_void_ptr,
         sizeof(void(*)(void)) == sizeof(alias) && sizeof(void*) == sizeof(alias));
 
+      dlerror(); // clear previous error
       alias.sym = dlsym(handle, buf);
       symbol = alias.fun;
     }
@@ -1389,22 +2116,11 @@ cos_module_load(STR *mod)
 
     // register symbols
     symbol();
-    tbl_mod[j] = handle;
+    tbl_mod[j++] = handle;
   }
 
   // init loaded tables and classes
-  if (init_done == NO)
-    cos_init();
-  else {
-    double t0, t1;
-
-    t0 = clock();
-    sym_init();
-    cls_init();
-    t1 = clock();
-    
-    init_duration += (t1-t0)/CLOCKS_PER_SEC;
-  }
+  cos_symbol_load();
 }
 
 #else
@@ -1429,6 +2145,214 @@ cos_module_load(STR *mod)
 
 #endif
 
+// ----- profile
+
+/* NOTE-INFO: method profile
+ * Profiled methods (see COS_METHOD_PROFILE) take an id on their first call
+ * and count their calls and sampled cycles in per-thread records indexed by
+ * this id. Records are never freed, they keep the counts of terminated
+ * threads and are merged on demand. The profile lock protects the ids, the
+ * list of records and their enlargement, not the counters themselves.
+ */
+static struct {
+  const struct Method **mth; // profiled methods indexed by id (0 unused)
+  U32 n, max;
+  struct cos_method_profile *thr;
+} prf;
+
+#if COS_HAS_POSIX // -----------------------------------------------------
+
+#include <pthread.h>
+
+static pthread_mutex_t prf_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static inline void
+prf_lock(void)
+{
+  pthread_mutex_lock(&prf_mutex);
+}
+
+static inline void
+prf_unlock(void)
+{
+  pthread_mutex_unlock(&prf_mutex);
+}
+
+#else // ------------------------------------------------------------------
+
+static inline void
+prf_lock(void)
+{
+}
+
+static inline void
+prf_unlock(void)
+{
+}
+
+#endif // ------------------------------------------------------------------
+
+#if defined(_OPENMP) || COS_HAS_TLS || !COS_HAS_POSIX // --------------------
+
+__thread struct cos_method_profile *cos_method_profile_ = 0;
+
+static inline void
+prf_setThread(struct cos_method_profile *thr)
+{
+  cos_method_profile_ = thr;
+}
+
+#else // !defined(_OPENMP) && !COS_HAS_TLS && COS_HAS_POSIX -----------------
+
+       int            cos_method_profile_key_init = 0;
+       pthread_key_t  cos_method_profile_key;
+static pthread_once_t cos_method_profile_key_once = PTHREAD_ONCE_INIT;
+
+static void
+make_key(void)
+{
+  // no destructor, records outlive their thread
+  if ( pthread_key_create(&cos_method_profile_key, 0) )
+    cos_abort("unable to initialize method profile");
+}
+
+static inline void
+prf_setThread(struct cos_method_profile *thr)
+{
+  pthread_once(&cos_method_profile_key_once, make_key);
+  cos_method_profile_key_init = 1;
+
+  if ( pthread_setspecific(cos_method_profile_key, thr) )
+    cos_abort("unable to initialize method profile");
+}
+
+#endif // ------------------------------------------------
+
+struct cos_method_profile*
+cos_method_profile_init(void)
+{
+  struct cos_method_profile *thr = calloc(1, sizeof *thr);
+
+  if (!thr)
+    cos_abort("out of memory while creating method profile");
+
+  prf_lock();
+  thr->nxt = prf.thr, prf.thr = thr;
+  prf_unlock();
+
+  prf_setThread(thr);
+
+  return thr;
+}
+
+void
+cos_method_profileInit(U32 *id, const struct Method *mth)
+{
+  prf_lock();
+
+  if (!*id) {
+    if (prf.n+1 >= prf.max) {
+      U32 max = prf.max ? 2*prf.max : 256;
+      const struct Method **buf = realloc(prf.mth, max * sizeof *buf);
+
+      if (!buf) {
+        prf_unlock();
+        cos_abort("out of memory while profiling methods");
+      }
+
+      prf.mth = buf, prf.max = max;
+    }
+
+    prf.mth[++prf.n] = mth;
+    *id = prf.n;
+  }
+
+  prf_unlock();
+}
+
+void
+cos_method_profileEnlarge(struct cos_method_profile *thr, U32 id)
+{
+  U32 n = thr->n ? thr->n : 64;
+  U64 *cnt, *cyc;
+
+  while (n <= id) n *= 2;
+
+  cnt = calloc(n, sizeof *cnt);
+  cyc = calloc(n, sizeof *cyc);
+
+  if (!cnt || !cyc)
+    cos_abort("out of memory while profiling methods");
+
+  prf_lock();
+
+  if (thr->n) {
+    memcpy(cnt, thr->cnt, thr->n * sizeof *cnt);
+    memcpy(cyc, thr->cyc, thr->n * sizeof *cyc);
+    free(thr->cnt);
+    free(thr->cyc);
+  }
+
+  thr->cnt = cnt, thr->cyc = cyc, thr->n = n;
+
+  prf_unlock();
+}
+
+static void // must be called with the profile lock
+prf_merge(U64 *cnt, U64 *cyc)
+{
+  struct cos_method_profile *thr;
+  U32 i;
+
+  memset(cnt, 0, (prf.n+1) * sizeof *cnt);
+  memset(cyc, 0, (prf.n+1) * sizeof *cyc);
+
+  for (thr = prf.thr; thr; thr = thr->nxt)
+    for (i = 1; i <= prf.n && i < thr->n; i++)
+      cnt[i] += thr->cnt[i], cyc[i] += thr->cyc[i];
+}
+
+BOOL
+cos_method_getProfile(const struct Method *mth, U64 *cnt, U64 *cyc)
+{
+  struct cos_method_profile *thr;
+  U64 c0 = 0, c1 = 0;
+  U32 id;
+
+  prf_lock();
+
+  for (id = 1; id <= prf.n; id++)
+    if (prf.mth[id] == mth) break;
+
+  if (id <= prf.n)
+    for (thr = prf.thr; thr; thr = thr->nxt)
+      if (id < thr->n)
+        c0 += thr->cnt[id], c1 += thr->cyc[id];
+
+  prf_unlock();
+
+  if (cnt) *cnt = c0;
+  if (cyc) *cyc = c1;
+
+  return c0 > 0;
+}
+
+void
+cos_method_clearProfile(void)
+{
+  struct cos_method_profile *thr;
+
+  prf_lock();
+
+  for (thr = prf.thr; thr; thr = thr->nxt)
+    if (thr->n) {
+      memset(thr->cnt, 0, thr->n * sizeof *thr->cnt);
+      memset(thr->cyc, 0, thr->n * sizeof *thr->cyc);
+    }
+
+  prf_unlock();
+}
+
 /*
  * ----------------------------------------------------------------------------
  *  Debug functions
@@ -1559,6 +2483,21 @@ cos_symbol_showSummary(FILE *fp)
   fprintf(fp, "generics  : %4u\n"     , sym.n_gen);
   fprintf(fp, "methods   : %4u\n"     , sym.n_mth);
   fprintf(fp, "behaviors : %4u / %u\n", sym.n_cls*3+sym.n_gen, sym.msk+!!sym.msk);
+
+  if (sym.dsp) {
+    U32 i, n = 0;
+    size_t sz = 0;
+
+    for (i = 0; i <= sym.msk; i++) {
+      struct dsp *dsp = sym.dsp[i];
+      if (dsp) {
+        n  += 1;
+        sz += sizeof *dsp + dsp->ncel * sizeof *dsp->cel;
+      }
+    }
+    sz += sym.n_row * 3*sym.n_cls * sizeof **sym.row;
+    fprintf(fp, "tables    : %4u (%lu kB)\n", n, (unsigned long)(sz+1023)/1024);
+  }
 }
 
 void
@@ -1695,3 +2634,119 @@ cos_symbol_showMethods(FILE *fp)
             COS_MTH_RK5(sym.mth[i]));
   }
 }
+
+// -- profile report
+
+struct prf_entry {
+  const struct Method *mth;
+  U64 cnt, cyc;
+};
+
+static int // qsort
+prf_cmp(const void *_e1, const void *_e2)
+{
+  const struct prf_entry *e1 = _e1;
+  const struct prf_entry *e2 = _e2;
+
+  // descending calls
+  return (e1->cnt < e2->cnt) - (e1->cnt > e2->cnt);
+}
+
+static struct prf_entry*
+prf_collect(U32 *n_, U64 *tot_)
+{
+  struct prf_entry *ent;
+  U64 *cnt, *cyc, tot = 0;
+  U32 i, n = 0;
+
+  prf_lock();
+
+  cnt = malloc((prf.n+1) * sizeof *cnt);
+  cyc = malloc((prf.n+1) * sizeof *cyc);
+  ent = malloc((prf.n+1) * sizeof *ent);
+
+  if (!cnt || !cyc || !ent) {
+    prf_unlock();
+    cos_abort("out of memory while merging method profile");
+  }
+
+  prf_merge(cnt, cyc);
+
+  for (i = 1; i <= prf.n; i++)
+    if (cnt[i]) {
+      ent[n].mth = prf.mth[i];
+      ent[n].cnt = cnt[i];
+      ent[n].cyc = cyc[i];
+      tot += cnt[i], ++n;
+    }
+
+  prf_unlock();
+
+  free(cnt);
+  free(cyc);
+
+  qsort(ent, n, sizeof *ent, prf_cmp);
+
+  *n_ = n, *tot_ = tot;
+  return ent;
+}
+
+void
+cos_symbol_showProfile(FILE *fp)
+{
+  struct prf_entry *ent;
+  char buf[128];
+  U64 tot;
+  U32 i, n;
+
+  if (!fp) fp = stderr;
+
+  ent = prf_collect(&n, &tot);
+
+  fprintf(fp,"profile   : %4u methods, %llu calls\n", n, (unsigned long long)tot);
+
+  for (i = 0; i < n; i++) {
+    fprintf(fp,"prf[%3u] =", i);
+
+    cos_method_name(ent[i].mth,buf,sizeof buf);
+    fprintf(fp," %-63s", buf);
+
+    fprintf(fp," %12llu %5.1f%% %10.1f\n",
+            (unsigned long long)ent[i].cnt,
+            100.0 * ent[i].cnt / tot,
+            (double)ent[i].cyc / ent[i].cnt);
+  }
+
+  free(ent);
+}
+
+void
+cos_symbol_exportProfile(FILE *fp)
+{
+  struct prf_entry *ent;
+  struct Class* const *cls;
+  U32 i, j, ncls, n;
+  U64 tot;
+
+  if (!fp) fp = stdout;
+
+  ent = prf_collect(&n, &tot);
+
+  fprintf(fp,"generic\trank\tclasses\taround\tcalls\tcycles\n");
+
+  for (i = 0; i < n; i++) {
+    cls  = CAST(const struct Method5*, ent[i].mth)->cls;
+    ncls = COS_GEN_RNK(ent[i].mth->gen);
+
+    fprintf(fp,"%s\t%u\t", ent[i].mth->gen->str, COS_MTH_RNK(ent[i].mth));
+
+    for (j = 0; j < ncls; j++)
+      fprintf(fp,"%s%s", j ? "," : "", cls[j]->str);
+
+    fprintf(fp,"\t%u\t%llu\t%llu\n", ent[i].mth->arnd,
+            (unsigned long long)ent[i].cnt,
+            (unsigned long long)ent[i].cyc);
+  }
+
+  free(ent);
+}
@@ -0,0 +1,36 @@
+/*
+ * -----------------------------
+ * COS generics
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosgen
+ * Sun Oct 18 12:22:09 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Object.h>
+
+#include "generics.h"
+
+
+makgeneric(OBJ, gaddTo1, _1, _2);
+makgeneric(OBJ, gaddTo2, _1, _2, _3);
+makgeneric(OBJ, gaddTo3, _1, _2, _3, _4);
+makgeneric(OBJ, gaddTo4, _1, _2, _3, _4, _5);
+makgeneric(OBJ, gaddToPlus, _1, _2, (U32)a);
+makgeneric(void, gcat2Str, _, _, (STR)str);
+makgeneric(void, gcatStr, _, (STR)str);
+makgeneric(void, gdoC, _, (int)val);
+makgeneric(void, gdoX, _, _);
+makgeneric(void, gdoY, _, _);
+makgeneric(void, gdoZ, _, _);
+makgeneric(OBJ, gincr, _);
+makgeneric(OBJ, gincrBy1, _, (U32)a);
+makgeneric(OBJ, gincrBy2, _, (U32)a, (U32)b);
+makgeneric(OBJ, gincrBy3, _, (U32)a, (U32)b, (U32)c);
+makgeneric(OBJ, gincrBy4, _, (U32)a, (U32)b, (U32)c, (U32)d);
+makgeneric(OBJ, gincrBy5, _, (U32)a, (U32)b, (U32)c, (U32)d, (U32)e);
+makgeneric(void, gprofile, _, (U32*)cnt);
+makgenericv(void, gvputStr, _, (STR)fmt, ...);
+makgeneric(STR, gwhich, _1);
+makgeneric(STR, gwhich2, _1, _2);
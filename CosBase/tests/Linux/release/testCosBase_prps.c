@@ -0,0 +1,82 @@
+/*
+ * -----------------------------
+ * COS properties
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosprp
+ * Sun Oct 18 12:22:09 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Property.h>
+
+#include "properties.h"
+
+
+makproperty((prop)subprop);
+makproperty(p00);
+makproperty(p01);
+makproperty(p02);
+makproperty(p03);
+makproperty(p04);
+makproperty(p05);
+makproperty(p06);
+makproperty(p07);
+makproperty(p08);
+makproperty(p09);
+makproperty(p10);
+makproperty(p11);
+makproperty(p12);
+makproperty(p13);
+makproperty(p14);
+makproperty(p15);
+makproperty(p16);
+makproperty(p17);
+makproperty(p18);
+makproperty(p19);
+makproperty(p20);
+makproperty(p21);
+makproperty(p22);
+makproperty(p23);
+makproperty(p24);
+makproperty(p25);
+makproperty(p26);
+makproperty(p27);
+makproperty(p28);
+makproperty(p29);
+makproperty(p30);
+makproperty(p31);
+makproperty(p32);
+makproperty(p33);
+makproperty(p34);
+makproperty(p35);
+makproperty(p36);
+makproperty(p37);
+makproperty(p38);
+makproperty(p39);
+makproperty(p40);
+makproperty(p41);
+makproperty(p42);
+makproperty(p43);
+makproperty(p44);
+makproperty(p45);
+makproperty(p46);
+makproperty(p47);
+makproperty(p48);
+makproperty(p49);
+makproperty(p50);
+makproperty(p51);
+makproperty(p52);
+makproperty(p53);
+makproperty(p54);
+makproperty(p55);
+makproperty(p56);
+makproperty(p57);
+makproperty(p58);
+makproperty(p59);
+makproperty(p60);
+makproperty(p61);
+makproperty(p62);
+makproperty(p63);
+makproperty(p64);
+makproperty(prop);
@@ -0,0 +1,862 @@
+/*
+ * -----------------------------
+ * COS symbols
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cossym
+ * Sun Oct 18 12:22:10 UTC 2026
+ * -----------------------------
+ */
+
+extern struct Any cos_c_A;
+extern struct Any cos_c_B;
+extern struct Any cos_c_C;
+extern struct Any cos_c_Counter;
+extern struct Any cos_c_D;
+extern struct Any cos_c_E;
+extern struct Any cos_c_MilliCounter;
+extern struct Any cos_c_PA;
+extern struct Any cos_c_P_p00;
+extern struct Any cos_c_P_p01;
+extern struct Any cos_c_P_p02;
+extern struct Any cos_c_P_p03;
+extern struct Any cos_c_P_p04;
+extern struct Any cos_c_P_p05;
+extern struct Any cos_c_P_p06;
+extern struct Any cos_c_P_p07;
+extern struct Any cos_c_P_p08;
+extern struct Any cos_c_P_p09;
+extern struct Any cos_c_P_p10;
+extern struct Any cos_c_P_p11;
+extern struct Any cos_c_P_p12;
+extern struct Any cos_c_P_p13;
+extern struct Any cos_c_P_p14;
+extern struct Any cos_c_P_p15;
+extern struct Any cos_c_P_p16;
+extern struct Any cos_c_P_p17;
+extern struct Any cos_c_P_p18;
+extern struct Any cos_c_P_p19;
+extern struct Any cos_c_P_p20;
+extern struct Any cos_c_P_p21;
+extern struct Any cos_c_P_p22;
+extern struct Any cos_c_P_p23;
+extern struct Any cos_c_P_p24;
+extern struct Any cos_c_P_p25;
+extern struct Any cos_c_P_p26;
+extern struct Any cos_c_P_p27;
+extern struct Any cos_c_P_p28;
+extern struct Any cos_c_P_p29;
+extern struct Any cos_c_P_p30;
+extern struct Any cos_c_P_p31;
+extern struct Any cos_c_P_p32;
+extern struct Any cos_c_P_p33;
+extern struct Any cos_c_P_p34;
+extern struct Any cos_c_P_p35;
+extern struct Any cos_c_P_p36;
+extern struct Any cos_c_P_p37;
+extern struct Any cos_c_P_p38;
+extern struct Any cos_c_P_p39;
+extern struct Any cos_c_P_p40;
+extern struct Any cos_c_P_p41;
+extern struct Any cos_c_P_p42;
+extern struct Any cos_c_P_p43;
+extern struct Any cos_c_P_p44;
+extern struct Any cos_c_P_p45;
+extern struct Any cos_c_P_p46;
+extern struct Any cos_c_P_p47;
+extern struct Any cos_c_P_p48;
+extern struct Any cos_c_P_p49;
+extern struct Any cos_c_P_p50;
+extern struct Any cos_c_P_p51;
+extern struct Any cos_c_P_p52;
+extern struct Any cos_c_P_p53;
+extern struct Any cos_c_P_p54;
+extern struct Any cos_c_P_p55;
+extern struct Any cos_c_P_p56;
+extern struct Any cos_c_P_p57;
+extern struct Any cos_c_P_p58;
+extern struct Any cos_c_P_p59;
+extern struct Any cos_c_P_p60;
+extern struct Any cos_c_P_p61;
+extern struct Any cos_c_P_p62;
+extern struct Any cos_c_P_p63;
+extern struct Any cos_c_P_p64;
+extern struct Any cos_c_P_prop;
+extern struct Any cos_c_P_subprop;
+extern struct Any cos_c_ProxyCounter;
+extern struct Any cos_c_SymA;
+extern struct Any cos_c_SymB;
+extern struct Any cos_c_SymC;
+extern struct Any cos_c_mA;
+extern struct Any cos_c_mB;
+extern struct Any cos_c_mC;
+extern struct Any cos_c_mCounter;
+extern struct Any cos_c_mD;
+extern struct Any cos_c_mE;
+extern struct Any cos_c_mMilliCounter;
+extern struct Any cos_c_mPA;
+extern struct Any cos_c_mP_p00;
+extern struct Any cos_c_mP_p01;
+extern struct Any cos_c_mP_p02;
+extern struct Any cos_c_mP_p03;
+extern struct Any cos_c_mP_p04;
+extern struct Any cos_c_mP_p05;
+extern struct Any cos_c_mP_p06;
+extern struct Any cos_c_mP_p07;
+extern struct Any cos_c_mP_p08;
+extern struct Any cos_c_mP_p09;
+extern struct Any cos_c_mP_p10;
+extern struct Any cos_c_mP_p11;
+extern struct Any cos_c_mP_p12;
+extern struct Any cos_c_mP_p13;
+extern struct Any cos_c_mP_p14;
+extern struct Any cos_c_mP_p15;
+extern struct Any cos_c_mP_p16;
+extern struct Any cos_c_mP_p17;
+extern struct Any cos_c_mP_p18;
+extern struct Any cos_c_mP_p19;
+extern struct Any cos_c_mP_p20;
+extern struct Any cos_c_mP_p21;
+extern struct Any cos_c_mP_p22;
+extern struct Any cos_c_mP_p23;
+extern struct Any cos_c_mP_p24;
+extern struct Any cos_c_mP_p25;
+extern struct Any cos_c_mP_p26;
+extern struct Any cos_c_mP_p27;
+extern struct Any cos_c_mP_p28;
+extern struct Any cos_c_mP_p29;
+extern struct Any cos_c_mP_p30;
+extern struct Any cos_c_mP_p31;
+extern struct Any cos_c_mP_p32;
+extern struct Any cos_c_mP_p33;
+extern struct Any cos_c_mP_p34;
+extern struct Any cos_c_mP_p35;
+extern struct Any cos_c_mP_p36;
+extern struct Any cos_c_mP_p37;
+extern struct Any cos_c_mP_p38;
+extern struct Any cos_c_mP_p39;
+extern struct Any cos_c_mP_p40;
+extern struct Any cos_c_mP_p41;
+extern struct Any cos_c_mP_p42;
+extern struct Any cos_c_mP_p43;
+extern struct Any cos_c_mP_p44;
+extern struct Any cos_c_mP_p45;
+extern struct Any cos_c_mP_p46;
+extern struct Any cos_c_mP_p47;
+extern struct Any cos_c_mP_p48;
+extern struct Any cos_c_mP_p49;
+extern struct Any cos_c_mP_p50;
+extern struct Any cos_c_mP_p51;
+extern struct Any cos_c_mP_p52;
+extern struct Any cos_c_mP_p53;
+extern struct Any cos_c_mP_p54;
+extern struct Any cos_c_mP_p55;
+extern struct Any cos_c_mP_p56;
+extern struct Any cos_c_mP_p57;
+extern struct Any cos_c_mP_p58;
+extern struct Any cos_c_mP_p59;
+extern struct Any cos_c_mP_p60;
+extern struct Any cos_c_mP_p61;
+extern struct Any cos_c_mP_p62;
+extern struct Any cos_c_mP_p63;
+extern struct Any cos_c_mP_p64;
+extern struct Any cos_c_mP_prop;
+extern struct Any cos_c_mP_subprop;
+extern struct Any cos_c_mProxyCounter;
+extern struct Any cos_c_mSymA;
+extern struct Any cos_c_mSymB;
+extern struct Any cos_c_mSymC;
+extern struct Any cos_c_pmA;
+extern struct Any cos_c_pmB;
+extern struct Any cos_c_pmC;
+extern struct Any cos_c_pmCounter;
+extern struct Any cos_c_pmD;
+extern struct Any cos_c_pmE;
+extern struct Any cos_c_pmMilliCounter;
+extern struct Any cos_c_pmPA;
+extern struct Any cos_c_pmP_p00;
+extern struct Any cos_c_pmP_p01;
+extern struct Any cos_c_pmP_p02;
+extern struct Any cos_c_pmP_p03;
+extern struct Any cos_c_pmP_p04;
+extern struct Any cos_c_pmP_p05;
+extern struct Any cos_c_pmP_p06;
+extern struct Any cos_c_pmP_p07;
+extern struct Any cos_c_pmP_p08;
+extern struct Any cos_c_pmP_p09;
+extern struct Any cos_c_pmP_p10;
+extern struct Any cos_c_pmP_p11;
+extern struct Any cos_c_pmP_p12;
+extern struct Any cos_c_pmP_p13;
+extern struct Any cos_c_pmP_p14;
+extern struct Any cos_c_pmP_p15;
+extern struct Any cos_c_pmP_p16;
+extern struct Any cos_c_pmP_p17;
+extern struct Any cos_c_pmP_p18;
+extern struct Any cos_c_pmP_p19;
+extern struct Any cos_c_pmP_p20;
+extern struct Any cos_c_pmP_p21;
+extern struct Any cos_c_pmP_p22;
+extern struct Any cos_c_pmP_p23;
+extern struct Any cos_c_pmP_p24;
+extern struct Any cos_c_pmP_p25;
+extern struct Any cos_c_pmP_p26;
+extern struct Any cos_c_pmP_p27;
+extern struct Any cos_c_pmP_p28;
+extern struct Any cos_c_pmP_p29;
+extern struct Any cos_c_pmP_p30;
+extern struct Any cos_c_pmP_p31;
+extern struct Any cos_c_pmP_p32;
+extern struct Any cos_c_pmP_p33;
+extern struct Any cos_c_pmP_p34;
+extern struct Any cos_c_pmP_p35;
+extern struct Any cos_c_pmP_p36;
+extern struct Any cos_c_pmP_p37;
+extern struct Any cos_c_pmP_p38;
+extern struct Any cos_c_pmP_p39;
+extern struct Any cos_c_pmP_p40;
+extern struct Any cos_c_pmP_p41;
+extern struct Any cos_c_pmP_p42;
+extern struct Any cos_c_pmP_p43;
+extern struct Any cos_c_pmP_p44;
+extern struct Any cos_c_pmP_p45;
+extern struct Any cos_c_pmP_p46;
+extern struct Any cos_c_pmP_p47;
+extern struct Any cos_c_pmP_p48;
+extern struct Any cos_c_pmP_p49;
+extern struct Any cos_c_pmP_p50;
+extern struct Any cos_c_pmP_p51;
+extern struct Any cos_c_pmP_p52;
+extern struct Any cos_c_pmP_p53;
+extern struct Any cos_c_pmP_p54;
+extern struct Any cos_c_pmP_p55;
+extern struct Any cos_c_pmP_p56;
+extern struct Any cos_c_pmP_p57;
+extern struct Any cos_c_pmP_p58;
+extern struct Any cos_c_pmP_p59;
+extern struct Any cos_c_pmP_p60;
+extern struct Any cos_c_pmP_p61;
+extern struct Any cos_c_pmP_p62;
+extern struct Any cos_c_pmP_p63;
+extern struct Any cos_c_pmP_p64;
+extern struct Any cos_c_pmP_prop;
+extern struct Any cos_c_pmP_subprop;
+extern struct Any cos_c_pmProxyCounter;
+extern struct Any cos_c_pmSymA;
+extern struct Any cos_c_pmSymB;
+extern struct Any cos_c_pmSymC;
+extern struct Any cos_g_gaddTo1;
+extern struct Any cos_g_gaddTo2;
+extern struct Any cos_g_gaddTo3;
+extern struct Any cos_g_gaddTo4;
+extern struct Any cos_g_gaddToPlus;
+extern struct Any cos_g_gcat2Str;
+extern struct Any cos_g_gcatStr;
+extern struct Any cos_g_gdoC;
+extern struct Any cos_g_gdoX;
+extern struct Any cos_g_gdoY;
+extern struct Any cos_g_gdoZ;
+extern struct Any cos_g_gincr;
+extern struct Any cos_g_gincrBy1;
+extern struct Any cos_g_gincrBy2;
+extern struct Any cos_g_gincrBy3;
+extern struct Any cos_g_gincrBy4;
+extern struct Any cos_g_gincrBy5;
+extern struct Any cos_g_gprofile;
+extern struct Any cos_g_gvputStr;
+extern struct Any cos_g_gwhich;
+extern struct Any cos_g_gwhich2;
+extern struct Any cos_m_gaddTo1__Counter__Counter;
+extern struct Any cos_m_gaddTo2__Counter__Counter__Counter;
+extern struct Any cos_m_gaddTo3__Counter__Counter__Counter__Counter;
+extern struct Any cos_m_gaddTo4__Counter__Counter__Counter__Counter__Counter;
+extern struct Any cos_m_gaddToPlus__Counter__Counter;
+extern struct Any cos_m_gcat2Str__A__A;
+extern struct Any cos_m_gcatStr__A;
+extern struct Any cos_m_gdeinit__A;
+extern struct Any cos_m_gdeinit__Counter;
+extern struct Any cos_m_gdeinit__MilliCounter;
+extern struct Any cos_m_gdeinit__SymA;
+extern struct Any cos_m_gdoC__A;
+extern struct Any cos_m_gdoC__B;
+extern struct Any cos_m_gdoC__C;
+extern struct Any cos_m_gdoC__D;
+extern struct Any cos_m_gdoC__E;
+extern struct Any cos_m_gdoX__A__A;
+extern struct Any cos_m_gdoX__B__B;
+extern struct Any cos_m_gdoX__C__C;
+extern struct Any cos_m_gdoX__D__D;
+extern struct Any cos_m_gdoX__E__E;
+extern struct Any cos_m_gdoY__A__A;
+extern struct Any cos_m_gdoY__A__B;
+extern struct Any cos_m_gdoY__A__C;
+extern struct Any cos_m_gdoY__A__C__a__360;
+extern struct Any cos_m_gdoY__A__D;
+extern struct Any cos_m_gdoY__A__E;
+extern struct Any cos_m_gdoY__B__A;
+extern struct Any cos_m_gdoY__B__A__a__371;
+extern struct Any cos_m_gdoY__B__A__a__377;
+extern struct Any cos_m_gdoY__B__A__a__383;
+extern struct Any cos_m_gdoY__B__B;
+extern struct Any cos_m_gdoY__B__C;
+extern struct Any cos_m_gdoY__B__C__a__410;
+extern struct Any cos_m_gdoY__B__D;
+extern struct Any cos_m_gdoY__B__E;
+extern struct Any cos_m_gdoY__C__A;
+extern struct Any cos_m_gdoY__C__B;
+extern struct Any cos_m_gdoY__C__C;
+extern struct Any cos_m_gdoY__C__D;
+extern struct Any cos_m_gdoY__C__E;
+extern struct Any cos_m_gdoY__D__A;
+extern struct Any cos_m_gdoY__D__B;
+extern struct Any cos_m_gdoY__D__C;
+extern struct Any cos_m_gdoY__D__D;
+extern struct Any cos_m_gdoY__D__E;
+extern struct Any cos_m_gdoY__E__A;
+extern struct Any cos_m_gdoY__E__B;
+extern struct Any cos_m_gdoY__E__C;
+extern struct Any cos_m_gdoY__E__D;
+extern struct Any cos_m_gdoY__E__E;
+extern struct Any cos_m_gdoZ__A__A;
+extern struct Any cos_m_gdoZ__B__B;
+extern struct Any cos_m_gdoZ__C__C;
+extern struct Any cos_m_gdoZ__D__D;
+extern struct Any cos_m_gdoZ__E__E;
+extern struct Any cos_m_ggetAt__A__mP_p00;
+extern struct Any cos_m_ggetAt__A__mP_p01;
+extern struct Any cos_m_ggetAt__A__mP_p02;
+extern struct Any cos_m_ggetAt__A__mP_p03;
+extern struct Any cos_m_ggetAt__A__mP_p04;
+extern struct Any cos_m_ggetAt__A__mP_p05;
+extern struct Any cos_m_ggetAt__A__mP_p06;
+extern struct Any cos_m_ggetAt__A__mP_p07;
+extern struct Any cos_m_ggetAt__A__mP_p08;
+extern struct Any cos_m_ggetAt__A__mP_p09;
+extern struct Any cos_m_ggetAt__A__mP_p10;
+extern struct Any cos_m_ggetAt__A__mP_p11;
+extern struct Any cos_m_ggetAt__A__mP_p12;
+extern struct Any cos_m_ggetAt__A__mP_p13;
+extern struct Any cos_m_ggetAt__A__mP_p14;
+extern struct Any cos_m_ggetAt__A__mP_p15;
+extern struct Any cos_m_ggetAt__A__mP_p16;
+extern struct Any cos_m_ggetAt__A__mP_p17;
+extern struct Any cos_m_ggetAt__A__mP_p18;
+extern struct Any cos_m_ggetAt__A__mP_p19;
+extern struct Any cos_m_ggetAt__A__mP_p20;
+extern struct Any cos_m_ggetAt__A__mP_p21;
+extern struct Any cos_m_ggetAt__A__mP_p22;
+extern struct Any cos_m_ggetAt__A__mP_p23;
+extern struct Any cos_m_ggetAt__A__mP_p24;
+extern struct Any cos_m_ggetAt__A__mP_p25;
+extern struct Any cos_m_ggetAt__A__mP_p26;
+extern struct Any cos_m_ggetAt__A__mP_p27;
+extern struct Any cos_m_ggetAt__A__mP_p28;
+extern struct Any cos_m_ggetAt__A__mP_p29;
+extern struct Any cos_m_ggetAt__A__mP_p30;
+extern struct Any cos_m_ggetAt__A__mP_p31;
+extern struct Any cos_m_ggetAt__A__mP_p32;
+extern struct Any cos_m_ggetAt__A__mP_p33;
+extern struct Any cos_m_ggetAt__A__mP_p34;
+extern struct Any cos_m_ggetAt__A__mP_p35;
+extern struct Any cos_m_ggetAt__A__mP_p36;
+extern struct Any cos_m_ggetAt__A__mP_p37;
+extern struct Any cos_m_ggetAt__A__mP_p38;
+extern struct Any cos_m_ggetAt__A__mP_p39;
+extern struct Any cos_m_ggetAt__A__mP_p40;
+extern struct Any cos_m_ggetAt__A__mP_p41;
+extern struct Any cos_m_ggetAt__A__mP_p42;
+extern struct Any cos_m_ggetAt__A__mP_p43;
+extern struct Any cos_m_ggetAt__A__mP_p44;
+extern struct Any cos_m_ggetAt__A__mP_p45;
+extern struct Any cos_m_ggetAt__A__mP_p46;
+extern struct Any cos_m_ggetAt__A__mP_p47;
+extern struct Any cos_m_ggetAt__A__mP_p48;
+extern struct Any cos_m_ggetAt__A__mP_p49;
+extern struct Any cos_m_ggetAt__A__mP_p50;
+extern struct Any cos_m_ggetAt__A__mP_p51;
+extern struct Any cos_m_ggetAt__A__mP_p52;
+extern struct Any cos_m_ggetAt__A__mP_p53;
+extern struct Any cos_m_ggetAt__A__mP_p54;
+extern struct Any cos_m_ggetAt__A__mP_p55;
+extern struct Any cos_m_ggetAt__A__mP_p56;
+extern struct Any cos_m_ggetAt__A__mP_p57;
+extern struct Any cos_m_ggetAt__A__mP_p58;
+extern struct Any cos_m_ggetAt__A__mP_p59;
+extern struct Any cos_m_ggetAt__A__mP_p60;
+extern struct Any cos_m_ggetAt__A__mP_p61;
+extern struct Any cos_m_ggetAt__A__mP_p62;
+extern struct Any cos_m_ggetAt__A__mP_p63;
+extern struct Any cos_m_gincr__Counter;
+extern struct Any cos_m_gincr__MilliCounter;
+extern struct Any cos_m_gincrBy1__Counter;
+extern struct Any cos_m_gincrBy1__MilliCounter;
+extern struct Any cos_m_gincrBy2__Counter;
+extern struct Any cos_m_gincrBy2__MilliCounter;
+extern struct Any cos_m_gincrBy3__Counter;
+extern struct Any cos_m_gincrBy3__MilliCounter;
+extern struct Any cos_m_gincrBy4__Counter;
+extern struct Any cos_m_gincrBy4__MilliCounter;
+extern struct Any cos_m_gincrBy5__Counter;
+extern struct Any cos_m_gincrBy5__MilliCounter;
+extern struct Any cos_m_ginit__A;
+extern struct Any cos_m_ginit__B;
+extern struct Any cos_m_ginit__C;
+extern struct Any cos_m_ginit__Counter;
+extern struct Any cos_m_ginit__D;
+extern struct Any cos_m_ginit__E;
+extern struct Any cos_m_ginit__MilliCounter;
+extern struct Any cos_m_ginit__SymA;
+extern struct Any cos_m_ginitWith__A__A;
+extern struct Any cos_m_gint__Counter;
+extern struct Any cos_m_ginvariant__A;
+extern struct Any cos_m_ginvariant__B;
+extern struct Any cos_m_ginvariant__C;
+extern struct Any cos_m_ginvariant__D;
+extern struct Any cos_m_ginvariant__E;
+extern struct Any cos_m_gprofile__A;
+extern struct Any cos_m_gprofile__B;
+extern struct Any cos_m_gstr__A;
+extern struct Any cos_m_gunrecognizedMessage1__A;
+extern struct Any cos_m_gunrecognizedMessage1__PA;
+extern struct Any cos_m_gunrecognizedMessage1__ProxyCounter;
+extern struct Any cos_m_gvputStr__C;
+extern struct Any cos_m_gwhich__Object;
+extern struct Any cos_m_gwhich__SymB;
+extern struct Any cos_m_gwhich2__Object__Object;
+extern struct Any cos_m_gwhich2__SymB__SymB;
+
+static struct Any* symtbl[] = {
+  &cos_c_A,
+  &cos_c_B,
+  &cos_c_C,
+  &cos_c_Counter,
+  &cos_c_D,
+  &cos_c_E,
+  &cos_c_MilliCounter,
+  &cos_c_PA,
+  &cos_c_P_p00,
+  &cos_c_P_p01,
+  &cos_c_P_p02,
+  &cos_c_P_p03,
+  &cos_c_P_p04,
+  &cos_c_P_p05,
+  &cos_c_P_p06,
+  &cos_c_P_p07,
+  &cos_c_P_p08,
+  &cos_c_P_p09,
+  &cos_c_P_p10,
+  &cos_c_P_p11,
+  &cos_c_P_p12,
+  &cos_c_P_p13,
+  &cos_c_P_p14,
+  &cos_c_P_p15,
+  &cos_c_P_p16,
+  &cos_c_P_p17,
+  &cos_c_P_p18,
+  &cos_c_P_p19,
+  &cos_c_P_p20,
+  &cos_c_P_p21,
+  &cos_c_P_p22,
+  &cos_c_P_p23,
+  &cos_c_P_p24,
+  &cos_c_P_p25,
+  &cos_c_P_p26,
+  &cos_c_P_p27,
+  &cos_c_P_p28,
+  &cos_c_P_p29,
+  &cos_c_P_p30,
+  &cos_c_P_p31,
+  &cos_c_P_p32,
+  &cos_c_P_p33,
+  &cos_c_P_p34,
+  &cos_c_P_p35,
+  &cos_c_P_p36,
+  &cos_c_P_p37,
+  &cos_c_P_p38,
+  &cos_c_P_p39,
+  &cos_c_P_p40,
+  &cos_c_P_p41,
+  &cos_c_P_p42,
+  &cos_c_P_p43,
+  &cos_c_P_p44,
+  &cos_c_P_p45,
+  &cos_c_P_p46,
+  &cos_c_P_p47,
+  &cos_c_P_p48,
+  &cos_c_P_p49,
+  &cos_c_P_p50,
+  &cos_c_P_p51,
+  &cos_c_P_p52,
+  &cos_c_P_p53,
+  &cos_c_P_p54,
+  &cos_c_P_p55,
+  &cos_c_P_p56,
+  &cos_c_P_p57,
+  &cos_c_P_p58,
+  &cos_c_P_p59,
+  &cos_c_P_p60,
+  &cos_c_P_p61,
+  &cos_c_P_p62,
+  &cos_c_P_p63,
+  &cos_c_P_p64,
+  &cos_c_P_prop,
+  &cos_c_P_subprop,
+  &cos_c_ProxyCounter,
+  &cos_c_SymA,
+  &cos_c_SymB,
+  &cos_c_SymC,
+  &cos_c_mA,
+  &cos_c_mB,
+  &cos_c_mC,
+  &cos_c_mCounter,
+  &cos_c_mD,
+  &cos_c_mE,
+  &cos_c_mMilliCounter,
+  &cos_c_mPA,
+  &cos_c_mP_p00,
+  &cos_c_mP_p01,
+  &cos_c_mP_p02,
+  &cos_c_mP_p03,
+  &cos_c_mP_p04,
+  &cos_c_mP_p05,
+  &cos_c_mP_p06,
+  &cos_c_mP_p07,
+  &cos_c_mP_p08,
+  &cos_c_mP_p09,
+  &cos_c_mP_p10,
+  &cos_c_mP_p11,
+  &cos_c_mP_p12,
+  &cos_c_mP_p13,
+  &cos_c_mP_p14,
+  &cos_c_mP_p15,
+  &cos_c_mP_p16,
+  &cos_c_mP_p17,
+  &cos_c_mP_p18,
+  &cos_c_mP_p19,
+  &cos_c_mP_p20,
+  &cos_c_mP_p21,
+  &cos_c_mP_p22,
+  &cos_c_mP_p23,
+  &cos_c_mP_p24,
+  &cos_c_mP_p25,
+  &cos_c_mP_p26,
+  &cos_c_mP_p27,
+  &cos_c_mP_p28,
+  &cos_c_mP_p29,
+  &cos_c_mP_p30,
+  &cos_c_mP_p31,
+  &cos_c_mP_p32,
+  &cos_c_mP_p33,
+  &cos_c_mP_p34,
+  &cos_c_mP_p35,
+  &cos_c_mP_p36,
+  &cos_c_mP_p37,
+  &cos_c_mP_p38,
+  &cos_c_mP_p39,
+  &cos_c_mP_p40,
+  &cos_c_mP_p41,
+  &cos_c_mP_p42,
+  &cos_c_mP_p43,
+  &cos_c_mP_p44,
+  &cos_c_mP_p45,
+  &cos_c_mP_p46,
+  &cos_c_mP_p47,
+  &cos_c_mP_p48,
+  &cos_c_mP_p49,
+  &cos_c_mP_p50,
+  &cos_c_mP_p51,
+  &cos_c_mP_p52,
+  &cos_c_mP_p53,
+  &cos_c_mP_p54,
+  &cos_c_mP_p55,
+  &cos_c_mP_p56,
+  &cos_c_mP_p57,
+  &cos_c_mP_p58,
+  &cos_c_mP_p59,
+  &cos_c_mP_p60,
+  &cos_c_mP_p61,
+  &cos_c_mP_p62,
+  &cos_c_mP_p63,
+  &cos_c_mP_p64,
+  &cos_c_mP_prop,
+  &cos_c_mP_subprop,
+  &cos_c_mProxyCounter,
+  &cos_c_mSymA,
+  &cos_c_mSymB,
+  &cos_c_mSymC,
+  &cos_c_pmA,
+  &cos_c_pmB,
+  &cos_c_pmC,
+  &cos_c_pmCounter,
+  &cos_c_pmD,
+  &cos_c_pmE,
+  &cos_c_pmMilliCounter,
+  &cos_c_pmPA,
+  &cos_c_pmP_p00,
+  &cos_c_pmP_p01,
+  &cos_c_pmP_p02,
+  &cos_c_pmP_p03,
+  &cos_c_pmP_p04,
+  &cos_c_pmP_p05,
+  &cos_c_pmP_p06,
+  &cos_c_pmP_p07,
+  &cos_c_pmP_p08,
+  &cos_c_pmP_p09,
+  &cos_c_pmP_p10,
+  &cos_c_pmP_p11,
+  &cos_c_pmP_p12,
+  &cos_c_pmP_p13,
+  &cos_c_pmP_p14,
+  &cos_c_pmP_p15,
+  &cos_c_pmP_p16,
+  &cos_c_pmP_p17,
+  &cos_c_pmP_p18,
+  &cos_c_pmP_p19,
+  &cos_c_pmP_p20,
+  &cos_c_pmP_p21,
+  &cos_c_pmP_p22,
+  &cos_c_pmP_p23,
+  &cos_c_pmP_p24,
+  &cos_c_pmP_p25,
+  &cos_c_pmP_p26,
+  &cos_c_pmP_p27,
+  &cos_c_pmP_p28,
+  &cos_c_pmP_p29,
+  &cos_c_pmP_p30,
+  &cos_c_pmP_p31,
+  &cos_c_pmP_p32,
+  &cos_c_pmP_p33,
+  &cos_c_pmP_p34,
+  &cos_c_pmP_p35,
+  &cos_c_pmP_p36,
+  &cos_c_pmP_p37,
+  &cos_c_pmP_p38,
+  &cos_c_pmP_p39,
+  &cos_c_pmP_p40,
+  &cos_c_pmP_p41,
+  &cos_c_pmP_p42,
+  &cos_c_pmP_p43,
+  &cos_c_pmP_p44,
+  &cos_c_pmP_p45,
+  &cos_c_pmP_p46,
+  &cos_c_pmP_p47,
+  &cos_c_pmP_p48,
+  &cos_c_pmP_p49,
+  &cos_c_pmP_p50,
+  &cos_c_pmP_p51,
+  &cos_c_pmP_p52,
+  &cos_c_pmP_p53,
+  &cos_c_pmP_p54,
+  &cos_c_pmP_p55,
+  &cos_c_pmP_p56,
+  &cos_c_pmP_p57,
+  &cos_c_pmP_p58,
+  &cos_c_pmP_p59,
+  &cos_c_pmP_p60,
+  &cos_c_pmP_p61,
+  &cos_c_pmP_p62,
+  &cos_c_pmP_p63,
+  &cos_c_pmP_p64,
+  &cos_c_pmP_prop,
+  &cos_c_pmP_subprop,
+  &cos_c_pmProxyCounter,
+  &cos_c_pmSymA,
+  &cos_c_pmSymB,
+  &cos_c_pmSymC,
+  &cos_g_gaddTo1,
+  &cos_g_gaddTo2,
+  &cos_g_gaddTo3,
+  &cos_g_gaddTo4,
+  &cos_g_gaddToPlus,
+  &cos_g_gcat2Str,
+  &cos_g_gcatStr,
+  &cos_g_gdoC,
+  &cos_g_gdoX,
+  &cos_g_gdoY,
+  &cos_g_gdoZ,
+  &cos_g_gincr,
+  &cos_g_gincrBy1,
+  &cos_g_gincrBy2,
+  &cos_g_gincrBy3,
+  &cos_g_gincrBy4,
+  &cos_g_gincrBy5,
+  &cos_g_gprofile,
+  &cos_g_gvputStr,
+  &cos_g_gwhich,
+  &cos_g_gwhich2,
+  &cos_m_gaddTo1__Counter__Counter,
+  &cos_m_gaddTo2__Counter__Counter__Counter,
+  &cos_m_gaddTo3__Counter__Counter__Counter__Counter,
+  &cos_m_gaddTo4__Counter__Counter__Counter__Counter__Counter,
+  &cos_m_gaddToPlus__Counter__Counter,
+  &cos_m_gcat2Str__A__A,
+  &cos_m_gcatStr__A,
+  &cos_m_gdeinit__A,
+  &cos_m_gdeinit__Counter,
+  &cos_m_gdeinit__MilliCounter,
+  &cos_m_gdeinit__SymA,
+  &cos_m_gdoC__A,
+  &cos_m_gdoC__B,
+  &cos_m_gdoC__C,
+  &cos_m_gdoC__D,
+  &cos_m_gdoC__E,
+  &cos_m_gdoX__A__A,
+  &cos_m_gdoX__B__B,
+  &cos_m_gdoX__C__C,
+  &cos_m_gdoX__D__D,
+  &cos_m_gdoX__E__E,
+  &cos_m_gdoY__A__A,
+  &cos_m_gdoY__A__B,
+  &cos_m_gdoY__A__C,
+  &cos_m_gdoY__A__C__a__360,
+  &cos_m_gdoY__A__D,
+  &cos_m_gdoY__A__E,
+  &cos_m_gdoY__B__A,
+  &cos_m_gdoY__B__A__a__371,
+  &cos_m_gdoY__B__A__a__377,
+  &cos_m_gdoY__B__A__a__383,
+  &cos_m_gdoY__B__B,
+  &cos_m_gdoY__B__C,
+  &cos_m_gdoY__B__C__a__410,
+  &cos_m_gdoY__B__D,
+  &cos_m_gdoY__B__E,
+  &cos_m_gdoY__C__A,
+  &cos_m_gdoY__C__B,
+  &cos_m_gdoY__C__C,
+  &cos_m_gdoY__C__D,
+  &cos_m_gdoY__C__E,
+  &cos_m_gdoY__D__A,
+  &cos_m_gdoY__D__B,
+  &cos_m_gdoY__D__C,
+  &cos_m_gdoY__D__D,
+  &cos_m_gdoY__D__E,
+  &cos_m_gdoY__E__A,
+  &cos_m_gdoY__E__B,
+  &cos_m_gdoY__E__C,
+  &cos_m_gdoY__E__D,
+  &cos_m_gdoY__E__E,
+  &cos_m_gdoZ__A__A,
+  &cos_m_gdoZ__B__B,
+  &cos_m_gdoZ__C__C,
+  &cos_m_gdoZ__D__D,
+  &cos_m_gdoZ__E__E,
+  &cos_m_ggetAt__A__mP_p00,
+  &cos_m_ggetAt__A__mP_p01,
+  &cos_m_ggetAt__A__mP_p02,
+  &cos_m_ggetAt__A__mP_p03,
+  &cos_m_ggetAt__A__mP_p04,
+  &cos_m_ggetAt__A__mP_p05,
+  &cos_m_ggetAt__A__mP_p06,
+  &cos_m_ggetAt__A__mP_p07,
+  &cos_m_ggetAt__A__mP_p08,
+  &cos_m_ggetAt__A__mP_p09,
+  &cos_m_ggetAt__A__mP_p10,
+  &cos_m_ggetAt__A__mP_p11,
+  &cos_m_ggetAt__A__mP_p12,
+  &cos_m_ggetAt__A__mP_p13,
+  &cos_m_ggetAt__A__mP_p14,
+  &cos_m_ggetAt__A__mP_p15,
+  &cos_m_ggetAt__A__mP_p16,
+  &cos_m_ggetAt__A__mP_p17,
+  &cos_m_ggetAt__A__mP_p18,
+  &cos_m_ggetAt__A__mP_p19,
+  &cos_m_ggetAt__A__mP_p20,
+  &cos_m_ggetAt__A__mP_p21,
+  &cos_m_ggetAt__A__mP_p22,
+  &cos_m_ggetAt__A__mP_p23,
+  &cos_m_ggetAt__A__mP_p24,
+  &cos_m_ggetAt__A__mP_p25,
+  &cos_m_ggetAt__A__mP_p26,
+  &cos_m_ggetAt__A__mP_p27,
+  &cos_m_ggetAt__A__mP_p28,
+  &cos_m_ggetAt__A__mP_p29,
+  &cos_m_ggetAt__A__mP_p30,
+  &cos_m_ggetAt__A__mP_p31,
+  &cos_m_ggetAt__A__mP_p32,
+  &cos_m_ggetAt__A__mP_p33,
+  &cos_m_ggetAt__A__mP_p34,
+  &cos_m_ggetAt__A__mP_p35,
+  &cos_m_ggetAt__A__mP_p36,
+  &cos_m_ggetAt__A__mP_p37,
+  &cos_m_ggetAt__A__mP_p38,
+  &cos_m_ggetAt__A__mP_p39,
+  &cos_m_ggetAt__A__mP_p40,
+  &cos_m_ggetAt__A__mP_p41,
+  &cos_m_ggetAt__A__mP_p42,
+  &cos_m_ggetAt__A__mP_p43,
+  &cos_m_ggetAt__A__mP_p44,
+  &cos_m_ggetAt__A__mP_p45,
+  &cos_m_ggetAt__A__mP_p46,
+  &cos_m_ggetAt__A__mP_p47,
+  &cos_m_ggetAt__A__mP_p48,
+  &cos_m_ggetAt__A__mP_p49,
+  &cos_m_ggetAt__A__mP_p50,
+  &cos_m_ggetAt__A__mP_p51,
+  &cos_m_ggetAt__A__mP_p52,
+  &cos_m_ggetAt__A__mP_p53,
+  &cos_m_ggetAt__A__mP_p54,
+  &cos_m_ggetAt__A__mP_p55,
+  &cos_m_ggetAt__A__mP_p56,
+  &cos_m_ggetAt__A__mP_p57,
+  &cos_m_ggetAt__A__mP_p58,
+  &cos_m_ggetAt__A__mP_p59,
+  &cos_m_ggetAt__A__mP_p60,
+  &cos_m_ggetAt__A__mP_p61,
+  &cos_m_ggetAt__A__mP_p62,
+  &cos_m_ggetAt__A__mP_p63,
+  &cos_m_gincr__Counter,
+  &cos_m_gincr__MilliCounter,
+  &cos_m_gincrBy1__Counter,
+  &cos_m_gincrBy1__MilliCounter,
+  &cos_m_gincrBy2__Counter,
+  &cos_m_gincrBy2__MilliCounter,
+  &cos_m_gincrBy3__Counter,
+  &cos_m_gincrBy3__MilliCounter,
+  &cos_m_gincrBy4__Counter,
+  &cos_m_gincrBy4__MilliCounter,
+  &cos_m_gincrBy5__Counter,
+  &cos_m_gincrBy5__MilliCounter,
+  &cos_m_ginit__A,
+  &cos_m_ginit__B,
+  &cos_m_ginit__C,
+  &cos_m_ginit__Counter,
+  &cos_m_ginit__D,
+  &cos_m_ginit__E,
+  &cos_m_ginit__MilliCounter,
+  &cos_m_ginit__SymA,
+  &cos_m_ginitWith__A__A,
+  &cos_m_gint__Counter,
+  &cos_m_ginvariant__A,
+  &cos_m_ginvariant__B,
+  &cos_m_ginvariant__C,
+  &cos_m_ginvariant__D,
+  &cos_m_ginvariant__E,
+  &cos_m_gprofile__A,
+  &cos_m_gprofile__B,
+  &cos_m_gstr__A,
+  &cos_m_gunrecognizedMessage1__A,
+  &cos_m_gunrecognizedMessage1__PA,
+  &cos_m_gunrecognizedMessage1__ProxyCounter,
+  &cos_m_gvputStr__C,
+  &cos_m_gwhich__Object,
+  &cos_m_gwhich__SymB,
+  &cos_m_gwhich2__Object__Object,
+  &cos_m_gwhich2__SymB__SymB,
+  0
+};
+
+void cos_symbol_register(struct Any**, const char*);
+
+void cos_symbol_initCosBase(void);
+
+void cos_symbol_init(void);
+void cos_symbol_init(void)
+{
+   static int done = 0;
+   
+   if (!done) {
+     done = 1;
+     cos_symbol_initCosBase();
+     cos_symbol_register(symtbl,"testCosBase");
+   }
+}
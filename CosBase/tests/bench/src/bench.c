@@ -0,0 +1,48 @@
+/**
+ * C Object System
+ * COS benchmarks
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/debug.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+
+int main(int argc, char *argv[])
+{
+  int cache_trc = YES;
+  int i;
+
+  for (i = 1; i < argc; i++)
+    if (!strcmp(argv[i], "-q"))
+      cache_trc = NO;
+
+  cos_init();
+
+  printf("\n** COS init duration: %.3f s\n", cos_initDuration());
+
+  bh_hkeys();
+  bh_shared();
+
+  if (cache_trc)
+    cos_method_statCaches(stdout);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,31 @@
+#ifndef COS_BENCH_BENCH_H
+#define COS_BENCH_BENCH_H
+
+/**
+ * C Object System
+ * COS benchmarks
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// synthetic classes and generics (see classes.c)
+extern struct Class *const bh_cls[];
+extern SEL const bh_gen[5][256];
+
+// benchmarks
+void bh_hkeys (void);
+void bh_shared(void);
+
+#endif // COS_BENCH_BENCH_H
@@ -0,0 +1,86 @@
+/**
+ * C Object System
+ * COS benchmarks - synthetic classes and methods
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+
+#include "generics.h"
+#include "bench.h"
+
+// -----
+
+#define BH_CLS(N) \
+  defclass(Bh##N) endclass \
+  makclass(Bh##N);
+
+BH_X1024(BH_CLS,)
+
+#define BH_REF(N) classref(Bh##N),
+
+struct Class *const bh_cls[BH_NCLS] = { BH_X1024(BH_REF,) };
+
+// -----
+
+#define BH_MTH1(N) \
+  defmethod(OBJ, gbh1_##N, Object) \
+    retmethod(_1); \
+  endmethod
+
+#define BH_MTH2(N) \
+  defmethod(OBJ, gbh2_##N, Object, Object) \
+    retmethod(_1); \
+  endmethod
+
+#define BH_MTH3(N) \
+  defmethod(OBJ, gbh3_##N, Object, Object, Object) \
+    retmethod(_1); \
+  endmethod
+
+#define BH_MTH4(N) \
+  defmethod(OBJ, gbh4_##N, Object, Object, Object, Object) \
+    retmethod(_1); \
+  endmethod
+
+#define BH_MTH5(N) \
+  defmethod(OBJ, gbh5_##N, Object, Object, Object, Object, Object) \
+    retmethod(_1); \
+  endmethod
+
+BH_X256(BH_MTH1,)
+BH_X256(BH_MTH2,)
+BH_X256(BH_MTH3,)
+BH_X256(BH_MTH4,)
+BH_X256(BH_MTH5,)
+
+// -----
+
+#define BH_GREF(N) genericref(N),
+
+#define BH_GREF1(N) BH_GREF(gbh1_##N)
+#define BH_GREF2(N) BH_GREF(gbh2_##N)
+#define BH_GREF3(N) BH_GREF(gbh3_##N)
+#define BH_GREF4(N) BH_GREF(gbh4_##N)
+#define BH_GREF5(N) BH_GREF(gbh5_##N)
+
+SEL const bh_gen[5][BH_NGEN] = {
+  { BH_X256(BH_GREF1,) },
+  { BH_X256(BH_GREF2,) },
+  { BH_X256(BH_GREF3,) },
+  { BH_X256(BH_GREF4,) },
+  { BH_X256(BH_GREF5,) },
+};
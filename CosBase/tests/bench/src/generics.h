@@ -0,0 +1,49 @@
+#ifndef COS_BENCH_GENERICS_H
+#define COS_BENCH_GENERICS_H
+
+/**
+ * C Object System
+ * COS benchmarks - synthetic generics
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* NOTE-INFO: synthetic symbols
+   BH_Xn(M,P) expands M(P<digits>) n times with base-4 digits appended to P,
+   e.g. BH_X16(M,) gives M(00) M(01) ... M(33). The expansion is done by
+   cpp, so cosgen and cossym see the generated symbols as usual.
+*/
+#define BH_X4(M,P)    M(P##0) M(P##1) M(P##2) M(P##3)
+#define BH_X16(M,P)   BH_X4  (M,P##0) BH_X4  (M,P##1) BH_X4  (M,P##2) BH_X4  (M,P##3)
+#define BH_X64(M,P)   BH_X16 (M,P##0) BH_X16 (M,P##1) BH_X16 (M,P##2) BH_X16 (M,P##3)
+#define BH_X256(M,P)  BH_X64 (M,P##0) BH_X64 (M,P##1) BH_X64 (M,P##2) BH_X64 (M,P##3)
+#define BH_X1024(M,P) BH_X256(M,P##0) BH_X256(M,P##1) BH_X256(M,P##2) BH_X256(M,P##3)
+
+// number of synthetic classes and generics (per rank)
+enum { BH_NCLS = 1024, BH_NGEN = 256 };
+
+#define BH_GEN1(N) defgeneric(OBJ, gbh1_##N, _1);
+#define BH_GEN2(N) defgeneric(OBJ, gbh2_##N, _1, _2);
+#define BH_GEN3(N) defgeneric(OBJ, gbh3_##N, _1, _2, _3);
+#define BH_GEN4(N) defgeneric(OBJ, gbh4_##N, _1, _2, _3, _4);
+#define BH_GEN5(N) defgeneric(OBJ, gbh5_##N, _1, _2, _3, _4, _5);
+
+BH_X256(BH_GEN1,)
+BH_X256(BH_GEN2,)
+BH_X256(BH_GEN3,)
+BH_X256(BH_GEN4,)
+BH_X256(BH_GEN5,)
+
+#endif // COS_BENCH_GENERICS_H
@@ -0,0 +1,150 @@
+/**
+ * C Object System
+ * COS benchmarks - dispatcher cache keys
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+
+#include <stdio.h>
+#include <time.h>
+
+#include "generics.h"
+#include "bench.h"
+
+/* NOTE-INFO: workload
+   Each rank replays W distinct-ish message signatures P times through the
+   inline dispatcher. Half of the signatures are random tuples, the other
+   half are permutations of the previous tuple (e.g. (A,B) then (B,A)),
+   the pattern additive keys cannot separate. Loads of the first pass are
+   compulsory, loads of the next passes are conflict misses.
+*/
+enum { W = 4096, P = 16 };
+
+static U32 idx[W][6];
+static U32 seed = 1;
+
+static U32
+rnd(U32 n)
+{
+  seed = seed * 1664525 + 1013904223;
+  return (seed >> 8) % n;
+}
+
+static void
+fill(U32 rnk)
+{
+  U32 w, i;
+
+  for (w = 0; w < W; w++) {
+    idx[w][0] = rnd(BH_NGEN);
+
+    if (w & 1 && rnk > 1) { // permutation of the previous tuple
+      U32 j = rnd(rnk), k = (j+1+rnd(rnk-1)) % rnk, t;
+      for (i = 1; i <= rnk; i++)
+        idx[w][i] = idx[w-1][i];
+      t = idx[w][j+1], idx[w][j+1] = idx[w][k+1], idx[w][k+1] = t;
+    } else
+      for (i = 1; i <= rnk; i++)
+        idx[w][i] = rnd(BH_NCLS);
+  }
+}
+
+#define ID(n) cos_class_id(bh_cls[idx[w][n]])
+
+static void
+lookup(U32 rnk)
+{
+  SEL const *gen = bh_gen[rnk-1];
+  U32 w;
+
+  switch(rnk) {
+  case 1:
+    for (w = 0; w < W; w++)
+      cos_method_fastLookup1(gen[idx[w][0]], ID(1));
+    break;
+  case 2:
+    for (w = 0; w < W; w++)
+      cos_method_fastLookup2(gen[idx[w][0]], ID(1), ID(2));
+    break;
+  case 3:
+    for (w = 0; w < W; w++)
+      cos_method_fastLookup3(gen[idx[w][0]], ID(1), ID(2), ID(3));
+    break;
+  case 4:
+    for (w = 0; w < W; w++)
+      cos_method_fastLookup4(gen[idx[w][0]], ID(1), ID(2), ID(3), ID(4));
+    break;
+  case 5:
+    for (w = 0; w < W; w++)
+      cos_method_fastLookup5(gen[idx[w][0]], ID(1), ID(2), ID(3), ID(4), ID(5));
+    break;
+  }
+}
+
+#undef ID
+
+#define LOADS(c) ((c)->cnt + (c)->mis)
+
+static U32
+loads(U32 rnk)
+{
+  switch(rnk) {
+  case 1: return LOADS(cos_method_cache1());
+  case 2: return LOADS(cos_method_cache2());
+  case 3: return LOADS(cos_method_cache3());
+  case 4: return LOADS(cos_method_cache4());
+  case 5: return LOADS(cos_method_cache5());
+  }
+  return 0;
+}
+
+#undef LOADS
+
+void
+bh_hkeys(void)
+{
+  U32 rnk, p;
+
+  printf("\n** COS dispatcher cache keys (%s keys, %s cache): "
+         "%d classes, %d generics per rank, %d signatures x %d passes\n",
+         COS_METHOD_HKEY == COS_METHOD_HKEY_MIX ? "mix" : "add",
+         COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK ? "pack" : "chain",
+         BH_NCLS, BH_NGEN, W, P);
+
+  for (rnk = 1; rnk <= 5; rnk++) {
+    U32 cold, warm;
+    clock_t t;
+
+    fill(rnk);
+
+    cold = loads(rnk);
+    lookup(rnk);
+    cold = loads(rnk) - cold;
+
+    warm = loads(rnk);
+    t = clock();
+    for (p = 1; p < P; p++)
+      lookup(rnk);
+    t = clock() - t;
+    warm = loads(rnk) - warm;
+
+    printf("rank %u: cold loads=%5u, conflict misses=%7u (%6.2f%%), "
+           "%6.2f ns/lookup\n", rnk, cold, warm,
+           100.0 * warm / ((double)W * (P-1)),
+           1e9 * t / CLOCKS_PER_SEC / ((double)W * (P-1)));
+  }
+}
@@ -0,0 +1,88 @@
+/**
+ * C Object System
+ * COS benchmarks - shared dispatch table
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "generics.h"
+#include "bench.h"
+
+/* NOTE-INFO: workload
+   T threads resolve the same W signatures of rank 2 one after the other
+   (fresh thread caches). With COS_METHOD_SHARED, only the first thread
+   should pay the binary search, the others hit the shared table.
+*/
+enum { T = 4, W = 4096 };
+
+static U32 idx[W][3];
+
+struct result {
+  U32    loads, shared;
+  double time;
+};
+
+static void*
+worker(void *arg)
+{
+  struct result *res = arg;
+  struct cos_method_cache2 *cache = cos_method_cache2();
+  clock_t t = clock();
+  U32 w;
+
+  for (w = 0; w < W; w++)
+    cos_method_fastLookup2(bh_gen[1][idx[w][0]],
+                           cos_class_id(bh_cls[idx[w][1]]),
+                           cos_class_id(bh_cls[idx[w][2]]));
+
+  res->time   = (double)(clock() - t) / CLOCKS_PER_SEC;
+  res->loads  = cache->cnt + cache->mis;
+  res->shared = cache->shr;
+
+  cos_method_clearCaches();
+  return 0;
+}
+
+void
+bh_shared(void)
+{
+  struct result res[T];
+  pthread_t thr;
+  U32 seed = 7, w, i;
+
+  for (w = 0; w < W; w++)
+    for (i = 0; i < 3; i++) {
+      seed = seed * 1664525 + 1013904223;
+      idx[w][i] = (seed >> 8) % (i ? BH_NCLS : BH_NGEN);
+    }
+
+  printf("\n** COS shared dispatch table (%s): "
+         "%d threads resolving the same %d signatures\n",
+         COS_METHOD_SHARED ? "enabled" : "disabled", T, W);
+
+  for (i = 0; i < T; i++) {
+    if (pthread_create(&thr, 0, worker, res+i) || pthread_join(thr, 0))
+      cos_abort("unable to run benchmark thread");
+
+    printf("thread %u: loads=%5u, shared hits=%5u, %6.2f ms\n",
+           i, res[i].loads, res[i].shared, res[i].time * 1e3);
+  }
+}
@@ -501,3 +501,17 @@ defmethod(void, gdoY, E, E)
   gcat2Str(_1,_2,"-EE");
   if (next_method_p) next_method(self1,self2);
 endmethod
+
+// profiled methods (see ut_profile.c)
+#define COS_METHOD_PROFILE
+
+defmethod(void, gprofile, A, (U32*)cnt)
+  ++*cnt;
+endmethod
+
+defmethod(void, gprofile, B, (U32*)cnt)
+  ++*cnt;
+  next_method(self, cnt);
+endmethod
+
+#undef COS_METHOD_PROFILE
@@ -32,6 +32,13 @@ defgeneric (void, gcat2Str, _, _, (STR)str);
 
 defgenericv(void, gvputStr, _, (STR)fmt, ...);
 
+// --- testsuite profile ---
+defgeneric (void, gprofile, _, (U32*)cnt);
+
+// --- testsuite symbol ---
+defgeneric(STR, gwhich , _1);
+defgeneric(STR, gwhich2, _1, _2);
+
 // --- speed tests Counter/MilliCounter ---
 defgeneric(OBJ, gincr   , _);
 defgeneric(OBJ, gincrBy1, _, (U32)a);
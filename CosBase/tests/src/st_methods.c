@@ -20,9 +20,11 @@
 #include <cos/Object.h>
 #include <cos/gen/object.h>
 #include <cos/gen/value.h>
+#include <cos/gen/message.h>
 #include <cos/utest.h>
 
 #include <string.h>
+#include <pthread.h>
 
 #include "tests.h"
 #include "generics.h"
@@ -67,6 +69,91 @@ st_nextmethods(void)
   grelease(cnt);
 }
 
+enum { T = 4, R = 16, Q = N/2/16/R*R };
+
+// rendez-vous of the T threads and the main thread
+static struct {
+  pthread_mutex_t mtx;
+  pthread_cond_t  cnd;
+  int cnt, gen;
+} nxt_bar = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, 0 };
+
+static void
+nxt_wait(void)
+{
+  int gen;
+
+  pthread_mutex_lock(&nxt_bar.mtx);
+  gen = nxt_bar.gen;
+  if (++nxt_bar.cnt == T+1)
+    nxt_bar.cnt = 0, nxt_bar.gen++, pthread_cond_broadcast(&nxt_bar.cnd);
+  else
+    while (gen == nxt_bar.gen)
+      pthread_cond_wait(&nxt_bar.cnd, &nxt_bar.mtx);
+  pthread_mutex_unlock(&nxt_bar.mtx);
+}
+
+static void*
+nextmethods(void *cnt)
+{
+  int i, r;
+
+  for (r = 0; r < R; r++) {
+    // all threads start on cleared slots and race on their resolution
+    nxt_wait();
+
+    for (i = 0; i < Q/R; i++) {
+      gincr(cnt);
+      gincrBy1(cnt,1);
+      gincrBy2(cnt,1,1);
+      gincrBy3(cnt,1,1,1);
+      gincrBy4(cnt,1,1,1,1);
+      gincrBy5(cnt,1,1,1,1,1);
+    }
+
+    nxt_wait();
+  }
+
+  return 0;
+}
+
+void
+st_nextmethods_mt(void)
+{
+  useclass(MilliCounter);
+  struct cos_stest_info info[1];
+  pthread_t thr[T];
+  OBJ cnt[T];
+  int i, r, err = 0;
+
+  for (i = 0; i < T; i++)
+    cnt[i] = gnew(MilliCounter);
+
+  cos_stest_init(info, "method + next method (4 threads)", 6L*T*Q);
+
+  for (i = 0; i < T; i++)
+    err |= pthread_create(thr+i, 0, nextmethods, cnt[i]);
+
+  // clear the next_method slots between the rounds (threads are parked)
+  for (r = 0; r < R; r++) {
+    cos_method_nextClear();
+    nxt_wait();
+    nxt_wait();
+  }
+
+  for (i = 0; i < T; i++)
+    err |= pthread_join(thr[i], 0);
+
+  cos_stest_fini(info);
+
+  ensure( !err );
+
+  for (i = 0; i < T; i++) {
+    ensure( gint(cnt[i]) == Q+Q+2*Q+3*Q+4*Q+5*Q );
+    grelease(cnt[i]);
+  }
+}
+
 void
 st_multimethods(void)
 {
@@ -87,6 +174,31 @@ st_multimethods(void)
   grelease(one);
 }
 
+void
+st_sitemethods(void)
+{
+  useclass(Counter);
+
+  OBJ cnt = gnew(Counter);
+  OBJ one = gincr(gnew(Counter));
+
+  COS_SITE_DCL(s1,1);
+  COS_SITE_DCL(s2,2);
+  COS_SITE_DCL(s3,3);
+  COS_SITE_DCL(s4,4);
+  COS_SITE_DCL(s5,5);
+
+  STEST( "call-site method (rank 1)", N, COS_SITE_SEND(s1,gincr,cnt) );
+  STEST( "call-site method (rank 2)", N, COS_SITE_SEND(s2,gaddTo1,cnt,one) );
+  STEST( "call-site method (rank 3)", N, COS_SITE_SEND(s3,gaddTo2,cnt,one,one) );
+  STEST( "call-site method (rank 4)", N, COS_SITE_SEND(s4,gaddTo3,cnt,one,one,one) );
+  STEST( "call-site method (rank 5)", N, COS_SITE_SEND(s5,gaddTo4,cnt,one,one,one,one) );
+
+  ensure( gint(cnt) == N+N+2*N+3*N+4*N );
+  grelease(cnt);
+  grelease(one);
+}
+
 void
 st_methods_ptr(void)
 {
@@ -153,13 +265,49 @@ st_multimethods_ptr(void)
   grelease(one);
 }
 
+void
+st_lookup(void)
+{
+  enum { P = N/16 };
+  useclass(Counter, MilliCounter, A, E);
+  usegeneric((ginit)ginit_s, (gdoY)gdoY_s,
+             (gunrecognizedMessage3)gunrecognizedMessage3_s,
+             (gunrecognizedMessage4)gunrecognizedMessage4_s,
+             (gunrecognizedMessage5)gunrecognizedMessage5_s);
+
+  OBJ cnt = gnew(MilliCounter);
+  OBJ one = gnew(Counter);
+  OBJ e   = gnew(E);
+
+  U32 cid = cos_object_id(cnt);
+  U32 oid = cos_object_id(one);
+  U32 eid = cos_object_id(e);
+
+  // method resolution behind a cache miss
+  STEST( "method lookup (rank 1)", P, cos_method_get1((SEL)ginit_s, cid) );
+  STEST( "method lookup (rank 2)", P, cos_method_get2((SEL)gdoY_s, eid, eid) );
+  STEST( "method lookup (rank 3)", P,
+         cos_method_get3((SEL)gunrecognizedMessage3_s, cid, oid, cid) );
+  STEST( "method lookup (rank 4)", P,
+         cos_method_get4((SEL)gunrecognizedMessage4_s, cid, oid, cid, oid) );
+  STEST( "method lookup (rank 5)", P,
+         cos_method_get5((SEL)gunrecognizedMessage5_s, cid, oid, cid, oid, cid) );
+
+  // subclass test (depth 3)
+  STEST( "isKindOf", N, cos_object_isKindOf(e, (const void*)A) );
+
+  grelease(cnt);
+  grelease(one);
+  grelease(e);
+}
+
 void
 st_memory(void)
 {
   enum { P = N/2/sizeof(void*) };
   static OBJ arr[P];
-  useclass(Counter, AutoRelease);
-  OBJ ar = gnew(AutoRelease);
+  useclass(Counter, AutoRelease, Region);
+  OBJ ar = gnew(AutoRelease), pool, reg;
   size_t sz = gsize(Counter);
   size_t i;
   int lvl;
@@ -193,11 +341,28 @@ st_memory(void)
 
   STEST( "alloc + init + release", P, grelease(ginit(galloc(Counter))) );
 
+  i = 0, pool = gnew(AutoRelease);
+  STEST( "alloc + init + autoRelease (drain)", P,
+         gautoRelease(ginit(galloc(Counter)));
+         if (++i % 16384 == 0) grelease(pool), pool = gnew(AutoRelease) );
+  grelease(pool);
+
+  reg = gnew(Region);
+  STEST( "alloc + init (region)", P, ginit(galloc(Counter)) );
+  grelease(reg);
+
   grelease(ar);
 }
 
 void
 st_exception(void)
 {
+#ifdef sigsetjmp
+  sigjmp_buf buf;
+
+  STEST( "sigsetjmp (save mask)", N/50, sigsetjmp(buf,1) );
+  STEST( "sigsetjmp (no mask)"  , N/50, sigsetjmp(buf,0) );
+#endif
   STEST( "try-endtry", N/50, TRY ENDTRY );
+  STEST( "try-finally-endtry", N/50, TRY FINALLY ENDTRY );
 }
@@ -25,6 +25,9 @@
 #include <cos/gen/value.h>
 #include <cos/utest.h>
 
+#include <stdio.h>
+#include <pthread.h>
+
 #include "tests.h"
 #include "generics.h"
 
@@ -102,3 +105,49 @@ st_pxymultimethods(void)
   grelease(pxy);
   grelease(one);
 }
+
+enum { T = 4, Q = N/8 };
+
+static void*
+pxymethods(void *pxy)
+{
+  int i;
+
+  for (i = 0; i < Q; i++)
+    gint(pxy);
+
+  return 0;
+}
+
+void
+st_pxymethods_mt(void)
+{
+  useclass(Counter, Proxy);
+
+  OBJ cnt = gnew(Counter);
+  OBJ pxy = gnewWith(Proxy,cnt);
+  struct cos_stest_info info[1];
+  pthread_t thr[T];
+  char str[64];
+  int i, n, err = 0;
+
+  grelease(cnt);
+
+  // contention of a shared proxy, rates are per CPU second (see cos_utest.c)
+  for (n = 1; n <= T; n *= 2) {
+    sprintf(str, "method through shared proxy (%d thread%s)", n, n > 1 ? "s" : "");
+    cos_stest_init(info, str, (long)n*Q);
+
+    for (i = 0; i < n; i++)
+      err |= pthread_create(thr+i, 0, pxymethods, pxy);
+
+    for (i = 0; i < n; i++)
+      err |= pthread_join(thr[i], 0);
+
+    cos_stest_fini(info);
+  }
+
+  ensure( !err );
+
+  grelease(pxy);
+}
@@ -42,6 +42,9 @@ int main(int argc, char *argv[])
   int debug_sym = NO;
   int alloc_trc = NO;
   int cache_trc = NO;
+  int mem_trc   = NO;
+  double dur;
+  STR str;
   int i;
   
   cos_logmsg_setLevel(COS_LOGMSG_DEBUG);
@@ -55,6 +58,8 @@ int main(int argc, char *argv[])
       alloc_trc = YES;
     if (!strcmp(argv[i], "-dc"))
       cache_trc = YES;
+    if (!strcmp(argv[i], "-dm"))
+      mem_trc = YES;
     if (!strcmp(argv[i], "-i"))
       init_time = YES;
     if (!strcmp(argv[i], "-s"))
@@ -71,6 +76,8 @@ int main(int argc, char *argv[])
     atexit(on_exit);
     cos_init(); // explicit initialization for measurement
     printf("** COS init duration: %.3f s\n", cos_initDuration());
+    for (i = 0; (str = cos_initPhase(i, &dur)); i++)
+      printf("**   %-20s: %.6f s\n", str, dur);
   } else
     cos_init();
     
@@ -92,6 +99,7 @@ int main(int argc, char *argv[])
   // testsuites
   printf("\n** C Object System Testsuite (%d bits) **\n", bits);
   ut_methods();
+  ut_dispatch();
   ut_classes();
   ut_properties();
   ut_nextmethod();
@@ -102,23 +110,33 @@ int main(int argc, char *argv[])
   ut_exception();
   ut_contract();
   ut_autorelease();
+  ut_refcount();
+  ut_memory();
+  ut_region();
+  ut_profile();
+  ut_symbol();
 
   cos_utest_stat();
 
   // speed testsuites
   if (speed_tst) {
-    printf("\n** C Object System Speed Testsuite (%d bits) **\n", bits);
+    printf("\n** C Object System Speed Testsuite (%d bits, %s cache) **\n", bits,
+           COS_METHOD_CACHE_LAYOUT == COS_METHOD_CACHE_PACK ? "pack" : "chain");
 
     st_methods();
     st_nextmethods();
+    st_nextmethods_mt();
     st_multimethods();
+    st_sitemethods();
 
     st_methods_ptr();
     st_multimethods_ptr();
+    st_lookup();
 
     st_pxymethods();
     st_pxynextmethods();
     st_pxymultimethods();
+    st_pxymethods_mt();
   
     st_memory();
     st_exception();
@@ -129,11 +147,13 @@ int main(int argc, char *argv[])
   if (cache_trc) {
     printf("\n** COS caches statistics\n");
 
-    cos_method_statCache1(0);
-    cos_method_statCache2(0);
-    cos_method_statCache3(0);
-    cos_method_statCache4(0);
-    cos_method_statCache5(0);
+    cos_method_statCaches(0);
+  }
+
+  if (mem_trc) {
+    printf("\n** COS memory statistics\n");
+
+    cos_mem_stats(0);
   }
 
   if (alloc_trc)
@@ -21,6 +21,7 @@
  */
 
 void ut_methods(void);
+void ut_dispatch(void);
 void ut_classes(void);
 void ut_properties(void);
 //void ut_predlogic(void);
@@ -32,18 +33,27 @@ void ut_proxy(void);
 void ut_exception(void);
 void ut_contract(void);
 void ut_autorelease(void);
+void ut_refcount(void);
+void ut_memory(void);
+void ut_region(void);
+void ut_profile(void);
+void ut_symbol(void);
 //void ut_autoconst(void);
 //void ut_autovector(void);
 
 void st_methods(void);
 void st_methods_ptr(void);
 void st_nextmethods(void);
+void st_nextmethods_mt(void);
 void st_multimethods(void);
+void st_sitemethods(void);
 void st_multimethods_ptr(void);
+void st_lookup(void);
 
 void st_pxymethods(void);
 void st_pxynextmethods(void);
 void st_pxymultimethods(void);
+void st_pxymethods_mt(void);
 
 void st_memory(void);
 void st_exception(void);
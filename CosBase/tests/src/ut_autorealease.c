@@ -31,7 +31,7 @@
 void
 ut_autorelease(void)
 {
-  useclass(A, AutoRelease);
+  useclass(A, B, AutoRelease);
   OBJ a, c;
   volatile size_t i;
   volatile OBJ ar, ar1, ar2, ar3, ar4;
@@ -126,6 +126,19 @@ ut_autorelease(void)
     }
     grelease(ar);
 
+    // ---- many chunks, mixed classes
+    ar = gnew(AutoRelease);
+    a = gretain(gautoRelease(gnew(A)));
+    for (i = 0; i < 3000; i++)
+      gautoRelease(i & 1 ? gnew(A) : gnew(B));
+    c = gretain(gautoRelease(gnew(B)));
+    UTEST( gsize(ar) == 3002 );
+    grelease(ar);
+    UTEST( gretainCount(a) == 1 );
+    UTEST( gretainCount(c) == 1 );
+    UTEST( (grelease(a), 1) );
+    UTEST( (grelease(c), 1) );
+
     // ----
     ar = gnew(AutoRelease);
     ar1 = ar2 = ar3 = ar4 = 0;
@@ -32,6 +32,7 @@ ut_classes(void)
   useclass(Behavior, mBehavior, pmBehavior);
   useclass(Generic, mGeneric);
   useclass(Proxy);
+  useclass(A, B, D, E, mA, mB, mC, mE);
 
   UTEST_START("class definition & inheritance")
   
@@ -178,5 +179,14 @@ ut_classes(void)
     UTEST( gisKindOf(Generic,  pmBehavior) == False );
     UTEST( gisKindOf(Behavior, pmBehavior) == True  );
 
+    // user classes (siblings and depth)
+    UTEST( gisKindOf(E, mA)      == True  );
+    UTEST( gisKindOf(E, mE)      == True  );
+    UTEST( gisKindOf(E, mObject) == True  );
+    UTEST( gisKindOf(D, mC)      == True  );
+    UTEST( gisKindOf(D, mB)      == False );
+    UTEST( gisKindOf(B, mC)      == False );
+    UTEST( gisKindOf(A, mE)      == False );
+
   UTEST_END
 }
@@ -0,0 +1,142 @@
+/**
+ * C Object System
+ * COS testsuites - dispatcher caches
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/gen/object.h>
+#include <cos/utest.h>
+
+#include "tests.h"
+#include "generics.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/* NOTE-INFO: colliding keys
+   The loads run in a new thread to start from an empty cache1. The keys of
+   the (generic,class) pairs are compared against the mask of the first
+   allocated cache to pick the colliding ones. A miss may grow the cache at
+   most once and only above half load, so the cache must never be larger
+   than four times the number of loaded keys (or its initial size).
+*/
+
+enum { NG = 16, NC = 16, N = NG*NC, R = 10 };
+
+static SEL gen[NG];
+static U32 cid[NC];
+
+static struct {
+  U32 msk, col, bad;
+  BOOL col_ok, all_ok;
+} res;
+
+static IMP1
+lookup(U32 i)
+{
+  return cos_method_fastLookup1(gen[i/NC], cid[i%NC]);
+}
+
+static BOOL
+bounded(U32 msk, U32 n)
+{
+  return cos_method_cache1()->msk+1 <= (4*n > msk+1 ? 4*n : msk+1);
+}
+
+static void*
+loads(void *arg)
+{
+  struct cos_method_cache1 *cache = cos_method_cache1();
+  IMP1 fct[N];
+  U32 key[N], i, j, r;
+  BOOL *used;
+
+  COS_UNUSED(arg);
+
+  // allocate the cache
+  lookup(0);
+  res.msk = cache->msk;
+
+  for (i = 0; i < N; i++)
+    key[i] = cos_method_hkey1(gen[i/NC]->Behavior.id, cid[i%NC]) & res.msk;
+
+  // two colliding keys must not grow the cache
+  for (i = 1; i < N && !res.col; i++)
+    for (j = i+1; j < N && !res.col; j++)
+      if (key[i] == key[j])
+        lookup(i), lookup(j), res.col = 1;
+
+  res.col_ok = cache->msk == res.msk;
+
+  // all the keys (with collisions), repeatedly
+  used = calloc(res.msk+1, sizeof *used);
+  if (!used) return 0;
+
+  for (i = 0; i < N; i++) {
+    fct[i] = lookup(i);
+    if (used[key[i]]) ++res.col;
+    used[key[i]] = YES;
+  }
+
+  res.all_ok = bounded(res.msk, N);
+
+  for (r = 0; r < R; r++)
+    for (j = 0; j < N; j++) {
+      i = (j*7 + r) % N;
+      if (lookup(i) != fct[i]) ++res.bad;
+    }
+
+  res.all_ok = res.all_ok && bounded(res.msk, N);
+
+  free(used);
+  return 0;
+}
+
+void
+ut_dispatch(void)
+{
+  useclass(Object, Class, MetaClass, PropMetaClass, Behavior, Generic, Proxy);
+  useclass(A, B, C, D, E, mA, mB, mC, mD);
+
+  OBJ cls[NC] = { Object, Class, MetaClass, PropMetaClass, Behavior, Generic,
+                  A, B, C, D, E, mA, mB, mC, mD, Proxy };
+  SEL sel[NG] = {
+    genericref(gretain), genericref(grelease), genericref(gautoRelease),
+    genericref(gretainCount), genericref(gcopy), genericref(gclone),
+    genericref(ginit), genericref(gdeinit), genericref(gclear),
+    genericref(galloc), genericref(gdealloc), genericref(gnew),
+    genericref(gclass), genericref(gincr), genericref(gprofile),
+    genericref(gwhich) };
+  pthread_t thr;
+  int err = 0, i;
+
+  for (i = 0; i < NC; i++) cid[i] = cos_class_id(CAST(struct Class*, cls[i]));
+  for (i = 0; i < NG; i++) gen[i] = sel[i];
+
+  UTEST_START("dispatcher caches")
+
+    err |= pthread_create(&thr, 0, loads, 0);
+    err |= pthread_join(thr, 0);
+
+    UTEST( !err );
+    UTEST( res.col > 1 );
+    UTEST( res.col_ok );
+    UTEST( res.all_ok );
+    UTEST( !res.bad );
+
+  UTEST_END
+}
@@ -131,6 +131,16 @@ useclass(ExSignal);
       grelease(ex);
     ENDTRY
 
+  // ----- same signal again (signal mask restored on the throw path)
+  for (i = 0; i < 2; i++)
+    TRY
+      raise(sig[0]);
+      UTEST( !"signal blocked" );
+    CATCH(ExSignal, ex)
+      UTEST( gint(ex) == sig[0] );
+      grelease(ex);
+    ENDTRY
+
   UTEST_END
 }
 
@@ -0,0 +1,209 @@
+/**
+ * C Object System
+ * COS testsuites - memory freed across threads
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/debug.h>
+#include <cos/utest.h>
+
+#include <pthread.h>
+
+#include "tests.h"
+
+enum { N = 1000, S = 40, L = 3000 };
+
+static void  *blk[N];
+static size_t sent_n; // remote frees sent by the consumer
+static size_t late_n; // memory left in the pool by the late frees
+
+static pthread_key_t late_key;
+
+#if COS_MEM_STAT
+static void *sample_site;
+static int   samples;
+
+static void
+sampled(void *ptr, size_t size, void *site)
+{
+  COS_UNUSED(ptr), COS_UNUSED(size);
+
+  sample_site = site;
+  samples++;
+}
+#endif
+
+static void*
+producer(void *unused)
+{
+  int i;
+
+  COS_UNUSED(unused);
+
+  for (i = 0; i < N; i++)
+    blk[i] = malloc(S);
+
+  return 0;
+}
+
+// runs after the destructor of the pool (keys are destroyed in creation order)
+static void
+late_free(void *unused)
+{
+  size_t size0;
+  int i;
+
+  COS_UNUSED(unused);
+
+  size0 = cos_mem_unused(0, 0);
+  for (i = 0; i < N; i++)
+    free(blk[i]);
+  late_n = cos_mem_unused(0, 0) - size0;
+}
+
+static void*
+late_producer(void *unused)
+{
+  int i;
+
+  COS_UNUSED(unused);
+
+  for (i = 0; i < N; i++)
+    blk[i] = malloc(i % 2 ? S : 100*L);
+  pthread_setspecific(late_key, blk);
+
+  return 0;
+}
+
+static void*
+consumer(void *unused)
+{
+  size_t sent0, sent;
+  int i;
+
+  COS_UNUSED(unused);
+
+  cos_mem_remote(0, &sent0);
+  for (i = 0; i < N; i++)
+    free(blk[i]);
+  cos_mem_remote(0, &sent);
+  sent_n = sent - sent0;
+
+  return 0;
+}
+
+void
+ut_memory(void)
+{
+  pthread_t thr;
+  FILE *fp;
+  size_t recv0, sent0, recv, sent, size;
+  int i, cnt0, cnt, err = 0;
+
+  UTEST_START("memory freed across threads")
+
+    // ---- allocated here, freed by another thread
+    cos_mem_remote(&recv0, &sent0);
+    for (i = 0; i < N; i++)
+      blk[i] = malloc(S);
+    err |= pthread_create(&thr, 0, consumer, 0);
+    err |= pthread_join(thr, 0);
+    UTEST( !err );
+    size = cos_mem_remote(&recv, &sent);
+#if COS_MEM_REMOTE && COS_HAS_TLS && !defined(_OPENMP)
+    UTEST( sent_n == N );
+    UTEST( size >= N*S );
+#endif
+
+    // ---- reclaimed on the next pool miss (large nodes are not carved)
+    cos_mem_collect(0, 0);
+    blk[0] = malloc(2*L);
+    free(blk[0]);
+    cos_mem_remote(&recv, 0);
+#if COS_MEM_REMOTE && COS_HAS_TLS && !defined(_OPENMP)
+    UTEST( recv >= recv0+N );
+    UTEST( cos_mem_remote(0, 0) == 0 );
+#endif
+
+    // ---- allocated by an exited thread, freed here (not sent)
+    err |= pthread_create(&thr, 0, producer, 0);
+    err |= pthread_join(thr, 0);
+    UTEST( !err );
+    cos_mem_remote(0, &sent0);
+    cos_mem_unused(&cnt0, &(size_t){ S });
+    for (i = 0; i < N; i++)
+      free(blk[i]);
+    cos_mem_remote(0, &sent);
+    cos_mem_unused(&cnt, &(size_t){ S });
+#if COS_MEM_REMOTE && COS_HAS_TLS && !defined(_OPENMP)
+    UTEST( sent - sent0 == 0 );
+#if COS_MEM_SLAB
+    UTEST( cnt - cnt0 == N ); // small nodes adopted by this pool
+#endif
+#endif
+
+    // ---- freed by its thread after the exit of its pool (not kept)
+    err |= pthread_key_create(&late_key, late_free);
+    err |= pthread_create(&thr, 0, late_producer, 0);
+    err |= pthread_join(thr, 0);
+    err |= pthread_key_delete(late_key);
+    UTEST( !err );
+#if COS_MEM_REMOTE && COS_HAS_TLS && !defined(_OPENMP)
+    UTEST( late_n == 0 );
+#endif
+
+#if COS_MEM_SLAB
+    // ---- small nodes carved from chunks in address order
+    cos_mem_collect(0, 0);
+    for (i = 0; i < N; i++)
+      blk[i] = malloc(L);
+    UTEST( cos_mem_size(blk[0]) >= L );
+    UTEST( (char*)blk[1] - (char*)blk[0] == (ptrdiff_t)(cos_mem_size(blk[0])+cos_mem_node_size_) );
+
+    // ---- empty chunks returned to the system
+    for (i = 0; i < N; i++)
+      free(blk[i]);
+    UTEST( cos_mem_unused(0, &(size_t){ L }) >= N*L );
+    UTEST( cos_mem_collect(0, &(size_t){ L }) >= N*L );
+    UTEST( cos_mem_unused(0, &(size_t){ L }) == 0 );
+
+    // ---- resized across the slab limit
+    blk[0] = malloc(L);
+    memset(blk[0], 1, L);
+    blk[0] = realloc(blk[0], 100*L);
+    UTEST( blk[0] && ((char*)blk[0])[L-1] == 1 );
+    blk[0] = realloc(blk[0], S);
+    UTEST( blk[0] && ((char*)blk[0])[S-1] == 1 );
+    free(blk[0]);
+#endif
+
+#if COS_MEM_STAT
+    // ---- sampled allocation sites
+    cos_mem_sampler(1, sampled);
+    for (i = 0; i < 10; i++)
+      free(malloc(S));
+    cos_mem_sampler(0, 0);
+    UTEST( samples == 10 && sample_site );
+#endif
+
+    // ---- statistics dump
+    fp = tmpfile();
+    UTEST( fp && (cos_mem_stats(fp), ftell(fp) > 0) );
+    if (fp) fclose(fp);
+
+  UTEST_END
+}
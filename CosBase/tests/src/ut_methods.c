@@ -103,6 +103,38 @@ ut_methods(void)
     UTEST(          gunderstandMessage1(PropMetaClass, (SEL)gretain)    == True );
     UTEST( ginstancesUnderstandMessage1(PropMetaClass, (SEL)grelease)   == True );
     UTEST( ginstancesUnderstandMessage1(PropMetaClass, (SEL)grelease)    == True );
+
+    // batched send (one lookup per run of receivers of the same classes)
+    {
+      OBJ rcv[] = { Object, Object, Class, Class, Object };
+      OBJ res[5];
+
+      UTEST( cos_method_send1((SEL)gclass, 5, rcv, 1, 0, res, 1) == 3 );
+      UTEST( res[0] == (OBJ)cos_object_class(Object) );
+      UTEST( res[2] == (OBJ)cos_object_class(Class)  );
+      UTEST( res[4] == (OBJ)cos_object_class(Object) );
+
+      UTEST( cos_method_send2((SEL)gisKindOf, 2, rcv, 1, rcv+2, 1, 0, res, 1) == 1 );
+      UTEST( res[0] == True && res[1] == True );
+    }
+
+    // call-site cache (refilled on class change and on a new generation)
+    {
+      COS_SITE_DCL(site,1);
+      U32 gen = cos_method_siteGeneration_, cgen = cos_method_generation_;
+
+      UTEST( COS_SITE_SEND(site,gclass,Object) == (OBJ)cos_object_class(Object) );
+      UTEST( site.gen == gen && site.id1 == cos_object_id(Object) );
+      UTEST( COS_SITE_SEND(site,gclass,Class ) == (OBJ)cos_object_class(Class)  );
+      UTEST( site.id1 == cos_object_id(Class) );
+
+      // only the sites generation changes, other threads caches are not synced
+      cos_method_clearCaches();
+      UTEST( cos_method_siteGeneration_ != gen );
+      UTEST( cos_method_generation_ == cgen );
+      UTEST( COS_SITE_SEND(site,gclass,Class ) == (OBJ)cos_object_class(Class)  );
+      UTEST( site.gen == cos_method_siteGeneration_ );
+    }
     
   UTEST_END
 }
@@ -0,0 +1,86 @@
+/**
+ * C Object System
+ * COS testsuites - method profile
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/gen/object.h>
+#include <cos/debug.h>
+#include <cos/utest.h>
+
+#include "tests.h"
+#include "generics.h"
+
+#include <stdio.h>
+#include <string.h>
+
+enum { N = 1000 };
+
+// profiled methods (see ABCDE.c)
+dclmethod(gprofile, A);
+dclmethod(gprofile, B);
+
+void
+ut_profile(void)
+{
+  useclass(A, B);
+  OBJ a = gnew(A);
+  OBJ b = gnew(B);
+  const struct Method *mthA = methodref(gprofile,A);
+  const struct Method *mthB = methodref(gprofile,B);
+  U64 cnt, cyc;
+  U32 i, n = 0;
+  char buf[4096];
+  FILE *fp;
+
+  UTEST_START("method profile")
+
+    // ---- not called yet
+    UTEST( !cos_method_getProfile(mthA, &cnt, &cyc) );
+    UTEST( cnt == 0 && cyc == 0 );
+
+    // ---- count calls, next_method included
+    for (i = 0; i < N; i++)
+      gprofile(a, &n), gprofile(b, &n);
+
+    UTEST( n == 3*N );
+    UTEST( cos_method_getProfile(mthA, &cnt, &cyc) );
+    UTEST( cnt == 2*N );
+    UTEST( cos_method_getProfile(mthB, &cnt, &cyc) );
+    UTEST( cnt == N );
+
+    // ---- export
+    fp = tmpfile();
+    if (fp) {
+      cos_symbol_exportProfile(fp);
+      rewind(fp);
+      buf[fread(buf, 1, sizeof buf - 1, fp)] = 0;
+      fclose(fp);
+      UTEST( !strncmp(buf, "generic\trank\tclasses", 20) );
+      UTEST( strstr(buf, "\ngprofile\t") != 0 );
+    }
+
+    // ---- clear
+    cos_method_clearProfile();
+    UTEST( !cos_method_getProfile(mthB, &cnt, &cyc) );
+    UTEST( cnt == 0 );
+
+    grelease(a);
+    grelease(b);
+
+  UTEST_END
+}
@@ -0,0 +1,95 @@
+/**
+ * C Object System
+ * COS testsuites - reference counting across threads
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/gen/object.h>
+#include <cos/utest.h>
+
+#include <pthread.h>
+
+#include "tests.h"
+
+enum { T = 4, N = 100000 };
+
+static void*
+retain_release(void *obj)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    gretain(obj);
+
+  for (i = 0; i < N; i++)
+    grelease(obj);
+
+  return 0;
+}
+
+static void*
+release(void *obj)
+{
+  grelease(obj);
+  return 0;
+}
+
+void
+ut_refcount(void)
+{
+  useclass(A);
+  pthread_t thr[T];
+  OBJ a;
+  int i, err;
+
+  UTEST_START("reference counting across threads")
+
+    // ---- retain/release from many threads
+    a = cos_object_share(gnew(A));
+    for (err = 0, i = 0; i < T; i++) {
+      err |= pthread_create(thr+i, 0, retain_release, a);
+#if COS_OBJECT_RC == COS_OBJECT_RC_PLAIN // threads must not overlap
+      err |= pthread_join(thr[i], 0);
+#endif
+    }
+#if COS_OBJECT_RC != COS_OBJECT_RC_PLAIN
+    for (i = 0; i < T; i++)
+      err |= pthread_join(thr[i], 0);
+#endif
+    UTEST( !err );
+    UTEST( gretainCount(a) == 1 );
+    UTEST( (grelease(a), 1) );
+
+    // ---- last reference released by another thread
+    a = cos_object_share(gretain(gnew(A)));
+    UTEST( gretainCount(a) == 2 );
+    grelease(a);
+    UTEST( gretainCount(a) == 1 );
+    UTEST( !pthread_create(thr, 0, release, a) && !pthread_join(thr[0], 0) );
+
+    // ---- owner fast path
+    a = gnew(A);
+    for (i = 0; i < N; i++)
+      gretain(a);
+    UTEST( gretainCount(a) == N+1 );
+    for (i = 0; i < N; i++)
+      grelease(a);
+    UTEST( gretainCount(a) == 1 );
+    UTEST( (grelease(a), 1) );
+
+  UTEST_END
+}
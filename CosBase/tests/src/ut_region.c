@@ -0,0 +1,96 @@
+/**
+ * C Object System
+ * COS testsuites - region allocation
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/gen/object.h>
+#include <cos/gen/value.h>
+#include <cos/utest.h>
+
+#include "tests.h"
+
+#include <string.h>
+
+enum { N = 10000 };
+
+void
+ut_region(void)
+{
+  useclass(A, AutoRelease, Region);
+  OBJ a, b, r, r2, ar;
+  void *p, *q;
+  int i;
+
+  UTEST_START("region allocation")
+
+    // ---- scope
+    UTEST( !cos_region() );
+    r = gnew(Region);
+    UTEST( cos_region() == (struct Region*)r );
+#if COS_MEM_AS_DEFAULT
+    a = gnew(A);
+    UTEST( cos_mem_size(a) >= gsize(A) );
+    UTEST( gretainCount(a) == 1 );
+    UTEST( (grelease(a), 1) ); // gdealloc does nothing
+#endif
+
+    // ---- autoreleased objects (released with the region)
+    for (i = 0; i < N; i++)
+      gautoRelease(gnew(A));
+    UTEST( gsize(r) == N );
+
+    // ---- temporaries never released and large objects
+    for (i = 0; i < N; i++)
+      gnew(A);
+    a = ginit(gallocWithSize(A, 100000));
+#if COS_MEM_AS_DEFAULT
+    UTEST( cos_mem_size(a) >= 100000 );
+#endif
+
+    // ---- region nodes are resized out of the region
+#if COS_MEM_AS_DEFAULT
+    p = cos_region_alloc(cos_region(), 64);
+    memset(p, 7, 64);
+    q = cos_mem_realloc(p, 100000);
+    UTEST( q && q != p && cos_mem_size(q) >= 100000 && ((char*)q)[63] == 7 );
+    q = cos_mem_realloc(q, 32);
+    UTEST( q && cos_mem_size(q) >= 32 && ((char*)q)[31] == 7 );
+    cos_mem_free(q);
+#endif
+
+    // ---- object allocated before the region
+    grelease(r);
+    UTEST( !cos_region() );
+    b = gnew(A);
+    r = gnew(Region);
+    UTEST( (grelease(b), 1) );
+
+    // ---- nested pools and regions
+    ar = gnew(AutoRelease);
+    gautoRelease(gnew(A));
+    UTEST( cos_region() == (struct Region*)r );
+    r2 = gnew(Region);
+    UTEST( cos_region() == (struct Region*)r2 );
+    gautoRelease(gnew(A));
+    UTEST( (grelease(ar), 1) ); // releases r2 above
+    UTEST( cos_region() == (struct Region*)r );
+    UTEST( (grelease(r), 1) );
+    UTEST( !cos_region() );
+
+  UTEST_END
+}
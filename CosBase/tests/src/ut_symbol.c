@@ -0,0 +1,170 @@
+/**
+ * C Object System
+ * COS testsuites - symbols loading
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/debug.h>
+#include <cos/gen/object.h>
+#include <cos/utest.h>
+
+#include "tests.h"
+#include "generics.h"
+
+#include <string.h>
+
+defclass(SymA,Object) endclass
+defclass(SymB,SymA  ) endclass
+defclass(SymC,SymB  ) endclass
+
+makclass(SymA,Object);
+makclass(SymB,SymA  );
+makclass(SymC,SymB  );
+
+defmethod(OBJ, ginit, SymA)
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gdeinit, SymA)
+  retmethod(_1);
+endmethod
+
+// ----- methods registered at startup
+
+defmethod(STR, gwhich, Object)
+  retmethod("Object");
+endmethod
+
+defmethod(STR, gwhich, SymB)
+  next_method(self);
+endmethod
+
+defmethod(STR, gwhich2, Object, Object)
+  retmethod("Object");
+endmethod
+
+defmethod(STR, gwhich2, SymB, SymB)
+  next_method(self1, self2);
+endmethod
+
+// ----- methods registered late (as by a loaded module)
+
+/* NOTE-INFO: late methods
+   Weak symbols are not collected by cossym (data symbols only), so these
+   methods are not registered at startup and ut_symbol registers them like
+   cos_module_load registers the symbols of a module.
+*/
+extern struct Method1 cos_m_gwhich__SymA        __attribute__((weak));
+extern struct Method2 cos_m_gwhich2__SymA__SymA __attribute__((weak));
+
+defmethod(STR, gwhich, SymA)
+  retmethod("SymA");
+endmethod
+
+defmethod(STR, gwhich2, SymA, SymA)
+  retmethod("SymA");
+endmethod
+
+static struct Any *late_sym[] = {
+  (struct Any*)&cos_m_gwhich__SymA,
+  (struct Any*)&cos_m_gwhich2__SymA__SymA,
+  0
+};
+
+#if COS_METHOD_SHARED
+static U32
+shared_cells(void)
+{
+  FILE *fp = tmpfile();
+  U32 slots, cells = -1;
+
+  if (fp) {
+    cos_method_statShared1(fp);
+    rewind(fp);
+    if (fscanf(fp, "shared1: slots=%u, cells=%u", &slots, &cells) != 2)
+      cells = -1;
+    fclose(fp);
+  }
+
+  return cells;
+}
+#endif
+
+void
+ut_symbol(void)
+{
+  useclass(SymA,SymB,SymC);
+
+  OBJ a = gnew(SymA), b = gnew(SymB), c = gnew(SymC);
+  U32 gen = cos_method_generation_, cnt1, cnt2;
+  BOOL ok = YES;
+  int i;
+
+  UTEST_START("symbols loading")
+
+    // warm up dispatch caches and next_method slots
+    UTEST( !strcmp(gwhich(a), "Object") );
+    UTEST( !strcmp(gwhich(b), "Object") );
+    UTEST( !strcmp(gwhich(c), "Object") );
+    UTEST( !strcmp(gwhich2(a,a), "Object") );
+    UTEST( !strcmp(gwhich2(b,b), "Object") );
+    UTEST( !strcmp(gwhich2(c,b), "Object") );
+    cnt1 = cos_method_cache1()->cnt;
+    cnt2 = cos_method_cache2()->cnt;
+
+    // register methods on initialized classes
+    cos_symbol_register(late_sym, "ut_symbol");
+    cos_symbol_load();
+    UTEST( cos_method_generation_ == gen+1 );
+    UTEST( cos_method_stamp(cos_generic_id(genericref(gwhich ))) == gen+1 );
+    UTEST( cos_method_stamp(cos_generic_id(genericref(gwhich2))) == gen+1 );
+    UTEST( cos_method_stamp(cos_generic_id(genericref(gincr  ))) <= gen   );
+
+    // the caches dropped the cells of the stamped generics (a,b,c), the
+    // load itself may have added a few others (class initialization)
+    UTEST( cos_method_cache1()->cnt < cnt1 );
+    UTEST( cos_method_cache2()->cnt < cnt2 );
+
+    // dispatch and next_method see the new methods
+    UTEST( !strcmp(gwhich(a), "SymA") );
+    UTEST( !strcmp(gwhich(b), "SymA") );
+    UTEST( !strcmp(gwhich(c), "SymA") );
+    UTEST( !strcmp(gwhich2(a,a), "SymA") );
+    UTEST( !strcmp(gwhich2(b,b), "SymA") );
+    UTEST( !strcmp(gwhich2(c,b), "SymA") );
+    UTEST( !strcmp(gwhich2(a,(OBJ)SymA), "Object") );
+
+    // repeated invalidate-and-publish cycles (dead shared cells are reclaimed)
+    cos_method_clearShared();
+    for (i = 0; i < 200; i++) {
+      cos_method_clearCache1();
+      cos_method_clearCache2();
+      ok = ok && !strcmp(gwhich(b), "SymA") && !strcmp(gwhich(c), "SymA");
+      ok = ok && !strcmp(gwhich2(b,b), "SymA") && !strcmp(gwhich2(c,b), "SymA");
+      cos_method_syncShared(gen);
+    }
+    UTEST( ok );
+#if COS_METHOD_SHARED
+    UTEST( shared_cells() < 32 );
+#endif
+
+  UTEST_END
+
+  grelease(a);
+  grelease(b);
+  grelease(c);
+}
@@ -0,0 +1,251 @@
+/*
+ * -----------------------------
+ * COS generics
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosgen
+ * Sun Oct 18 12:17:40 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Object.h>
+
+#include "cos/gen/algorithm.h"
+#include "cos/gen/array.h"
+#include "cos/gen/collection.h"
+#include "cos/gen/delegate.h"
+#include "cos/gen/file.h"
+#include "cos/gen/floatop.h"
+#include "cos/gen/functor.h"
+#include "cos/gen/iterator.h"
+#include "cos/gen/logicop.h"
+#include "cos/gen/numop.h"
+#include "cos/gen/range.h"
+#include "cos/gen/relop.h"
+#include "cos/gen/sequence.h"
+#include "cos/gen/stream.h"
+#include "cos/gen/string.h"
+#include "cos/gen/vectop.h"
+
+
+makgeneric(OBJ, (G_abs)gabs, _1);
+makgeneric(OBJ, (G_absolute)gabsolute, _1);
+makgeneric(OBJ, (G_acos)gacos, _1);
+makgeneric(OBJ, (G_acosh)gacosh, _1);
+makgeneric(OBJ, (G_acosine)gacosine, _1);
+makgeneric(OBJ, (G_acosineh)gacosineh, _1);
+makgeneric(OBJ, (G_add)gadd, _1, _2);
+makgeneric(OBJ, (G_addTo)gaddTo, _1, _2);
+makgeneric(OBJ, (G_and)gand, _1, _2);
+makgeneric(OBJ, (G_arg)garg, _1);
+makgeneric(OBJ, (G_argument)gargument, _1);
+makgeneric(OBJ, (G_asin)gasin, _1);
+makgeneric(OBJ, (G_asine)gasine, _1);
+makgeneric(OBJ, (G_asineh)gasineh, _1);
+makgeneric(OBJ, (G_asinh)gasinh, _1);
+makgeneric(OBJ, (G_atan)gatan, _1);
+makgeneric(OBJ, (G_atangent)gatangent, _1);
+makgeneric(OBJ, (G_atangenth)gatangenth, _1);
+makgeneric(OBJ, (G_atanh)gatanh, _1);
+makgeneric(OBJ, (G_compare)gcompare, _1, _2);
+makgeneric(OBJ, (G_conj)gconj, _1);
+makgeneric(OBJ, (G_conjugate)gconjugate, _1);
+makgeneric(OBJ, (G_cos)gcos, _1);
+makgeneric(OBJ, (G_cosh)gcosh, _1);
+makgeneric(OBJ, (G_cosine)gcosine, _1);
+makgeneric(OBJ, (G_cosineh)gcosineh, _1);
+makgeneric(OBJ, (G_div)gdiv, _1, _2);
+makgeneric(OBJ, (G_divBy)gdivBy, _1, _2);
+makgeneric(OBJ, (G_exp)gexp, _1);
+makgeneric(OBJ, (G_exponential)gexponential, _1);
+makgeneric(U64, (G_hash)ghash, _1);
+makgeneric(OBJ, (G_hypot)ghypot, _1, _2);
+makgeneric(OBJ, (G_implies)gimplies, _1, _2);
+makgeneric(OBJ, (G_inv)ginv, _1);
+makgeneric(OBJ, (G_invert)ginvert, _1);
+makgeneric(OBJ, (G_isEqual)gisEqual, _1, _2);
+makgeneric(OBJ, (G_isGreater)gisGreater, _1, _2);
+makgeneric(OBJ, (G_isGreaterOrEqual)gisGreaterOrEqual, _1, _2);
+makgeneric(OBJ, (G_isLesser)gisLesser, _1, _2);
+makgeneric(OBJ, (G_isLesserOrEqual)gisLesserOrEqual, _1, _2);
+makgeneric(OBJ, (G_isNotEqual)gisNotEqual, _1, _2);
+makgeneric(OBJ, (G_log)glog, _1);
+makgeneric(OBJ, (G_logarithm)glogarithm, _1);
+makgeneric(OBJ, (G_max)gmax, _1, _2 or fun);
+makgeneric(OBJ, (G_min)gmin, _1, _2 or fun);
+makgeneric(OBJ, (G_mod)gmod, _1, _2);
+makgeneric(OBJ, (G_modulo)gmodulo, _1, _2);
+makgeneric(OBJ, (G_mul)gmul, _1, _2);
+makgeneric(OBJ, (G_mulAdd)gmulAdd, _1, _2, _3);
+makgeneric(OBJ, (G_mulBy)gmulBy, _1, _2);
+makgeneric(OBJ, (G_neg)gneg, _1);
+makgeneric(OBJ, (G_negate)gnegate, _1);
+makgeneric(OBJ, (G_not)gnot, _1);
+makgeneric(OBJ, (G_or)gor, _1, _2);
+makgeneric(OBJ, (G_pow)gpow, _1, _2);
+makgeneric(OBJ, (G_power)gpower, _1, _2);
+makgeneric(OBJ, (G_prod)gprod, _1);
+makgeneric(OBJ, (G_sin)gsin, _1);
+makgeneric(OBJ, (G_sine)gsine, _1);
+makgeneric(OBJ, (G_sineh)gsineh, _1);
+makgeneric(OBJ, (G_sinh)gsinh, _1);
+makgeneric(OBJ, (G_sqr)gsqr, _1);
+makgeneric(OBJ, (G_sqrErr)gsqrErr, _1, _2);
+makgeneric(OBJ, (G_sqroot)gsqroot, _1);
+makgeneric(OBJ, (G_sqrt)gsqrt, _1);
+makgeneric(OBJ, (G_square)gsquare, _1);
+makgeneric(OBJ, (G_sub)gsub, _1, _2);
+makgeneric(OBJ, (G_subTo)gsubTo, _1, _2);
+makgeneric(OBJ, (G_sum)gsum, _1);
+makgeneric(OBJ, (G_tan)gtan, _1);
+makgeneric(OBJ, (G_tangent)gtangent, _1);
+makgeneric(OBJ, (G_tangenth)gtangenth, _1);
+makgeneric(OBJ, (G_tanh)gtanh, _1);
+makgeneric(OBJ, (G_xor)gxor, _1, _2);
+makgeneric(OBJ, gaccumulate, _1, fun);
+makgeneric(OBJ, gaccumulate1, _1, fun, ini);
+makgeneric(OBJ, gaccumulate2, _1, fun, ini, fin);
+makgeneric(OBJ, gadjust, _1);
+makgeneric(OBJ, gall, _1, fun);
+makgeneric(OBJ, gallNext, _1);
+makgeneric(OBJ, gany, _1, fun);
+makgeneric(OBJ, gappend, _1, what);
+makgeneric(OBJ, gapply, fun, _1);
+makgeneric(OBJ, gapply2, fun, _1, _2);
+makgeneric(OBJ, gapply3, fun, _1, _2, _3);
+makgeneric(OBJ, gapply4, fun, _1, _2, _3, _4);
+makgeneric(OBJ, gapplyIf, fun, _1);
+makgeneric(OBJ, gapplyWhile, fun, _1);
+makgeneric(OBJ, gaxpy, _1, _2, _3);
+makgeneric(U32, gcapacity, _1);
+makgeneric(OBJ, gcompose, _1, _2);
+makgeneric(OBJ, gcomposen, _1);
+makgeneric(OBJ, gconcat, _1, _2);
+makgeneric(OBJ, gconcat3, _1, _2, _3);
+makgeneric(OBJ, gconcat4, _1, _2, _3, _4);
+makgeneric(OBJ, gconcatn, _1);
+makgeneric(U32, gcount, _1, fun);
+makgeneric(OBJ, gdelegate, _1);
+makgeneric(OBJ, gdiff, _1, _2, fun);
+makgeneric(OBJ, gdot, _1, _2);
+makgeneric(OBJ, gdrop, _1, idx);
+makgeneric(OBJ, genlarge, _1, by);
+makgeneric(OBJ, gevalFun, fun);
+makgeneric(OBJ, gfind, _1, fun);
+makgeneric(OBJ, gfirst, _1);
+makgeneric(OBJ, gflush, _1);
+makgeneric(void, gforeach, _1, fun);
+makgeneric(void, gforeach2, _1, _2, fun);
+makgeneric(void, gforeach3, _1, _2, _3, fun);
+makgeneric(void, gforeach4, _1, _2, _3, _4, fun);
+makgeneric(void, gforeachWhile, _1, fun);
+makgeneric(OBJ, ggenerate, fun, ini);
+makgeneric(OBJ, gget, _1, _2);
+makgeneric(I32, ggetChr, _1);
+makgeneric(OBJ, ggetContent, _1);
+makgeneric(size_t, ggetData, _1, (U8*)buf, (size_t)len);
+makgeneric(size_t, ggetDelim, _1, (U8*)buf, (size_t)len, (I32)delim);
+makgeneric(size_t, ggetDelims, _1, (U8*)buf, (size_t)len, (STR)delims);
+makgeneric(FILE*, ggetFILE, _1);
+makgeneric(size_t, ggetLine, _1, (U8*)buf, (size_t)len);
+makgeneric(OBJ, ggetLines, _1);
+makgeneric(size_t, ggetWhile, _1, (U8*)buf, (size_t)len, fun);
+makgeneric(OBJ, ggroup, _1, fun);
+makgeneric(OBJ, giamax, _1);
+makgeneric(OBJ, gifind, _1, fun);
+makgeneric(U32, gindexOf, _1, fun);
+makgeneric(OBJ, ginitWithFILE, _1, (FILE*)fp, name);
+makgeneric(OBJ, ginitWithFun0, Functor, (FUN0)fct);
+makgeneric(OBJ, ginitWithFun1, Functor, (FUN1)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun2, Functor, (FUN2)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun3, Functor, (FUN3)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun4, Functor, (FUN4)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun5, Functor, (FUN5)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun6, Functor, (FUN6)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun7, Functor, (FUN7)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun8, Functor, (FUN8)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithFun9, Functor, (FUN9)fct, (OBJ*)arg);
+makgeneric(OBJ, ginitWithMth, Functor, (SEL)sel, (OBJ*)rcv, (void*)arg);
+makgeneric(OBJ, ginsertAt, _1, at, what);
+makgeneric(OBJ, gintersect, _1, _2, fun);
+makgeneric(OBJ, gintersperse, _1, fun);
+makgeneric(OBJ, gisAlnum, _1);
+makgeneric(OBJ, gisAlpha, _1);
+makgeneric(OBJ, gisBlank, _1);
+makgeneric(OBJ, gisCntrl, _1);
+makgeneric(OBJ, gisDigit, _1);
+makgeneric(OBJ, gisEmpty, _1);
+makgeneric(OBJ, gisGraph, _1);
+makgeneric(OBJ, gisLower, _1);
+makgeneric(OBJ, gisPrint, _1);
+makgeneric(OBJ, gisPunct, _1);
+makgeneric(OBJ, gisSorted, _1, fun);
+makgeneric(OBJ, gisSpace, _1);
+makgeneric(OBJ, gisUpper, _1);
+makgeneric(OBJ, gisXDigit, _1);
+makgeneric(OBJ, gisort, _1, fun);
+makgeneric(OBJ, giterate, fun, num);
+makgeneric(OBJ, giterator, _1);
+makgeneric(OBJ, glast, _1);
+makgeneric(OBJ, gmap, fun, _1);
+makgeneric(OBJ, gmap2, fun, _1, _2);
+makgeneric(OBJ, gmap3, fun, _1, _2, _3);
+makgeneric(OBJ, gmap4, fun, _1, _2, _3, _4);
+makgeneric(OBJ, gmapIf, fun, _1);
+makgeneric(OBJ, gmapWhile, fun, _1);
+makgeneric(OBJ, gmerge, _1, _2, fun);
+makgeneric(OBJ, gminmax, _1);
+makgeneric(OBJ, gnewRng, _1, (I32)start, (I32)end, (I32)stride);
+makgeneric(OBJ, gnewSlc, _1, (I32)start, (U32)size, (I32)stride);
+makgeneric(OBJ, gnewXRng, _1, (F64)start, (F64)end, (F64)stride);
+makgeneric(OBJ, gnext, _1);
+makgeneric(OBJ, gnorm2, _1);
+makgeneric(OBJ, gpermute, _1, idx);
+makgeneric(OBJ, gpop, _1);
+makgeneric(OBJ, gpopBack, _1);
+makgeneric(OBJ, gpopFront, _1);
+makgeneric(OBJ, gprepend, _1, what);
+makgeneric(OBJ, gpush, _1, what);
+makgeneric(OBJ, gpushBack, _1, what);
+makgeneric(OBJ, gpushFront, _1, what);
+makgeneric(OBJ, gput, _1, _2);
+makgeneric(I32, gputChr, _1, (I32)chr);
+makgeneric(size_t, gputData, _1, (U8*)buf, (size_t)len);
+makgeneric(OBJ, gputLn, _1, _2);
+makgeneric(size_t, gputStr, _1, (STR)str);
+makgeneric(size_t, gputStrLn, _1, (STR)str);
+makgeneric(size_t, gputnChr, _1, (I32)chr, (size_t)len);
+makgeneric(OBJ, greduce, _1, fun);
+makgeneric(OBJ, greduce1, _1, fun, ini);
+makgeneric(OBJ, greduce2, _1, fun, ini, fin);
+makgeneric(OBJ, greject, _1, fun);
+makgeneric(OBJ, grejectWhile, _1, fun);
+makgeneric(OBJ, gremoveAt, _1, at);
+makgeneric(OBJ, grepeat, obj, num);
+makgeneric(OBJ, grevIterator, _1);
+makgeneric(OBJ, greverse, _1);
+makgeneric(OBJ, gscal, _1, _2);
+makgeneric(int, gseek, _1, (long)pos, (int)from);
+makgeneric(OBJ, gselect, _1, fun);
+makgeneric(OBJ, gselectWhile, _1, fun);
+makgeneric(OBJ, gsetDelegate, _1, del);
+makgeneric(size_t, gskipDelim, _1, (I32)delim);
+makgeneric(size_t, gskipDelims, _1, (STR)delims);
+makgeneric(size_t, gskipLine, _1);
+makgeneric(size_t, gskipWhile, _1, fun);
+makgeneric(size_t, gskipnChr, _1, (size_t)len);
+makgeneric(OBJ, gsort, _1, fun);
+makgeneric(OBJ, gsplit, _1, fun);
+makgeneric(OBJ, gstrip, _1);
+makgeneric(long, gtell, _1);
+makgeneric(OBJ, gtoLower, _1);
+makgeneric(OBJ, gtoUpper, _1);
+makgeneric(OBJ, gtop, _1);
+makgeneric(OBJ, gtopBack, _1);
+makgeneric(OBJ, gtopFront, _1);
+makgeneric(I32, gungetChr, _1, (I32)chr);
+makgeneric(OBJ, gunique, _1, fun);
+makgeneric(OBJ, gzip, _1, _2);
+makgeneric(OBJ, gzip3, _1, _2, _3);
+makgeneric(OBJ, gzip4, _1, _2, _3, _4);
+makgeneric(OBJ, gzipn, _1);
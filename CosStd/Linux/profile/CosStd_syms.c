@@ -0,0 +1,6404 @@
+/*
+ * -----------------------------
+ * COS symbols
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cossym
+ * Sun Oct 18 12:19:28 UTC 2026
+ * -----------------------------
+ */
+
+extern struct Any cos_c_Array;
+extern struct Any cos_c_Array0;
+extern struct Any cos_c_Array1;
+extern struct Any cos_c_Array2;
+extern struct Any cos_c_Array3;
+extern struct Any cos_c_Array4;
+extern struct Any cos_c_Array5;
+extern struct Any cos_c_Array6;
+extern struct Any cos_c_Array7;
+extern struct Any cos_c_Array8;
+extern struct Any cos_c_Array9;
+extern struct Any cos_c_ArrayBlk;
+extern struct Any cos_c_ArrayDyn;
+extern struct Any cos_c_ArrayFix;
+extern struct Any cos_c_ArrayN;
+extern struct Any cos_c_ArraySubView;
+extern struct Any cos_c_ArrayView;
+extern struct Any cos_c_Char;
+extern struct Any cos_c_ChrVector;
+extern struct Any cos_c_ChrVector0;
+extern struct Any cos_c_ChrVector1;
+extern struct Any cos_c_ChrVector2;
+extern struct Any cos_c_ChrVector3;
+extern struct Any cos_c_ChrVector4;
+extern struct Any cos_c_ChrVector5;
+extern struct Any cos_c_ChrVector6;
+extern struct Any cos_c_ChrVector7;
+extern struct Any cos_c_ChrVector8;
+extern struct Any cos_c_ChrVector9;
+extern struct Any cos_c_ChrVectorDyn;
+extern struct Any cos_c_ChrVectorFix;
+extern struct Any cos_c_ChrVectorN;
+extern struct Any cos_c_ChrVectorSubView;
+extern struct Any cos_c_ChrVectorView;
+extern struct Any cos_c_Collection;
+extern struct Any cos_c_Complex;
+extern struct Any cos_c_ComposeFun;
+extern struct Any cos_c_CpxFunction;
+extern struct Any cos_c_CpxFunction1;
+extern struct Any cos_c_CpxFunction2;
+extern struct Any cos_c_CpxFunction3;
+extern struct Any cos_c_CpxFunction4;
+extern struct Any cos_c_CpxFunction5;
+extern struct Any cos_c_CpxFunction6;
+extern struct Any cos_c_CpxFunction7;
+extern struct Any cos_c_CpxFunction8;
+extern struct Any cos_c_CpxFunction9;
+extern struct Any cos_c_CpxVector;
+extern struct Any cos_c_CpxVector0;
+extern struct Any cos_c_CpxVector1;
+extern struct Any cos_c_CpxVector2;
+extern struct Any cos_c_CpxVector3;
+extern struct Any cos_c_CpxVector4;
+extern struct Any cos_c_CpxVector5;
+extern struct Any cos_c_CpxVector6;
+extern struct Any cos_c_CpxVector7;
+extern struct Any cos_c_CpxVector8;
+extern struct Any cos_c_CpxVector9;
+extern struct Any cos_c_CpxVectorDyn;
+extern struct Any cos_c_CpxVectorFix;
+extern struct Any cos_c_CpxVectorN;
+extern struct Any cos_c_CpxVectorSubView;
+extern struct Any cos_c_CpxVectorView;
+extern struct Any cos_c_Equal;
+extern struct Any cos_c_ExBadStream;
+extern struct Any cos_c_Expression;
+extern struct Any cos_c_Float;
+extern struct Any cos_c_Floating;
+extern struct Any cos_c_FloatingVector;
+extern struct Any cos_c_FltFunction;
+extern struct Any cos_c_FltFunction1;
+extern struct Any cos_c_FltFunction2;
+extern struct Any cos_c_FltFunction3;
+extern struct Any cos_c_FltFunction4;
+extern struct Any cos_c_FltFunction5;
+extern struct Any cos_c_FltFunction6;
+extern struct Any cos_c_FltFunction7;
+extern struct Any cos_c_FltFunction8;
+extern struct Any cos_c_FltFunction9;
+extern struct Any cos_c_FltVector;
+extern struct Any cos_c_FltVector0;
+extern struct Any cos_c_FltVector1;
+extern struct Any cos_c_FltVector2;
+extern struct Any cos_c_FltVector3;
+extern struct Any cos_c_FltVector4;
+extern struct Any cos_c_FltVector5;
+extern struct Any cos_c_FltVector6;
+extern struct Any cos_c_FltVector7;
+extern struct Any cos_c_FltVector8;
+extern struct Any cos_c_FltVector9;
+extern struct Any cos_c_FltVectorDyn;
+extern struct Any cos_c_FltVectorFix;
+extern struct Any cos_c_FltVectorN;
+extern struct Any cos_c_FltVectorSubView;
+extern struct Any cos_c_FltVectorView;
+extern struct Any cos_c_FunArg;
+extern struct Any cos_c_FunExpr;
+extern struct Any cos_c_FunExpr0;
+extern struct Any cos_c_FunExpr1;
+extern struct Any cos_c_FunExpr11;
+extern struct Any cos_c_FunExpr12;
+extern struct Any cos_c_FunExpr2;
+extern struct Any cos_c_FunExpr21;
+extern struct Any cos_c_FunExpr22;
+extern struct Any cos_c_FunExpr23;
+extern struct Any cos_c_FunExpr24;
+extern struct Any cos_c_FunExpr3;
+extern struct Any cos_c_FunExpr31;
+extern struct Any cos_c_FunExpr32;
+extern struct Any cos_c_FunExpr33;
+extern struct Any cos_c_FunExpr34;
+extern struct Any cos_c_FunExpr35;
+extern struct Any cos_c_FunExpr36;
+extern struct Any cos_c_FunExpr37;
+extern struct Any cos_c_FunExpr38;
+extern struct Any cos_c_FunExpr4;
+extern struct Any cos_c_FunExpr5;
+extern struct Any cos_c_FunExpr6;
+extern struct Any cos_c_FunExpr7;
+extern struct Any cos_c_FunExpr8;
+extern struct Any cos_c_FunExpr9;
+extern struct Any cos_c_Functor;
+extern struct Any cos_c_G_BinaryOp;
+extern struct Any cos_c_G_Operator;
+extern struct Any cos_c_G_TernaryOp;
+extern struct Any cos_c_G_UnaryOp;
+extern struct Any cos_c_G_abs;
+extern struct Any cos_c_G_absolute;
+extern struct Any cos_c_G_acos;
+extern struct Any cos_c_G_acosh;
+extern struct Any cos_c_G_acosine;
+extern struct Any cos_c_G_acosineh;
+extern struct Any cos_c_G_add;
+extern struct Any cos_c_G_addTo;
+extern struct Any cos_c_G_and;
+extern struct Any cos_c_G_arg;
+extern struct Any cos_c_G_argument;
+extern struct Any cos_c_G_asin;
+extern struct Any cos_c_G_asine;
+extern struct Any cos_c_G_asineh;
+extern struct Any cos_c_G_asinh;
+extern struct Any cos_c_G_atan;
+extern struct Any cos_c_G_atangent;
+extern struct Any cos_c_G_atangenth;
+extern struct Any cos_c_G_atanh;
+extern struct Any cos_c_G_compare;
+extern struct Any cos_c_G_conj;
+extern struct Any cos_c_G_conjugate;
+extern struct Any cos_c_G_cos;
+extern struct Any cos_c_G_cosh;
+extern struct Any cos_c_G_cosine;
+extern struct Any cos_c_G_cosineh;
+extern struct Any cos_c_G_div;
+extern struct Any cos_c_G_divBy;
+extern struct Any cos_c_G_exp;
+extern struct Any cos_c_G_exponential;
+extern struct Any cos_c_G_hash;
+extern struct Any cos_c_G_hypot;
+extern struct Any cos_c_G_implies;
+extern struct Any cos_c_G_inv;
+extern struct Any cos_c_G_invert;
+extern struct Any cos_c_G_isEqual;
+extern struct Any cos_c_G_isGreater;
+extern struct Any cos_c_G_isGreaterOrEqual;
+extern struct Any cos_c_G_isLesser;
+extern struct Any cos_c_G_isLesserOrEqual;
+extern struct Any cos_c_G_isNotEqual;
+extern struct Any cos_c_G_log;
+extern struct Any cos_c_G_logarithm;
+extern struct Any cos_c_G_max;
+extern struct Any cos_c_G_min;
+extern struct Any cos_c_G_mod;
+extern struct Any cos_c_G_modulo;
+extern struct Any cos_c_G_mul;
+extern struct Any cos_c_G_mulAdd;
+extern struct Any cos_c_G_mulBy;
+extern struct Any cos_c_G_neg;
+extern struct Any cos_c_G_negate;
+extern struct Any cos_c_G_not;
+extern struct Any cos_c_G_or;
+extern struct Any cos_c_G_pow;
+extern struct Any cos_c_G_power;
+extern struct Any cos_c_G_prod;
+extern struct Any cos_c_G_sin;
+extern struct Any cos_c_G_sine;
+extern struct Any cos_c_G_sineh;
+extern struct Any cos_c_G_sinh;
+extern struct Any cos_c_G_sqr;
+extern struct Any cos_c_G_sqrErr;
+extern struct Any cos_c_G_sqroot;
+extern struct Any cos_c_G_sqrt;
+extern struct Any cos_c_G_square;
+extern struct Any cos_c_G_sub;
+extern struct Any cos_c_G_subTo;
+extern struct Any cos_c_G_sum;
+extern struct Any cos_c_G_tan;
+extern struct Any cos_c_G_tangent;
+extern struct Any cos_c_G_tangenth;
+extern struct Any cos_c_G_tanh;
+extern struct Any cos_c_G_xor;
+extern struct Any cos_c_Greater;
+extern struct Any cos_c_InputFile;
+extern struct Any cos_c_InputOutputFile;
+extern struct Any cos_c_InputStream;
+extern struct Any cos_c_Int;
+extern struct Any cos_c_IntFunction;
+extern struct Any cos_c_IntFunction1;
+extern struct Any cos_c_IntFunction2;
+extern struct Any cos_c_IntFunction3;
+extern struct Any cos_c_IntFunction4;
+extern struct Any cos_c_IntFunction5;
+extern struct Any cos_c_IntFunction6;
+extern struct Any cos_c_IntFunction7;
+extern struct Any cos_c_IntFunction8;
+extern struct Any cos_c_IntFunction9;
+extern struct Any cos_c_IntVector;
+extern struct Any cos_c_IntVector0;
+extern struct Any cos_c_IntVector1;
+extern struct Any cos_c_IntVector2;
+extern struct Any cos_c_IntVector3;
+extern struct Any cos_c_IntVector4;
+extern struct Any cos_c_IntVector5;
+extern struct Any cos_c_IntVector6;
+extern struct Any cos_c_IntVector7;
+extern struct Any cos_c_IntVector8;
+extern struct Any cos_c_IntVector9;
+extern struct Any cos_c_IntVectorDyn;
+extern struct Any cos_c_IntVectorFix;
+extern struct Any cos_c_IntVectorN;
+extern struct Any cos_c_IntVectorSubView;
+extern struct Any cos_c_IntVectorView;
+extern struct Any cos_c_Integral;
+extern struct Any cos_c_IntegralVector;
+extern struct Any cos_c_IterateFun;
+extern struct Any cos_c_Iterator;
+extern struct Any cos_c_Lesser;
+extern struct Any cos_c_LngFunction;
+extern struct Any cos_c_LngFunction1;
+extern struct Any cos_c_LngFunction2;
+extern struct Any cos_c_LngFunction3;
+extern struct Any cos_c_LngFunction4;
+extern struct Any cos_c_LngFunction5;
+extern struct Any cos_c_LngFunction6;
+extern struct Any cos_c_LngFunction7;
+extern struct Any cos_c_LngFunction8;
+extern struct Any cos_c_LngFunction9;
+extern struct Any cos_c_LngVector;
+extern struct Any cos_c_LngVector0;
+extern struct Any cos_c_LngVector1;
+extern struct Any cos_c_LngVector2;
+extern struct Any cos_c_LngVector3;
+extern struct Any cos_c_LngVector4;
+extern struct Any cos_c_LngVector5;
+extern struct Any cos_c_LngVector6;
+extern struct Any cos_c_LngVector7;
+extern struct Any cos_c_LngVector8;
+extern struct Any cos_c_LngVector9;
+extern struct Any cos_c_LngVectorDyn;
+extern struct Any cos_c_LngVectorFix;
+extern struct Any cos_c_LngVectorN;
+extern struct Any cos_c_LngVectorSubView;
+extern struct Any cos_c_LngVectorView;
+extern struct Any cos_c_Locker;
+extern struct Any cos_c_Long;
+extern struct Any cos_c_MsgExpr;
+extern struct Any cos_c_Number;
+extern struct Any cos_c_Ordered;
+extern struct Any cos_c_OutputFile;
+extern struct Any cos_c_OutputInputFile;
+extern struct Any cos_c_OutputStream;
+extern struct Any cos_c_RWLocker;
+extern struct Any cos_c_Range;
+extern struct Any cos_c_Sequence;
+extern struct Any cos_c_Short;
+extern struct Any cos_c_ShtVector;
+extern struct Any cos_c_ShtVector0;
+extern struct Any cos_c_ShtVector1;
+extern struct Any cos_c_ShtVector2;
+extern struct Any cos_c_ShtVector3;
+extern struct Any cos_c_ShtVector4;
+extern struct Any cos_c_ShtVector5;
+extern struct Any cos_c_ShtVector6;
+extern struct Any cos_c_ShtVector7;
+extern struct Any cos_c_ShtVector8;
+extern struct Any cos_c_ShtVector9;
+extern struct Any cos_c_ShtVectorDyn;
+extern struct Any cos_c_ShtVectorFix;
+extern struct Any cos_c_ShtVectorN;
+extern struct Any cos_c_ShtVectorSubView;
+extern struct Any cos_c_ShtVectorView;
+extern struct Any cos_c_Slice;
+extern struct Any cos_c_SpinLocker;
+extern struct Any cos_c_Stream;
+extern struct Any cos_c_String;
+extern struct Any cos_c_StringDyn;
+extern struct Any cos_c_StringFix;
+extern struct Any cos_c_StringN;
+extern struct Any cos_c_SubView;
+extern struct Any cos_c_Tracer;
+extern struct Any cos_c_Value;
+extern struct Any cos_c_ValueSequence;
+extern struct Any cos_c_VarExpr;
+extern struct Any cos_c_Vector;
+extern struct Any cos_c_VectorExpr;
+extern struct Any cos_c_View;
+extern struct Any cos_c_XRange;
+extern struct Any cos_c_mArray;
+extern struct Any cos_c_mArray0;
+extern struct Any cos_c_mArray1;
+extern struct Any cos_c_mArray2;
+extern struct Any cos_c_mArray3;
+extern struct Any cos_c_mArray4;
+extern struct Any cos_c_mArray5;
+extern struct Any cos_c_mArray6;
+extern struct Any cos_c_mArray7;
+extern struct Any cos_c_mArray8;
+extern struct Any cos_c_mArray9;
+extern struct Any cos_c_mArrayBlk;
+extern struct Any cos_c_mArrayDyn;
+extern struct Any cos_c_mArrayFix;
+extern struct Any cos_c_mArrayN;
+extern struct Any cos_c_mArraySubView;
+extern struct Any cos_c_mArrayView;
+extern struct Any cos_c_mChar;
+extern struct Any cos_c_mChrVector;
+extern struct Any cos_c_mChrVector0;
+extern struct Any cos_c_mChrVector1;
+extern struct Any cos_c_mChrVector2;
+extern struct Any cos_c_mChrVector3;
+extern struct Any cos_c_mChrVector4;
+extern struct Any cos_c_mChrVector5;
+extern struct Any cos_c_mChrVector6;
+extern struct Any cos_c_mChrVector7;
+extern struct Any cos_c_mChrVector8;
+extern struct Any cos_c_mChrVector9;
+extern struct Any cos_c_mChrVectorDyn;
+extern struct Any cos_c_mChrVectorFix;
+extern struct Any cos_c_mChrVectorN;
+extern struct Any cos_c_mChrVectorSubView;
+extern struct Any cos_c_mChrVectorView;
+extern struct Any cos_c_mCollection;
+extern struct Any cos_c_mComplex;
+extern struct Any cos_c_mComposeFun;
+extern struct Any cos_c_mCpxFunction;
+extern struct Any cos_c_mCpxFunction1;
+extern struct Any cos_c_mCpxFunction2;
+extern struct Any cos_c_mCpxFunction3;
+extern struct Any cos_c_mCpxFunction4;
+extern struct Any cos_c_mCpxFunction5;
+extern struct Any cos_c_mCpxFunction6;
+extern struct Any cos_c_mCpxFunction7;
+extern struct Any cos_c_mCpxFunction8;
+extern struct Any cos_c_mCpxFunction9;
+extern struct Any cos_c_mCpxVector;
+extern struct Any cos_c_mCpxVector0;
+extern struct Any cos_c_mCpxVector1;
+extern struct Any cos_c_mCpxVector2;
+extern struct Any cos_c_mCpxVector3;
+extern struct Any cos_c_mCpxVector4;
+extern struct Any cos_c_mCpxVector5;
+extern struct Any cos_c_mCpxVector6;
+extern struct Any cos_c_mCpxVector7;
+extern struct Any cos_c_mCpxVector8;
+extern struct Any cos_c_mCpxVector9;
+extern struct Any cos_c_mCpxVectorDyn;
+extern struct Any cos_c_mCpxVectorFix;
+extern struct Any cos_c_mCpxVectorN;
+extern struct Any cos_c_mCpxVectorSubView;
+extern struct Any cos_c_mCpxVectorView;
+extern struct Any cos_c_mEqual;
+extern struct Any cos_c_mExBadStream;
+extern struct Any cos_c_mExpression;
+extern struct Any cos_c_mFloat;
+extern struct Any cos_c_mFloating;
+extern struct Any cos_c_mFloatingVector;
+extern struct Any cos_c_mFltFunction;
+extern struct Any cos_c_mFltFunction1;
+extern struct Any cos_c_mFltFunction2;
+extern struct Any cos_c_mFltFunction3;
+extern struct Any cos_c_mFltFunction4;
+extern struct Any cos_c_mFltFunction5;
+extern struct Any cos_c_mFltFunction6;
+extern struct Any cos_c_mFltFunction7;
+extern struct Any cos_c_mFltFunction8;
+extern struct Any cos_c_mFltFunction9;
+extern struct Any cos_c_mFltVector;
+extern struct Any cos_c_mFltVector0;
+extern struct Any cos_c_mFltVector1;
+extern struct Any cos_c_mFltVector2;
+extern struct Any cos_c_mFltVector3;
+extern struct Any cos_c_mFltVector4;
+extern struct Any cos_c_mFltVector5;
+extern struct Any cos_c_mFltVector6;
+extern struct Any cos_c_mFltVector7;
+extern struct Any cos_c_mFltVector8;
+extern struct Any cos_c_mFltVector9;
+extern struct Any cos_c_mFltVectorDyn;
+extern struct Any cos_c_mFltVectorFix;
+extern struct Any cos_c_mFltVectorN;
+extern struct Any cos_c_mFltVectorSubView;
+extern struct Any cos_c_mFltVectorView;
+extern struct Any cos_c_mFunArg;
+extern struct Any cos_c_mFunExpr;
+extern struct Any cos_c_mFunExpr0;
+extern struct Any cos_c_mFunExpr1;
+extern struct Any cos_c_mFunExpr11;
+extern struct Any cos_c_mFunExpr12;
+extern struct Any cos_c_mFunExpr2;
+extern struct Any cos_c_mFunExpr21;
+extern struct Any cos_c_mFunExpr22;
+extern struct Any cos_c_mFunExpr23;
+extern struct Any cos_c_mFunExpr24;
+extern struct Any cos_c_mFunExpr3;
+extern struct Any cos_c_mFunExpr31;
+extern struct Any cos_c_mFunExpr32;
+extern struct Any cos_c_mFunExpr33;
+extern struct Any cos_c_mFunExpr34;
+extern struct Any cos_c_mFunExpr35;
+extern struct Any cos_c_mFunExpr36;
+extern struct Any cos_c_mFunExpr37;
+extern struct Any cos_c_mFunExpr38;
+extern struct Any cos_c_mFunExpr4;
+extern struct Any cos_c_mFunExpr5;
+extern struct Any cos_c_mFunExpr6;
+extern struct Any cos_c_mFunExpr7;
+extern struct Any cos_c_mFunExpr8;
+extern struct Any cos_c_mFunExpr9;
+extern struct Any cos_c_mFunctor;
+extern struct Any cos_c_mG_BinaryOp;
+extern struct Any cos_c_mG_Operator;
+extern struct Any cos_c_mG_TernaryOp;
+extern struct Any cos_c_mG_UnaryOp;
+extern struct Any cos_c_mG_abs;
+extern struct Any cos_c_mG_absolute;
+extern struct Any cos_c_mG_acos;
+extern struct Any cos_c_mG_acosh;
+extern struct Any cos_c_mG_acosine;
+extern struct Any cos_c_mG_acosineh;
+extern struct Any cos_c_mG_add;
+extern struct Any cos_c_mG_addTo;
+extern struct Any cos_c_mG_and;
+extern struct Any cos_c_mG_arg;
+extern struct Any cos_c_mG_argument;
+extern struct Any cos_c_mG_asin;
+extern struct Any cos_c_mG_asine;
+extern struct Any cos_c_mG_asineh;
+extern struct Any cos_c_mG_asinh;
+extern struct Any cos_c_mG_atan;
+extern struct Any cos_c_mG_atangent;
+extern struct Any cos_c_mG_atangenth;
+extern struct Any cos_c_mG_atanh;
+extern struct Any cos_c_mG_compare;
+extern struct Any cos_c_mG_conj;
+extern struct Any cos_c_mG_conjugate;
+extern struct Any cos_c_mG_cos;
+extern struct Any cos_c_mG_cosh;
+extern struct Any cos_c_mG_cosine;
+extern struct Any cos_c_mG_cosineh;
+extern struct Any cos_c_mG_div;
+extern struct Any cos_c_mG_divBy;
+extern struct Any cos_c_mG_exp;
+extern struct Any cos_c_mG_exponential;
+extern struct Any cos_c_mG_hash;
+extern struct Any cos_c_mG_hypot;
+extern struct Any cos_c_mG_implies;
+extern struct Any cos_c_mG_inv;
+extern struct Any cos_c_mG_invert;
+extern struct Any cos_c_mG_isEqual;
+extern struct Any cos_c_mG_isGreater;
+extern struct Any cos_c_mG_isGreaterOrEqual;
+extern struct Any cos_c_mG_isLesser;
+extern struct Any cos_c_mG_isLesserOrEqual;
+extern struct Any cos_c_mG_isNotEqual;
+extern struct Any cos_c_mG_log;
+extern struct Any cos_c_mG_logarithm;
+extern struct Any cos_c_mG_max;
+extern struct Any cos_c_mG_min;
+extern struct Any cos_c_mG_mod;
+extern struct Any cos_c_mG_modulo;
+extern struct Any cos_c_mG_mul;
+extern struct Any cos_c_mG_mulAdd;
+extern struct Any cos_c_mG_mulBy;
+extern struct Any cos_c_mG_neg;
+extern struct Any cos_c_mG_negate;
+extern struct Any cos_c_mG_not;
+extern struct Any cos_c_mG_or;
+extern struct Any cos_c_mG_pow;
+extern struct Any cos_c_mG_power;
+extern struct Any cos_c_mG_prod;
+extern struct Any cos_c_mG_sin;
+extern struct Any cos_c_mG_sine;
+extern struct Any cos_c_mG_sineh;
+extern struct Any cos_c_mG_sinh;
+extern struct Any cos_c_mG_sqr;
+extern struct Any cos_c_mG_sqrErr;
+extern struct Any cos_c_mG_sqroot;
+extern struct Any cos_c_mG_sqrt;
+extern struct Any cos_c_mG_square;
+extern struct Any cos_c_mG_sub;
+extern struct Any cos_c_mG_subTo;
+extern struct Any cos_c_mG_sum;
+extern struct Any cos_c_mG_tan;
+extern struct Any cos_c_mG_tangent;
+extern struct Any cos_c_mG_tangenth;
+extern struct Any cos_c_mG_tanh;
+extern struct Any cos_c_mG_xor;
+extern struct Any cos_c_mGreater;
+extern struct Any cos_c_mInputFile;
+extern struct Any cos_c_mInputOutputFile;
+extern struct Any cos_c_mInputStream;
+extern struct Any cos_c_mInt;
+extern struct Any cos_c_mIntFunction;
+extern struct Any cos_c_mIntFunction1;
+extern struct Any cos_c_mIntFunction2;
+extern struct Any cos_c_mIntFunction3;
+extern struct Any cos_c_mIntFunction4;
+extern struct Any cos_c_mIntFunction5;
+extern struct Any cos_c_mIntFunction6;
+extern struct Any cos_c_mIntFunction7;
+extern struct Any cos_c_mIntFunction8;
+extern struct Any cos_c_mIntFunction9;
+extern struct Any cos_c_mIntVector;
+extern struct Any cos_c_mIntVector0;
+extern struct Any cos_c_mIntVector1;
+extern struct Any cos_c_mIntVector2;
+extern struct Any cos_c_mIntVector3;
+extern struct Any cos_c_mIntVector4;
+extern struct Any cos_c_mIntVector5;
+extern struct Any cos_c_mIntVector6;
+extern struct Any cos_c_mIntVector7;
+extern struct Any cos_c_mIntVector8;
+extern struct Any cos_c_mIntVector9;
+extern struct Any cos_c_mIntVectorDyn;
+extern struct Any cos_c_mIntVectorFix;
+extern struct Any cos_c_mIntVectorN;
+extern struct Any cos_c_mIntVectorSubView;
+extern struct Any cos_c_mIntVectorView;
+extern struct Any cos_c_mIntegral;
+extern struct Any cos_c_mIntegralVector;
+extern struct Any cos_c_mIterateFun;
+extern struct Any cos_c_mIterator;
+extern struct Any cos_c_mLesser;
+extern struct Any cos_c_mLngFunction;
+extern struct Any cos_c_mLngFunction1;
+extern struct Any cos_c_mLngFunction2;
+extern struct Any cos_c_mLngFunction3;
+extern struct Any cos_c_mLngFunction4;
+extern struct Any cos_c_mLngFunction5;
+extern struct Any cos_c_mLngFunction6;
+extern struct Any cos_c_mLngFunction7;
+extern struct Any cos_c_mLngFunction8;
+extern struct Any cos_c_mLngFunction9;
+extern struct Any cos_c_mLngVector;
+extern struct Any cos_c_mLngVector0;
+extern struct Any cos_c_mLngVector1;
+extern struct Any cos_c_mLngVector2;
+extern struct Any cos_c_mLngVector3;
+extern struct Any cos_c_mLngVector4;
+extern struct Any cos_c_mLngVector5;
+extern struct Any cos_c_mLngVector6;
+extern struct Any cos_c_mLngVector7;
+extern struct Any cos_c_mLngVector8;
+extern struct Any cos_c_mLngVector9;
+extern struct Any cos_c_mLngVectorDyn;
+extern struct Any cos_c_mLngVectorFix;
+extern struct Any cos_c_mLngVectorN;
+extern struct Any cos_c_mLngVectorSubView;
+extern struct Any cos_c_mLngVectorView;
+extern struct Any cos_c_mLocker;
+extern struct Any cos_c_mLong;
+extern struct Any cos_c_mMsgExpr;
+extern struct Any cos_c_mNumber;
+extern struct Any cos_c_mOrdered;
+extern struct Any cos_c_mOutputFile;
+extern struct Any cos_c_mOutputInputFile;
+extern struct Any cos_c_mOutputStream;
+extern struct Any cos_c_mRWLocker;
+extern struct Any cos_c_mRange;
+extern struct Any cos_c_mSequence;
+extern struct Any cos_c_mShort;
+extern struct Any cos_c_mShtVector;
+extern struct Any cos_c_mShtVector0;
+extern struct Any cos_c_mShtVector1;
+extern struct Any cos_c_mShtVector2;
+extern struct Any cos_c_mShtVector3;
+extern struct Any cos_c_mShtVector4;
+extern struct Any cos_c_mShtVector5;
+extern struct Any cos_c_mShtVector6;
+extern struct Any cos_c_mShtVector7;
+extern struct Any cos_c_mShtVector8;
+extern struct Any cos_c_mShtVector9;
+extern struct Any cos_c_mShtVectorDyn;
+extern struct Any cos_c_mShtVectorFix;
+extern struct Any cos_c_mShtVectorN;
+extern struct Any cos_c_mShtVectorSubView;
+extern struct Any cos_c_mShtVectorView;
+extern struct Any cos_c_mSlice;
+extern struct Any cos_c_mSpinLocker;
+extern struct Any cos_c_mStream;
+extern struct Any cos_c_mString;
+extern struct Any cos_c_mStringDyn;
+extern struct Any cos_c_mStringFix;
+extern struct Any cos_c_mStringN;
+extern struct Any cos_c_mSubView;
+extern struct Any cos_c_mTracer;
+extern struct Any cos_c_mValue;
+extern struct Any cos_c_mValueSequence;
+extern struct Any cos_c_mVarExpr;
+extern struct Any cos_c_mVector;
+extern struct Any cos_c_mVectorExpr;
+extern struct Any cos_c_mView;
+extern struct Any cos_c_mXRange;
+extern struct Any cos_c_pmArray;
+extern struct Any cos_c_pmArray0;
+extern struct Any cos_c_pmArray1;
+extern struct Any cos_c_pmArray2;
+extern struct Any cos_c_pmArray3;
+extern struct Any cos_c_pmArray4;
+extern struct Any cos_c_pmArray5;
+extern struct Any cos_c_pmArray6;
+extern struct Any cos_c_pmArray7;
+extern struct Any cos_c_pmArray8;
+extern struct Any cos_c_pmArray9;
+extern struct Any cos_c_pmArrayBlk;
+extern struct Any cos_c_pmArrayDyn;
+extern struct Any cos_c_pmArrayFix;
+extern struct Any cos_c_pmArrayN;
+extern struct Any cos_c_pmArraySubView;
+extern struct Any cos_c_pmArrayView;
+extern struct Any cos_c_pmChar;
+extern struct Any cos_c_pmChrVector;
+extern struct Any cos_c_pmChrVector0;
+extern struct Any cos_c_pmChrVector1;
+extern struct Any cos_c_pmChrVector2;
+extern struct Any cos_c_pmChrVector3;
+extern struct Any cos_c_pmChrVector4;
+extern struct Any cos_c_pmChrVector5;
+extern struct Any cos_c_pmChrVector6;
+extern struct Any cos_c_pmChrVector7;
+extern struct Any cos_c_pmChrVector8;
+extern struct Any cos_c_pmChrVector9;
+extern struct Any cos_c_pmChrVectorDyn;
+extern struct Any cos_c_pmChrVectorFix;
+extern struct Any cos_c_pmChrVectorN;
+extern struct Any cos_c_pmChrVectorSubView;
+extern struct Any cos_c_pmChrVectorView;
+extern struct Any cos_c_pmCollection;
+extern struct Any cos_c_pmComplex;
+extern struct Any cos_c_pmComposeFun;
+extern struct Any cos_c_pmCpxFunction;
+extern struct Any cos_c_pmCpxFunction1;
+extern struct Any cos_c_pmCpxFunction2;
+extern struct Any cos_c_pmCpxFunction3;
+extern struct Any cos_c_pmCpxFunction4;
+extern struct Any cos_c_pmCpxFunction5;
+extern struct Any cos_c_pmCpxFunction6;
+extern struct Any cos_c_pmCpxFunction7;
+extern struct Any cos_c_pmCpxFunction8;
+extern struct Any cos_c_pmCpxFunction9;
+extern struct Any cos_c_pmCpxVector;
+extern struct Any cos_c_pmCpxVector0;
+extern struct Any cos_c_pmCpxVector1;
+extern struct Any cos_c_pmCpxVector2;
+extern struct Any cos_c_pmCpxVector3;
+extern struct Any cos_c_pmCpxVector4;
+extern struct Any cos_c_pmCpxVector5;
+extern struct Any cos_c_pmCpxVector6;
+extern struct Any cos_c_pmCpxVector7;
+extern struct Any cos_c_pmCpxVector8;
+extern struct Any cos_c_pmCpxVector9;
+extern struct Any cos_c_pmCpxVectorDyn;
+extern struct Any cos_c_pmCpxVectorFix;
+extern struct Any cos_c_pmCpxVectorN;
+extern struct Any cos_c_pmCpxVectorSubView;
+extern struct Any cos_c_pmCpxVectorView;
+extern struct Any cos_c_pmEqual;
+extern struct Any cos_c_pmExBadStream;
+extern struct Any cos_c_pmExpression;
+extern struct Any cos_c_pmFloat;
+extern struct Any cos_c_pmFloating;
+extern struct Any cos_c_pmFloatingVector;
+extern struct Any cos_c_pmFltFunction;
+extern struct Any cos_c_pmFltFunction1;
+extern struct Any cos_c_pmFltFunction2;
+extern struct Any cos_c_pmFltFunction3;
+extern struct Any cos_c_pmFltFunction4;
+extern struct Any cos_c_pmFltFunction5;
+extern struct Any cos_c_pmFltFunction6;
+extern struct Any cos_c_pmFltFunction7;
+extern struct Any cos_c_pmFltFunction8;
+extern struct Any cos_c_pmFltFunction9;
+extern struct Any cos_c_pmFltVector;
+extern struct Any cos_c_pmFltVector0;
+extern struct Any cos_c_pmFltVector1;
+extern struct Any cos_c_pmFltVector2;
+extern struct Any cos_c_pmFltVector3;
+extern struct Any cos_c_pmFltVector4;
+extern struct Any cos_c_pmFltVector5;
+extern struct Any cos_c_pmFltVector6;
+extern struct Any cos_c_pmFltVector7;
+extern struct Any cos_c_pmFltVector8;
+extern struct Any cos_c_pmFltVector9;
+extern struct Any cos_c_pmFltVectorDyn;
+extern struct Any cos_c_pmFltVectorFix;
+extern struct Any cos_c_pmFltVectorN;
+extern struct Any cos_c_pmFltVectorSubView;
+extern struct Any cos_c_pmFltVectorView;
+extern struct Any cos_c_pmFunArg;
+extern struct Any cos_c_pmFunExpr;
+extern struct Any cos_c_pmFunExpr0;
+extern struct Any cos_c_pmFunExpr1;
+extern struct Any cos_c_pmFunExpr11;
+extern struct Any cos_c_pmFunExpr12;
+extern struct Any cos_c_pmFunExpr2;
+extern struct Any cos_c_pmFunExpr21;
+extern struct Any cos_c_pmFunExpr22;
+extern struct Any cos_c_pmFunExpr23;
+extern struct Any cos_c_pmFunExpr24;
+extern struct Any cos_c_pmFunExpr3;
+extern struct Any cos_c_pmFunExpr31;
+extern struct Any cos_c_pmFunExpr32;
+extern struct Any cos_c_pmFunExpr33;
+extern struct Any cos_c_pmFunExpr34;
+extern struct Any cos_c_pmFunExpr35;
+extern struct Any cos_c_pmFunExpr36;
+extern struct Any cos_c_pmFunExpr37;
+extern struct Any cos_c_pmFunExpr38;
+extern struct Any cos_c_pmFunExpr4;
+extern struct Any cos_c_pmFunExpr5;
+extern struct Any cos_c_pmFunExpr6;
+extern struct Any cos_c_pmFunExpr7;
+extern struct Any cos_c_pmFunExpr8;
+extern struct Any cos_c_pmFunExpr9;
+extern struct Any cos_c_pmFunctor;
+extern struct Any cos_c_pmG_BinaryOp;
+extern struct Any cos_c_pmG_Operator;
+extern struct Any cos_c_pmG_TernaryOp;
+extern struct Any cos_c_pmG_UnaryOp;
+extern struct Any cos_c_pmG_abs;
+extern struct Any cos_c_pmG_absolute;
+extern struct Any cos_c_pmG_acos;
+extern struct Any cos_c_pmG_acosh;
+extern struct Any cos_c_pmG_acosine;
+extern struct Any cos_c_pmG_acosineh;
+extern struct Any cos_c_pmG_add;
+extern struct Any cos_c_pmG_addTo;
+extern struct Any cos_c_pmG_and;
+extern struct Any cos_c_pmG_arg;
+extern struct Any cos_c_pmG_argument;
+extern struct Any cos_c_pmG_asin;
+extern struct Any cos_c_pmG_asine;
+extern struct Any cos_c_pmG_asineh;
+extern struct Any cos_c_pmG_asinh;
+extern struct Any cos_c_pmG_atan;
+extern struct Any cos_c_pmG_atangent;
+extern struct Any cos_c_pmG_atangenth;
+extern struct Any cos_c_pmG_atanh;
+extern struct Any cos_c_pmG_compare;
+extern struct Any cos_c_pmG_conj;
+extern struct Any cos_c_pmG_conjugate;
+extern struct Any cos_c_pmG_cos;
+extern struct Any cos_c_pmG_cosh;
+extern struct Any cos_c_pmG_cosine;
+extern struct Any cos_c_pmG_cosineh;
+extern struct Any cos_c_pmG_div;
+extern struct Any cos_c_pmG_divBy;
+extern struct Any cos_c_pmG_exp;
+extern struct Any cos_c_pmG_exponential;
+extern struct Any cos_c_pmG_hash;
+extern struct Any cos_c_pmG_hypot;
+extern struct Any cos_c_pmG_implies;
+extern struct Any cos_c_pmG_inv;
+extern struct Any cos_c_pmG_invert;
+extern struct Any cos_c_pmG_isEqual;
+extern struct Any cos_c_pmG_isGreater;
+extern struct Any cos_c_pmG_isGreaterOrEqual;
+extern struct Any cos_c_pmG_isLesser;
+extern struct Any cos_c_pmG_isLesserOrEqual;
+extern struct Any cos_c_pmG_isNotEqual;
+extern struct Any cos_c_pmG_log;
+extern struct Any cos_c_pmG_logarithm;
+extern struct Any cos_c_pmG_max;
+extern struct Any cos_c_pmG_min;
+extern struct Any cos_c_pmG_mod;
+extern struct Any cos_c_pmG_modulo;
+extern struct Any cos_c_pmG_mul;
+extern struct Any cos_c_pmG_mulAdd;
+extern struct Any cos_c_pmG_mulBy;
+extern struct Any cos_c_pmG_neg;
+extern struct Any cos_c_pmG_negate;
+extern struct Any cos_c_pmG_not;
+extern struct Any cos_c_pmG_or;
+extern struct Any cos_c_pmG_pow;
+extern struct Any cos_c_pmG_power;
+extern struct Any cos_c_pmG_prod;
+extern struct Any cos_c_pmG_sin;
+extern struct Any cos_c_pmG_sine;
+extern struct Any cos_c_pmG_sineh;
+extern struct Any cos_c_pmG_sinh;
+extern struct Any cos_c_pmG_sqr;
+extern struct Any cos_c_pmG_sqrErr;
+extern struct Any cos_c_pmG_sqroot;
+extern struct Any cos_c_pmG_sqrt;
+extern struct Any cos_c_pmG_square;
+extern struct Any cos_c_pmG_sub;
+extern struct Any cos_c_pmG_subTo;
+extern struct Any cos_c_pmG_sum;
+extern struct Any cos_c_pmG_tan;
+extern struct Any cos_c_pmG_tangent;
+extern struct Any cos_c_pmG_tangenth;
+extern struct Any cos_c_pmG_tanh;
+extern struct Any cos_c_pmG_xor;
+extern struct Any cos_c_pmGreater;
+extern struct Any cos_c_pmInputFile;
+extern struct Any cos_c_pmInputOutputFile;
+extern struct Any cos_c_pmInputStream;
+extern struct Any cos_c_pmInt;
+extern struct Any cos_c_pmIntFunction;
+extern struct Any cos_c_pmIntFunction1;
+extern struct Any cos_c_pmIntFunction2;
+extern struct Any cos_c_pmIntFunction3;
+extern struct Any cos_c_pmIntFunction4;
+extern struct Any cos_c_pmIntFunction5;
+extern struct Any cos_c_pmIntFunction6;
+extern struct Any cos_c_pmIntFunction7;
+extern struct Any cos_c_pmIntFunction8;
+extern struct Any cos_c_pmIntFunction9;
+extern struct Any cos_c_pmIntVector;
+extern struct Any cos_c_pmIntVector0;
+extern struct Any cos_c_pmIntVector1;
+extern struct Any cos_c_pmIntVector2;
+extern struct Any cos_c_pmIntVector3;
+extern struct Any cos_c_pmIntVector4;
+extern struct Any cos_c_pmIntVector5;
+extern struct Any cos_c_pmIntVector6;
+extern struct Any cos_c_pmIntVector7;
+extern struct Any cos_c_pmIntVector8;
+extern struct Any cos_c_pmIntVector9;
+extern struct Any cos_c_pmIntVectorDyn;
+extern struct Any cos_c_pmIntVectorFix;
+extern struct Any cos_c_pmIntVectorN;
+extern struct Any cos_c_pmIntVectorSubView;
+extern struct Any cos_c_pmIntVectorView;
+extern struct Any cos_c_pmIntegral;
+extern struct Any cos_c_pmIntegralVector;
+extern struct Any cos_c_pmIterateFun;
+extern struct Any cos_c_pmIterator;
+extern struct Any cos_c_pmLesser;
+extern struct Any cos_c_pmLngFunction;
+extern struct Any cos_c_pmLngFunction1;
+extern struct Any cos_c_pmLngFunction2;
+extern struct Any cos_c_pmLngFunction3;
+extern struct Any cos_c_pmLngFunction4;
+extern struct Any cos_c_pmLngFunction5;
+extern struct Any cos_c_pmLngFunction6;
+extern struct Any cos_c_pmLngFunction7;
+extern struct Any cos_c_pmLngFunction8;
+extern struct Any cos_c_pmLngFunction9;
+extern struct Any cos_c_pmLngVector;
+extern struct Any cos_c_pmLngVector0;
+extern struct Any cos_c_pmLngVector1;
+extern struct Any cos_c_pmLngVector2;
+extern struct Any cos_c_pmLngVector3;
+extern struct Any cos_c_pmLngVector4;
+extern struct Any cos_c_pmLngVector5;
+extern struct Any cos_c_pmLngVector6;
+extern struct Any cos_c_pmLngVector7;
+extern struct Any cos_c_pmLngVector8;
+extern struct Any cos_c_pmLngVector9;
+extern struct Any cos_c_pmLngVectorDyn;
+extern struct Any cos_c_pmLngVectorFix;
+extern struct Any cos_c_pmLngVectorN;
+extern struct Any cos_c_pmLngVectorSubView;
+extern struct Any cos_c_pmLngVectorView;
+extern struct Any cos_c_pmLocker;
+extern struct Any cos_c_pmLong;
+extern struct Any cos_c_pmMsgExpr;
+extern struct Any cos_c_pmNumber;
+extern struct Any cos_c_pmOrdered;
+extern struct Any cos_c_pmOutputFile;
+extern struct Any cos_c_pmOutputInputFile;
+extern struct Any cos_c_pmOutputStream;
+extern struct Any cos_c_pmRWLocker;
+extern struct Any cos_c_pmRange;
+extern struct Any cos_c_pmSequence;
+extern struct Any cos_c_pmShort;
+extern struct Any cos_c_pmShtVector;
+extern struct Any cos_c_pmShtVector0;
+extern struct Any cos_c_pmShtVector1;
+extern struct Any cos_c_pmShtVector2;
+extern struct Any cos_c_pmShtVector3;
+extern struct Any cos_c_pmShtVector4;
+extern struct Any cos_c_pmShtVector5;
+extern struct Any cos_c_pmShtVector6;
+extern struct Any cos_c_pmShtVector7;
+extern struct Any cos_c_pmShtVector8;
+extern struct Any cos_c_pmShtVector9;
+extern struct Any cos_c_pmShtVectorDyn;
+extern struct Any cos_c_pmShtVectorFix;
+extern struct Any cos_c_pmShtVectorN;
+extern struct Any cos_c_pmShtVectorSubView;
+extern struct Any cos_c_pmShtVectorView;
+extern struct Any cos_c_pmSlice;
+extern struct Any cos_c_pmSpinLocker;
+extern struct Any cos_c_pmStream;
+extern struct Any cos_c_pmString;
+extern struct Any cos_c_pmStringDyn;
+extern struct Any cos_c_pmStringFix;
+extern struct Any cos_c_pmStringN;
+extern struct Any cos_c_pmSubView;
+extern struct Any cos_c_pmTracer;
+extern struct Any cos_c_pmValue;
+extern struct Any cos_c_pmValueSequence;
+extern struct Any cos_c_pmVarExpr;
+extern struct Any cos_c_pmVector;
+extern struct Any cos_c_pmVectorExpr;
+extern struct Any cos_c_pmView;
+extern struct Any cos_c_pmXRange;
+extern struct Any cos_g_gabs;
+extern struct Any cos_g_gabsolute;
+extern struct Any cos_g_gaccumulate;
+extern struct Any cos_g_gaccumulate1;
+extern struct Any cos_g_gaccumulate2;
+extern struct Any cos_g_gacos;
+extern struct Any cos_g_gacosh;
+extern struct Any cos_g_gacosine;
+extern struct Any cos_g_gacosineh;
+extern struct Any cos_g_gadd;
+extern struct Any cos_g_gaddTo;
+extern struct Any cos_g_gadjust;
+extern struct Any cos_g_gall;
+extern struct Any cos_g_gallNext;
+extern struct Any cos_g_gand;
+extern struct Any cos_g_gany;
+extern struct Any cos_g_gappend;
+extern struct Any cos_g_gapply;
+extern struct Any cos_g_gapply2;
+extern struct Any cos_g_gapply3;
+extern struct Any cos_g_gapply4;
+extern struct Any cos_g_gapplyIf;
+extern struct Any cos_g_gapplyWhile;
+extern struct Any cos_g_garg;
+extern struct Any cos_g_gargument;
+extern struct Any cos_g_gasin;
+extern struct Any cos_g_gasine;
+extern struct Any cos_g_gasineh;
+extern struct Any cos_g_gasinh;
+extern struct Any cos_g_gatan;
+extern struct Any cos_g_gatangent;
+extern struct Any cos_g_gatangenth;
+extern struct Any cos_g_gatanh;
+extern struct Any cos_g_gaxpy;
+extern struct Any cos_g_gcapacity;
+extern struct Any cos_g_gcompare;
+extern struct Any cos_g_gcompose;
+extern struct Any cos_g_gcomposen;
+extern struct Any cos_g_gconcat;
+extern struct Any cos_g_gconcat3;
+extern struct Any cos_g_gconcat4;
+extern struct Any cos_g_gconcatn;
+extern struct Any cos_g_gconj;
+extern struct Any cos_g_gconjugate;
+extern struct Any cos_g_gcos;
+extern struct Any cos_g_gcosh;
+extern struct Any cos_g_gcosine;
+extern struct Any cos_g_gcosineh;
+extern struct Any cos_g_gcount;
+extern struct Any cos_g_gdelegate;
+extern struct Any cos_g_gdiff;
+extern struct Any cos_g_gdiv;
+extern struct Any cos_g_gdivBy;
+extern struct Any cos_g_gdot;
+extern struct Any cos_g_gdrop;
+extern struct Any cos_g_genlarge;
+extern struct Any cos_g_gevalFun;
+extern struct Any cos_g_gexp;
+extern struct Any cos_g_gexponential;
+extern struct Any cos_g_gfind;
+extern struct Any cos_g_gfirst;
+extern struct Any cos_g_gflush;
+extern struct Any cos_g_gforeach;
+extern struct Any cos_g_gforeach2;
+extern struct Any cos_g_gforeach3;
+extern struct Any cos_g_gforeach4;
+extern struct Any cos_g_gforeachWhile;
+extern struct Any cos_g_ggenerate;
+extern struct Any cos_g_gget;
+extern struct Any cos_g_ggetChr;
+extern struct Any cos_g_ggetContent;
+extern struct Any cos_g_ggetData;
+extern struct Any cos_g_ggetDelim;
+extern struct Any cos_g_ggetDelims;
+extern struct Any cos_g_ggetFILE;
+extern struct Any cos_g_ggetLine;
+extern struct Any cos_g_ggetLines;
+extern struct Any cos_g_ggetWhile;
+extern struct Any cos_g_ggroup;
+extern struct Any cos_g_ghash;
+extern struct Any cos_g_ghypot;
+extern struct Any cos_g_giamax;
+extern struct Any cos_g_gifind;
+extern struct Any cos_g_gimplies;
+extern struct Any cos_g_gindexOf;
+extern struct Any cos_g_ginitWithFILE;
+extern struct Any cos_g_ginitWithFun0;
+extern struct Any cos_g_ginitWithFun1;
+extern struct Any cos_g_ginitWithFun2;
+extern struct Any cos_g_ginitWithFun3;
+extern struct Any cos_g_ginitWithFun4;
+extern struct Any cos_g_ginitWithFun5;
+extern struct Any cos_g_ginitWithFun6;
+extern struct Any cos_g_ginitWithFun7;
+extern struct Any cos_g_ginitWithFun8;
+extern struct Any cos_g_ginitWithFun9;
+extern struct Any cos_g_ginitWithMth;
+extern struct Any cos_g_ginsertAt;
+extern struct Any cos_g_gintersect;
+extern struct Any cos_g_gintersperse;
+extern struct Any cos_g_ginv;
+extern struct Any cos_g_ginvert;
+extern struct Any cos_g_gisAlnum;
+extern struct Any cos_g_gisAlpha;
+extern struct Any cos_g_gisBlank;
+extern struct Any cos_g_gisCntrl;
+extern struct Any cos_g_gisDigit;
+extern struct Any cos_g_gisEmpty;
+extern struct Any cos_g_gisEqual;
+extern struct Any cos_g_gisGraph;
+extern struct Any cos_g_gisGreater;
+extern struct Any cos_g_gisGreaterOrEqual;
+extern struct Any cos_g_gisLesser;
+extern struct Any cos_g_gisLesserOrEqual;
+extern struct Any cos_g_gisLower;
+extern struct Any cos_g_gisNotEqual;
+extern struct Any cos_g_gisPrint;
+extern struct Any cos_g_gisPunct;
+extern struct Any cos_g_gisSorted;
+extern struct Any cos_g_gisSpace;
+extern struct Any cos_g_gisUpper;
+extern struct Any cos_g_gisXDigit;
+extern struct Any cos_g_gisort;
+extern struct Any cos_g_giterate;
+extern struct Any cos_g_giterator;
+extern struct Any cos_g_glast;
+extern struct Any cos_g_glog;
+extern struct Any cos_g_glogarithm;
+extern struct Any cos_g_gmap;
+extern struct Any cos_g_gmap2;
+extern struct Any cos_g_gmap3;
+extern struct Any cos_g_gmap4;
+extern struct Any cos_g_gmapIf;
+extern struct Any cos_g_gmapWhile;
+extern struct Any cos_g_gmax;
+extern struct Any cos_g_gmerge;
+extern struct Any cos_g_gmin;
+extern struct Any cos_g_gminmax;
+extern struct Any cos_g_gmod;
+extern struct Any cos_g_gmodulo;
+extern struct Any cos_g_gmul;
+extern struct Any cos_g_gmulAdd;
+extern struct Any cos_g_gmulBy;
+extern struct Any cos_g_gneg;
+extern struct Any cos_g_gnegate;
+extern struct Any cos_g_gnewRng;
+extern struct Any cos_g_gnewSlc;
+extern struct Any cos_g_gnewXRng;
+extern struct Any cos_g_gnext;
+extern struct Any cos_g_gnorm2;
+extern struct Any cos_g_gnot;
+extern struct Any cos_g_gor;
+extern struct Any cos_g_gpermute;
+extern struct Any cos_g_gpop;
+extern struct Any cos_g_gpopBack;
+extern struct Any cos_g_gpopFront;
+extern struct Any cos_g_gpow;
+extern struct Any cos_g_gpower;
+extern struct Any cos_g_gprepend;
+extern struct Any cos_g_gprod;
+extern struct Any cos_g_gpush;
+extern struct Any cos_g_gpushBack;
+extern struct Any cos_g_gpushFront;
+extern struct Any cos_g_gput;
+extern struct Any cos_g_gputChr;
+extern struct Any cos_g_gputData;
+extern struct Any cos_g_gputLn;
+extern struct Any cos_g_gputStr;
+extern struct Any cos_g_gputStrLn;
+extern struct Any cos_g_gputnChr;
+extern struct Any cos_g_greduce;
+extern struct Any cos_g_greduce1;
+extern struct Any cos_g_greduce2;
+extern struct Any cos_g_greject;
+extern struct Any cos_g_grejectWhile;
+extern struct Any cos_g_gremoveAt;
+extern struct Any cos_g_grepeat;
+extern struct Any cos_g_grevIterator;
+extern struct Any cos_g_greverse;
+extern struct Any cos_g_gscal;
+extern struct Any cos_g_gseek;
+extern struct Any cos_g_gselect;
+extern struct Any cos_g_gselectWhile;
+extern struct Any cos_g_gsetDelegate;
+extern struct Any cos_g_gsin;
+extern struct Any cos_g_gsine;
+extern struct Any cos_g_gsineh;
+extern struct Any cos_g_gsinh;
+extern struct Any cos_g_gskipDelim;
+extern struct Any cos_g_gskipDelims;
+extern struct Any cos_g_gskipLine;
+extern struct Any cos_g_gskipWhile;
+extern struct Any cos_g_gskipnChr;
+extern struct Any cos_g_gsort;
+extern struct Any cos_g_gsplit;
+extern struct Any cos_g_gsqr;
+extern struct Any cos_g_gsqrErr;
+extern struct Any cos_g_gsqroot;
+extern struct Any cos_g_gsqrt;
+extern struct Any cos_g_gsquare;
+extern struct Any cos_g_gstrip;
+extern struct Any cos_g_gsub;
+extern struct Any cos_g_gsubTo;
+extern struct Any cos_g_gsum;
+extern struct Any cos_g_gtan;
+extern struct Any cos_g_gtangent;
+extern struct Any cos_g_gtangenth;
+extern struct Any cos_g_gtanh;
+extern struct Any cos_g_gtell;
+extern struct Any cos_g_gtoLower;
+extern struct Any cos_g_gtoUpper;
+extern struct Any cos_g_gtop;
+extern struct Any cos_g_gtopBack;
+extern struct Any cos_g_gtopFront;
+extern struct Any cos_g_gungetChr;
+extern struct Any cos_g_gunique;
+extern struct Any cos_g_gxor;
+extern struct Any cos_g_gzip;
+extern struct Any cos_g_gzip3;
+extern struct Any cos_g_gzip4;
+extern struct Any cos_g_gzipn;
+extern struct Any cos_m_gabs__Complex;
+extern struct Any cos_m_gabs__FloatingVector;
+extern struct Any cos_m_gabs__Number;
+extern struct Any cos_m_gabs__Vector;
+extern struct Any cos_m_gabs__VectorExpr;
+extern struct Any cos_m_gabsolute__Complex;
+extern struct Any cos_m_gabsolute__CpxVector;
+extern struct Any cos_m_gabsolute__Float;
+extern struct Any cos_m_gabsolute__FltVector;
+extern struct Any cos_m_gabsolute__Int;
+extern struct Any cos_m_gabsolute__IntVector;
+extern struct Any cos_m_gabsolute__LngVector;
+extern struct Any cos_m_gabsolute__Long;
+extern struct Any cos_m_gabsolute__ShtVector;
+extern struct Any cos_m_gaccumulate__Array__Functor;
+extern struct Any cos_m_gaccumulate__ChrVector__Functor;
+extern struct Any cos_m_gaccumulate__ChrVector__IntFunction2;
+extern struct Any cos_m_gaccumulate__CpxVector__CpxFunction2;
+extern struct Any cos_m_gaccumulate__CpxVector__Functor;
+extern struct Any cos_m_gaccumulate__FltVector__FltFunction2;
+extern struct Any cos_m_gaccumulate__FltVector__Functor;
+extern struct Any cos_m_gaccumulate__IntVector__Functor;
+extern struct Any cos_m_gaccumulate__IntVector__IntFunction2;
+extern struct Any cos_m_gaccumulate__LngVector__Functor;
+extern struct Any cos_m_gaccumulate__LngVector__LngFunction2;
+extern struct Any cos_m_gaccumulate__ShtVector__Functor;
+extern struct Any cos_m_gaccumulate__ShtVector__IntFunction2;
+extern struct Any cos_m_gaccumulate1__Array__Functor__Object;
+extern struct Any cos_m_gaccumulate1__ChrVector__Functor__Object;
+extern struct Any cos_m_gaccumulate1__ChrVector__IntFunction2__Object;
+extern struct Any cos_m_gaccumulate1__CpxVector__CpxFunction2__Object;
+extern struct Any cos_m_gaccumulate1__CpxVector__Functor__Object;
+extern struct Any cos_m_gaccumulate1__FltVector__FltFunction2__Object;
+extern struct Any cos_m_gaccumulate1__FltVector__Functor__Object;
+extern struct Any cos_m_gaccumulate1__IntVector__Functor__Object;
+extern struct Any cos_m_gaccumulate1__IntVector__IntFunction2__Object;
+extern struct Any cos_m_gaccumulate1__LngVector__Functor__Object;
+extern struct Any cos_m_gaccumulate1__LngVector__LngFunction2__Object;
+extern struct Any cos_m_gaccumulate1__ShtVector__Functor__Object;
+extern struct Any cos_m_gaccumulate1__ShtVector__IntFunction2__Object;
+extern struct Any cos_m_gaccumulate2__Array__Functor__Object__Object;
+extern struct Any cos_m_gaccumulate2__ChrVector__Functor__Object__Object;
+extern struct Any cos_m_gaccumulate2__CpxVector__Functor__Object__Object;
+extern struct Any cos_m_gaccumulate2__FltVector__Functor__Object__Object;
+extern struct Any cos_m_gaccumulate2__IntVector__Functor__Object__Object;
+extern struct Any cos_m_gaccumulate2__LngVector__Functor__Object__Object;
+extern struct Any cos_m_gaccumulate2__ShtVector__Functor__Object__Object;
+extern struct Any cos_m_gacos__Floating;
+extern struct Any cos_m_gacos__FloatingVector;
+extern struct Any cos_m_gacosh__Floating;
+extern struct Any cos_m_gacosh__FloatingVector;
+extern struct Any cos_m_gacosine__Complex;
+extern struct Any cos_m_gacosine__CpxVector;
+extern struct Any cos_m_gacosine__Float;
+extern struct Any cos_m_gacosine__FltVector;
+extern struct Any cos_m_gacosineh__Complex;
+extern struct Any cos_m_gacosineh__CpxVector;
+extern struct Any cos_m_gacosineh__Float;
+extern struct Any cos_m_gacosineh__FltVector;
+extern struct Any cos_m_gadd__FloatingVector__CpxVector;
+extern struct Any cos_m_gadd__Floating__Complex;
+extern struct Any cos_m_gadd__IntegralVector__FloatingVector;
+extern struct Any cos_m_gadd__IntegralVector__LngVector;
+extern struct Any cos_m_gadd__Integral__Floating;
+extern struct Any cos_m_gadd__Integral__Long;
+extern struct Any cos_m_gadd__Number__Number;
+extern struct Any cos_m_gadd__VectorExpr__Vector;
+extern struct Any cos_m_gadd__VectorExpr__VectorExpr;
+extern struct Any cos_m_gadd__Vector__Vector;
+extern struct Any cos_m_gadd__Vector__VectorExpr;
+extern struct Any cos_m_gaddTo__Complex__Complex;
+extern struct Any cos_m_gaddTo__Complex__Float;
+extern struct Any cos_m_gaddTo__Complex__Int;
+extern struct Any cos_m_gaddTo__Complex__Long;
+extern struct Any cos_m_gaddTo__CpxVector__CpxVector;
+extern struct Any cos_m_gaddTo__CpxVector__FltVector;
+extern struct Any cos_m_gaddTo__CpxVector__IntVector;
+extern struct Any cos_m_gaddTo__CpxVector__LngVector;
+extern struct Any cos_m_gaddTo__CpxVector__ShtVector;
+extern struct Any cos_m_gaddTo__Float__Float;
+extern struct Any cos_m_gaddTo__Float__Int;
+extern struct Any cos_m_gaddTo__Float__Long;
+extern struct Any cos_m_gaddTo__FltVector__FltVector;
+extern struct Any cos_m_gaddTo__FltVector__IntVector;
+extern struct Any cos_m_gaddTo__FltVector__LngVector;
+extern struct Any cos_m_gaddTo__FltVector__ShtVector;
+extern struct Any cos_m_gaddTo__IntVector__IntVector;
+extern struct Any cos_m_gaddTo__IntVector__ShtVector;
+extern struct Any cos_m_gaddTo__Int__Int;
+extern struct Any cos_m_gaddTo__LngVector__IntVector;
+extern struct Any cos_m_gaddTo__LngVector__LngVector;
+extern struct Any cos_m_gaddTo__LngVector__ShtVector;
+extern struct Any cos_m_gaddTo__Long__Int;
+extern struct Any cos_m_gaddTo__Long__Long;
+extern struct Any cos_m_gaddTo__ShtVector__ShtVector;
+extern struct Any cos_m_gadjust__Array;
+extern struct Any cos_m_gadjust__ArrayDyn;
+extern struct Any cos_m_gadjust__ChrVectorDyn;
+extern struct Any cos_m_gadjust__CpxVectorDyn;
+extern struct Any cos_m_gadjust__FltVectorDyn;
+extern struct Any cos_m_gadjust__IntVectorDyn;
+extern struct Any cos_m_gadjust__LngVectorDyn;
+extern struct Any cos_m_gadjust__ShtVectorDyn;
+extern struct Any cos_m_gadjust__StringDyn;
+extern struct Any cos_m_gall__Array__Functor;
+extern struct Any cos_m_gall__ChrVector__Functor;
+extern struct Any cos_m_gall__ChrVector__IntFunction1;
+extern struct Any cos_m_gall__CpxVector__CpxFunction1;
+extern struct Any cos_m_gall__CpxVector__Functor;
+extern struct Any cos_m_gall__FltVector__FltFunction1;
+extern struct Any cos_m_gall__FltVector__Functor;
+extern struct Any cos_m_gall__IntVector__Functor;
+extern struct Any cos_m_gall__IntVector__IntFunction1;
+extern struct Any cos_m_gall__LngVector__Functor;
+extern struct Any cos_m_gall__LngVector__LngFunction1;
+extern struct Any cos_m_gall__ShtVector__Functor;
+extern struct Any cos_m_gall__ShtVector__IntFunction1;
+extern struct Any cos_m_gall__String__Functor;
+extern struct Any cos_m_gallNext__Iterator;
+extern struct Any cos_m_galloc__mView;
+extern struct Any cos_m_galloc__pmArray;
+extern struct Any cos_m_galloc__pmChrVector;
+extern struct Any cos_m_galloc__pmCpxVector;
+extern struct Any cos_m_galloc__pmFltVector;
+extern struct Any cos_m_galloc__pmFunctor;
+extern struct Any cos_m_galloc__pmIntVector;
+extern struct Any cos_m_galloc__pmLngVector;
+extern struct Any cos_m_galloc__pmNumber;
+extern struct Any cos_m_galloc__pmShtVector;
+extern struct Any cos_m_galloc__pmString;
+extern struct Any cos_m_gand__mFalse__mTrueFalse;
+extern struct Any cos_m_gand__mTrueFalse__mFalse;
+extern struct Any cos_m_gand__mTrueFalse__mTrueFalse;
+extern struct Any cos_m_gand__mTrue__mTrue;
+extern struct Any cos_m_gany__Array__Functor;
+extern struct Any cos_m_gany__ChrVector__Functor;
+extern struct Any cos_m_gany__ChrVector__IntFunction1;
+extern struct Any cos_m_gany__CpxVector__CpxFunction1;
+extern struct Any cos_m_gany__CpxVector__Functor;
+extern struct Any cos_m_gany__FltVector__FltFunction1;
+extern struct Any cos_m_gany__FltVector__Functor;
+extern struct Any cos_m_gany__IntVector__Functor;
+extern struct Any cos_m_gany__IntVector__IntFunction1;
+extern struct Any cos_m_gany__LngVector__Functor;
+extern struct Any cos_m_gany__LngVector__LngFunction1;
+extern struct Any cos_m_gany__ShtVector__Functor;
+extern struct Any cos_m_gany__ShtVector__IntFunction1;
+extern struct Any cos_m_gany__String__Functor;
+extern struct Any cos_m_gappend__ArrayDyn__Array;
+extern struct Any cos_m_gappend__ArrayDyn__Object;
+extern struct Any cos_m_gappend__ChrVectorDyn__Char;
+extern struct Any cos_m_gappend__ChrVectorDyn__ChrVector;
+extern struct Any cos_m_gappend__ChrVectorDyn__Object;
+extern struct Any cos_m_gappend__CpxVectorDyn__Complex;
+extern struct Any cos_m_gappend__CpxVectorDyn__CpxVector;
+extern struct Any cos_m_gappend__CpxVectorDyn__Object;
+extern struct Any cos_m_gappend__FltVectorDyn__Float;
+extern struct Any cos_m_gappend__FltVectorDyn__FltVector;
+extern struct Any cos_m_gappend__FltVectorDyn__Object;
+extern struct Any cos_m_gappend__IntVectorDyn__Int;
+extern struct Any cos_m_gappend__IntVectorDyn__IntVector;
+extern struct Any cos_m_gappend__IntVectorDyn__Object;
+extern struct Any cos_m_gappend__LngVectorDyn__LngVector;
+extern struct Any cos_m_gappend__LngVectorDyn__Long;
+extern struct Any cos_m_gappend__LngVectorDyn__Object;
+extern struct Any cos_m_gappend__ShtVectorDyn__Object;
+extern struct Any cos_m_gappend__ShtVectorDyn__Short;
+extern struct Any cos_m_gappend__ShtVectorDyn__ShtVector;
+extern struct Any cos_m_gappend__StringDyn__Char;
+extern struct Any cos_m_gappend__StringDyn__Object;
+extern struct Any cos_m_gappend__StringDyn__String;
+extern struct Any cos_m_gapply__CpxFunction1__CpxVector;
+extern struct Any cos_m_gapply__FltFunction1__FltVector;
+extern struct Any cos_m_gapply__Functor__Array;
+extern struct Any cos_m_gapply__Functor__ChrVector;
+extern struct Any cos_m_gapply__Functor__CpxVector;
+extern struct Any cos_m_gapply__Functor__FltVector;
+extern struct Any cos_m_gapply__Functor__IntVector;
+extern struct Any cos_m_gapply__Functor__LngVector;
+extern struct Any cos_m_gapply__Functor__ShtVector;
+extern struct Any cos_m_gapply__Functor__String;
+extern struct Any cos_m_gapply__IntFunction1__ChrVector;
+extern struct Any cos_m_gapply__IntFunction1__IntVector;
+extern struct Any cos_m_gapply__IntFunction1__ShtVector;
+extern struct Any cos_m_gapply__LngFunction1__LngVector;
+extern struct Any cos_m_gapply__MsgExpr__Array;
+extern struct Any cos_m_gapply__MsgExpr__ChrVector;
+extern struct Any cos_m_gapply__MsgExpr__CpxVector;
+extern struct Any cos_m_gapply__MsgExpr__FltVector;
+extern struct Any cos_m_gapply__MsgExpr__IntVector;
+extern struct Any cos_m_gapply__MsgExpr__LngVector;
+extern struct Any cos_m_gapply__MsgExpr__ShtVector;
+extern struct Any cos_m_gapply2__Functor__Array__Array;
+extern struct Any cos_m_gapply2__Functor__ChrVector__ChrVector;
+extern struct Any cos_m_gapply2__Functor__CpxVector__CpxVector;
+extern struct Any cos_m_gapply2__Functor__FltVector__FltVector;
+extern struct Any cos_m_gapply2__Functor__IntVector__IntVector;
+extern struct Any cos_m_gapply2__Functor__LngVector__LngVector;
+extern struct Any cos_m_gapply2__Functor__ShtVector__ShtVector;
+extern struct Any cos_m_gapply2__Functor__String__String;
+extern struct Any cos_m_gapply2__MsgExpr__Array__Array;
+extern struct Any cos_m_gapply2__MsgExpr__ChrVector__ChrVector;
+extern struct Any cos_m_gapply2__MsgExpr__CpxVector__CpxVector;
+extern struct Any cos_m_gapply2__MsgExpr__FltVector__FltVector;
+extern struct Any cos_m_gapply2__MsgExpr__IntVector__IntVector;
+extern struct Any cos_m_gapply2__MsgExpr__LngVector__LngVector;
+extern struct Any cos_m_gapply2__MsgExpr__ShtVector__ShtVector;
+extern struct Any cos_m_gapply3__Functor__Array__Array__Array;
+extern struct Any cos_m_gapply3__Functor__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gapply3__Functor__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gapply3__Functor__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gapply3__Functor__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gapply3__Functor__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gapply3__Functor__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gapply3__Functor__String__String__String;
+extern struct Any cos_m_gapply4__Functor__Array__Array__Array__Array;
+extern struct Any cos_m_gapply4__Functor__ChrVector__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gapply4__Functor__CpxVector__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gapply4__Functor__FltVector__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gapply4__Functor__IntVector__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gapply4__Functor__LngVector__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gapply4__Functor__ShtVector__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gapply4__Functor__String__String__String__String;
+extern struct Any cos_m_gapplyIf__Functor__Array;
+extern struct Any cos_m_gapplyIf__Functor__ChrVector;
+extern struct Any cos_m_gapplyIf__Functor__CpxVector;
+extern struct Any cos_m_gapplyIf__Functor__FltVector;
+extern struct Any cos_m_gapplyIf__Functor__IntVector;
+extern struct Any cos_m_gapplyIf__Functor__LngVector;
+extern struct Any cos_m_gapplyIf__Functor__ShtVector;
+extern struct Any cos_m_gapplyWhile__Functor__Array;
+extern struct Any cos_m_gapplyWhile__Functor__ChrVector;
+extern struct Any cos_m_gapplyWhile__Functor__CpxVector;
+extern struct Any cos_m_gapplyWhile__Functor__FltVector;
+extern struct Any cos_m_gapplyWhile__Functor__IntVector;
+extern struct Any cos_m_gapplyWhile__Functor__LngVector;
+extern struct Any cos_m_gapplyWhile__Functor__ShtVector;
+extern struct Any cos_m_gapplyWhile__Functor__String;
+extern struct Any cos_m_garg__Complex;
+extern struct Any cos_m_garg__FloatingVector;
+extern struct Any cos_m_gargument__Complex;
+extern struct Any cos_m_gargument__CpxVector;
+extern struct Any cos_m_gasin__Floating;
+extern struct Any cos_m_gasin__FloatingVector;
+extern struct Any cos_m_gasine__Complex;
+extern struct Any cos_m_gasine__CpxVector;
+extern struct Any cos_m_gasine__Float;
+extern struct Any cos_m_gasine__FltVector;
+extern struct Any cos_m_gasineh__Complex;
+extern struct Any cos_m_gasineh__CpxVector;
+extern struct Any cos_m_gasineh__Float;
+extern struct Any cos_m_gasineh__FltVector;
+extern struct Any cos_m_gasinh__Floating;
+extern struct Any cos_m_gasinh__FloatingVector;
+extern struct Any cos_m_gassign__Array__Array;
+extern struct Any cos_m_gassign__Vector__VectorExpr;
+extern struct Any cos_m_gatan__Floating;
+extern struct Any cos_m_gatan__FloatingVector;
+extern struct Any cos_m_gatangent__Complex;
+extern struct Any cos_m_gatangent__CpxVector;
+extern struct Any cos_m_gatangent__Float;
+extern struct Any cos_m_gatangent__FltVector;
+extern struct Any cos_m_gatangenth__Complex;
+extern struct Any cos_m_gatangenth__CpxVector;
+extern struct Any cos_m_gatangenth__Float;
+extern struct Any cos_m_gatangenth__FltVector;
+extern struct Any cos_m_gatanh__Floating;
+extern struct Any cos_m_gatanh__FloatingVector;
+extern struct Any cos_m_gaxpy__CpxVector__Number__CpxVector;
+extern struct Any cos_m_gaxpy__FltVector__Number__FltVector;
+extern struct Any cos_m_gbool__mTrue;
+extern struct Any cos_m_gbool__mTrueFalse;
+extern struct Any cos_m_gcapacity__ArrayDyn;
+extern struct Any cos_m_gcapacity__StringDyn;
+extern struct Any cos_m_gchr__Char;
+extern struct Any cos_m_gchrAt__ChrVector__Int;
+extern struct Any cos_m_gchrAt__String__Int;
+extern struct Any cos_m_gchrPtr__ChrVector;
+extern struct Any cos_m_gchrPtr__String;
+extern struct Any cos_m_gclass__Array;
+extern struct Any cos_m_gclass__ChrVector;
+extern struct Any cos_m_gclass__CpxVector;
+extern struct Any cos_m_gclass__FltVector;
+extern struct Any cos_m_gclass__IntVector;
+extern struct Any cos_m_gclass__LngVector;
+extern struct Any cos_m_gclass__ShtVector;
+extern struct Any cos_m_gclass__String;
+extern struct Any cos_m_gclear__ArrayDyn;
+extern struct Any cos_m_gclear__ChrVectorDyn;
+extern struct Any cos_m_gclear__Complex;
+extern struct Any cos_m_gclear__CpxVectorDyn;
+extern struct Any cos_m_gclear__Float;
+extern struct Any cos_m_gclear__FltVectorDyn;
+extern struct Any cos_m_gclear__Int;
+extern struct Any cos_m_gclear__IntVectorDyn;
+extern struct Any cos_m_gclear__LngVectorDyn;
+extern struct Any cos_m_gclear__Long;
+extern struct Any cos_m_gclear__ShtVectorDyn;
+extern struct Any cos_m_gclear__StringDyn;
+extern struct Any cos_m_gclone__Array;
+extern struct Any cos_m_gclone__Char;
+extern struct Any cos_m_gclone__ChrVector;
+extern struct Any cos_m_gclone__Complex;
+extern struct Any cos_m_gclone__CpxVector;
+extern struct Any cos_m_gclone__Float;
+extern struct Any cos_m_gclone__FltVector;
+extern struct Any cos_m_gclone__Int;
+extern struct Any cos_m_gclone__IntVector;
+extern struct Any cos_m_gclone__LngVector;
+extern struct Any cos_m_gclone__Long;
+extern struct Any cos_m_gclone__Range;
+extern struct Any cos_m_gclone__Short;
+extern struct Any cos_m_gclone__ShtVector;
+extern struct Any cos_m_gclone__Slice;
+extern struct Any cos_m_gclone__String;
+extern struct Any cos_m_gclone__XRange;
+extern struct Any cos_m_gcompare__Array__Array;
+extern struct Any cos_m_gcompare__Float__Float;
+extern struct Any cos_m_gcompare__Float__Int;
+extern struct Any cos_m_gcompare__Float__Long;
+extern struct Any cos_m_gcompare__Int__Float;
+extern struct Any cos_m_gcompare__Int__Int;
+extern struct Any cos_m_gcompare__Int__Long;
+extern struct Any cos_m_gcompare__Long__Float;
+extern struct Any cos_m_gcompare__Long__Int;
+extern struct Any cos_m_gcompare__Long__Long;
+extern struct Any cos_m_gcompare__String__String;
+extern struct Any cos_m_gconcat__Array__Array;
+extern struct Any cos_m_gconcat__ChrVector__ChrVector;
+extern struct Any cos_m_gconcat__CpxVector__CpxVector;
+extern struct Any cos_m_gconcat__FltVector__FltVector;
+extern struct Any cos_m_gconcat__IntVector__IntVector;
+extern struct Any cos_m_gconcat__LngVector__LngVector;
+extern struct Any cos_m_gconcat__ShtVector__ShtVector;
+extern struct Any cos_m_gconcat__String__String;
+extern struct Any cos_m_gconcat3__Array__Array__Array;
+extern struct Any cos_m_gconcat3__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gconcat3__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gconcat3__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gconcat3__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gconcat3__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gconcat3__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gconcat3__String__String__String;
+extern struct Any cos_m_gconcat4__Array__Array__Array__Array;
+extern struct Any cos_m_gconcat4__ChrVector__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gconcat4__CpxVector__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gconcat4__FltVector__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gconcat4__IntVector__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gconcat4__LngVector__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gconcat4__ShtVector__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gconcat4__String__String__String__String;
+extern struct Any cos_m_gconcatn__Array;
+extern struct Any cos_m_gconj__Complex;
+extern struct Any cos_m_gconj__FloatingVector;
+extern struct Any cos_m_gconjugate__Complex;
+extern struct Any cos_m_gconjugate__CpxVector;
+extern struct Any cos_m_gcopy__Array;
+extern struct Any cos_m_gcopy__Char;
+extern struct Any cos_m_gcopy__Complex;
+extern struct Any cos_m_gcopy__Float;
+extern struct Any cos_m_gcopy__Int;
+extern struct Any cos_m_gcopy__Long;
+extern struct Any cos_m_gcopy__Range;
+extern struct Any cos_m_gcopy__Short;
+extern struct Any cos_m_gcopy__Slice;
+extern struct Any cos_m_gcopy__String;
+extern struct Any cos_m_gcopy__XRange;
+extern struct Any cos_m_gcos__Floating;
+extern struct Any cos_m_gcos__FloatingVector;
+extern struct Any cos_m_gcosh__Floating;
+extern struct Any cos_m_gcosh__FloatingVector;
+extern struct Any cos_m_gcosine__Complex;
+extern struct Any cos_m_gcosine__CpxVector;
+extern struct Any cos_m_gcosine__Float;
+extern struct Any cos_m_gcosine__FltVector;
+extern struct Any cos_m_gcosineh__Complex;
+extern struct Any cos_m_gcosineh__CpxVector;
+extern struct Any cos_m_gcosineh__Float;
+extern struct Any cos_m_gcosineh__FltVector;
+extern struct Any cos_m_gcount__Array__Functor;
+extern struct Any cos_m_gcount__ChrVector__Functor;
+extern struct Any cos_m_gcount__ChrVector__IntFunction1;
+extern struct Any cos_m_gcount__CpxVector__CpxFunction1;
+extern struct Any cos_m_gcount__CpxVector__Functor;
+extern struct Any cos_m_gcount__FltVector__FltFunction1;
+extern struct Any cos_m_gcount__FltVector__Functor;
+extern struct Any cos_m_gcount__IntVector__Functor;
+extern struct Any cos_m_gcount__IntVector__IntFunction1;
+extern struct Any cos_m_gcount__LngVector__Functor;
+extern struct Any cos_m_gcount__LngVector__LngFunction1;
+extern struct Any cos_m_gcount__ShtVector__Functor;
+extern struct Any cos_m_gcount__ShtVector__IntFunction1;
+extern struct Any cos_m_gcount__String__Functor;
+extern struct Any cos_m_gcpx__Complex;
+extern struct Any cos_m_gcpx__Float;
+extern struct Any cos_m_gcpx__Int;
+extern struct Any cos_m_gcpx__Long;
+extern struct Any cos_m_gcpxAt__ChrVector__Int;
+extern struct Any cos_m_gcpxAt__CpxVector__Int;
+extern struct Any cos_m_gcpxAt__FltVector__Int;
+extern struct Any cos_m_gcpxAt__IntVector__Int;
+extern struct Any cos_m_gcpxAt__LngVector__Int;
+extern struct Any cos_m_gcpxAt__ShtVector__Int;
+extern struct Any cos_m_gcpxPtr__CpxVector;
+extern struct Any cos_m_gdeinit__Array;
+extern struct Any cos_m_gdeinit__ArrayFix;
+extern struct Any cos_m_gdeinit__ArrayView;
+extern struct Any cos_m_gdeinit__ChrVectorFix;
+extern struct Any cos_m_gdeinit__ChrVectorView;
+extern struct Any cos_m_gdeinit__CpxVectorFix;
+extern struct Any cos_m_gdeinit__CpxVectorView;
+extern struct Any cos_m_gdeinit__FltVectorFix;
+extern struct Any cos_m_gdeinit__FltVectorView;
+extern struct Any cos_m_gdeinit__FunExpr0;
+extern struct Any cos_m_gdeinit__FunExpr1;
+extern struct Any cos_m_gdeinit__FunExpr2;
+extern struct Any cos_m_gdeinit__FunExpr3;
+extern struct Any cos_m_gdeinit__FunExpr4;
+extern struct Any cos_m_gdeinit__FunExpr5;
+extern struct Any cos_m_gdeinit__FunExpr6;
+extern struct Any cos_m_gdeinit__FunExpr7;
+extern struct Any cos_m_gdeinit__FunExpr8;
+extern struct Any cos_m_gdeinit__FunExpr9;
+extern struct Any cos_m_gdeinit__InputFile;
+extern struct Any cos_m_gdeinit__IntVectorFix;
+extern struct Any cos_m_gdeinit__IntVectorView;
+extern struct Any cos_m_gdeinit__LngVectorFix;
+extern struct Any cos_m_gdeinit__LngVectorView;
+extern struct Any cos_m_gdeinit__Locker;
+extern struct Any cos_m_gdeinit__OutputFile;
+extern struct Any cos_m_gdeinit__ShtVectorFix;
+extern struct Any cos_m_gdeinit__ShtVectorView;
+extern struct Any cos_m_gdeinit__StringFix;
+extern struct Any cos_m_gdeinit__Value;
+extern struct Any cos_m_gdeinit__ValueSequence;
+extern struct Any cos_m_gdeinit__VectorExpr;
+extern struct Any cos_m_gdeinitialize__Any__a__226StdioDeinit;
+extern struct Any cos_m_gdiff__Array__Collection__Functor;
+extern struct Any cos_m_gdiv__FloatingVector__CpxVector;
+extern struct Any cos_m_gdiv__Floating__Complex;
+extern struct Any cos_m_gdiv__IntegralVector__FloatingVector;
+extern struct Any cos_m_gdiv__IntegralVector__LngVector;
+extern struct Any cos_m_gdiv__Integral__Floating;
+extern struct Any cos_m_gdiv__Integral__Long;
+extern struct Any cos_m_gdiv__Number__Number;
+extern struct Any cos_m_gdiv__VectorExpr__Vector;
+extern struct Any cos_m_gdiv__VectorExpr__VectorExpr;
+extern struct Any cos_m_gdiv__Vector__Vector;
+extern struct Any cos_m_gdiv__Vector__VectorExpr;
+extern struct Any cos_m_gdivBy__Complex__Complex;
+extern struct Any cos_m_gdivBy__Complex__Float;
+extern struct Any cos_m_gdivBy__Complex__Int;
+extern struct Any cos_m_gdivBy__Complex__Long;
+extern struct Any cos_m_gdivBy__CpxVector__CpxVector;
+extern struct Any cos_m_gdivBy__CpxVector__FltVector;
+extern struct Any cos_m_gdivBy__CpxVector__IntVector;
+extern struct Any cos_m_gdivBy__CpxVector__LngVector;
+extern struct Any cos_m_gdivBy__CpxVector__ShtVector;
+extern struct Any cos_m_gdivBy__Float__Float;
+extern struct Any cos_m_gdivBy__Float__Int;
+extern struct Any cos_m_gdivBy__Float__Long;
+extern struct Any cos_m_gdivBy__FltVector__FltVector;
+extern struct Any cos_m_gdivBy__FltVector__IntVector;
+extern struct Any cos_m_gdivBy__FltVector__LngVector;
+extern struct Any cos_m_gdivBy__FltVector__ShtVector;
+extern struct Any cos_m_gdivBy__IntVector__IntVector;
+extern struct Any cos_m_gdivBy__IntVector__ShtVector;
+extern struct Any cos_m_gdivBy__Int__Int;
+extern struct Any cos_m_gdivBy__LngVector__IntVector;
+extern struct Any cos_m_gdivBy__LngVector__LngVector;
+extern struct Any cos_m_gdivBy__LngVector__ShtVector;
+extern struct Any cos_m_gdivBy__Long__Int;
+extern struct Any cos_m_gdivBy__Long__Long;
+extern struct Any cos_m_gdivBy__ShtVector__ShtVector;
+extern struct Any cos_m_gdot__CpxVector__CpxVector;
+extern struct Any cos_m_gdot__FltVector__FltVector;
+extern struct Any cos_m_gdrop__ArrayDyn__Int;
+extern struct Any cos_m_gdrop__ChrVectorDyn__Int;
+extern struct Any cos_m_gdrop__CpxVectorDyn__Int;
+extern struct Any cos_m_gdrop__FltVectorDyn__Int;
+extern struct Any cos_m_gdrop__IntVectorDyn__Int;
+extern struct Any cos_m_gdrop__LngVectorDyn__Int;
+extern struct Any cos_m_gdrop__ShtVectorDyn__Int;
+extern struct Any cos_m_gdrop__StringDyn__Int;
+extern struct Any cos_m_genlarge__ArrayDyn__Int;
+extern struct Any cos_m_genlarge__ChrVectorDyn__Float;
+extern struct Any cos_m_genlarge__ChrVectorDyn__Int;
+extern struct Any cos_m_genlarge__CpxVectorDyn__Float;
+extern struct Any cos_m_genlarge__CpxVectorDyn__Int;
+extern struct Any cos_m_genlarge__FltVectorDyn__Float;
+extern struct Any cos_m_genlarge__FltVectorDyn__Int;
+extern struct Any cos_m_genlarge__IntVectorDyn__Float;
+extern struct Any cos_m_genlarge__IntVectorDyn__Int;
+extern struct Any cos_m_genlarge__LngVectorDyn__Float;
+extern struct Any cos_m_genlarge__LngVectorDyn__Int;
+extern struct Any cos_m_genlarge__ShtVectorDyn__Float;
+extern struct Any cos_m_genlarge__ShtVectorDyn__Int;
+extern struct Any cos_m_genlarge__StringDyn__Int;
+extern struct Any cos_m_gevalFun__FunExpr0;
+extern struct Any cos_m_gevalFun__FunExpr1;
+extern struct Any cos_m_gevalFun__FunExpr11;
+extern struct Any cos_m_gevalFun__FunExpr12;
+extern struct Any cos_m_gevalFun__FunExpr2;
+extern struct Any cos_m_gevalFun__FunExpr21;
+extern struct Any cos_m_gevalFun__FunExpr22;
+extern struct Any cos_m_gevalFun__FunExpr23;
+extern struct Any cos_m_gevalFun__FunExpr24;
+extern struct Any cos_m_gevalFun__FunExpr3;
+extern struct Any cos_m_gevalFun__FunExpr31;
+extern struct Any cos_m_gevalFun__FunExpr32;
+extern struct Any cos_m_gevalFun__FunExpr33;
+extern struct Any cos_m_gevalFun__FunExpr34;
+extern struct Any cos_m_gevalFun__FunExpr35;
+extern struct Any cos_m_gevalFun__FunExpr36;
+extern struct Any cos_m_gevalFun__FunExpr37;
+extern struct Any cos_m_gevalFun__FunExpr38;
+extern struct Any cos_m_gevalFun__FunExpr4;
+extern struct Any cos_m_gevalFun__FunExpr5;
+extern struct Any cos_m_gevalFun__FunExpr6;
+extern struct Any cos_m_gevalFun__FunExpr7;
+extern struct Any cos_m_gevalFun__FunExpr8;
+extern struct Any cos_m_gevalFun__FunExpr9;
+extern struct Any cos_m_gevalFun__MsgExpr;
+extern struct Any cos_m_gexp__Floating;
+extern struct Any cos_m_gexp__FloatingVector;
+extern struct Any cos_m_gexponential__Complex;
+extern struct Any cos_m_gexponential__CpxVector;
+extern struct Any cos_m_gexponential__Float;
+extern struct Any cos_m_gexponential__FltVector;
+extern struct Any cos_m_gfind__Array__Array;
+extern struct Any cos_m_gfind__Array__Functor;
+extern struct Any cos_m_gfind__Array__Object;
+extern struct Any cos_m_gfind__ChrVector__ChrVector;
+extern struct Any cos_m_gfind__ChrVector__Functor;
+extern struct Any cos_m_gfind__ChrVector__Object;
+extern struct Any cos_m_gfind__CpxVector__CpxVector;
+extern struct Any cos_m_gfind__CpxVector__Functor;
+extern struct Any cos_m_gfind__CpxVector__Object;
+extern struct Any cos_m_gfind__FltVector__FltVector;
+extern struct Any cos_m_gfind__FltVector__Functor;
+extern struct Any cos_m_gfind__FltVector__Object;
+extern struct Any cos_m_gfind__IntVector__Functor;
+extern struct Any cos_m_gfind__IntVector__IntVector;
+extern struct Any cos_m_gfind__IntVector__Object;
+extern struct Any cos_m_gfind__LngVector__Functor;
+extern struct Any cos_m_gfind__LngVector__LngVector;
+extern struct Any cos_m_gfind__LngVector__Object;
+extern struct Any cos_m_gfind__ShtVector__Functor;
+extern struct Any cos_m_gfind__ShtVector__Object;
+extern struct Any cos_m_gfind__ShtVector__ShtVector;
+extern struct Any cos_m_gfind__String__Char;
+extern struct Any cos_m_gfind__String__Functor;
+extern struct Any cos_m_gfind__String__Object;
+extern struct Any cos_m_gfirst__Array;
+extern struct Any cos_m_gfirst__ChrVector;
+extern struct Any cos_m_gfirst__CpxVector;
+extern struct Any cos_m_gfirst__FltVector;
+extern struct Any cos_m_gfirst__IntVector;
+extern struct Any cos_m_gfirst__LngVector;
+extern struct Any cos_m_gfirst__ShtVector;
+extern struct Any cos_m_gfirst__String;
+extern struct Any cos_m_gflt__Float;
+extern struct Any cos_m_gflt__Int;
+extern struct Any cos_m_gflt__Long;
+extern struct Any cos_m_gfltAt__ChrVector__Int;
+extern struct Any cos_m_gfltAt__FltVector__Int;
+extern struct Any cos_m_gfltAt__IntVector__Int;
+extern struct Any cos_m_gfltAt__LngVector__Int;
+extern struct Any cos_m_gfltAt__ShtVector__Int;
+extern struct Any cos_m_gfltPtr__FltVector;
+extern struct Any cos_m_gflush__InputFile;
+extern struct Any cos_m_gflush__OutputFile;
+extern struct Any cos_m_gforeach__Array__Functor;
+extern struct Any cos_m_gforeach__Array__MsgExpr;
+extern struct Any cos_m_gforeach__ChrVector__Functor;
+extern struct Any cos_m_gforeach__ChrVector__IntFunction1;
+extern struct Any cos_m_gforeach__ChrVector__MsgExpr;
+extern struct Any cos_m_gforeach__CpxVector__CpxFunction1;
+extern struct Any cos_m_gforeach__CpxVector__Functor;
+extern struct Any cos_m_gforeach__CpxVector__MsgExpr;
+extern struct Any cos_m_gforeach__FltVector__FltFunction1;
+extern struct Any cos_m_gforeach__FltVector__Functor;
+extern struct Any cos_m_gforeach__FltVector__MsgExpr;
+extern struct Any cos_m_gforeach__IntVector__Functor;
+extern struct Any cos_m_gforeach__IntVector__IntFunction1;
+extern struct Any cos_m_gforeach__IntVector__MsgExpr;
+extern struct Any cos_m_gforeach__LngVector__Functor;
+extern struct Any cos_m_gforeach__LngVector__LngFunction1;
+extern struct Any cos_m_gforeach__LngVector__MsgExpr;
+extern struct Any cos_m_gforeach__Range__Functor;
+extern struct Any cos_m_gforeach__Range__IntFunction1;
+extern struct Any cos_m_gforeach__ShtVector__Functor;
+extern struct Any cos_m_gforeach__ShtVector__IntFunction1;
+extern struct Any cos_m_gforeach__ShtVector__MsgExpr;
+extern struct Any cos_m_gforeach__Slice__Functor;
+extern struct Any cos_m_gforeach__Slice__IntFunction1;
+extern struct Any cos_m_gforeach__XRange__FltFunction1;
+extern struct Any cos_m_gforeach__XRange__Functor;
+extern struct Any cos_m_gforeach2__Array__Array__Functor;
+extern struct Any cos_m_gforeach2__Array__Array__MsgExpr;
+extern struct Any cos_m_gforeach2__ChrVector__ChrVector__Functor;
+extern struct Any cos_m_gforeach2__ChrVector__ChrVector__MsgExpr;
+extern struct Any cos_m_gforeach2__CpxVector__CpxVector__Functor;
+extern struct Any cos_m_gforeach2__CpxVector__CpxVector__MsgExpr;
+extern struct Any cos_m_gforeach2__FltVector__FltVector__Functor;
+extern struct Any cos_m_gforeach2__FltVector__FltVector__MsgExpr;
+extern struct Any cos_m_gforeach2__IntVector__IntVector__Functor;
+extern struct Any cos_m_gforeach2__IntVector__IntVector__MsgExpr;
+extern struct Any cos_m_gforeach2__LngVector__LngVector__Functor;
+extern struct Any cos_m_gforeach2__LngVector__LngVector__MsgExpr;
+extern struct Any cos_m_gforeach2__ShtVector__ShtVector__Functor;
+extern struct Any cos_m_gforeach2__ShtVector__ShtVector__MsgExpr;
+extern struct Any cos_m_gforeach3__Array__Array__Array__Functor;
+extern struct Any cos_m_gforeach3__ChrVector__ChrVector__ChrVector__Functor;
+extern struct Any cos_m_gforeach3__CpxVector__CpxVector__CpxVector__Functor;
+extern struct Any cos_m_gforeach3__FltVector__FltVector__FltVector__Functor;
+extern struct Any cos_m_gforeach3__IntVector__IntVector__IntVector__Functor;
+extern struct Any cos_m_gforeach3__LngVector__LngVector__LngVector__Functor;
+extern struct Any cos_m_gforeach3__ShtVector__ShtVector__ShtVector__Functor;
+extern struct Any cos_m_gforeach4__Array__Array__Array__Array__Functor;
+extern struct Any cos_m_gforeach4__ChrVector__ChrVector__ChrVector__ChrVector__Functor;
+extern struct Any cos_m_gforeach4__CpxVector__CpxVector__CpxVector__CpxVector__Functor;
+extern struct Any cos_m_gforeach4__FltVector__FltVector__FltVector__FltVector__Functor;
+extern struct Any cos_m_gforeach4__IntVector__IntVector__IntVector__IntVector__Functor;
+extern struct Any cos_m_gforeach4__LngVector__LngVector__LngVector__LngVector__Functor;
+extern struct Any cos_m_gforeach4__ShtVector__ShtVector__ShtVector__ShtVector__Functor;
+extern struct Any cos_m_gforeachWhile__Array__Functor;
+extern struct Any cos_m_gforeachWhile__ChrVector__Functor;
+extern struct Any cos_m_gforeachWhile__CpxVector__Functor;
+extern struct Any cos_m_gforeachWhile__FltVector__Functor;
+extern struct Any cos_m_gforeachWhile__InputStream__Functor;
+extern struct Any cos_m_gforeachWhile__IntVector__Functor;
+extern struct Any cos_m_gforeachWhile__LngVector__Functor;
+extern struct Any cos_m_gforeachWhile__ShtVector__Functor;
+extern struct Any cos_m_gget__InputStream__Char;
+extern struct Any cos_m_gget__InputStream__Class;
+extern struct Any cos_m_gget__InputStream__Float;
+extern struct Any cos_m_gget__InputStream__Int;
+extern struct Any cos_m_gget__InputStream__Long;
+extern struct Any cos_m_gget__InputStream__Short;
+extern struct Any cos_m_gget__InputStream__StringDyn;
+extern struct Any cos_m_gget__String__Char;
+extern struct Any cos_m_gget__String__Class;
+extern struct Any cos_m_gget__String__Complex;
+extern struct Any cos_m_gget__String__Float;
+extern struct Any cos_m_gget__String__Int;
+extern struct Any cos_m_gget__String__Long;
+extern struct Any cos_m_gget__String__pmString;
+extern struct Any cos_m_ggetAt__Array__Array;
+extern struct Any cos_m_ggetAt__Array__Int;
+extern struct Any cos_m_ggetAt__Array__IntVector;
+extern struct Any cos_m_ggetAt__Array__Range;
+extern struct Any cos_m_ggetAt__Array__Slice;
+extern struct Any cos_m_ggetAt__ChrVector__Int;
+extern struct Any cos_m_ggetAt__ChrVector__IntVector;
+extern struct Any cos_m_ggetAt__ChrVector__Range;
+extern struct Any cos_m_ggetAt__ChrVector__Slice;
+extern struct Any cos_m_ggetAt__CpxVector__Int;
+extern struct Any cos_m_ggetAt__CpxVector__IntVector;
+extern struct Any cos_m_ggetAt__CpxVector__Range;
+extern struct Any cos_m_ggetAt__CpxVector__Slice;
+extern struct Any cos_m_ggetAt__FltVector__Int;
+extern struct Any cos_m_ggetAt__FltVector__IntVector;
+extern struct Any cos_m_ggetAt__FltVector__Range;
+extern struct Any cos_m_ggetAt__FltVector__Slice;
+extern struct Any cos_m_ggetAt__IntVector__Int;
+extern struct Any cos_m_ggetAt__IntVector__IntVector;
+extern struct Any cos_m_ggetAt__IntVector__Range;
+extern struct Any cos_m_ggetAt__IntVector__Slice;
+extern struct Any cos_m_ggetAt__LngVector__Int;
+extern struct Any cos_m_ggetAt__LngVector__IntVector;
+extern struct Any cos_m_ggetAt__LngVector__Range;
+extern struct Any cos_m_ggetAt__LngVector__Slice;
+extern struct Any cos_m_ggetAt__ShtVector__Int;
+extern struct Any cos_m_ggetAt__ShtVector__IntVector;
+extern struct Any cos_m_ggetAt__ShtVector__Range;
+extern struct Any cos_m_ggetAt__ShtVector__Slice;
+extern struct Any cos_m_ggetAt__String__Array;
+extern struct Any cos_m_ggetAt__String__Int;
+extern struct Any cos_m_ggetAt__String__IntVector;
+extern struct Any cos_m_ggetAt__String__Range;
+extern struct Any cos_m_ggetAt__String__Slice;
+extern struct Any cos_m_ggetAtIdx__Array;
+extern struct Any cos_m_ggetAtIdx__ChrVector;
+extern struct Any cos_m_ggetAtIdx__CpxVector;
+extern struct Any cos_m_ggetAtIdx__FltVector;
+extern struct Any cos_m_ggetAtIdx__IntVector;
+extern struct Any cos_m_ggetAtIdx__LngVector;
+extern struct Any cos_m_ggetAtIdx__ShtVector;
+extern struct Any cos_m_ggetAtIdx__String;
+extern struct Any cos_m_ggetChr__InputFile;
+extern struct Any cos_m_ggetContent__InputStream;
+extern struct Any cos_m_ggetData__InputStream;
+extern struct Any cos_m_ggetDelim__InputStream;
+extern struct Any cos_m_ggetDelims__InputStream;
+extern struct Any cos_m_ggetFILE__InputFile;
+extern struct Any cos_m_ggetFILE__OutputFile;
+extern struct Any cos_m_ggetLine__InputStream;
+extern struct Any cos_m_ggetLines__InputStream;
+extern struct Any cos_m_ggetWhile__InputStream__Functor;
+extern struct Any cos_m_ghypot__Float__Float;
+extern struct Any cos_m_giamax__CpxVector;
+extern struct Any cos_m_giamax__FltVector;
+extern struct Any cos_m_gifind__Array__Array;
+extern struct Any cos_m_gifind__Array__Functor;
+extern struct Any cos_m_gifind__Array__Object;
+extern struct Any cos_m_gifind__ChrVector__ChrVector;
+extern struct Any cos_m_gifind__ChrVector__Functor;
+extern struct Any cos_m_gifind__ChrVector__Object;
+extern struct Any cos_m_gifind__CpxVector__CpxVector;
+extern struct Any cos_m_gifind__CpxVector__Functor;
+extern struct Any cos_m_gifind__CpxVector__Object;
+extern struct Any cos_m_gifind__FltVector__FltVector;
+extern struct Any cos_m_gifind__FltVector__Functor;
+extern struct Any cos_m_gifind__FltVector__Object;
+extern struct Any cos_m_gifind__IntVector__Functor;
+extern struct Any cos_m_gifind__IntVector__IntVector;
+extern struct Any cos_m_gifind__IntVector__Object;
+extern struct Any cos_m_gifind__LngVector__Functor;
+extern struct Any cos_m_gifind__LngVector__LngVector;
+extern struct Any cos_m_gifind__LngVector__Object;
+extern struct Any cos_m_gifind__ShtVector__Functor;
+extern struct Any cos_m_gifind__ShtVector__Object;
+extern struct Any cos_m_gifind__ShtVector__ShtVector;
+extern struct Any cos_m_gifind__String__Char;
+extern struct Any cos_m_gifind__String__Functor;
+extern struct Any cos_m_gifind__String__Object;
+extern struct Any cos_m_gifind__String__String;
+extern struct Any cos_m_gimplies__mFalse__mTrueFalse;
+extern struct Any cos_m_gimplies__mTrueFalse__mTrue;
+extern struct Any cos_m_gimplies__mTrueFalse__mTrueFalse;
+extern struct Any cos_m_gimplies__mTrue__mFalse;
+extern struct Any cos_m_gindexOf__Array__Array;
+extern struct Any cos_m_gindexOf__ChrVector__ChrVector;
+extern struct Any cos_m_gindexOf__CpxVector__CpxVector;
+extern struct Any cos_m_gindexOf__FltVector__FltVector;
+extern struct Any cos_m_gindexOf__IntVector__IntVector;
+extern struct Any cos_m_gindexOf__LngVector__LngVector;
+extern struct Any cos_m_gindexOf__ShtVector__ShtVector;
+extern struct Any cos_m_gindexOf__String__String;
+extern struct Any cos_m_ginit__ArrayDyn;
+extern struct Any cos_m_ginit__Complex;
+extern struct Any cos_m_ginit__Float;
+extern struct Any cos_m_ginit__Int;
+extern struct Any cos_m_ginit__Long;
+extern struct Any cos_m_ginit__StringDyn;
+extern struct Any cos_m_ginit__pmArray;
+extern struct Any cos_m_ginit__pmChrVector;
+extern struct Any cos_m_ginit__pmCpxVector;
+extern struct Any cos_m_ginit__pmFltVector;
+extern struct Any cos_m_ginit__pmIntVector;
+extern struct Any cos_m_ginit__pmLngVector;
+extern struct Any cos_m_ginit__pmShtVector;
+extern struct Any cos_m_ginit__pmString;
+extern struct Any cos_m_ginitWith__ArrayDyn__Int;
+extern struct Any cos_m_ginitWith__ChrVectorDyn__Int;
+extern struct Any cos_m_ginitWith__Complex__Complex;
+extern struct Any cos_m_ginitWith__Complex__Float;
+extern struct Any cos_m_ginitWith__Complex__Int;
+extern struct Any cos_m_ginitWith__Complex__Long;
+extern struct Any cos_m_ginitWith__CpxVectorDyn__Int;
+extern struct Any cos_m_ginitWith__Float__Float;
+extern struct Any cos_m_ginitWith__Float__Int;
+extern struct Any cos_m_ginitWith__Float__Long;
+extern struct Any cos_m_ginitWith__FltVectorDyn__Int;
+extern struct Any cos_m_ginitWith__FunExpr0__FunExpr0;
+extern struct Any cos_m_ginitWith__FunExpr1__FunExpr1;
+extern struct Any cos_m_ginitWith__FunExpr2__FunExpr2;
+extern struct Any cos_m_ginitWith__FunExpr3__FunExpr3;
+extern struct Any cos_m_ginitWith__FunExpr4__FunExpr4;
+extern struct Any cos_m_ginitWith__FunExpr5__FunExpr5;
+extern struct Any cos_m_ginitWith__FunExpr6__FunExpr6;
+extern struct Any cos_m_ginitWith__FunExpr7__FunExpr7;
+extern struct Any cos_m_ginitWith__FunExpr8__FunExpr8;
+extern struct Any cos_m_ginitWith__FunExpr9__FunExpr9;
+extern struct Any cos_m_ginitWith__InputFile__String;
+extern struct Any cos_m_ginitWith__InputOutputFile__String;
+extern struct Any cos_m_ginitWith__IntVectorDyn__Int;
+extern struct Any cos_m_ginitWith__Int__Int;
+extern struct Any cos_m_ginitWith__LngVectorDyn__Int;
+extern struct Any cos_m_ginitWith__Locker__Object;
+extern struct Any cos_m_ginitWith__Long__Int;
+extern struct Any cos_m_ginitWith__Long__Long;
+extern struct Any cos_m_ginitWith__OutputFile__String;
+extern struct Any cos_m_ginitWith__OutputInputFile__String;
+extern struct Any cos_m_ginitWith__RWLocker__Object;
+extern struct Any cos_m_ginitWith__ShtVectorDyn__Int;
+extern struct Any cos_m_ginitWith__SpinLocker__Object;
+extern struct Any cos_m_ginitWith__StringDyn__Int;
+extern struct Any cos_m_ginitWith__VectorExpr__Vector;
+extern struct Any cos_m_ginitWith__VectorExpr__VectorExpr;
+extern struct Any cos_m_ginitWith__pmArray__Array;
+extern struct Any cos_m_ginitWith__pmArray__Int;
+extern struct Any cos_m_ginitWith__pmArray__Range;
+extern struct Any cos_m_ginitWith__pmArray__Slice;
+extern struct Any cos_m_ginitWith__pmArray__XRange;
+extern struct Any cos_m_ginitWith__pmChrVector__ChrVector;
+extern struct Any cos_m_ginitWith__pmChrVector__Int;
+extern struct Any cos_m_ginitWith__pmChrVector__Range;
+extern struct Any cos_m_ginitWith__pmChrVector__Slice;
+extern struct Any cos_m_ginitWith__pmChrVector__XRange;
+extern struct Any cos_m_ginitWith__pmCpxVector__CpxVector;
+extern struct Any cos_m_ginitWith__pmCpxVector__Int;
+extern struct Any cos_m_ginitWith__pmCpxVector__Range;
+extern struct Any cos_m_ginitWith__pmCpxVector__Slice;
+extern struct Any cos_m_ginitWith__pmCpxVector__VectorExpr;
+extern struct Any cos_m_ginitWith__pmCpxVector__XRange;
+extern struct Any cos_m_ginitWith__pmFltVector__FltVector;
+extern struct Any cos_m_ginitWith__pmFltVector__Int;
+extern struct Any cos_m_ginitWith__pmFltVector__Range;
+extern struct Any cos_m_ginitWith__pmFltVector__Slice;
+extern struct Any cos_m_ginitWith__pmFltVector__VectorExpr;
+extern struct Any cos_m_ginitWith__pmFltVector__XRange;
+extern struct Any cos_m_ginitWith__pmIntVector__Int;
+extern struct Any cos_m_ginitWith__pmIntVector__IntVector;
+extern struct Any cos_m_ginitWith__pmIntVector__Range;
+extern struct Any cos_m_ginitWith__pmIntVector__Slice;
+extern struct Any cos_m_ginitWith__pmIntVector__VectorExpr;
+extern struct Any cos_m_ginitWith__pmIntVector__XRange;
+extern struct Any cos_m_ginitWith__pmLngVector__Int;
+extern struct Any cos_m_ginitWith__pmLngVector__LngVector;
+extern struct Any cos_m_ginitWith__pmLngVector__Range;
+extern struct Any cos_m_ginitWith__pmLngVector__Slice;
+extern struct Any cos_m_ginitWith__pmLngVector__VectorExpr;
+extern struct Any cos_m_ginitWith__pmLngVector__XRange;
+extern struct Any cos_m_ginitWith__pmNumber__Char;
+extern struct Any cos_m_ginitWith__pmNumber__Complex;
+extern struct Any cos_m_ginitWith__pmNumber__Float;
+extern struct Any cos_m_ginitWith__pmNumber__Int;
+extern struct Any cos_m_ginitWith__pmNumber__Long;
+extern struct Any cos_m_ginitWith__pmNumber__Short;
+extern struct Any cos_m_ginitWith__pmShtVector__Int;
+extern struct Any cos_m_ginitWith__pmShtVector__Range;
+extern struct Any cos_m_ginitWith__pmShtVector__ShtVector;
+extern struct Any cos_m_ginitWith__pmShtVector__Slice;
+extern struct Any cos_m_ginitWith__pmShtVector__VectorExpr;
+extern struct Any cos_m_ginitWith__pmShtVector__XRange;
+extern struct Any cos_m_ginitWith__pmString__Int;
+extern struct Any cos_m_ginitWith__pmString__String;
+extern struct Any cos_m_ginitWith2__ArraySubView__Array__Range;
+extern struct Any cos_m_ginitWith2__ArraySubView__Array__Slice;
+extern struct Any cos_m_ginitWith2__ArrayView__Array__Range;
+extern struct Any cos_m_ginitWith2__ArrayView__Array__Slice;
+extern struct Any cos_m_ginitWith2__Complex__Float__Float;
+extern struct Any cos_m_ginitWith2__mSubView__Array__Range;
+extern struct Any cos_m_ginitWith2__mSubView__Array__Slice;
+extern struct Any cos_m_ginitWith2__mSubView__ChrVector__Range;
+extern struct Any cos_m_ginitWith2__mSubView__ChrVector__Slice;
+extern struct Any cos_m_ginitWith2__mSubView__CpxVector__Range;
+extern struct Any cos_m_ginitWith2__mSubView__CpxVector__Slice;
+extern struct Any cos_m_ginitWith2__mSubView__FltVector__Range;
+extern struct Any cos_m_ginitWith2__mSubView__FltVector__Slice;
+extern struct Any cos_m_ginitWith2__mSubView__IntVector__Range;
+extern struct Any cos_m_ginitWith2__mSubView__IntVector__Slice;
+extern struct Any cos_m_ginitWith2__mSubView__LngVector__Range;
+extern struct Any cos_m_ginitWith2__mSubView__LngVector__Slice;
+extern struct Any cos_m_ginitWith2__mSubView__ShtVector__Range;
+extern struct Any cos_m_ginitWith2__mSubView__ShtVector__Slice;
+extern struct Any cos_m_ginitWith2__mView__Array__Range;
+extern struct Any cos_m_ginitWith2__mView__Array__Slice;
+extern struct Any cos_m_ginitWith2__mView__ChrVector__Range;
+extern struct Any cos_m_ginitWith2__mView__ChrVector__Slice;
+extern struct Any cos_m_ginitWith2__mView__CpxVector__Range;
+extern struct Any cos_m_ginitWith2__mView__CpxVector__Slice;
+extern struct Any cos_m_ginitWith2__mView__FltVector__Range;
+extern struct Any cos_m_ginitWith2__mView__FltVector__Slice;
+extern struct Any cos_m_ginitWith2__mView__IntVector__Range;
+extern struct Any cos_m_ginitWith2__mView__IntVector__Slice;
+extern struct Any cos_m_ginitWith2__mView__LngVector__Range;
+extern struct Any cos_m_ginitWith2__mView__LngVector__Slice;
+extern struct Any cos_m_ginitWith2__mView__ShtVector__Range;
+extern struct Any cos_m_ginitWith2__mView__ShtVector__Slice;
+extern struct Any cos_m_ginitWith2__pmArray__Array__IntVector;
+extern struct Any cos_m_ginitWith2__pmArray__Array__Range;
+extern struct Any cos_m_ginitWith2__pmArray__Array__Slice;
+extern struct Any cos_m_ginitWith2__pmArray__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmArray__Int__Object;
+extern struct Any cos_m_ginitWith2__pmChrVector__ChrVector__IntVector;
+extern struct Any cos_m_ginitWith2__pmChrVector__ChrVector__Range;
+extern struct Any cos_m_ginitWith2__pmChrVector__ChrVector__Slice;
+extern struct Any cos_m_ginitWith2__pmChrVector__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmChrVector__Int__Object;
+extern struct Any cos_m_ginitWith2__pmCpxVector__CpxVector__IntVector;
+extern struct Any cos_m_ginitWith2__pmCpxVector__CpxVector__Range;
+extern struct Any cos_m_ginitWith2__pmCpxVector__CpxVector__Slice;
+extern struct Any cos_m_ginitWith2__pmCpxVector__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmCpxVector__Int__Object;
+extern struct Any cos_m_ginitWith2__pmFltVector__FltVector__IntVector;
+extern struct Any cos_m_ginitWith2__pmFltVector__FltVector__Range;
+extern struct Any cos_m_ginitWith2__pmFltVector__FltVector__Slice;
+extern struct Any cos_m_ginitWith2__pmFltVector__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmFltVector__Int__Object;
+extern struct Any cos_m_ginitWith2__pmIntVector__IntVector__IntVector;
+extern struct Any cos_m_ginitWith2__pmIntVector__IntVector__Range;
+extern struct Any cos_m_ginitWith2__pmIntVector__IntVector__Slice;
+extern struct Any cos_m_ginitWith2__pmIntVector__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmIntVector__Int__Object;
+extern struct Any cos_m_ginitWith2__pmLngVector__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmLngVector__Int__Object;
+extern struct Any cos_m_ginitWith2__pmLngVector__LngVector__IntVector;
+extern struct Any cos_m_ginitWith2__pmLngVector__LngVector__Range;
+extern struct Any cos_m_ginitWith2__pmLngVector__LngVector__Slice;
+extern struct Any cos_m_ginitWith2__pmShtVector__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmShtVector__Int__Object;
+extern struct Any cos_m_ginitWith2__pmShtVector__ShtVector__IntVector;
+extern struct Any cos_m_ginitWith2__pmShtVector__ShtVector__Range;
+extern struct Any cos_m_ginitWith2__pmShtVector__ShtVector__Slice;
+extern struct Any cos_m_ginitWith2__pmString__Int__Functor;
+extern struct Any cos_m_ginitWith2__pmString__Int__Object;
+extern struct Any cos_m_ginitWith2__pmString__String__IntVector;
+extern struct Any cos_m_ginitWith2__pmString__String__Range;
+extern struct Any cos_m_ginitWith2__pmString__String__Slice;
+extern struct Any cos_m_ginitWith3__ChrVectorView__ChrVector__Slice__Int;
+extern struct Any cos_m_ginitWith3__CpxVectorView__CpxVector__Slice__Int;
+extern struct Any cos_m_ginitWith3__FltVectorView__FltVector__Slice__Int;
+extern struct Any cos_m_ginitWith3__IntVectorView__IntVector__Slice__Int;
+extern struct Any cos_m_ginitWith3__LngVectorView__LngVector__Slice__Int;
+extern struct Any cos_m_ginitWith3__ShtVectorView__ShtVector__Slice__Int;
+extern struct Any cos_m_ginitWithChr__Char;
+extern struct Any cos_m_ginitWithChrPtr__pmChrVector;
+extern struct Any cos_m_ginitWithChrPtr__pmString;
+extern struct Any cos_m_ginitWithCpx__Complex;
+extern struct Any cos_m_ginitWithCpxPtr__pmCpxVector;
+extern struct Any cos_m_ginitWithFILE__InputFile__String;
+extern struct Any cos_m_ginitWithFILE__OutputFile__String;
+extern struct Any cos_m_ginitWithFlt__Float;
+extern struct Any cos_m_ginitWithFltPtr__pmFltVector;
+extern struct Any cos_m_ginitWithFun0__pmFunctor;
+extern struct Any cos_m_ginitWithFun1__pmFunctor;
+extern struct Any cos_m_ginitWithFun2__pmFunctor;
+extern struct Any cos_m_ginitWithFun3__pmFunctor;
+extern struct Any cos_m_ginitWithFun4__pmFunctor;
+extern struct Any cos_m_ginitWithFun5__pmFunctor;
+extern struct Any cos_m_ginitWithFun6__pmFunctor;
+extern struct Any cos_m_ginitWithFun7__pmFunctor;
+extern struct Any cos_m_ginitWithFun8__pmFunctor;
+extern struct Any cos_m_ginitWithFun9__pmFunctor;
+extern struct Any cos_m_ginitWithInt__Int;
+extern struct Any cos_m_ginitWithIntPtr__pmIntVector;
+extern struct Any cos_m_ginitWithLng__Long;
+extern struct Any cos_m_ginitWithLngPtr__pmLngVector;
+extern struct Any cos_m_ginitWithLoc__Tracer__Object;
+extern struct Any cos_m_ginitWithSht__Short;
+extern struct Any cos_m_ginitWithShtPtr__pmShtVector;
+extern struct Any cos_m_ginitWithStr__pmString;
+extern struct Any cos_m_ginitialize__Any__a__219StdioInit;
+extern struct Any cos_m_ginsertAt__ChrVectorDyn__Int__Object;
+extern struct Any cos_m_ginsertAt__ChrVectorDyn__Range__Object;
+extern struct Any cos_m_ginsertAt__ChrVectorDyn__Slice__ChrVector;
+extern struct Any cos_m_ginsertAt__ChrVectorDyn__Slice__Object;
+extern struct Any cos_m_ginsertAt__CpxVectorDyn__Int__Object;
+extern struct Any cos_m_ginsertAt__CpxVectorDyn__Range__Object;
+extern struct Any cos_m_ginsertAt__CpxVectorDyn__Slice__CpxVector;
+extern struct Any cos_m_ginsertAt__CpxVectorDyn__Slice__Object;
+extern struct Any cos_m_ginsertAt__FltVectorDyn__Int__Object;
+extern struct Any cos_m_ginsertAt__FltVectorDyn__Range__Object;
+extern struct Any cos_m_ginsertAt__FltVectorDyn__Slice__FltVector;
+extern struct Any cos_m_ginsertAt__FltVectorDyn__Slice__Object;
+extern struct Any cos_m_ginsertAt__IntVectorDyn__Int__Object;
+extern struct Any cos_m_ginsertAt__IntVectorDyn__Range__Object;
+extern struct Any cos_m_ginsertAt__IntVectorDyn__Slice__IntVector;
+extern struct Any cos_m_ginsertAt__IntVectorDyn__Slice__Object;
+extern struct Any cos_m_ginsertAt__LngVectorDyn__Int__Object;
+extern struct Any cos_m_ginsertAt__LngVectorDyn__Range__Object;
+extern struct Any cos_m_ginsertAt__LngVectorDyn__Slice__LngVector;
+extern struct Any cos_m_ginsertAt__LngVectorDyn__Slice__Object;
+extern struct Any cos_m_ginsertAt__ShtVectorDyn__Int__Object;
+extern struct Any cos_m_ginsertAt__ShtVectorDyn__Range__Object;
+extern struct Any cos_m_ginsertAt__ShtVectorDyn__Slice__Object;
+extern struct Any cos_m_ginsertAt__ShtVectorDyn__Slice__ShtVector;
+extern struct Any cos_m_gint__Int;
+extern struct Any cos_m_gint__mFalse;
+extern struct Any cos_m_gint__mTrue;
+extern struct Any cos_m_gint__mTrueFalse;
+extern struct Any cos_m_gintAt__ChrVector__Int;
+extern struct Any cos_m_gintAt__IntVector__Int;
+extern struct Any cos_m_gintAt__ShtVector__Int;
+extern struct Any cos_m_gintPtr__IntVector;
+extern struct Any cos_m_gintersect__Array__Collection__Functor;
+extern struct Any cos_m_ginv__Floating;
+extern struct Any cos_m_ginv__FloatingVector;
+extern struct Any cos_m_ginv__VectorExpr;
+extern struct Any cos_m_ginvariant__Array;
+extern struct Any cos_m_ginvariant__ArrayDyn;
+extern struct Any cos_m_ginvariant__ArrayView;
+extern struct Any cos_m_ginvariant__ChrVectorDyn;
+extern struct Any cos_m_ginvariant__ChrVectorView;
+extern struct Any cos_m_ginvariant__CpxVectorDyn;
+extern struct Any cos_m_ginvariant__CpxVectorView;
+extern struct Any cos_m_ginvariant__FltVectorDyn;
+extern struct Any cos_m_ginvariant__FltVectorView;
+extern struct Any cos_m_ginvariant__IntVectorDyn;
+extern struct Any cos_m_ginvariant__IntVectorView;
+extern struct Any cos_m_ginvariant__LngVectorDyn;
+extern struct Any cos_m_ginvariant__LngVectorView;
+extern struct Any cos_m_ginvariant__ShtVectorDyn;
+extern struct Any cos_m_ginvariant__ShtVectorView;
+extern struct Any cos_m_ginvariant__StringDyn;
+extern struct Any cos_m_ginvert__Complex;
+extern struct Any cos_m_ginvert__CpxVector;
+extern struct Any cos_m_ginvert__Float;
+extern struct Any cos_m_ginvert__FltVector;
+extern struct Any cos_m_gisAlnum__Char;
+extern struct Any cos_m_gisAlpha__Char;
+extern struct Any cos_m_gisBlank__Char;
+extern struct Any cos_m_gisCntrl__Char;
+extern struct Any cos_m_gisDigit__Char;
+extern struct Any cos_m_gisEmpty__Array;
+extern struct Any cos_m_gisEmpty__ChrVector;
+extern struct Any cos_m_gisEmpty__CpxVector;
+extern struct Any cos_m_gisEmpty__FltVector;
+extern struct Any cos_m_gisEmpty__InputFile;
+extern struct Any cos_m_gisEmpty__IntVector;
+extern struct Any cos_m_gisEmpty__LngVector;
+extern struct Any cos_m_gisEmpty__OutputFile;
+extern struct Any cos_m_gisEmpty__ShtVector;
+extern struct Any cos_m_gisEmpty__String;
+extern struct Any cos_m_gisEqual__Array__Array;
+extern struct Any cos_m_gisEqual__ChrVector__ChrVector;
+extern struct Any cos_m_gisEqual__Class__Class;
+extern struct Any cos_m_gisEqual__Complex__Complex;
+extern struct Any cos_m_gisEqual__Complex__Float;
+extern struct Any cos_m_gisEqual__Complex__Int;
+extern struct Any cos_m_gisEqual__Complex__Long;
+extern struct Any cos_m_gisEqual__CpxVector__CpxVector;
+extern struct Any cos_m_gisEqual__Float__Complex;
+extern struct Any cos_m_gisEqual__Float__Float;
+extern struct Any cos_m_gisEqual__Float__Int;
+extern struct Any cos_m_gisEqual__Float__Long;
+extern struct Any cos_m_gisEqual__FltVector__FltVector;
+extern struct Any cos_m_gisEqual__IntVector__IntVector;
+extern struct Any cos_m_gisEqual__Int__Complex;
+extern struct Any cos_m_gisEqual__Int__Float;
+extern struct Any cos_m_gisEqual__Int__Int;
+extern struct Any cos_m_gisEqual__Int__Long;
+extern struct Any cos_m_gisEqual__LngVector__LngVector;
+extern struct Any cos_m_gisEqual__Long__Complex;
+extern struct Any cos_m_gisEqual__Long__Float;
+extern struct Any cos_m_gisEqual__Long__Int;
+extern struct Any cos_m_gisEqual__Long__Long;
+extern struct Any cos_m_gisEqual__Range__Range;
+extern struct Any cos_m_gisEqual__ShtVector__ShtVector;
+extern struct Any cos_m_gisEqual__Slice__Slice;
+extern struct Any cos_m_gisEqual__String__String;
+extern struct Any cos_m_gisEqual__XRange__XRange;
+extern struct Any cos_m_gisEqual__mFalse__mFalse;
+extern struct Any cos_m_gisEqual__mTrueFalse__mTrue;
+extern struct Any cos_m_gisEqual__mTrueFalse__mTrueFalse;
+extern struct Any cos_m_gisEqual__mTrue__mTrueFalse;
+extern struct Any cos_m_gisGraph__Char;
+extern struct Any cos_m_gisGreater__Number__Number;
+extern struct Any cos_m_gisGreaterOrEqual__Number__Number;
+extern struct Any cos_m_gisLesser__Number__Number;
+extern struct Any cos_m_gisLesserOrEqual__Number__Number;
+extern struct Any cos_m_gisLower__Char;
+extern struct Any cos_m_gisNotEqual__Number__Number;
+extern struct Any cos_m_gisNotEqual__mFalse__mTrueFalse;
+extern struct Any cos_m_gisNotEqual__mTrueFalse__mFalse;
+extern struct Any cos_m_gisNotEqual__mTrueFalse__mTrueFalse;
+extern struct Any cos_m_gisNotEqual__mTrue__mTrue;
+extern struct Any cos_m_gisPrint__Char;
+extern struct Any cos_m_gisPunct__Char;
+extern struct Any cos_m_gisSorted__Array__Functor;
+extern struct Any cos_m_gisSorted__ChrVector__Functor;
+extern struct Any cos_m_gisSorted__CpxVector__Functor;
+extern struct Any cos_m_gisSorted__FltVector__Functor;
+extern struct Any cos_m_gisSorted__IntVector__Functor;
+extern struct Any cos_m_gisSorted__LngVector__Functor;
+extern struct Any cos_m_gisSorted__ShtVector__Functor;
+extern struct Any cos_m_gisSpace__Char;
+extern struct Any cos_m_gisUpper__Char;
+extern struct Any cos_m_gisXDigit__Char;
+extern struct Any cos_m_gisort__Array__Functor;
+extern struct Any cos_m_gisort__ChrVector__Functor;
+extern struct Any cos_m_gisort__ChrVector__IntFunction2;
+extern struct Any cos_m_gisort__ChrVector__pmGreater;
+extern struct Any cos_m_gisort__ChrVector__pmLesser;
+extern struct Any cos_m_gisort__CpxVector__Functor;
+extern struct Any cos_m_gisort__FltVector__FltFunction2;
+extern struct Any cos_m_gisort__FltVector__Functor;
+extern struct Any cos_m_gisort__FltVector__pmGreater;
+extern struct Any cos_m_gisort__FltVector__pmLesser;
+extern struct Any cos_m_gisort__IntVector__Functor;
+extern struct Any cos_m_gisort__IntVector__IntFunction2;
+extern struct Any cos_m_gisort__IntVector__pmGreater;
+extern struct Any cos_m_gisort__IntVector__pmLesser;
+extern struct Any cos_m_gisort__LngVector__Functor;
+extern struct Any cos_m_gisort__LngVector__LngFunction2;
+extern struct Any cos_m_gisort__LngVector__pmGreater;
+extern struct Any cos_m_gisort__LngVector__pmLesser;
+extern struct Any cos_m_gisort__ShtVector__Functor;
+extern struct Any cos_m_gisort__ShtVector__IntFunction2;
+extern struct Any cos_m_gisort__ShtVector__pmGreater;
+extern struct Any cos_m_gisort__ShtVector__pmLesser;
+extern struct Any cos_m_glast__Array;
+extern struct Any cos_m_glast__ChrVector;
+extern struct Any cos_m_glast__CpxVector;
+extern struct Any cos_m_glast__FltVector;
+extern struct Any cos_m_glast__IntVector;
+extern struct Any cos_m_glast__LngVector;
+extern struct Any cos_m_glast__ShtVector;
+extern struct Any cos_m_glast__String;
+extern struct Any cos_m_glng__Int;
+extern struct Any cos_m_glng__Long;
+extern struct Any cos_m_glngAt__ChrVector__Int;
+extern struct Any cos_m_glngAt__IntVector__Int;
+extern struct Any cos_m_glngAt__LngVector__Int;
+extern struct Any cos_m_glngAt__ShtVector__Int;
+extern struct Any cos_m_glngPtr__LngVector;
+extern struct Any cos_m_glog__Floating;
+extern struct Any cos_m_glog__FloatingVector;
+extern struct Any cos_m_glogarithm__Complex;
+extern struct Any cos_m_glogarithm__CpxVector;
+extern struct Any cos_m_glogarithm__Float;
+extern struct Any cos_m_glogarithm__FltVector;
+extern struct Any cos_m_gmap__CpxFunction1__CpxVector;
+extern struct Any cos_m_gmap__FltFunction1__FltVector;
+extern struct Any cos_m_gmap__FltFunction1__XRange;
+extern struct Any cos_m_gmap__Functor__Array;
+extern struct Any cos_m_gmap__Functor__ChrVector;
+extern struct Any cos_m_gmap__Functor__CpxVector;
+extern struct Any cos_m_gmap__Functor__FltVector;
+extern struct Any cos_m_gmap__Functor__IntVector;
+extern struct Any cos_m_gmap__Functor__LngVector;
+extern struct Any cos_m_gmap__Functor__Range;
+extern struct Any cos_m_gmap__Functor__ShtVector;
+extern struct Any cos_m_gmap__Functor__Slice;
+extern struct Any cos_m_gmap__Functor__String;
+extern struct Any cos_m_gmap__Functor__XRange;
+extern struct Any cos_m_gmap__IntFunction1__ChrVector;
+extern struct Any cos_m_gmap__IntFunction1__IntVector;
+extern struct Any cos_m_gmap__IntFunction1__Range;
+extern struct Any cos_m_gmap__IntFunction1__ShtVector;
+extern struct Any cos_m_gmap__IntFunction1__Slice;
+extern struct Any cos_m_gmap__LngFunction1__LngVector;
+extern struct Any cos_m_gmap__MsgExpr__Array;
+extern struct Any cos_m_gmap__MsgExpr__ChrVector;
+extern struct Any cos_m_gmap__MsgExpr__CpxVector;
+extern struct Any cos_m_gmap__MsgExpr__FltVector;
+extern struct Any cos_m_gmap__MsgExpr__IntVector;
+extern struct Any cos_m_gmap__MsgExpr__LngVector;
+extern struct Any cos_m_gmap__MsgExpr__ShtVector;
+extern struct Any cos_m_gmap2__CpxFunction2__CpxVector__CpxVector;
+extern struct Any cos_m_gmap2__FltFunction2__FltVector__FltVector;
+extern struct Any cos_m_gmap2__Functor__Array__Array;
+extern struct Any cos_m_gmap2__Functor__ChrVector__ChrVector;
+extern struct Any cos_m_gmap2__Functor__CpxVector__CpxVector;
+extern struct Any cos_m_gmap2__Functor__FltVector__FltVector;
+extern struct Any cos_m_gmap2__Functor__IntVector__IntVector;
+extern struct Any cos_m_gmap2__Functor__LngVector__LngVector;
+extern struct Any cos_m_gmap2__Functor__ShtVector__ShtVector;
+extern struct Any cos_m_gmap2__Functor__String__String;
+extern struct Any cos_m_gmap2__IntFunction2__ChrVector__ChrVector;
+extern struct Any cos_m_gmap2__IntFunction2__IntVector__IntVector;
+extern struct Any cos_m_gmap2__IntFunction2__ShtVector__ShtVector;
+extern struct Any cos_m_gmap2__LngFunction2__LngVector__LngVector;
+extern struct Any cos_m_gmap2__MsgExpr__Array__Array;
+extern struct Any cos_m_gmap2__MsgExpr__ChrVector__ChrVector;
+extern struct Any cos_m_gmap2__MsgExpr__CpxVector__CpxVector;
+extern struct Any cos_m_gmap2__MsgExpr__FltVector__FltVector;
+extern struct Any cos_m_gmap2__MsgExpr__IntVector__IntVector;
+extern struct Any cos_m_gmap2__MsgExpr__LngVector__LngVector;
+extern struct Any cos_m_gmap2__MsgExpr__ShtVector__ShtVector;
+extern struct Any cos_m_gmap3__CpxFunction3__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gmap3__FltFunction3__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gmap3__Functor__Array__Array__Array;
+extern struct Any cos_m_gmap3__Functor__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gmap3__Functor__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gmap3__Functor__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gmap3__Functor__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gmap3__Functor__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gmap3__Functor__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gmap3__Functor__String__String__String;
+extern struct Any cos_m_gmap3__IntFunction3__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gmap3__IntFunction3__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gmap3__IntFunction3__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gmap3__LngFunction3__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gmap4__CpxFunction4__CpxVector__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gmap4__FltFunction4__FltVector__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gmap4__Functor__Array__Array__Array__Array;
+extern struct Any cos_m_gmap4__Functor__ChrVector__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gmap4__Functor__CpxVector__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gmap4__Functor__FltVector__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gmap4__Functor__IntVector__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gmap4__Functor__LngVector__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gmap4__Functor__ShtVector__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gmap4__Functor__String__String__String__String;
+extern struct Any cos_m_gmap4__IntFunction4__ChrVector__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gmap4__IntFunction4__IntVector__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gmap4__IntFunction4__ShtVector__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gmap4__LngFunction4__LngVector__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gmapIf__Functor__Array;
+extern struct Any cos_m_gmapIf__Functor__ChrVector;
+extern struct Any cos_m_gmapIf__Functor__CpxVector;
+extern struct Any cos_m_gmapIf__Functor__FltVector;
+extern struct Any cos_m_gmapIf__Functor__IntVector;
+extern struct Any cos_m_gmapIf__Functor__LngVector;
+extern struct Any cos_m_gmapIf__Functor__ShtVector;
+extern struct Any cos_m_gmapIf__Functor__String;
+extern struct Any cos_m_gmapWhile__Functor__Array;
+extern struct Any cos_m_gmapWhile__Functor__ChrVector;
+extern struct Any cos_m_gmapWhile__Functor__CpxVector;
+extern struct Any cos_m_gmapWhile__Functor__FltVector;
+extern struct Any cos_m_gmapWhile__Functor__InputStream;
+extern struct Any cos_m_gmapWhile__Functor__IntVector;
+extern struct Any cos_m_gmapWhile__Functor__LngVector;
+extern struct Any cos_m_gmapWhile__Functor__ShtVector;
+extern struct Any cos_m_gmapWhile__Functor__String;
+extern struct Any cos_m_gmax__Number__Number;
+extern struct Any cos_m_gmerge__Array__Array__Functor;
+extern struct Any cos_m_gmin__Number__Number;
+extern struct Any cos_m_gminmax__FltVector;
+extern struct Any cos_m_gmod__IntegralVector__Integral;
+extern struct Any cos_m_gmod__Integral__Integral;
+extern struct Any cos_m_gmodulo__IntVector__IntVector;
+extern struct Any cos_m_gmodulo__IntVector__ShtVector;
+extern struct Any cos_m_gmodulo__Int__Int;
+extern struct Any cos_m_gmodulo__LngVector__IntVector;
+extern struct Any cos_m_gmodulo__LngVector__LngVector;
+extern struct Any cos_m_gmodulo__LngVector__ShtVector;
+extern struct Any cos_m_gmodulo__Long__Int;
+extern struct Any cos_m_gmodulo__Long__Long;
+extern struct Any cos_m_gmodulo__ShtVector__ShtVector;
+extern struct Any cos_m_gmul__FloatingVector__CpxVector;
+extern struct Any cos_m_gmul__Floating__Complex;
+extern struct Any cos_m_gmul__IntegralVector__FloatingVector;
+extern struct Any cos_m_gmul__IntegralVector__LngVector;
+extern struct Any cos_m_gmul__Integral__Floating;
+extern struct Any cos_m_gmul__Integral__Long;
+extern struct Any cos_m_gmul__Number__Number;
+extern struct Any cos_m_gmul__VectorExpr__Vector;
+extern struct Any cos_m_gmul__VectorExpr__VectorExpr;
+extern struct Any cos_m_gmul__Vector__Vector;
+extern struct Any cos_m_gmul__Vector__VectorExpr;
+extern struct Any cos_m_gmulAdd__Float__Complex__Floating;
+extern struct Any cos_m_gmulAdd__Float__Float__Complex;
+extern struct Any cos_m_gmulAdd__Floating__Floating__Floating;
+extern struct Any cos_m_gmulBy__Complex__Complex;
+extern struct Any cos_m_gmulBy__Complex__Float;
+extern struct Any cos_m_gmulBy__Complex__Int;
+extern struct Any cos_m_gmulBy__Complex__Long;
+extern struct Any cos_m_gmulBy__CpxVector__CpxVector;
+extern struct Any cos_m_gmulBy__CpxVector__FltVector;
+extern struct Any cos_m_gmulBy__CpxVector__IntVector;
+extern struct Any cos_m_gmulBy__CpxVector__LngVector;
+extern struct Any cos_m_gmulBy__CpxVector__ShtVector;
+extern struct Any cos_m_gmulBy__Float__Float;
+extern struct Any cos_m_gmulBy__Float__Int;
+extern struct Any cos_m_gmulBy__Float__Long;
+extern struct Any cos_m_gmulBy__FltVector__FltVector;
+extern struct Any cos_m_gmulBy__FltVector__IntVector;
+extern struct Any cos_m_gmulBy__FltVector__LngVector;
+extern struct Any cos_m_gmulBy__FltVector__ShtVector;
+extern struct Any cos_m_gmulBy__IntVector__IntVector;
+extern struct Any cos_m_gmulBy__IntVector__ShtVector;
+extern struct Any cos_m_gmulBy__Int__Int;
+extern struct Any cos_m_gmulBy__LngVector__IntVector;
+extern struct Any cos_m_gmulBy__LngVector__LngVector;
+extern struct Any cos_m_gmulBy__LngVector__ShtVector;
+extern struct Any cos_m_gmulBy__Long__Int;
+extern struct Any cos_m_gmulBy__Long__Long;
+extern struct Any cos_m_gmulBy__ShtVector__ShtVector;
+extern struct Any cos_m_gneg__Number;
+extern struct Any cos_m_gneg__Vector;
+extern struct Any cos_m_gneg__VectorExpr;
+extern struct Any cos_m_gneg__pmGreater;
+extern struct Any cos_m_gneg__pmLesser;
+extern struct Any cos_m_gneg__pmOrdered;
+extern struct Any cos_m_gnegate__Complex;
+extern struct Any cos_m_gnegate__CpxVector;
+extern struct Any cos_m_gnegate__Float;
+extern struct Any cos_m_gnegate__FltVector;
+extern struct Any cos_m_gnegate__Int;
+extern struct Any cos_m_gnegate__IntVector;
+extern struct Any cos_m_gnegate__LngVector;
+extern struct Any cos_m_gnegate__Long;
+extern struct Any cos_m_gnegate__ShtVector;
+extern struct Any cos_m_gnegate__pmGreater;
+extern struct Any cos_m_gnegate__pmLesser;
+extern struct Any cos_m_gnegate__pmOrdered;
+extern struct Any cos_m_gnew__pmArray;
+extern struct Any cos_m_gnew__pmChrVector;
+extern struct Any cos_m_gnew__pmCpxVector;
+extern struct Any cos_m_gnew__pmFltVector;
+extern struct Any cos_m_gnew__pmIntVector;
+extern struct Any cos_m_gnew__pmLngVector;
+extern struct Any cos_m_gnew__pmShtVector;
+extern struct Any cos_m_gnew__pmString;
+extern struct Any cos_m_gnewRng__pmRange;
+extern struct Any cos_m_gnewSlc__pmSlice;
+extern struct Any cos_m_gnewWith__pmArray__Array;
+extern struct Any cos_m_gnewWith__pmArray__Int;
+extern struct Any cos_m_gnewWith__pmArray__Range;
+extern struct Any cos_m_gnewWith__pmArray__Slice;
+extern struct Any cos_m_gnewWith__pmArray__XRange;
+extern struct Any cos_m_gnewWith__pmChrVector__ChrVector;
+extern struct Any cos_m_gnewWith__pmChrVector__Int;
+extern struct Any cos_m_gnewWith__pmChrVector__Range;
+extern struct Any cos_m_gnewWith__pmChrVector__Slice;
+extern struct Any cos_m_gnewWith__pmChrVector__XRange;
+extern struct Any cos_m_gnewWith__pmCpxVector__CpxVector;
+extern struct Any cos_m_gnewWith__pmCpxVector__Int;
+extern struct Any cos_m_gnewWith__pmCpxVector__Range;
+extern struct Any cos_m_gnewWith__pmCpxVector__Slice;
+extern struct Any cos_m_gnewWith__pmCpxVector__VectorExpr;
+extern struct Any cos_m_gnewWith__pmCpxVector__XRange;
+extern struct Any cos_m_gnewWith__pmFltVector__FltVector;
+extern struct Any cos_m_gnewWith__pmFltVector__Int;
+extern struct Any cos_m_gnewWith__pmFltVector__Range;
+extern struct Any cos_m_gnewWith__pmFltVector__Slice;
+extern struct Any cos_m_gnewWith__pmFltVector__VectorExpr;
+extern struct Any cos_m_gnewWith__pmFltVector__XRange;
+extern struct Any cos_m_gnewWith__pmIntVector__Int;
+extern struct Any cos_m_gnewWith__pmIntVector__IntVector;
+extern struct Any cos_m_gnewWith__pmIntVector__Range;
+extern struct Any cos_m_gnewWith__pmIntVector__Slice;
+extern struct Any cos_m_gnewWith__pmIntVector__VectorExpr;
+extern struct Any cos_m_gnewWith__pmIntVector__XRange;
+extern struct Any cos_m_gnewWith__pmLngVector__Int;
+extern struct Any cos_m_gnewWith__pmLngVector__LngVector;
+extern struct Any cos_m_gnewWith__pmLngVector__Range;
+extern struct Any cos_m_gnewWith__pmLngVector__Slice;
+extern struct Any cos_m_gnewWith__pmLngVector__VectorExpr;
+extern struct Any cos_m_gnewWith__pmLngVector__XRange;
+extern struct Any cos_m_gnewWith__pmNumber__Char;
+extern struct Any cos_m_gnewWith__pmNumber__Complex;
+extern struct Any cos_m_gnewWith__pmNumber__Float;
+extern struct Any cos_m_gnewWith__pmNumber__Int;
+extern struct Any cos_m_gnewWith__pmNumber__Long;
+extern struct Any cos_m_gnewWith__pmNumber__Short;
+extern struct Any cos_m_gnewWith__pmShtVector__Int;
+extern struct Any cos_m_gnewWith__pmShtVector__Range;
+extern struct Any cos_m_gnewWith__pmShtVector__ShtVector;
+extern struct Any cos_m_gnewWith__pmShtVector__Slice;
+extern struct Any cos_m_gnewWith__pmShtVector__VectorExpr;
+extern struct Any cos_m_gnewWith__pmShtVector__XRange;
+extern struct Any cos_m_gnewWith__pmString__Int;
+extern struct Any cos_m_gnewWith__pmString__String;
+extern struct Any cos_m_gnewWith2__mSubView__Array__Range;
+extern struct Any cos_m_gnewWith2__mSubView__Array__Slice;
+extern struct Any cos_m_gnewWith2__mSubView__ChrVector__Range;
+extern struct Any cos_m_gnewWith2__mSubView__ChrVector__Slice;
+extern struct Any cos_m_gnewWith2__mSubView__CpxVector__Range;
+extern struct Any cos_m_gnewWith2__mSubView__CpxVector__Slice;
+extern struct Any cos_m_gnewWith2__mSubView__FltVector__Range;
+extern struct Any cos_m_gnewWith2__mSubView__FltVector__Slice;
+extern struct Any cos_m_gnewWith2__mSubView__IntVector__Range;
+extern struct Any cos_m_gnewWith2__mSubView__IntVector__Slice;
+extern struct Any cos_m_gnewWith2__mSubView__LngVector__Range;
+extern struct Any cos_m_gnewWith2__mSubView__LngVector__Slice;
+extern struct Any cos_m_gnewWith2__mSubView__ShtVector__Range;
+extern struct Any cos_m_gnewWith2__mSubView__ShtVector__Slice;
+extern struct Any cos_m_gnewWith2__mView__Array__Range;
+extern struct Any cos_m_gnewWith2__mView__Array__Slice;
+extern struct Any cos_m_gnewWith2__mView__ChrVector__Range;
+extern struct Any cos_m_gnewWith2__mView__ChrVector__Slice;
+extern struct Any cos_m_gnewWith2__mView__CpxVector__Range;
+extern struct Any cos_m_gnewWith2__mView__CpxVector__Slice;
+extern struct Any cos_m_gnewWith2__mView__FltVector__Range;
+extern struct Any cos_m_gnewWith2__mView__FltVector__Slice;
+extern struct Any cos_m_gnewWith2__mView__IntVector__Range;
+extern struct Any cos_m_gnewWith2__mView__IntVector__Slice;
+extern struct Any cos_m_gnewWith2__mView__LngVector__Range;
+extern struct Any cos_m_gnewWith2__mView__LngVector__Slice;
+extern struct Any cos_m_gnewWith2__mView__ShtVector__Range;
+extern struct Any cos_m_gnewWith2__mView__ShtVector__Slice;
+extern struct Any cos_m_gnewWith2__pmArray__Array__IntVector;
+extern struct Any cos_m_gnewWith2__pmArray__Array__Range;
+extern struct Any cos_m_gnewWith2__pmArray__Array__Slice;
+extern struct Any cos_m_gnewWith2__pmArray__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmArray__Int__Object;
+extern struct Any cos_m_gnewWith2__pmChrVector__ChrVector__IntVector;
+extern struct Any cos_m_gnewWith2__pmChrVector__ChrVector__Range;
+extern struct Any cos_m_gnewWith2__pmChrVector__ChrVector__Slice;
+extern struct Any cos_m_gnewWith2__pmChrVector__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmChrVector__Int__Object;
+extern struct Any cos_m_gnewWith2__pmCpxVector__CpxVector__IntVector;
+extern struct Any cos_m_gnewWith2__pmCpxVector__CpxVector__Range;
+extern struct Any cos_m_gnewWith2__pmCpxVector__CpxVector__Slice;
+extern struct Any cos_m_gnewWith2__pmCpxVector__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmCpxVector__Int__Object;
+extern struct Any cos_m_gnewWith2__pmFltVector__FltVector__IntVector;
+extern struct Any cos_m_gnewWith2__pmFltVector__FltVector__Range;
+extern struct Any cos_m_gnewWith2__pmFltVector__FltVector__Slice;
+extern struct Any cos_m_gnewWith2__pmFltVector__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmFltVector__Int__Object;
+extern struct Any cos_m_gnewWith2__pmIntVector__IntVector__IntVector;
+extern struct Any cos_m_gnewWith2__pmIntVector__IntVector__Range;
+extern struct Any cos_m_gnewWith2__pmIntVector__IntVector__Slice;
+extern struct Any cos_m_gnewWith2__pmIntVector__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmIntVector__Int__Object;
+extern struct Any cos_m_gnewWith2__pmLngVector__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmLngVector__Int__Object;
+extern struct Any cos_m_gnewWith2__pmLngVector__LngVector__IntVector;
+extern struct Any cos_m_gnewWith2__pmLngVector__LngVector__Range;
+extern struct Any cos_m_gnewWith2__pmLngVector__LngVector__Slice;
+extern struct Any cos_m_gnewWith2__pmShtVector__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmShtVector__Int__Object;
+extern struct Any cos_m_gnewWith2__pmShtVector__ShtVector__IntVector;
+extern struct Any cos_m_gnewWith2__pmShtVector__ShtVector__Range;
+extern struct Any cos_m_gnewWith2__pmShtVector__ShtVector__Slice;
+extern struct Any cos_m_gnewWith2__pmString__Int__Functor;
+extern struct Any cos_m_gnewWith2__pmString__Int__Object;
+extern struct Any cos_m_gnewWith2__pmString__String__IntVector;
+extern struct Any cos_m_gnewWith2__pmString__String__Range;
+extern struct Any cos_m_gnewWith2__pmString__String__Slice;
+extern struct Any cos_m_gnewWithStr__pmString;
+extern struct Any cos_m_gnewXRng__pmXRange;
+extern struct Any cos_m_gnorm2__CpxVector;
+extern struct Any cos_m_gnorm2__FltVector;
+extern struct Any cos_m_gnot__mFalse;
+extern struct Any cos_m_gnot__mTrue;
+extern struct Any cos_m_gnot__mTrueFalse;
+extern struct Any cos_m_gobjPtr__Array;
+extern struct Any cos_m_gor__mFalse__mFalse;
+extern struct Any cos_m_gor__mTrueFalse__mTrue;
+extern struct Any cos_m_gor__mTrueFalse__mTrueFalse;
+extern struct Any cos_m_gor__mTrue__mTrueFalse;
+extern struct Any cos_m_gpermute__Array__IntVector;
+extern struct Any cos_m_gpermute__ChrVector__IntVector;
+extern struct Any cos_m_gpermute__CpxVector__IntVector;
+extern struct Any cos_m_gpermute__FltVector__IntVector;
+extern struct Any cos_m_gpermute__IntVector__IntVector;
+extern struct Any cos_m_gpermute__LngVector__IntVector;
+extern struct Any cos_m_gpermute__ShtVector__IntVector;
+extern struct Any cos_m_gpop__ArrayDyn;
+extern struct Any cos_m_gpop__ChrVectorDyn;
+extern struct Any cos_m_gpop__CpxVectorDyn;
+extern struct Any cos_m_gpop__FltVectorDyn;
+extern struct Any cos_m_gpop__IntVectorDyn;
+extern struct Any cos_m_gpop__LngVectorDyn;
+extern struct Any cos_m_gpop__ShtVectorDyn;
+extern struct Any cos_m_gpop__StringDyn;
+extern struct Any cos_m_gpopBack__ArrayDyn;
+extern struct Any cos_m_gpopBack__ChrVectorDyn;
+extern struct Any cos_m_gpopBack__CpxVectorDyn;
+extern struct Any cos_m_gpopBack__FltVectorDyn;
+extern struct Any cos_m_gpopBack__IntVectorDyn;
+extern struct Any cos_m_gpopBack__LngVectorDyn;
+extern struct Any cos_m_gpopBack__ShtVectorDyn;
+extern struct Any cos_m_gpopBack__StringDyn;
+extern struct Any cos_m_gpopFront__ArrayDyn;
+extern struct Any cos_m_gpopFront__ChrVectorDyn;
+extern struct Any cos_m_gpopFront__CpxVectorDyn;
+extern struct Any cos_m_gpopFront__FltVectorDyn;
+extern struct Any cos_m_gpopFront__IntVectorDyn;
+extern struct Any cos_m_gpopFront__LngVectorDyn;
+extern struct Any cos_m_gpopFront__ShtVectorDyn;
+extern struct Any cos_m_gpopFront__StringDyn;
+extern struct Any cos_m_gpow__FloatingVector__Floating;
+extern struct Any cos_m_gpow__FloatingVector__Int;
+extern struct Any cos_m_gpow__Floating__Floating;
+extern struct Any cos_m_gpow__Floating__Int;
+extern struct Any cos_m_gpower__Complex__Complex;
+extern struct Any cos_m_gpower__Complex__Float;
+extern struct Any cos_m_gpower__Complex__Int;
+extern struct Any cos_m_gpower__CpxVector__Floating;
+extern struct Any cos_m_gpower__CpxVector__Int;
+extern struct Any cos_m_gpower__Float__Float;
+extern struct Any cos_m_gpower__Float__Int;
+extern struct Any cos_m_gpower__FltVector__Float;
+extern struct Any cos_m_gpower__FltVector__Int;
+extern struct Any cos_m_gprepend__ArrayDyn__Array;
+extern struct Any cos_m_gprepend__ArrayDyn__Object;
+extern struct Any cos_m_gprepend__ChrVectorDyn__Char;
+extern struct Any cos_m_gprepend__ChrVectorDyn__ChrVector;
+extern struct Any cos_m_gprepend__ChrVectorDyn__Object;
+extern struct Any cos_m_gprepend__CpxVectorDyn__Complex;
+extern struct Any cos_m_gprepend__CpxVectorDyn__CpxVector;
+extern struct Any cos_m_gprepend__CpxVectorDyn__Object;
+extern struct Any cos_m_gprepend__FltVectorDyn__Float;
+extern struct Any cos_m_gprepend__FltVectorDyn__FltVector;
+extern struct Any cos_m_gprepend__FltVectorDyn__Object;
+extern struct Any cos_m_gprepend__IntVectorDyn__Int;
+extern struct Any cos_m_gprepend__IntVectorDyn__IntVector;
+extern struct Any cos_m_gprepend__IntVectorDyn__Object;
+extern struct Any cos_m_gprepend__LngVectorDyn__LngVector;
+extern struct Any cos_m_gprepend__LngVectorDyn__Long;
+extern struct Any cos_m_gprepend__LngVectorDyn__Object;
+extern struct Any cos_m_gprepend__ShtVectorDyn__Object;
+extern struct Any cos_m_gprepend__ShtVectorDyn__Short;
+extern struct Any cos_m_gprepend__ShtVectorDyn__ShtVector;
+extern struct Any cos_m_gprepend__StringDyn__Char;
+extern struct Any cos_m_gprepend__StringDyn__Object;
+extern struct Any cos_m_gprepend__StringDyn__String;
+extern struct Any cos_m_gprod__CpxVector;
+extern struct Any cos_m_gprod__FltVector;
+extern struct Any cos_m_gpush__ArrayDyn__Object;
+extern struct Any cos_m_gpush__ChrVectorDyn__Char;
+extern struct Any cos_m_gpush__ChrVectorDyn__Object;
+extern struct Any cos_m_gpush__CpxVectorDyn__Complex;
+extern struct Any cos_m_gpush__CpxVectorDyn__Object;
+extern struct Any cos_m_gpush__FltVectorDyn__Float;
+extern struct Any cos_m_gpush__FltVectorDyn__Object;
+extern struct Any cos_m_gpush__IntVectorDyn__Int;
+extern struct Any cos_m_gpush__IntVectorDyn__Object;
+extern struct Any cos_m_gpush__LngVectorDyn__Long;
+extern struct Any cos_m_gpush__LngVectorDyn__Object;
+extern struct Any cos_m_gpush__ShtVectorDyn__Object;
+extern struct Any cos_m_gpush__ShtVectorDyn__Short;
+extern struct Any cos_m_gpush__StringDyn__Char;
+extern struct Any cos_m_gpush__StringDyn__Object;
+extern struct Any cos_m_gpushBack__ArrayDyn__Object;
+extern struct Any cos_m_gpushBack__ChrVectorDyn__Char;
+extern struct Any cos_m_gpushBack__ChrVectorDyn__Object;
+extern struct Any cos_m_gpushBack__CpxVectorDyn__Complex;
+extern struct Any cos_m_gpushBack__CpxVectorDyn__Object;
+extern struct Any cos_m_gpushBack__FltVectorDyn__Float;
+extern struct Any cos_m_gpushBack__FltVectorDyn__Object;
+extern struct Any cos_m_gpushBack__IntVectorDyn__Int;
+extern struct Any cos_m_gpushBack__IntVectorDyn__Object;
+extern struct Any cos_m_gpushBack__LngVectorDyn__Long;
+extern struct Any cos_m_gpushBack__LngVectorDyn__Object;
+extern struct Any cos_m_gpushBack__ShtVectorDyn__Object;
+extern struct Any cos_m_gpushBack__ShtVectorDyn__Short;
+extern struct Any cos_m_gpushBack__StringDyn__Char;
+extern struct Any cos_m_gpushBack__StringDyn__Object;
+extern struct Any cos_m_gpushFront__ArrayDyn__Object;
+extern struct Any cos_m_gpushFront__ChrVectorDyn__Char;
+extern struct Any cos_m_gpushFront__ChrVectorDyn__Object;
+extern struct Any cos_m_gpushFront__CpxVectorDyn__Complex;
+extern struct Any cos_m_gpushFront__CpxVectorDyn__Object;
+extern struct Any cos_m_gpushFront__FltVectorDyn__Float;
+extern struct Any cos_m_gpushFront__FltVectorDyn__Object;
+extern struct Any cos_m_gpushFront__IntVectorDyn__Int;
+extern struct Any cos_m_gpushFront__IntVectorDyn__Object;
+extern struct Any cos_m_gpushFront__LngVectorDyn__Long;
+extern struct Any cos_m_gpushFront__LngVectorDyn__Object;
+extern struct Any cos_m_gpushFront__ShtVectorDyn__Object;
+extern struct Any cos_m_gpushFront__ShtVectorDyn__Short;
+extern struct Any cos_m_gpushFront__StringDyn__Char;
+extern struct Any cos_m_gpushFront__StringDyn__Object;
+extern struct Any cos_m_gput__OutputStream__Char;
+extern struct Any cos_m_gput__OutputStream__Float;
+extern struct Any cos_m_gput__OutputStream__Int;
+extern struct Any cos_m_gput__OutputStream__Long;
+extern struct Any cos_m_gput__OutputStream__String;
+extern struct Any cos_m_gput__String__Char;
+extern struct Any cos_m_gput__String__Complex;
+extern struct Any cos_m_gput__String__Float;
+extern struct Any cos_m_gput__String__Int;
+extern struct Any cos_m_gput__String__Long;
+extern struct Any cos_m_gputAt__Array__Array__Array;
+extern struct Any cos_m_gputAt__Array__Array__Object;
+extern struct Any cos_m_gputAt__Array__IntVector__Array;
+extern struct Any cos_m_gputAt__Array__IntVector__Object;
+extern struct Any cos_m_gputAt__Array__Int__Object;
+extern struct Any cos_m_gputAt__Array__Range__Array;
+extern struct Any cos_m_gputAt__Array__Range__Object;
+extern struct Any cos_m_gputAt__Array__Slice__Array;
+extern struct Any cos_m_gputAt__Array__Slice__Object;
+extern struct Any cos_m_gputAt__ChrVector__IntVector__ChrVector;
+extern struct Any cos_m_gputAt__ChrVector__IntVector__Object;
+extern struct Any cos_m_gputAt__ChrVector__Int__Char;
+extern struct Any cos_m_gputAt__ChrVector__Int__Object;
+extern struct Any cos_m_gputAt__ChrVector__Range__Object;
+extern struct Any cos_m_gputAt__ChrVector__Slice__ChrVector;
+extern struct Any cos_m_gputAt__ChrVector__Slice__Object;
+extern struct Any cos_m_gputAt__CpxVector__IntVector__CpxVector;
+extern struct Any cos_m_gputAt__CpxVector__IntVector__Object;
+extern struct Any cos_m_gputAt__CpxVector__Int__Char;
+extern struct Any cos_m_gputAt__CpxVector__Int__Complex;
+extern struct Any cos_m_gputAt__CpxVector__Int__Float;
+extern struct Any cos_m_gputAt__CpxVector__Int__Int;
+extern struct Any cos_m_gputAt__CpxVector__Int__Long;
+extern struct Any cos_m_gputAt__CpxVector__Int__Object;
+extern struct Any cos_m_gputAt__CpxVector__Int__Short;
+extern struct Any cos_m_gputAt__CpxVector__Range__Object;
+extern struct Any cos_m_gputAt__CpxVector__Range__VectorExpr;
+extern struct Any cos_m_gputAt__CpxVector__Slice__CpxVector;
+extern struct Any cos_m_gputAt__CpxVector__Slice__Object;
+extern struct Any cos_m_gputAt__CpxVector__Slice__VectorExpr;
+extern struct Any cos_m_gputAt__FltVector__IntVector__FltVector;
+extern struct Any cos_m_gputAt__FltVector__IntVector__Object;
+extern struct Any cos_m_gputAt__FltVector__Int__Char;
+extern struct Any cos_m_gputAt__FltVector__Int__Float;
+extern struct Any cos_m_gputAt__FltVector__Int__Int;
+extern struct Any cos_m_gputAt__FltVector__Int__Long;
+extern struct Any cos_m_gputAt__FltVector__Int__Object;
+extern struct Any cos_m_gputAt__FltVector__Int__Short;
+extern struct Any cos_m_gputAt__FltVector__Range__Object;
+extern struct Any cos_m_gputAt__FltVector__Range__VectorExpr;
+extern struct Any cos_m_gputAt__FltVector__Slice__FltVector;
+extern struct Any cos_m_gputAt__FltVector__Slice__Object;
+extern struct Any cos_m_gputAt__FltVector__Slice__VectorExpr;
+extern struct Any cos_m_gputAt__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gputAt__IntVector__IntVector__Object;
+extern struct Any cos_m_gputAt__IntVector__Int__Char;
+extern struct Any cos_m_gputAt__IntVector__Int__Int;
+extern struct Any cos_m_gputAt__IntVector__Int__Object;
+extern struct Any cos_m_gputAt__IntVector__Int__Short;
+extern struct Any cos_m_gputAt__IntVector__Range__Object;
+extern struct Any cos_m_gputAt__IntVector__Range__VectorExpr;
+extern struct Any cos_m_gputAt__IntVector__Slice__IntVector;
+extern struct Any cos_m_gputAt__IntVector__Slice__Object;
+extern struct Any cos_m_gputAt__IntVector__Slice__VectorExpr;
+extern struct Any cos_m_gputAt__LngVector__IntVector__LngVector;
+extern struct Any cos_m_gputAt__LngVector__IntVector__Object;
+extern struct Any cos_m_gputAt__LngVector__Int__Char;
+extern struct Any cos_m_gputAt__LngVector__Int__Int;
+extern struct Any cos_m_gputAt__LngVector__Int__Long;
+extern struct Any cos_m_gputAt__LngVector__Int__Object;
+extern struct Any cos_m_gputAt__LngVector__Int__Short;
+extern struct Any cos_m_gputAt__LngVector__Range__Object;
+extern struct Any cos_m_gputAt__LngVector__Range__VectorExpr;
+extern struct Any cos_m_gputAt__LngVector__Slice__LngVector;
+extern struct Any cos_m_gputAt__LngVector__Slice__Object;
+extern struct Any cos_m_gputAt__LngVector__Slice__VectorExpr;
+extern struct Any cos_m_gputAt__ShtVector__IntVector__Object;
+extern struct Any cos_m_gputAt__ShtVector__IntVector__ShtVector;
+extern struct Any cos_m_gputAt__ShtVector__Int__Char;
+extern struct Any cos_m_gputAt__ShtVector__Int__Object;
+extern struct Any cos_m_gputAt__ShtVector__Int__Short;
+extern struct Any cos_m_gputAt__ShtVector__Range__Object;
+extern struct Any cos_m_gputAt__ShtVector__Range__VectorExpr;
+extern struct Any cos_m_gputAt__ShtVector__Slice__Object;
+extern struct Any cos_m_gputAt__ShtVector__Slice__ShtVector;
+extern struct Any cos_m_gputAt__ShtVector__Slice__VectorExpr;
+extern struct Any cos_m_gputAt__String__Array__Array;
+extern struct Any cos_m_gputAt__String__Array__Object;
+extern struct Any cos_m_gputAt__String__IntVector__Object;
+extern struct Any cos_m_gputAt__String__IntVector__String;
+extern struct Any cos_m_gputAt__String__Int__Char;
+extern struct Any cos_m_gputAt__String__Int__Object;
+extern struct Any cos_m_gputAt__String__Range__Array;
+extern struct Any cos_m_gputAt__String__Range__Object;
+extern struct Any cos_m_gputAt__String__Slice__Object;
+extern struct Any cos_m_gputAt__String__Slice__String;
+extern struct Any cos_m_gputAtIdx__Array__Object;
+extern struct Any cos_m_gputAtIdx__ChrVector__Object;
+extern struct Any cos_m_gputAtIdx__CpxVector__Object;
+extern struct Any cos_m_gputAtIdx__FltVector__Object;
+extern struct Any cos_m_gputAtIdx__IntVector__Object;
+extern struct Any cos_m_gputAtIdx__LngVector__Object;
+extern struct Any cos_m_gputAtIdx__ShtVector__Object;
+extern struct Any cos_m_gputAtIdx__String__Object;
+extern struct Any cos_m_gputChr__OutputFile;
+extern struct Any cos_m_gputData__OutputStream;
+extern struct Any cos_m_gputLn__OutputStream__Object;
+extern struct Any cos_m_gputStr__OutputStream;
+extern struct Any cos_m_gputStrLn__OutputStream;
+extern struct Any cos_m_gputnChr__OutputStream;
+extern struct Any cos_m_greduce__Array__Functor;
+extern struct Any cos_m_greduce__ChrVector__Functor;
+extern struct Any cos_m_greduce__ChrVector__IntFunction2;
+extern struct Any cos_m_greduce__CpxVector__CpxFunction2;
+extern struct Any cos_m_greduce__CpxVector__Functor;
+extern struct Any cos_m_greduce__FltVector__FltFunction2;
+extern struct Any cos_m_greduce__FltVector__Functor;
+extern struct Any cos_m_greduce__IntVector__Functor;
+extern struct Any cos_m_greduce__IntVector__IntFunction2;
+extern struct Any cos_m_greduce__LngVector__Functor;
+extern struct Any cos_m_greduce__LngVector__LngFunction2;
+extern struct Any cos_m_greduce__ShtVector__Functor;
+extern struct Any cos_m_greduce__ShtVector__IntFunction2;
+extern struct Any cos_m_greduce__String__Functor;
+extern struct Any cos_m_greduce1__Array__Functor__Object;
+extern struct Any cos_m_greduce1__ChrVector__Functor__Object;
+extern struct Any cos_m_greduce1__ChrVector__IntFunction2__Object;
+extern struct Any cos_m_greduce1__CpxVector__CpxFunction2__Object;
+extern struct Any cos_m_greduce1__CpxVector__Functor__Object;
+extern struct Any cos_m_greduce1__FltVector__FltFunction2__Object;
+extern struct Any cos_m_greduce1__FltVector__Functor__Object;
+extern struct Any cos_m_greduce1__IntVector__Functor__Object;
+extern struct Any cos_m_greduce1__IntVector__IntFunction2__Object;
+extern struct Any cos_m_greduce1__LngVector__Functor__Object;
+extern struct Any cos_m_greduce1__LngVector__LngFunction2__Object;
+extern struct Any cos_m_greduce1__ShtVector__Functor__Object;
+extern struct Any cos_m_greduce1__ShtVector__IntFunction2__Object;
+extern struct Any cos_m_greduce1__String__Functor__Object;
+extern struct Any cos_m_greduce2__Array__Functor__Object__Object;
+extern struct Any cos_m_greduce2__ChrVector__Functor__Object__Object;
+extern struct Any cos_m_greduce2__CpxVector__Functor__Object__Object;
+extern struct Any cos_m_greduce2__FltVector__Functor__Object__Object;
+extern struct Any cos_m_greduce2__IntVector__Functor__Object__Object;
+extern struct Any cos_m_greduce2__LngVector__Functor__Object__Object;
+extern struct Any cos_m_greduce2__ShtVector__Functor__Object__Object;
+extern struct Any cos_m_greject__Array__Functor;
+extern struct Any cos_m_greject__ChrVector__Functor;
+extern struct Any cos_m_greject__ChrVector__IntFunction1;
+extern struct Any cos_m_greject__CpxVector__CpxFunction1;
+extern struct Any cos_m_greject__CpxVector__Functor;
+extern struct Any cos_m_greject__FltVector__FltFunction1;
+extern struct Any cos_m_greject__FltVector__Functor;
+extern struct Any cos_m_greject__IntVector__Functor;
+extern struct Any cos_m_greject__IntVector__IntFunction1;
+extern struct Any cos_m_greject__LngVector__Functor;
+extern struct Any cos_m_greject__LngVector__LngFunction1;
+extern struct Any cos_m_greject__ShtVector__Functor;
+extern struct Any cos_m_greject__ShtVector__IntFunction1;
+extern struct Any cos_m_greject__String__Functor;
+extern struct Any cos_m_grejectWhile__Array__Functor;
+extern struct Any cos_m_grejectWhile__ChrVector__Functor;
+extern struct Any cos_m_grejectWhile__CpxVector__Functor;
+extern struct Any cos_m_grejectWhile__FltVector__Functor;
+extern struct Any cos_m_grejectWhile__IntVector__Functor;
+extern struct Any cos_m_grejectWhile__LngVector__Functor;
+extern struct Any cos_m_grejectWhile__ShtVector__Functor;
+extern struct Any cos_m_grejectWhile__String__Functor;
+extern struct Any cos_m_gremoveAt__ChrVectorDyn__Int;
+extern struct Any cos_m_gremoveAt__ChrVectorDyn__Range;
+extern struct Any cos_m_gremoveAt__ChrVectorDyn__Slice;
+extern struct Any cos_m_gremoveAt__CpxVectorDyn__Int;
+extern struct Any cos_m_gremoveAt__CpxVectorDyn__Range;
+extern struct Any cos_m_gremoveAt__CpxVectorDyn__Slice;
+extern struct Any cos_m_gremoveAt__FltVectorDyn__Int;
+extern struct Any cos_m_gremoveAt__FltVectorDyn__Range;
+extern struct Any cos_m_gremoveAt__FltVectorDyn__Slice;
+extern struct Any cos_m_gremoveAt__IntVectorDyn__Int;
+extern struct Any cos_m_gremoveAt__IntVectorDyn__Range;
+extern struct Any cos_m_gremoveAt__IntVectorDyn__Slice;
+extern struct Any cos_m_gremoveAt__LngVectorDyn__Int;
+extern struct Any cos_m_gremoveAt__LngVectorDyn__Range;
+extern struct Any cos_m_gremoveAt__LngVectorDyn__Slice;
+extern struct Any cos_m_gremoveAt__ShtVectorDyn__Int;
+extern struct Any cos_m_gremoveAt__ShtVectorDyn__Range;
+extern struct Any cos_m_gremoveAt__ShtVectorDyn__Slice;
+extern struct Any cos_m_grepeat__Char__Int;
+extern struct Any cos_m_grepeat__Complex__Int;
+extern struct Any cos_m_grepeat__Float__Int;
+extern struct Any cos_m_grepeat__Int__Int;
+extern struct Any cos_m_grepeat__Long__Int;
+extern struct Any cos_m_grepeat__Object__Int;
+extern struct Any cos_m_grepeat__Short__Int;
+extern struct Any cos_m_greverse__Array;
+extern struct Any cos_m_greverse__ChrVector;
+extern struct Any cos_m_greverse__CpxVector;
+extern struct Any cos_m_greverse__FltVector;
+extern struct Any cos_m_greverse__IntVector;
+extern struct Any cos_m_greverse__LngVector;
+extern struct Any cos_m_greverse__ShtVector;
+extern struct Any cos_m_greverse__String;
+extern struct Any cos_m_greverse__pmGreater;
+extern struct Any cos_m_greverse__pmLesser;
+extern struct Any cos_m_greverse__pmOrdered;
+extern struct Any cos_m_gscal__CpxVector__Number;
+extern struct Any cos_m_gscal__FltVector__Number;
+extern struct Any cos_m_gseek__InputFile;
+extern struct Any cos_m_gseek__OutputFile;
+extern struct Any cos_m_gselect__Array__Functor;
+extern struct Any cos_m_gselect__ChrVector__Functor;
+extern struct Any cos_m_gselect__ChrVector__IntFunction1;
+extern struct Any cos_m_gselect__CpxVector__CpxFunction1;
+extern struct Any cos_m_gselect__CpxVector__Functor;
+extern struct Any cos_m_gselect__FltVector__FltFunction1;
+extern struct Any cos_m_gselect__FltVector__Functor;
+extern struct Any cos_m_gselect__IntVector__Functor;
+extern struct Any cos_m_gselect__IntVector__IntFunction1;
+extern struct Any cos_m_gselect__LngVector__Functor;
+extern struct Any cos_m_gselect__LngVector__LngFunction1;
+extern struct Any cos_m_gselect__ShtVector__Functor;
+extern struct Any cos_m_gselect__ShtVector__IntFunction1;
+extern struct Any cos_m_gselect__String__Functor;
+extern struct Any cos_m_gselectWhile__Array__Functor;
+extern struct Any cos_m_gselectWhile__ChrVector__Functor;
+extern struct Any cos_m_gselectWhile__CpxVector__Functor;
+extern struct Any cos_m_gselectWhile__FltVector__Functor;
+extern struct Any cos_m_gselectWhile__IntVector__Functor;
+extern struct Any cos_m_gselectWhile__LngVector__Functor;
+extern struct Any cos_m_gselectWhile__ShtVector__Functor;
+extern struct Any cos_m_gselectWhile__String__Functor;
+extern struct Any cos_m_gsht__Short;
+extern struct Any cos_m_gshtAt__ChrVector__Int;
+extern struct Any cos_m_gshtAt__ShtVector__Int;
+extern struct Any cos_m_gshtPtr__ShtVector;
+extern struct Any cos_m_gsin__Floating;
+extern struct Any cos_m_gsin__FloatingVector;
+extern struct Any cos_m_gsine__Complex;
+extern struct Any cos_m_gsine__CpxVector;
+extern struct Any cos_m_gsine__Float;
+extern struct Any cos_m_gsine__FltVector;
+extern struct Any cos_m_gsineh__Complex;
+extern struct Any cos_m_gsineh__CpxVector;
+extern struct Any cos_m_gsineh__Float;
+extern struct Any cos_m_gsineh__FltVector;
+extern struct Any cos_m_gsinh__Floating;
+extern struct Any cos_m_gsinh__FloatingVector;
+extern struct Any cos_m_gsize__Array;
+extern struct Any cos_m_gsize__ChrVector;
+extern struct Any cos_m_gsize__CpxVector;
+extern struct Any cos_m_gsize__FltVector;
+extern struct Any cos_m_gsize__IntVector;
+extern struct Any cos_m_gsize__LngVector;
+extern struct Any cos_m_gsize__Range;
+extern struct Any cos_m_gsize__ShtVector;
+extern struct Any cos_m_gsize__Slice;
+extern struct Any cos_m_gsize__String;
+extern struct Any cos_m_gsize__VectorExpr;
+extern struct Any cos_m_gsize__XRange;
+extern struct Any cos_m_gskipDelim__InputStream;
+extern struct Any cos_m_gskipDelims__InputStream;
+extern struct Any cos_m_gskipLine__InputStream;
+extern struct Any cos_m_gskipWhile__InputStream__Functor;
+extern struct Any cos_m_gskipnChr__InputStream;
+extern struct Any cos_m_gsort__ArrayView__Functor;
+extern struct Any cos_m_gsort__Array__Functor;
+extern struct Any cos_m_gsort__ChrVectorView__Functor;
+extern struct Any cos_m_gsort__ChrVectorView__IntFunction2;
+extern struct Any cos_m_gsort__ChrVector__Functor;
+extern struct Any cos_m_gsort__ChrVector__IntFunction2;
+extern struct Any cos_m_gsort__ChrVector__pmGreater;
+extern struct Any cos_m_gsort__ChrVector__pmLesser;
+extern struct Any cos_m_gsort__CpxVectorView__Functor;
+extern struct Any cos_m_gsort__CpxVector__Functor;
+extern struct Any cos_m_gsort__FltVectorView__FltFunction2;
+extern struct Any cos_m_gsort__FltVectorView__Functor;
+extern struct Any cos_m_gsort__FltVector__FltFunction2;
+extern struct Any cos_m_gsort__FltVector__Functor;
+extern struct Any cos_m_gsort__FltVector__pmGreater;
+extern struct Any cos_m_gsort__FltVector__pmLesser;
+extern struct Any cos_m_gsort__IntVectorView__Functor;
+extern struct Any cos_m_gsort__IntVectorView__IntFunction2;
+extern struct Any cos_m_gsort__IntVector__Functor;
+extern struct Any cos_m_gsort__IntVector__IntFunction2;
+extern struct Any cos_m_gsort__IntVector__pmGreater;
+extern struct Any cos_m_gsort__IntVector__pmLesser;
+extern struct Any cos_m_gsort__LngVectorView__Functor;
+extern struct Any cos_m_gsort__LngVectorView__LngFunction2;
+extern struct Any cos_m_gsort__LngVector__Functor;
+extern struct Any cos_m_gsort__LngVector__LngFunction2;
+extern struct Any cos_m_gsort__LngVector__pmGreater;
+extern struct Any cos_m_gsort__LngVector__pmLesser;
+extern struct Any cos_m_gsort__ShtVectorView__Functor;
+extern struct Any cos_m_gsort__ShtVectorView__IntFunction2;
+extern struct Any cos_m_gsort__ShtVector__Functor;
+extern struct Any cos_m_gsort__ShtVector__IntFunction2;
+extern struct Any cos_m_gsort__ShtVector__pmGreater;
+extern struct Any cos_m_gsort__ShtVector__pmLesser;
+extern struct Any cos_m_gsplit__Array__Functor;
+extern struct Any cos_m_gsplit__String__Object;
+extern struct Any cos_m_gsqr__Number;
+extern struct Any cos_m_gsqr__Vector;
+extern struct Any cos_m_gsqr__VectorExpr;
+extern struct Any cos_m_gsqrErr__Integral__Number;
+extern struct Any cos_m_gsqrErr__Number__Number;
+extern struct Any cos_m_gsqroot__Complex;
+extern struct Any cos_m_gsqroot__CpxVector;
+extern struct Any cos_m_gsqroot__Float;
+extern struct Any cos_m_gsqroot__FltVector;
+extern struct Any cos_m_gsqrt__Floating;
+extern struct Any cos_m_gsqrt__FloatingVector;
+extern struct Any cos_m_gsquare__CpxVector;
+extern struct Any cos_m_gsquare__FltVector;
+extern struct Any cos_m_gsquare__IntVector;
+extern struct Any cos_m_gsquare__LngVector;
+extern struct Any cos_m_gsquare__ShtVector;
+extern struct Any cos_m_gstr__FunExpr;
+extern struct Any cos_m_gstr__InputFile;
+extern struct Any cos_m_gstr__MsgExpr;
+extern struct Any cos_m_gstr__OutputFile;
+extern struct Any cos_m_gstr__String;
+extern struct Any cos_m_gstride__Array;
+extern struct Any cos_m_gstrip__String;
+extern struct Any cos_m_gstrip__StringDyn;
+extern struct Any cos_m_gsub__FloatingVector__CpxVector;
+extern struct Any cos_m_gsub__Floating__Complex;
+extern struct Any cos_m_gsub__IntegralVector__FloatingVector;
+extern struct Any cos_m_gsub__IntegralVector__LngVector;
+extern struct Any cos_m_gsub__Integral__Floating;
+extern struct Any cos_m_gsub__Integral__Long;
+extern struct Any cos_m_gsub__Number__Number;
+extern struct Any cos_m_gsub__VectorExpr__Vector;
+extern struct Any cos_m_gsub__VectorExpr__VectorExpr;
+extern struct Any cos_m_gsub__Vector__Vector;
+extern struct Any cos_m_gsub__Vector__VectorExpr;
+extern struct Any cos_m_gsubTo__Complex__Complex;
+extern struct Any cos_m_gsubTo__Complex__Float;
+extern struct Any cos_m_gsubTo__Complex__Int;
+extern struct Any cos_m_gsubTo__Complex__Long;
+extern struct Any cos_m_gsubTo__CpxVector__CpxVector;
+extern struct Any cos_m_gsubTo__CpxVector__FltVector;
+extern struct Any cos_m_gsubTo__CpxVector__IntVector;
+extern struct Any cos_m_gsubTo__CpxVector__LngVector;
+extern struct Any cos_m_gsubTo__CpxVector__ShtVector;
+extern struct Any cos_m_gsubTo__Float__Float;
+extern struct Any cos_m_gsubTo__Float__Int;
+extern struct Any cos_m_gsubTo__Float__Long;
+extern struct Any cos_m_gsubTo__FltVector__FltVector;
+extern struct Any cos_m_gsubTo__FltVector__IntVector;
+extern struct Any cos_m_gsubTo__FltVector__LngVector;
+extern struct Any cos_m_gsubTo__FltVector__ShtVector;
+extern struct Any cos_m_gsubTo__IntVector__IntVector;
+extern struct Any cos_m_gsubTo__IntVector__ShtVector;
+extern struct Any cos_m_gsubTo__Int__Int;
+extern struct Any cos_m_gsubTo__LngVector__IntVector;
+extern struct Any cos_m_gsubTo__LngVector__LngVector;
+extern struct Any cos_m_gsubTo__LngVector__ShtVector;
+extern struct Any cos_m_gsubTo__Long__Int;
+extern struct Any cos_m_gsubTo__Long__Long;
+extern struct Any cos_m_gsubTo__ShtVector__ShtVector;
+extern struct Any cos_m_gsum__CpxVector;
+extern struct Any cos_m_gsum__FltVector;
+extern struct Any cos_m_gswap__Array__Array;
+extern struct Any cos_m_gtan__Floating;
+extern struct Any cos_m_gtan__FloatingVector;
+extern struct Any cos_m_gtangent__Complex;
+extern struct Any cos_m_gtangent__CpxVector;
+extern struct Any cos_m_gtangent__Float;
+extern struct Any cos_m_gtangent__FltVector;
+extern struct Any cos_m_gtangenth__Complex;
+extern struct Any cos_m_gtangenth__CpxVector;
+extern struct Any cos_m_gtangenth__Float;
+extern struct Any cos_m_gtangenth__FltVector;
+extern struct Any cos_m_gtanh__Floating;
+extern struct Any cos_m_gtanh__FloatingVector;
+extern struct Any cos_m_gtell__InputFile;
+extern struct Any cos_m_gtell__OutputFile;
+extern struct Any cos_m_gtoLower__Char;
+extern struct Any cos_m_gtoUpper__Char;
+extern struct Any cos_m_gtop__Array;
+extern struct Any cos_m_gtop__ChrVector;
+extern struct Any cos_m_gtop__CpxVector;
+extern struct Any cos_m_gtop__FltVector;
+extern struct Any cos_m_gtop__IntVector;
+extern struct Any cos_m_gtop__LngVector;
+extern struct Any cos_m_gtop__ShtVector;
+extern struct Any cos_m_gtop__String;
+extern struct Any cos_m_gtopBack__Array;
+extern struct Any cos_m_gtopBack__ChrVector;
+extern struct Any cos_m_gtopBack__CpxVector;
+extern struct Any cos_m_gtopBack__FltVector;
+extern struct Any cos_m_gtopBack__IntVector;
+extern struct Any cos_m_gtopBack__LngVector;
+extern struct Any cos_m_gtopBack__ShtVector;
+extern struct Any cos_m_gtopBack__String;
+extern struct Any cos_m_gtopFront__Array;
+extern struct Any cos_m_gtopFront__ChrVector;
+extern struct Any cos_m_gtopFront__CpxVector;
+extern struct Any cos_m_gtopFront__FltVector;
+extern struct Any cos_m_gtopFront__IntVector;
+extern struct Any cos_m_gtopFront__LngVector;
+extern struct Any cos_m_gtopFront__ShtVector;
+extern struct Any cos_m_gtopFront__String;
+extern struct Any cos_m_gungetChr__InputFile;
+extern struct Any cos_m_gunique__Array__Functor;
+extern struct Any cos_m_gunique__ChrVector__Functor;
+extern struct Any cos_m_gunique__CpxVector__Functor;
+extern struct Any cos_m_gunique__FltVector__Functor;
+extern struct Any cos_m_gunique__IntVector__Functor;
+extern struct Any cos_m_gunique__LngVector__Functor;
+extern struct Any cos_m_gunique__ShtVector__Functor;
+extern struct Any cos_m_gunique__String__Functor;
+extern struct Any cos_m_gunrecognizedMessage1__InputOutputFile;
+extern struct Any cos_m_gunrecognizedMessage1__Locker;
+extern struct Any cos_m_gunrecognizedMessage1__OutputInputFile;
+extern struct Any cos_m_gunrecognizedMessage1__Tracer;
+extern struct Any cos_m_gunrecognizedMessage2__InputOutputFile__Object;
+extern struct Any cos_m_gunrecognizedMessage2__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage2__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage2__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage2__Object__Tracer;
+extern struct Any cos_m_gunrecognizedMessage2__OutputInputFile__Object;
+extern struct Any cos_m_gunrecognizedMessage2__Tracer__Object;
+extern struct Any cos_m_gunrecognizedMessage3__InputOutputFile__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage3__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage3__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Object__Tracer;
+extern struct Any cos_m_gunrecognizedMessage3__Object__Tracer__Object;
+extern struct Any cos_m_gunrecognizedMessage3__OutputInputFile__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage3__Tracer__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Locker__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Object__Tracer;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Object__Tracer__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Object__Tracer__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage4__Tracer__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Locker__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Locker__Object__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Locker__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Locker__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Locker__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Locker__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Locker__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Locker__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Locker__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Object__Locker;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Object__Tracer;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Object__Tracer__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Object__Tracer__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Object__Tracer__Object__Object__Object;
+extern struct Any cos_m_gunrecognizedMessage5__Tracer__Object__Object__Object__Object;
+extern struct Any cos_m_gxor__mFalse__mTrueFalse;
+extern struct Any cos_m_gxor__mTrueFalse__mFalse;
+extern struct Any cos_m_gxor__mTrueFalse__mTrueFalse;
+extern struct Any cos_m_gxor__mTrue__mTrue;
+extern struct Any cos_m_gzip__Array__Array;
+extern struct Any cos_m_gzip__ChrVector__ChrVector;
+extern struct Any cos_m_gzip__CpxVector__CpxVector;
+extern struct Any cos_m_gzip__FltVector__FltVector;
+extern struct Any cos_m_gzip__IntVector__IntVector;
+extern struct Any cos_m_gzip__LngVector__LngVector;
+extern struct Any cos_m_gzip__ShtVector__ShtVector;
+extern struct Any cos_m_gzip__String__String;
+extern struct Any cos_m_gzip3__Array__Array__Array;
+extern struct Any cos_m_gzip3__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gzip3__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gzip3__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gzip3__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gzip3__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gzip3__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gzip3__String__String__String;
+extern struct Any cos_m_gzip4__Array__Array__Array__Array;
+extern struct Any cos_m_gzip4__ChrVector__ChrVector__ChrVector__ChrVector;
+extern struct Any cos_m_gzip4__CpxVector__CpxVector__CpxVector__CpxVector;
+extern struct Any cos_m_gzip4__FltVector__FltVector__FltVector__FltVector;
+extern struct Any cos_m_gzip4__IntVector__IntVector__IntVector__IntVector;
+extern struct Any cos_m_gzip4__LngVector__LngVector__LngVector__LngVector;
+extern struct Any cos_m_gzip4__ShtVector__ShtVector__ShtVector__ShtVector;
+extern struct Any cos_m_gzipn__Array;
+
+static struct Any* symtbl[] = {
+  &cos_c_Array,
+  &cos_c_Array0,
+  &cos_c_Array1,
+  &cos_c_Array2,
+  &cos_c_Array3,
+  &cos_c_Array4,
+  &cos_c_Array5,
+  &cos_c_Array6,
+  &cos_c_Array7,
+  &cos_c_Array8,
+  &cos_c_Array9,
+  &cos_c_ArrayBlk,
+  &cos_c_ArrayDyn,
+  &cos_c_ArrayFix,
+  &cos_c_ArrayN,
+  &cos_c_ArraySubView,
+  &cos_c_ArrayView,
+  &cos_c_Char,
+  &cos_c_ChrVector,
+  &cos_c_ChrVector0,
+  &cos_c_ChrVector1,
+  &cos_c_ChrVector2,
+  &cos_c_ChrVector3,
+  &cos_c_ChrVector4,
+  &cos_c_ChrVector5,
+  &cos_c_ChrVector6,
+  &cos_c_ChrVector7,
+  &cos_c_ChrVector8,
+  &cos_c_ChrVector9,
+  &cos_c_ChrVectorDyn,
+  &cos_c_ChrVectorFix,
+  &cos_c_ChrVectorN,
+  &cos_c_ChrVectorSubView,
+  &cos_c_ChrVectorView,
+  &cos_c_Collection,
+  &cos_c_Complex,
+  &cos_c_ComposeFun,
+  &cos_c_CpxFunction,
+  &cos_c_CpxFunction1,
+  &cos_c_CpxFunction2,
+  &cos_c_CpxFunction3,
+  &cos_c_CpxFunction4,
+  &cos_c_CpxFunction5,
+  &cos_c_CpxFunction6,
+  &cos_c_CpxFunction7,
+  &cos_c_CpxFunction8,
+  &cos_c_CpxFunction9,
+  &cos_c_CpxVector,
+  &cos_c_CpxVector0,
+  &cos_c_CpxVector1,
+  &cos_c_CpxVector2,
+  &cos_c_CpxVector3,
+  &cos_c_CpxVector4,
+  &cos_c_CpxVector5,
+  &cos_c_CpxVector6,
+  &cos_c_CpxVector7,
+  &cos_c_CpxVector8,
+  &cos_c_CpxVector9,
+  &cos_c_CpxVectorDyn,
+  &cos_c_CpxVectorFix,
+  &cos_c_CpxVectorN,
+  &cos_c_CpxVectorSubView,
+  &cos_c_CpxVectorView,
+  &cos_c_Equal,
+  &cos_c_ExBadStream,
+  &cos_c_Expression,
+  &cos_c_Float,
+  &cos_c_Floating,
+  &cos_c_FloatingVector,
+  &cos_c_FltFunction,
+  &cos_c_FltFunction1,
+  &cos_c_FltFunction2,
+  &cos_c_FltFunction3,
+  &cos_c_FltFunction4,
+  &cos_c_FltFunction5,
+  &cos_c_FltFunction6,
+  &cos_c_FltFunction7,
+  &cos_c_FltFunction8,
+  &cos_c_FltFunction9,
+  &cos_c_FltVector,
+  &cos_c_FltVector0,
+  &cos_c_FltVector1,
+  &cos_c_FltVector2,
+  &cos_c_FltVector3,
+  &cos_c_FltVector4,
+  &cos_c_FltVector5,
+  &cos_c_FltVector6,
+  &cos_c_FltVector7,
+  &cos_c_FltVector8,
+  &cos_c_FltVector9,
+  &cos_c_FltVectorDyn,
+  &cos_c_FltVectorFix,
+  &cos_c_FltVectorN,
+  &cos_c_FltVectorSubView,
+  &cos_c_FltVectorView,
+  &cos_c_FunArg,
+  &cos_c_FunExpr,
+  &cos_c_FunExpr0,
+  &cos_c_FunExpr1,
+  &cos_c_FunExpr11,
+  &cos_c_FunExpr12,
+  &cos_c_FunExpr2,
+  &cos_c_FunExpr21,
+  &cos_c_FunExpr22,
+  &cos_c_FunExpr23,
+  &cos_c_FunExpr24,
+  &cos_c_FunExpr3,
+  &cos_c_FunExpr31,
+  &cos_c_FunExpr32,
+  &cos_c_FunExpr33,
+  &cos_c_FunExpr34,
+  &cos_c_FunExpr35,
+  &cos_c_FunExpr36,
+  &cos_c_FunExpr37,
+  &cos_c_FunExpr38,
+  &cos_c_FunExpr4,
+  &cos_c_FunExpr5,
+  &cos_c_FunExpr6,
+  &cos_c_FunExpr7,
+  &cos_c_FunExpr8,
+  &cos_c_FunExpr9,
+  &cos_c_Functor,
+  &cos_c_G_BinaryOp,
+  &cos_c_G_Operator,
+  &cos_c_G_TernaryOp,
+  &cos_c_G_UnaryOp,
+  &cos_c_G_abs,
+  &cos_c_G_absolute,
+  &cos_c_G_acos,
+  &cos_c_G_acosh,
+  &cos_c_G_acosine,
+  &cos_c_G_acosineh,
+  &cos_c_G_add,
+  &cos_c_G_addTo,
+  &cos_c_G_and,
+  &cos_c_G_arg,
+  &cos_c_G_argument,
+  &cos_c_G_asin,
+  &cos_c_G_asine,
+  &cos_c_G_asineh,
+  &cos_c_G_asinh,
+  &cos_c_G_atan,
+  &cos_c_G_atangent,
+  &cos_c_G_atangenth,
+  &cos_c_G_atanh,
+  &cos_c_G_compare,
+  &cos_c_G_conj,
+  &cos_c_G_conjugate,
+  &cos_c_G_cos,
+  &cos_c_G_cosh,
+  &cos_c_G_cosine,
+  &cos_c_G_cosineh,
+  &cos_c_G_div,
+  &cos_c_G_divBy,
+  &cos_c_G_exp,
+  &cos_c_G_exponential,
+  &cos_c_G_hash,
+  &cos_c_G_hypot,
+  &cos_c_G_implies,
+  &cos_c_G_inv,
+  &cos_c_G_invert,
+  &cos_c_G_isEqual,
+  &cos_c_G_isGreater,
+  &cos_c_G_isGreaterOrEqual,
+  &cos_c_G_isLesser,
+  &cos_c_G_isLesserOrEqual,
+  &cos_c_G_isNotEqual,
+  &cos_c_G_log,
+  &cos_c_G_logarithm,
+  &cos_c_G_max,
+  &cos_c_G_min,
+  &cos_c_G_mod,
+  &cos_c_G_modulo,
+  &cos_c_G_mul,
+  &cos_c_G_mulAdd,
+  &cos_c_G_mulBy,
+  &cos_c_G_neg,
+  &cos_c_G_negate,
+  &cos_c_G_not,
+  &cos_c_G_or,
+  &cos_c_G_pow,
+  &cos_c_G_power,
+  &cos_c_G_prod,
+  &cos_c_G_sin,
+  &cos_c_G_sine,
+  &cos_c_G_sineh,
+  &cos_c_G_sinh,
+  &cos_c_G_sqr,
+  &cos_c_G_sqrErr,
+  &cos_c_G_sqroot,
+  &cos_c_G_sqrt,
+  &cos_c_G_square,
+  &cos_c_G_sub,
+  &cos_c_G_subTo,
+  &cos_c_G_sum,
+  &cos_c_G_tan,
+  &cos_c_G_tangent,
+  &cos_c_G_tangenth,
+  &cos_c_G_tanh,
+  &cos_c_G_xor,
+  &cos_c_Greater,
+  &cos_c_InputFile,
+  &cos_c_InputOutputFile,
+  &cos_c_InputStream,
+  &cos_c_Int,
+  &cos_c_IntFunction,
+  &cos_c_IntFunction1,
+  &cos_c_IntFunction2,
+  &cos_c_IntFunction3,
+  &cos_c_IntFunction4,
+  &cos_c_IntFunction5,
+  &cos_c_IntFunction6,
+  &cos_c_IntFunction7,
+  &cos_c_IntFunction8,
+  &cos_c_IntFunction9,
+  &cos_c_IntVector,
+  &cos_c_IntVector0,
+  &cos_c_IntVector1,
+  &cos_c_IntVector2,
+  &cos_c_IntVector3,
+  &cos_c_IntVector4,
+  &cos_c_IntVector5,
+  &cos_c_IntVector6,
+  &cos_c_IntVector7,
+  &cos_c_IntVector8,
+  &cos_c_IntVector9,
+  &cos_c_IntVectorDyn,
+  &cos_c_IntVectorFix,
+  &cos_c_IntVectorN,
+  &cos_c_IntVectorSubView,
+  &cos_c_IntVectorView,
+  &cos_c_Integral,
+  &cos_c_IntegralVector,
+  &cos_c_IterateFun,
+  &cos_c_Iterator,
+  &cos_c_Lesser,
+  &cos_c_LngFunction,
+  &cos_c_LngFunction1,
+  &cos_c_LngFunction2,
+  &cos_c_LngFunction3,
+  &cos_c_LngFunction4,
+  &cos_c_LngFunction5,
+  &cos_c_LngFunction6,
+  &cos_c_LngFunction7,
+  &cos_c_LngFunction8,
+  &cos_c_LngFunction9,
+  &cos_c_LngVector,
+  &cos_c_LngVector0,
+  &cos_c_LngVector1,
+  &cos_c_LngVector2,
+  &cos_c_LngVector3,
+  &cos_c_LngVector4,
+  &cos_c_LngVector5,
+  &cos_c_LngVector6,
+  &cos_c_LngVector7,
+  &cos_c_LngVector8,
+  &cos_c_LngVector9,
+  &cos_c_LngVectorDyn,
+  &cos_c_LngVectorFix,
+  &cos_c_LngVectorN,
+  &cos_c_LngVectorSubView,
+  &cos_c_LngVectorView,
+  &cos_c_Locker,
+  &cos_c_Long,
+  &cos_c_MsgExpr,
+  &cos_c_Number,
+  &cos_c_Ordered,
+  &cos_c_OutputFile,
+  &cos_c_OutputInputFile,
+  &cos_c_OutputStream,
+  &cos_c_RWLocker,
+  &cos_c_Range,
+  &cos_c_Sequence,
+  &cos_c_Short,
+  &cos_c_ShtVector,
+  &cos_c_ShtVector0,
+  &cos_c_ShtVector1,
+  &cos_c_ShtVector2,
+  &cos_c_ShtVector3,
+  &cos_c_ShtVector4,
+  &cos_c_ShtVector5,
+  &cos_c_ShtVector6,
+  &cos_c_ShtVector7,
+  &cos_c_ShtVector8,
+  &cos_c_ShtVector9,
+  &cos_c_ShtVectorDyn,
+  &cos_c_ShtVectorFix,
+  &cos_c_ShtVectorN,
+  &cos_c_ShtVectorSubView,
+  &cos_c_ShtVectorView,
+  &cos_c_Slice,
+  &cos_c_SpinLocker,
+  &cos_c_Stream,
+  &cos_c_String,
+  &cos_c_StringDyn,
+  &cos_c_StringFix,
+  &cos_c_StringN,
+  &cos_c_SubView,
+  &cos_c_Tracer,
+  &cos_c_Value,
+  &cos_c_ValueSequence,
+  &cos_c_VarExpr,
+  &cos_c_Vector,
+  &cos_c_VectorExpr,
+  &cos_c_View,
+  &cos_c_XRange,
+  &cos_c_mArray,
+  &cos_c_mArray0,
+  &cos_c_mArray1,
+  &cos_c_mArray2,
+  &cos_c_mArray3,
+  &cos_c_mArray4,
+  &cos_c_mArray5,
+  &cos_c_mArray6,
+  &cos_c_mArray7,
+  &cos_c_mArray8,
+  &cos_c_mArray9,
+  &cos_c_mArrayBlk,
+  &cos_c_mArrayDyn,
+  &cos_c_mArrayFix,
+  &cos_c_mArrayN,
+  &cos_c_mArraySubView,
+  &cos_c_mArrayView,
+  &cos_c_mChar,
+  &cos_c_mChrVector,
+  &cos_c_mChrVector0,
+  &cos_c_mChrVector1,
+  &cos_c_mChrVector2,
+  &cos_c_mChrVector3,
+  &cos_c_mChrVector4,
+  &cos_c_mChrVector5,
+  &cos_c_mChrVector6,
+  &cos_c_mChrVector7,
+  &cos_c_mChrVector8,
+  &cos_c_mChrVector9,
+  &cos_c_mChrVectorDyn,
+  &cos_c_mChrVectorFix,
+  &cos_c_mChrVectorN,
+  &cos_c_mChrVectorSubView,
+  &cos_c_mChrVectorView,
+  &cos_c_mCollection,
+  &cos_c_mComplex,
+  &cos_c_mComposeFun,
+  &cos_c_mCpxFunction,
+  &cos_c_mCpxFunction1,
+  &cos_c_mCpxFunction2,
+  &cos_c_mCpxFunction3,
+  &cos_c_mCpxFunction4,
+  &cos_c_mCpxFunction5,
+  &cos_c_mCpxFunction6,
+  &cos_c_mCpxFunction7,
+  &cos_c_mCpxFunction8,
+  &cos_c_mCpxFunction9,
+  &cos_c_mCpxVector,
+  &cos_c_mCpxVector0,
+  &cos_c_mCpxVector1,
+  &cos_c_mCpxVector2,
+  &cos_c_mCpxVector3,
+  &cos_c_mCpxVector4,
+  &cos_c_mCpxVector5,
+  &cos_c_mCpxVector6,
+  &cos_c_mCpxVector7,
+  &cos_c_mCpxVector8,
+  &cos_c_mCpxVector9,
+  &cos_c_mCpxVectorDyn,
+  &cos_c_mCpxVectorFix,
+  &cos_c_mCpxVectorN,
+  &cos_c_mCpxVectorSubView,
+  &cos_c_mCpxVectorView,
+  &cos_c_mEqual,
+  &cos_c_mExBadStream,
+  &cos_c_mExpression,
+  &cos_c_mFloat,
+  &cos_c_mFloating,
+  &cos_c_mFloatingVector,
+  &cos_c_mFltFunction,
+  &cos_c_mFltFunction1,
+  &cos_c_mFltFunction2,
+  &cos_c_mFltFunction3,
+  &cos_c_mFltFunction4,
+  &cos_c_mFltFunction5,
+  &cos_c_mFltFunction6,
+  &cos_c_mFltFunction7,
+  &cos_c_mFltFunction8,
+  &cos_c_mFltFunction9,
+  &cos_c_mFltVector,
+  &cos_c_mFltVector0,
+  &cos_c_mFltVector1,
+  &cos_c_mFltVector2,
+  &cos_c_mFltVector3,
+  &cos_c_mFltVector4,
+  &cos_c_mFltVector5,
+  &cos_c_mFltVector6,
+  &cos_c_mFltVector7,
+  &cos_c_mFltVector8,
+  &cos_c_mFltVector9,
+  &cos_c_mFltVectorDyn,
+  &cos_c_mFltVectorFix,
+  &cos_c_mFltVectorN,
+  &cos_c_mFltVectorSubView,
+  &cos_c_mFltVectorView,
+  &cos_c_mFunArg,
+  &cos_c_mFunExpr,
+  &cos_c_mFunExpr0,
+  &cos_c_mFunExpr1,
+  &cos_c_mFunExpr11,
+  &cos_c_mFunExpr12,
+  &cos_c_mFunExpr2,
+  &cos_c_mFunExpr21,
+  &cos_c_mFunExpr22,
+  &cos_c_mFunExpr23,
+  &cos_c_mFunExpr24,
+  &cos_c_mFunExpr3,
+  &cos_c_mFunExpr31,
+  &cos_c_mFunExpr32,
+  &cos_c_mFunExpr33,
+  &cos_c_mFunExpr34,
+  &cos_c_mFunExpr35,
+  &cos_c_mFunExpr36,
+  &cos_c_mFunExpr37,
+  &cos_c_mFunExpr38,
+  &cos_c_mFunExpr4,
+  &cos_c_mFunExpr5,
+  &cos_c_mFunExpr6,
+  &cos_c_mFunExpr7,
+  &cos_c_mFunExpr8,
+  &cos_c_mFunExpr9,
+  &cos_c_mFunctor,
+  &cos_c_mG_BinaryOp,
+  &cos_c_mG_Operator,
+  &cos_c_mG_TernaryOp,
+  &cos_c_mG_UnaryOp,
+  &cos_c_mG_abs,
+  &cos_c_mG_absolute,
+  &cos_c_mG_acos,
+  &cos_c_mG_acosh,
+  &cos_c_mG_acosine,
+  &cos_c_mG_acosineh,
+  &cos_c_mG_add,
+  &cos_c_mG_addTo,
+  &cos_c_mG_and,
+  &cos_c_mG_arg,
+  &cos_c_mG_argument,
+  &cos_c_mG_asin,
+  &cos_c_mG_asine,
+  &cos_c_mG_asineh,
+  &cos_c_mG_asinh,
+  &cos_c_mG_atan,
+  &cos_c_mG_atangent,
+  &cos_c_mG_atangenth,
+  &cos_c_mG_atanh,
+  &cos_c_mG_compare,
+  &cos_c_mG_conj,
+  &cos_c_mG_conjugate,
+  &cos_c_mG_cos,
+  &cos_c_mG_cosh,
+  &cos_c_mG_cosine,
+  &cos_c_mG_cosineh,
+  &cos_c_mG_div,
+  &cos_c_mG_divBy,
+  &cos_c_mG_exp,
+  &cos_c_mG_exponential,
+  &cos_c_mG_hash,
+  &cos_c_mG_hypot,
+  &cos_c_mG_implies,
+  &cos_c_mG_inv,
+  &cos_c_mG_invert,
+  &cos_c_mG_isEqual,
+  &cos_c_mG_isGreater,
+  &cos_c_mG_isGreaterOrEqual,
+  &cos_c_mG_isLesser,
+  &cos_c_mG_isLesserOrEqual,
+  &cos_c_mG_isNotEqual,
+  &cos_c_mG_log,
+  &cos_c_mG_logarithm,
+  &cos_c_mG_max,
+  &cos_c_mG_min,
+  &cos_c_mG_mod,
+  &cos_c_mG_modulo,
+  &cos_c_mG_mul,
+  &cos_c_mG_mulAdd,
+  &cos_c_mG_mulBy,
+  &cos_c_mG_neg,
+  &cos_c_mG_negate,
+  &cos_c_mG_not,
+  &cos_c_mG_or,
+  &cos_c_mG_pow,
+  &cos_c_mG_power,
+  &cos_c_mG_prod,
+  &cos_c_mG_sin,
+  &cos_c_mG_sine,
+  &cos_c_mG_sineh,
+  &cos_c_mG_sinh,
+  &cos_c_mG_sqr,
+  &cos_c_mG_sqrErr,
+  &cos_c_mG_sqroot,
+  &cos_c_mG_sqrt,
+  &cos_c_mG_square,
+  &cos_c_mG_sub,
+  &cos_c_mG_subTo,
+  &cos_c_mG_sum,
+  &cos_c_mG_tan,
+  &cos_c_mG_tangent,
+  &cos_c_mG_tangenth,
+  &cos_c_mG_tanh,
+  &cos_c_mG_xor,
+  &cos_c_mGreater,
+  &cos_c_mInputFile,
+  &cos_c_mInputOutputFile,
+  &cos_c_mInputStream,
+  &cos_c_mInt,
+  &cos_c_mIntFunction,
+  &cos_c_mIntFunction1,
+  &cos_c_mIntFunction2,
+  &cos_c_mIntFunction3,
+  &cos_c_mIntFunction4,
+  &cos_c_mIntFunction5,
+  &cos_c_mIntFunction6,
+  &cos_c_mIntFunction7,
+  &cos_c_mIntFunction8,
+  &cos_c_mIntFunction9,
+  &cos_c_mIntVector,
+  &cos_c_mIntVector0,
+  &cos_c_mIntVector1,
+  &cos_c_mIntVector2,
+  &cos_c_mIntVector3,
+  &cos_c_mIntVector4,
+  &cos_c_mIntVector5,
+  &cos_c_mIntVector6,
+  &cos_c_mIntVector7,
+  &cos_c_mIntVector8,
+  &cos_c_mIntVector9,
+  &cos_c_mIntVectorDyn,
+  &cos_c_mIntVectorFix,
+  &cos_c_mIntVectorN,
+  &cos_c_mIntVectorSubView,
+  &cos_c_mIntVectorView,
+  &cos_c_mIntegral,
+  &cos_c_mIntegralVector,
+  &cos_c_mIterateFun,
+  &cos_c_mIterator,
+  &cos_c_mLesser,
+  &cos_c_mLngFunction,
+  &cos_c_mLngFunction1,
+  &cos_c_mLngFunction2,
+  &cos_c_mLngFunction3,
+  &cos_c_mLngFunction4,
+  &cos_c_mLngFunction5,
+  &cos_c_mLngFunction6,
+  &cos_c_mLngFunction7,
+  &cos_c_mLngFunction8,
+  &cos_c_mLngFunction9,
+  &cos_c_mLngVector,
+  &cos_c_mLngVector0,
+  &cos_c_mLngVector1,
+  &cos_c_mLngVector2,
+  &cos_c_mLngVector3,
+  &cos_c_mLngVector4,
+  &cos_c_mLngVector5,
+  &cos_c_mLngVector6,
+  &cos_c_mLngVector7,
+  &cos_c_mLngVector8,
+  &cos_c_mLngVector9,
+  &cos_c_mLngVectorDyn,
+  &cos_c_mLngVectorFix,
+  &cos_c_mLngVectorN,
+  &cos_c_mLngVectorSubView,
+  &cos_c_mLngVectorView,
+  &cos_c_mLocker,
+  &cos_c_mLong,
+  &cos_c_mMsgExpr,
+  &cos_c_mNumber,
+  &cos_c_mOrdered,
+  &cos_c_mOutputFile,
+  &cos_c_mOutputInputFile,
+  &cos_c_mOutputStream,
+  &cos_c_mRWLocker,
+  &cos_c_mRange,
+  &cos_c_mSequence,
+  &cos_c_mShort,
+  &cos_c_mShtVector,
+  &cos_c_mShtVector0,
+  &cos_c_mShtVector1,
+  &cos_c_mShtVector2,
+  &cos_c_mShtVector3,
+  &cos_c_mShtVector4,
+  &cos_c_mShtVector5,
+  &cos_c_mShtVector6,
+  &cos_c_mShtVector7,
+  &cos_c_mShtVector8,
+  &cos_c_mShtVector9,
+  &cos_c_mShtVectorDyn,
+  &cos_c_mShtVectorFix,
+  &cos_c_mShtVectorN,
+  &cos_c_mShtVectorSubView,
+  &cos_c_mShtVectorView,
+  &cos_c_mSlice,
+  &cos_c_mSpinLocker,
+  &cos_c_mStream,
+  &cos_c_mString,
+  &cos_c_mStringDyn,
+  &cos_c_mStringFix,
+  &cos_c_mStringN,
+  &cos_c_mSubView,
+  &cos_c_mTracer,
+  &cos_c_mValue,
+  &cos_c_mValueSequence,
+  &cos_c_mVarExpr,
+  &cos_c_mVector,
+  &cos_c_mVectorExpr,
+  &cos_c_mView,
+  &cos_c_mXRange,
+  &cos_c_pmArray,
+  &cos_c_pmArray0,
+  &cos_c_pmArray1,
+  &cos_c_pmArray2,
+  &cos_c_pmArray3,
+  &cos_c_pmArray4,
+  &cos_c_pmArray5,
+  &cos_c_pmArray6,
+  &cos_c_pmArray7,
+  &cos_c_pmArray8,
+  &cos_c_pmArray9,
+  &cos_c_pmArrayBlk,
+  &cos_c_pmArrayDyn,
+  &cos_c_pmArrayFix,
+  &cos_c_pmArrayN,
+  &cos_c_pmArraySubView,
+  &cos_c_pmArrayView,
+  &cos_c_pmChar,
+  &cos_c_pmChrVector,
+  &cos_c_pmChrVector0,
+  &cos_c_pmChrVector1,
+  &cos_c_pmChrVector2,
+  &cos_c_pmChrVector3,
+  &cos_c_pmChrVector4,
+  &cos_c_pmChrVector5,
+  &cos_c_pmChrVector6,
+  &cos_c_pmChrVector7,
+  &cos_c_pmChrVector8,
+  &cos_c_pmChrVector9,
+  &cos_c_pmChrVectorDyn,
+  &cos_c_pmChrVectorFix,
+  &cos_c_pmChrVectorN,
+  &cos_c_pmChrVectorSubView,
+  &cos_c_pmChrVectorView,
+  &cos_c_pmCollection,
+  &cos_c_pmComplex,
+  &cos_c_pmComposeFun,
+  &cos_c_pmCpxFunction,
+  &cos_c_pmCpxFunction1,
+  &cos_c_pmCpxFunction2,
+  &cos_c_pmCpxFunction3,
+  &cos_c_pmCpxFunction4,
+  &cos_c_pmCpxFunction5,
+  &cos_c_pmCpxFunction6,
+  &cos_c_pmCpxFunction7,
+  &cos_c_pmCpxFunction8,
+  &cos_c_pmCpxFunction9,
+  &cos_c_pmCpxVector,
+  &cos_c_pmCpxVector0,
+  &cos_c_pmCpxVector1,
+  &cos_c_pmCpxVector2,
+  &cos_c_pmCpxVector3,
+  &cos_c_pmCpxVector4,
+  &cos_c_pmCpxVector5,
+  &cos_c_pmCpxVector6,
+  &cos_c_pmCpxVector7,
+  &cos_c_pmCpxVector8,
+  &cos_c_pmCpxVector9,
+  &cos_c_pmCpxVectorDyn,
+  &cos_c_pmCpxVectorFix,
+  &cos_c_pmCpxVectorN,
+  &cos_c_pmCpxVectorSubView,
+  &cos_c_pmCpxVectorView,
+  &cos_c_pmEqual,
+  &cos_c_pmExBadStream,
+  &cos_c_pmExpression,
+  &cos_c_pmFloat,
+  &cos_c_pmFloating,
+  &cos_c_pmFloatingVector,
+  &cos_c_pmFltFunction,
+  &cos_c_pmFltFunction1,
+  &cos_c_pmFltFunction2,
+  &cos_c_pmFltFunction3,
+  &cos_c_pmFltFunction4,
+  &cos_c_pmFltFunction5,
+  &cos_c_pmFltFunction6,
+  &cos_c_pmFltFunction7,
+  &cos_c_pmFltFunction8,
+  &cos_c_pmFltFunction9,
+  &cos_c_pmFltVector,
+  &cos_c_pmFltVector0,
+  &cos_c_pmFltVector1,
+  &cos_c_pmFltVector2,
+  &cos_c_pmFltVector3,
+  &cos_c_pmFltVector4,
+  &cos_c_pmFltVector5,
+  &cos_c_pmFltVector6,
+  &cos_c_pmFltVector7,
+  &cos_c_pmFltVector8,
+  &cos_c_pmFltVector9,
+  &cos_c_pmFltVectorDyn,
+  &cos_c_pmFltVectorFix,
+  &cos_c_pmFltVectorN,
+  &cos_c_pmFltVectorSubView,
+  &cos_c_pmFltVectorView,
+  &cos_c_pmFunArg,
+  &cos_c_pmFunExpr,
+  &cos_c_pmFunExpr0,
+  &cos_c_pmFunExpr1,
+  &cos_c_pmFunExpr11,
+  &cos_c_pmFunExpr12,
+  &cos_c_pmFunExpr2,
+  &cos_c_pmFunExpr21,
+  &cos_c_pmFunExpr22,
+  &cos_c_pmFunExpr23,
+  &cos_c_pmFunExpr24,
+  &cos_c_pmFunExpr3,
+  &cos_c_pmFunExpr31,
+  &cos_c_pmFunExpr32,
+  &cos_c_pmFunExpr33,
+  &cos_c_pmFunExpr34,
+  &cos_c_pmFunExpr35,
+  &cos_c_pmFunExpr36,
+  &cos_c_pmFunExpr37,
+  &cos_c_pmFunExpr38,
+  &cos_c_pmFunExpr4,
+  &cos_c_pmFunExpr5,
+  &cos_c_pmFunExpr6,
+  &cos_c_pmFunExpr7,
+  &cos_c_pmFunExpr8,
+  &cos_c_pmFunExpr9,
+  &cos_c_pmFunctor,
+  &cos_c_pmG_BinaryOp,
+  &cos_c_pmG_Operator,
+  &cos_c_pmG_TernaryOp,
+  &cos_c_pmG_UnaryOp,
+  &cos_c_pmG_abs,
+  &cos_c_pmG_absolute,
+  &cos_c_pmG_acos,
+  &cos_c_pmG_acosh,
+  &cos_c_pmG_acosine,
+  &cos_c_pmG_acosineh,
+  &cos_c_pmG_add,
+  &cos_c_pmG_addTo,
+  &cos_c_pmG_and,
+  &cos_c_pmG_arg,
+  &cos_c_pmG_argument,
+  &cos_c_pmG_asin,
+  &cos_c_pmG_asine,
+  &cos_c_pmG_asineh,
+  &cos_c_pmG_asinh,
+  &cos_c_pmG_atan,
+  &cos_c_pmG_atangent,
+  &cos_c_pmG_atangenth,
+  &cos_c_pmG_atanh,
+  &cos_c_pmG_compare,
+  &cos_c_pmG_conj,
+  &cos_c_pmG_conjugate,
+  &cos_c_pmG_cos,
+  &cos_c_pmG_cosh,
+  &cos_c_pmG_cosine,
+  &cos_c_pmG_cosineh,
+  &cos_c_pmG_div,
+  &cos_c_pmG_divBy,
+  &cos_c_pmG_exp,
+  &cos_c_pmG_exponential,
+  &cos_c_pmG_hash,
+  &cos_c_pmG_hypot,
+  &cos_c_pmG_implies,
+  &cos_c_pmG_inv,
+  &cos_c_pmG_invert,
+  &cos_c_pmG_isEqual,
+  &cos_c_pmG_isGreater,
+  &cos_c_pmG_isGreaterOrEqual,
+  &cos_c_pmG_isLesser,
+  &cos_c_pmG_isLesserOrEqual,
+  &cos_c_pmG_isNotEqual,
+  &cos_c_pmG_log,
+  &cos_c_pmG_logarithm,
+  &cos_c_pmG_max,
+  &cos_c_pmG_min,
+  &cos_c_pmG_mod,
+  &cos_c_pmG_modulo,
+  &cos_c_pmG_mul,
+  &cos_c_pmG_mulAdd,
+  &cos_c_pmG_mulBy,
+  &cos_c_pmG_neg,
+  &cos_c_pmG_negate,
+  &cos_c_pmG_not,
+  &cos_c_pmG_or,
+  &cos_c_pmG_pow,
+  &cos_c_pmG_power,
+  &cos_c_pmG_prod,
+  &cos_c_pmG_sin,
+  &cos_c_pmG_sine,
+  &cos_c_pmG_sineh,
+  &cos_c_pmG_sinh,
+  &cos_c_pmG_sqr,
+  &cos_c_pmG_sqrErr,
+  &cos_c_pmG_sqroot,
+  &cos_c_pmG_sqrt,
+  &cos_c_pmG_square,
+  &cos_c_pmG_sub,
+  &cos_c_pmG_subTo,
+  &cos_c_pmG_sum,
+  &cos_c_pmG_tan,
+  &cos_c_pmG_tangent,
+  &cos_c_pmG_tangenth,
+  &cos_c_pmG_tanh,
+  &cos_c_pmG_xor,
+  &cos_c_pmGreater,
+  &cos_c_pmInputFile,
+  &cos_c_pmInputOutputFile,
+  &cos_c_pmInputStream,
+  &cos_c_pmInt,
+  &cos_c_pmIntFunction,
+  &cos_c_pmIntFunction1,
+  &cos_c_pmIntFunction2,
+  &cos_c_pmIntFunction3,
+  &cos_c_pmIntFunction4,
+  &cos_c_pmIntFunction5,
+  &cos_c_pmIntFunction6,
+  &cos_c_pmIntFunction7,
+  &cos_c_pmIntFunction8,
+  &cos_c_pmIntFunction9,
+  &cos_c_pmIntVector,
+  &cos_c_pmIntVector0,
+  &cos_c_pmIntVector1,
+  &cos_c_pmIntVector2,
+  &cos_c_pmIntVector3,
+  &cos_c_pmIntVector4,
+  &cos_c_pmIntVector5,
+  &cos_c_pmIntVector6,
+  &cos_c_pmIntVector7,
+  &cos_c_pmIntVector8,
+  &cos_c_pmIntVector9,
+  &cos_c_pmIntVectorDyn,
+  &cos_c_pmIntVectorFix,
+  &cos_c_pmIntVectorN,
+  &cos_c_pmIntVectorSubView,
+  &cos_c_pmIntVectorView,
+  &cos_c_pmIntegral,
+  &cos_c_pmIntegralVector,
+  &cos_c_pmIterateFun,
+  &cos_c_pmIterator,
+  &cos_c_pmLesser,
+  &cos_c_pmLngFunction,
+  &cos_c_pmLngFunction1,
+  &cos_c_pmLngFunction2,
+  &cos_c_pmLngFunction3,
+  &cos_c_pmLngFunction4,
+  &cos_c_pmLngFunction5,
+  &cos_c_pmLngFunction6,
+  &cos_c_pmLngFunction7,
+  &cos_c_pmLngFunction8,
+  &cos_c_pmLngFunction9,
+  &cos_c_pmLngVector,
+  &cos_c_pmLngVector0,
+  &cos_c_pmLngVector1,
+  &cos_c_pmLngVector2,
+  &cos_c_pmLngVector3,
+  &cos_c_pmLngVector4,
+  &cos_c_pmLngVector5,
+  &cos_c_pmLngVector6,
+  &cos_c_pmLngVector7,
+  &cos_c_pmLngVector8,
+  &cos_c_pmLngVector9,
+  &cos_c_pmLngVectorDyn,
+  &cos_c_pmLngVectorFix,
+  &cos_c_pmLngVectorN,
+  &cos_c_pmLngVectorSubView,
+  &cos_c_pmLngVectorView,
+  &cos_c_pmLocker,
+  &cos_c_pmLong,
+  &cos_c_pmMsgExpr,
+  &cos_c_pmNumber,
+  &cos_c_pmOrdered,
+  &cos_c_pmOutputFile,
+  &cos_c_pmOutputInputFile,
+  &cos_c_pmOutputStream,
+  &cos_c_pmRWLocker,
+  &cos_c_pmRange,
+  &cos_c_pmSequence,
+  &cos_c_pmShort,
+  &cos_c_pmShtVector,
+  &cos_c_pmShtVector0,
+  &cos_c_pmShtVector1,
+  &cos_c_pmShtVector2,
+  &cos_c_pmShtVector3,
+  &cos_c_pmShtVector4,
+  &cos_c_pmShtVector5,
+  &cos_c_pmShtVector6,
+  &cos_c_pmShtVector7,
+  &cos_c_pmShtVector8,
+  &cos_c_pmShtVector9,
+  &cos_c_pmShtVectorDyn,
+  &cos_c_pmShtVectorFix,
+  &cos_c_pmShtVectorN,
+  &cos_c_pmShtVectorSubView,
+  &cos_c_pmShtVectorView,
+  &cos_c_pmSlice,
+  &cos_c_pmSpinLocker,
+  &cos_c_pmStream,
+  &cos_c_pmString,
+  &cos_c_pmStringDyn,
+  &cos_c_pmStringFix,
+  &cos_c_pmStringN,
+  &cos_c_pmSubView,
+  &cos_c_pmTracer,
+  &cos_c_pmValue,
+  &cos_c_pmValueSequence,
+  &cos_c_pmVarExpr,
+  &cos_c_pmVector,
+  &cos_c_pmVectorExpr,
+  &cos_c_pmView,
+  &cos_c_pmXRange,
+  &cos_g_gabs,
+  &cos_g_gabsolute,
+  &cos_g_gaccumulate,
+  &cos_g_gaccumulate1,
+  &cos_g_gaccumulate2,
+  &cos_g_gacos,
+  &cos_g_gacosh,
+  &cos_g_gacosine,
+  &cos_g_gacosineh,
+  &cos_g_gadd,
+  &cos_g_gaddTo,
+  &cos_g_gadjust,
+  &cos_g_gall,
+  &cos_g_gallNext,
+  &cos_g_gand,
+  &cos_g_gany,
+  &cos_g_gappend,
+  &cos_g_gapply,
+  &cos_g_gapply2,
+  &cos_g_gapply3,
+  &cos_g_gapply4,
+  &cos_g_gapplyIf,
+  &cos_g_gapplyWhile,
+  &cos_g_garg,
+  &cos_g_gargument,
+  &cos_g_gasin,
+  &cos_g_gasine,
+  &cos_g_gasineh,
+  &cos_g_gasinh,
+  &cos_g_gatan,
+  &cos_g_gatangent,
+  &cos_g_gatangenth,
+  &cos_g_gatanh,
+  &cos_g_gaxpy,
+  &cos_g_gcapacity,
+  &cos_g_gcompare,
+  &cos_g_gcompose,
+  &cos_g_gcomposen,
+  &cos_g_gconcat,
+  &cos_g_gconcat3,
+  &cos_g_gconcat4,
+  &cos_g_gconcatn,
+  &cos_g_gconj,
+  &cos_g_gconjugate,
+  &cos_g_gcos,
+  &cos_g_gcosh,
+  &cos_g_gcosine,
+  &cos_g_gcosineh,
+  &cos_g_gcount,
+  &cos_g_gdelegate,
+  &cos_g_gdiff,
+  &cos_g_gdiv,
+  &cos_g_gdivBy,
+  &cos_g_gdot,
+  &cos_g_gdrop,
+  &cos_g_genlarge,
+  &cos_g_gevalFun,
+  &cos_g_gexp,
+  &cos_g_gexponential,
+  &cos_g_gfind,
+  &cos_g_gfirst,
+  &cos_g_gflush,
+  &cos_g_gforeach,
+  &cos_g_gforeach2,
+  &cos_g_gforeach3,
+  &cos_g_gforeach4,
+  &cos_g_gforeachWhile,
+  &cos_g_ggenerate,
+  &cos_g_gget,
+  &cos_g_ggetChr,
+  &cos_g_ggetContent,
+  &cos_g_ggetData,
+  &cos_g_ggetDelim,
+  &cos_g_ggetDelims,
+  &cos_g_ggetFILE,
+  &cos_g_ggetLine,
+  &cos_g_ggetLines,
+  &cos_g_ggetWhile,
+  &cos_g_ggroup,
+  &cos_g_ghash,
+  &cos_g_ghypot,
+  &cos_g_giamax,
+  &cos_g_gifind,
+  &cos_g_gimplies,
+  &cos_g_gindexOf,
+  &cos_g_ginitWithFILE,
+  &cos_g_ginitWithFun0,
+  &cos_g_ginitWithFun1,
+  &cos_g_ginitWithFun2,
+  &cos_g_ginitWithFun3,
+  &cos_g_ginitWithFun4,
+  &cos_g_ginitWithFun5,
+  &cos_g_ginitWithFun6,
+  &cos_g_ginitWithFun7,
+  &cos_g_ginitWithFun8,
+  &cos_g_ginitWithFun9,
+  &cos_g_ginitWithMth,
+  &cos_g_ginsertAt,
+  &cos_g_gintersect,
+  &cos_g_gintersperse,
+  &cos_g_ginv,
+  &cos_g_ginvert,
+  &cos_g_gisAlnum,
+  &cos_g_gisAlpha,
+  &cos_g_gisBlank,
+  &cos_g_gisCntrl,
+  &cos_g_gisDigit,
+  &cos_g_gisEmpty,
+  &cos_g_gisEqual,
+  &cos_g_gisGraph,
+  &cos_g_gisGreater,
+  &cos_g_gisGreaterOrEqual,
+  &cos_g_gisLesser,
+  &cos_g_gisLesserOrEqual,
+  &cos_g_gisLower,
+  &cos_g_gisNotEqual,
+  &cos_g_gisPrint,
+  &cos_g_gisPunct,
+  &cos_g_gisSorted,
+  &cos_g_gisSpace,
+  &cos_g_gisUpper,
+  &cos_g_gisXDigit,
+  &cos_g_gisort,
+  &cos_g_giterate,
+  &cos_g_giterator,
+  &cos_g_glast,
+  &cos_g_glog,
+  &cos_g_glogarithm,
+  &cos_g_gmap,
+  &cos_g_gmap2,
+  &cos_g_gmap3,
+  &cos_g_gmap4,
+  &cos_g_gmapIf,
+  &cos_g_gmapWhile,
+  &cos_g_gmax,
+  &cos_g_gmerge,
+  &cos_g_gmin,
+  &cos_g_gminmax,
+  &cos_g_gmod,
+  &cos_g_gmodulo,
+  &cos_g_gmul,
+  &cos_g_gmulAdd,
+  &cos_g_gmulBy,
+  &cos_g_gneg,
+  &cos_g_gnegate,
+  &cos_g_gnewRng,
+  &cos_g_gnewSlc,
+  &cos_g_gnewXRng,
+  &cos_g_gnext,
+  &cos_g_gnorm2,
+  &cos_g_gnot,
+  &cos_g_gor,
+  &cos_g_gpermute,
+  &cos_g_gpop,
+  &cos_g_gpopBack,
+  &cos_g_gpopFront,
+  &cos_g_gpow,
+  &cos_g_gpower,
+  &cos_g_gprepend,
+  &cos_g_gprod,
+  &cos_g_gpush,
+  &cos_g_gpushBack,
+  &cos_g_gpushFront,
+  &cos_g_gput,
+  &cos_g_gputChr,
+  &cos_g_gputData,
+  &cos_g_gputLn,
+  &cos_g_gputStr,
+  &cos_g_gputStrLn,
+  &cos_g_gputnChr,
+  &cos_g_greduce,
+  &cos_g_greduce1,
+  &cos_g_greduce2,
+  &cos_g_greject,
+  &cos_g_grejectWhile,
+  &cos_g_gremoveAt,
+  &cos_g_grepeat,
+  &cos_g_grevIterator,
+  &cos_g_greverse,
+  &cos_g_gscal,
+  &cos_g_gseek,
+  &cos_g_gselect,
+  &cos_g_gselectWhile,
+  &cos_g_gsetDelegate,
+  &cos_g_gsin,
+  &cos_g_gsine,
+  &cos_g_gsineh,
+  &cos_g_gsinh,
+  &cos_g_gskipDelim,
+  &cos_g_gskipDelims,
+  &cos_g_gskipLine,
+  &cos_g_gskipWhile,
+  &cos_g_gskipnChr,
+  &cos_g_gsort,
+  &cos_g_gsplit,
+  &cos_g_gsqr,
+  &cos_g_gsqrErr,
+  &cos_g_gsqroot,
+  &cos_g_gsqrt,
+  &cos_g_gsquare,
+  &cos_g_gstrip,
+  &cos_g_gsub,
+  &cos_g_gsubTo,
+  &cos_g_gsum,
+  &cos_g_gtan,
+  &cos_g_gtangent,
+  &cos_g_gtangenth,
+  &cos_g_gtanh,
+  &cos_g_gtell,
+  &cos_g_gtoLower,
+  &cos_g_gtoUpper,
+  &cos_g_gtop,
+  &cos_g_gtopBack,
+  &cos_g_gtopFront,
+  &cos_g_gungetChr,
+  &cos_g_gunique,
+  &cos_g_gxor,
+  &cos_g_gzip,
+  &cos_g_gzip3,
+  &cos_g_gzip4,
+  &cos_g_gzipn,
+  &cos_m_gabs__Complex,
+  &cos_m_gabs__FloatingVector,
+  &cos_m_gabs__Number,
+  &cos_m_gabs__Vector,
+  &cos_m_gabs__VectorExpr,
+  &cos_m_gabsolute__Complex,
+  &cos_m_gabsolute__CpxVector,
+  &cos_m_gabsolute__Float,
+  &cos_m_gabsolute__FltVector,
+  &cos_m_gabsolute__Int,
+  &cos_m_gabsolute__IntVector,
+  &cos_m_gabsolute__LngVector,
+  &cos_m_gabsolute__Long,
+  &cos_m_gabsolute__ShtVector,
+  &cos_m_gaccumulate__Array__Functor,
+  &cos_m_gaccumulate__ChrVector__Functor,
+  &cos_m_gaccumulate__ChrVector__IntFunction2,
+  &cos_m_gaccumulate__CpxVector__CpxFunction2,
+  &cos_m_gaccumulate__CpxVector__Functor,
+  &cos_m_gaccumulate__FltVector__FltFunction2,
+  &cos_m_gaccumulate__FltVector__Functor,
+  &cos_m_gaccumulate__IntVector__Functor,
+  &cos_m_gaccumulate__IntVector__IntFunction2,
+  &cos_m_gaccumulate__LngVector__Functor,
+  &cos_m_gaccumulate__LngVector__LngFunction2,
+  &cos_m_gaccumulate__ShtVector__Functor,
+  &cos_m_gaccumulate__ShtVector__IntFunction2,
+  &cos_m_gaccumulate1__Array__Functor__Object,
+  &cos_m_gaccumulate1__ChrVector__Functor__Object,
+  &cos_m_gaccumulate1__ChrVector__IntFunction2__Object,
+  &cos_m_gaccumulate1__CpxVector__CpxFunction2__Object,
+  &cos_m_gaccumulate1__CpxVector__Functor__Object,
+  &cos_m_gaccumulate1__FltVector__FltFunction2__Object,
+  &cos_m_gaccumulate1__FltVector__Functor__Object,
+  &cos_m_gaccumulate1__IntVector__Functor__Object,
+  &cos_m_gaccumulate1__IntVector__IntFunction2__Object,
+  &cos_m_gaccumulate1__LngVector__Functor__Object,
+  &cos_m_gaccumulate1__LngVector__LngFunction2__Object,
+  &cos_m_gaccumulate1__ShtVector__Functor__Object,
+  &cos_m_gaccumulate1__ShtVector__IntFunction2__Object,
+  &cos_m_gaccumulate2__Array__Functor__Object__Object,
+  &cos_m_gaccumulate2__ChrVector__Functor__Object__Object,
+  &cos_m_gaccumulate2__CpxVector__Functor__Object__Object,
+  &cos_m_gaccumulate2__FltVector__Functor__Object__Object,
+  &cos_m_gaccumulate2__IntVector__Functor__Object__Object,
+  &cos_m_gaccumulate2__LngVector__Functor__Object__Object,
+  &cos_m_gaccumulate2__ShtVector__Functor__Object__Object,
+  &cos_m_gacos__Floating,
+  &cos_m_gacos__FloatingVector,
+  &cos_m_gacosh__Floating,
+  &cos_m_gacosh__FloatingVector,
+  &cos_m_gacosine__Complex,
+  &cos_m_gacosine__CpxVector,
+  &cos_m_gacosine__Float,
+  &cos_m_gacosine__FltVector,
+  &cos_m_gacosineh__Complex,
+  &cos_m_gacosineh__CpxVector,
+  &cos_m_gacosineh__Float,
+  &cos_m_gacosineh__FltVector,
+  &cos_m_gadd__FloatingVector__CpxVector,
+  &cos_m_gadd__Floating__Complex,
+  &cos_m_gadd__IntegralVector__FloatingVector,
+  &cos_m_gadd__IntegralVector__LngVector,
+  &cos_m_gadd__Integral__Floating,
+  &cos_m_gadd__Integral__Long,
+  &cos_m_gadd__Number__Number,
+  &cos_m_gadd__VectorExpr__Vector,
+  &cos_m_gadd__VectorExpr__VectorExpr,
+  &cos_m_gadd__Vector__Vector,
+  &cos_m_gadd__Vector__VectorExpr,
+  &cos_m_gaddTo__Complex__Complex,
+  &cos_m_gaddTo__Complex__Float,
+  &cos_m_gaddTo__Complex__Int,
+  &cos_m_gaddTo__Complex__Long,
+  &cos_m_gaddTo__CpxVector__CpxVector,
+  &cos_m_gaddTo__CpxVector__FltVector,
+  &cos_m_gaddTo__CpxVector__IntVector,
+  &cos_m_gaddTo__CpxVector__LngVector,
+  &cos_m_gaddTo__CpxVector__ShtVector,
+  &cos_m_gaddTo__Float__Float,
+  &cos_m_gaddTo__Float__Int,
+  &cos_m_gaddTo__Float__Long,
+  &cos_m_gaddTo__FltVector__FltVector,
+  &cos_m_gaddTo__FltVector__IntVector,
+  &cos_m_gaddTo__FltVector__LngVector,
+  &cos_m_gaddTo__FltVector__ShtVector,
+  &cos_m_gaddTo__IntVector__IntVector,
+  &cos_m_gaddTo__IntVector__ShtVector,
+  &cos_m_gaddTo__Int__Int,
+  &cos_m_gaddTo__LngVector__IntVector,
+  &cos_m_gaddTo__LngVector__LngVector,
+  &cos_m_gaddTo__LngVector__ShtVector,
+  &cos_m_gaddTo__Long__Int,
+  &cos_m_gaddTo__Long__Long,
+  &cos_m_gaddTo__ShtVector__ShtVector,
+  &cos_m_gadjust__Array,
+  &cos_m_gadjust__ArrayDyn,
+  &cos_m_gadjust__ChrVectorDyn,
+  &cos_m_gadjust__CpxVectorDyn,
+  &cos_m_gadjust__FltVectorDyn,
+  &cos_m_gadjust__IntVectorDyn,
+  &cos_m_gadjust__LngVectorDyn,
+  &cos_m_gadjust__ShtVectorDyn,
+  &cos_m_gadjust__StringDyn,
+  &cos_m_gall__Array__Functor,
+  &cos_m_gall__ChrVector__Functor,
+  &cos_m_gall__ChrVector__IntFunction1,
+  &cos_m_gall__CpxVector__CpxFunction1,
+  &cos_m_gall__CpxVector__Functor,
+  &cos_m_gall__FltVector__FltFunction1,
+  &cos_m_gall__FltVector__Functor,
+  &cos_m_gall__IntVector__Functor,
+  &cos_m_gall__IntVector__IntFunction1,
+  &cos_m_gall__LngVector__Functor,
+  &cos_m_gall__LngVector__LngFunction1,
+  &cos_m_gall__ShtVector__Functor,
+  &cos_m_gall__ShtVector__IntFunction1,
+  &cos_m_gall__String__Functor,
+  &cos_m_gallNext__Iterator,
+  &cos_m_galloc__mView,
+  &cos_m_galloc__pmArray,
+  &cos_m_galloc__pmChrVector,
+  &cos_m_galloc__pmCpxVector,
+  &cos_m_galloc__pmFltVector,
+  &cos_m_galloc__pmFunctor,
+  &cos_m_galloc__pmIntVector,
+  &cos_m_galloc__pmLngVector,
+  &cos_m_galloc__pmNumber,
+  &cos_m_galloc__pmShtVector,
+  &cos_m_galloc__pmString,
+  &cos_m_gand__mFalse__mTrueFalse,
+  &cos_m_gand__mTrueFalse__mFalse,
+  &cos_m_gand__mTrueFalse__mTrueFalse,
+  &cos_m_gand__mTrue__mTrue,
+  &cos_m_gany__Array__Functor,
+  &cos_m_gany__ChrVector__Functor,
+  &cos_m_gany__ChrVector__IntFunction1,
+  &cos_m_gany__CpxVector__CpxFunction1,
+  &cos_m_gany__CpxVector__Functor,
+  &cos_m_gany__FltVector__FltFunction1,
+  &cos_m_gany__FltVector__Functor,
+  &cos_m_gany__IntVector__Functor,
+  &cos_m_gany__IntVector__IntFunction1,
+  &cos_m_gany__LngVector__Functor,
+  &cos_m_gany__LngVector__LngFunction1,
+  &cos_m_gany__ShtVector__Functor,
+  &cos_m_gany__ShtVector__IntFunction1,
+  &cos_m_gany__String__Functor,
+  &cos_m_gappend__ArrayDyn__Array,
+  &cos_m_gappend__ArrayDyn__Object,
+  &cos_m_gappend__ChrVectorDyn__Char,
+  &cos_m_gappend__ChrVectorDyn__ChrVector,
+  &cos_m_gappend__ChrVectorDyn__Object,
+  &cos_m_gappend__CpxVectorDyn__Complex,
+  &cos_m_gappend__CpxVectorDyn__CpxVector,
+  &cos_m_gappend__CpxVectorDyn__Object,
+  &cos_m_gappend__FltVectorDyn__Float,
+  &cos_m_gappend__FltVectorDyn__FltVector,
+  &cos_m_gappend__FltVectorDyn__Object,
+  &cos_m_gappend__IntVectorDyn__Int,
+  &cos_m_gappend__IntVectorDyn__IntVector,
+  &cos_m_gappend__IntVectorDyn__Object,
+  &cos_m_gappend__LngVectorDyn__LngVector,
+  &cos_m_gappend__LngVectorDyn__Long,
+  &cos_m_gappend__LngVectorDyn__Object,
+  &cos_m_gappend__ShtVectorDyn__Object,
+  &cos_m_gappend__ShtVectorDyn__Short,
+  &cos_m_gappend__ShtVectorDyn__ShtVector,
+  &cos_m_gappend__StringDyn__Char,
+  &cos_m_gappend__StringDyn__Object,
+  &cos_m_gappend__StringDyn__String,
+  &cos_m_gapply__CpxFunction1__CpxVector,
+  &cos_m_gapply__FltFunction1__FltVector,
+  &cos_m_gapply__Functor__Array,
+  &cos_m_gapply__Functor__ChrVector,
+  &cos_m_gapply__Functor__CpxVector,
+  &cos_m_gapply__Functor__FltVector,
+  &cos_m_gapply__Functor__IntVector,
+  &cos_m_gapply__Functor__LngVector,
+  &cos_m_gapply__Functor__ShtVector,
+  &cos_m_gapply__Functor__String,
+  &cos_m_gapply__IntFunction1__ChrVector,
+  &cos_m_gapply__IntFunction1__IntVector,
+  &cos_m_gapply__IntFunction1__ShtVector,
+  &cos_m_gapply__LngFunction1__LngVector,
+  &cos_m_gapply__MsgExpr__Array,
+  &cos_m_gapply__MsgExpr__ChrVector,
+  &cos_m_gapply__MsgExpr__CpxVector,
+  &cos_m_gapply__MsgExpr__FltVector,
+  &cos_m_gapply__MsgExpr__IntVector,
+  &cos_m_gapply__MsgExpr__LngVector,
+  &cos_m_gapply__MsgExpr__ShtVector,
+  &cos_m_gapply2__Functor__Array__Array,
+  &cos_m_gapply2__Functor__ChrVector__ChrVector,
+  &cos_m_gapply2__Functor__CpxVector__CpxVector,
+  &cos_m_gapply2__Functor__FltVector__FltVector,
+  &cos_m_gapply2__Functor__IntVector__IntVector,
+  &cos_m_gapply2__Functor__LngVector__LngVector,
+  &cos_m_gapply2__Functor__ShtVector__ShtVector,
+  &cos_m_gapply2__Functor__String__String,
+  &cos_m_gapply2__MsgExpr__Array__Array,
+  &cos_m_gapply2__MsgExpr__ChrVector__ChrVector,
+  &cos_m_gapply2__MsgExpr__CpxVector__CpxVector,
+  &cos_m_gapply2__MsgExpr__FltVector__FltVector,
+  &cos_m_gapply2__MsgExpr__IntVector__IntVector,
+  &cos_m_gapply2__MsgExpr__LngVector__LngVector,
+  &cos_m_gapply2__MsgExpr__ShtVector__ShtVector,
+  &cos_m_gapply3__Functor__Array__Array__Array,
+  &cos_m_gapply3__Functor__ChrVector__ChrVector__ChrVector,
+  &cos_m_gapply3__Functor__CpxVector__CpxVector__CpxVector,
+  &cos_m_gapply3__Functor__FltVector__FltVector__FltVector,
+  &cos_m_gapply3__Functor__IntVector__IntVector__IntVector,
+  &cos_m_gapply3__Functor__LngVector__LngVector__LngVector,
+  &cos_m_gapply3__Functor__ShtVector__ShtVector__ShtVector,
+  &cos_m_gapply3__Functor__String__String__String,
+  &cos_m_gapply4__Functor__Array__Array__Array__Array,
+  &cos_m_gapply4__Functor__ChrVector__ChrVector__ChrVector__ChrVector,
+  &cos_m_gapply4__Functor__CpxVector__CpxVector__CpxVector__CpxVector,
+  &cos_m_gapply4__Functor__FltVector__FltVector__FltVector__FltVector,
+  &cos_m_gapply4__Functor__IntVector__IntVector__IntVector__IntVector,
+  &cos_m_gapply4__Functor__LngVector__LngVector__LngVector__LngVector,
+  &cos_m_gapply4__Functor__ShtVector__ShtVector__ShtVector__ShtVector,
+  &cos_m_gapply4__Functor__String__String__String__String,
+  &cos_m_gapplyIf__Functor__Array,
+  &cos_m_gapplyIf__Functor__ChrVector,
+  &cos_m_gapplyIf__Functor__CpxVector,
+  &cos_m_gapplyIf__Functor__FltVector,
+  &cos_m_gapplyIf__Functor__IntVector,
+  &cos_m_gapplyIf__Functor__LngVector,
+  &cos_m_gapplyIf__Functor__ShtVector,
+  &cos_m_gapplyWhile__Functor__Array,
+  &cos_m_gapplyWhile__Functor__ChrVector,
+  &cos_m_gapplyWhile__Functor__CpxVector,
+  &cos_m_gapplyWhile__Functor__FltVector,
+  &cos_m_gapplyWhile__Functor__IntVector,
+  &cos_m_gapplyWhile__Functor__LngVector,
+  &cos_m_gapplyWhile__Functor__ShtVector,
+  &cos_m_gapplyWhile__Functor__String,
+  &cos_m_garg__Complex,
+  &cos_m_garg__FloatingVector,
+  &cos_m_gargument__Complex,
+  &cos_m_gargument__CpxVector,
+  &cos_m_gasin__Floating,
+  &cos_m_gasin__FloatingVector,
+  &cos_m_gasine__Complex,
+  &cos_m_gasine__CpxVector,
+  &cos_m_gasine__Float,
+  &cos_m_gasine__FltVector,
+  &cos_m_gasineh__Complex,
+  &cos_m_gasineh__CpxVector,
+  &cos_m_gasineh__Float,
+  &cos_m_gasineh__FltVector,
+  &cos_m_gasinh__Floating,
+  &cos_m_gasinh__FloatingVector,
+  &cos_m_gassign__Array__Array,
+  &cos_m_gassign__Vector__VectorExpr,
+  &cos_m_gatan__Floating,
+  &cos_m_gatan__FloatingVector,
+  &cos_m_gatangent__Complex,
+  &cos_m_gatangent__CpxVector,
+  &cos_m_gatangent__Float,
+  &cos_m_gatangent__FltVector,
+  &cos_m_gatangenth__Complex,
+  &cos_m_gatangenth__CpxVector,
+  &cos_m_gatangenth__Float,
+  &cos_m_gatangenth__FltVector,
+  &cos_m_gatanh__Floating,
+  &cos_m_gatanh__FloatingVector,
+  &cos_m_gaxpy__CpxVector__Number__CpxVector,
+  &cos_m_gaxpy__FltVector__Number__FltVector,
+  &cos_m_gbool__mTrue,
+  &cos_m_gbool__mTrueFalse,
+  &cos_m_gcapacity__ArrayDyn,
+  &cos_m_gcapacity__StringDyn,
+  &cos_m_gchr__Char,
+  &cos_m_gchrAt__ChrVector__Int,
+  &cos_m_gchrAt__String__Int,
+  &cos_m_gchrPtr__ChrVector,
+  &cos_m_gchrPtr__String,
+  &cos_m_gclass__Array,
+  &cos_m_gclass__ChrVector,
+  &cos_m_gclass__CpxVector,
+  &cos_m_gclass__FltVector,
+  &cos_m_gclass__IntVector,
+  &cos_m_gclass__LngVector,
+  &cos_m_gclass__ShtVector,
+  &cos_m_gclass__String,
+  &cos_m_gclear__ArrayDyn,
+  &cos_m_gclear__ChrVectorDyn,
+  &cos_m_gclear__Complex,
+  &cos_m_gclear__CpxVectorDyn,
+  &cos_m_gclear__Float,
+  &cos_m_gclear__FltVectorDyn,
+  &cos_m_gclear__Int,
+  &cos_m_gclear__IntVectorDyn,
+  &cos_m_gclear__LngVectorDyn,
+  &cos_m_gclear__Long,
+  &cos_m_gclear__ShtVectorDyn,
+  &cos_m_gclear__StringDyn,
+  &cos_m_gclone__Array,
+  &cos_m_gclone__Char,
+  &cos_m_gclone__ChrVector,
+  &cos_m_gclone__Complex,
+  &cos_m_gclone__CpxVector,
+  &cos_m_gclone__Float,
+  &cos_m_gclone__FltVector,
+  &cos_m_gclone__Int,
+  &cos_m_gclone__IntVector,
+  &cos_m_gclone__LngVector,
+  &cos_m_gclone__Long,
+  &cos_m_gclone__Range,
+  &cos_m_gclone__Short,
+  &cos_m_gclone__ShtVector,
+  &cos_m_gclone__Slice,
+  &cos_m_gclone__String,
+  &cos_m_gclone__XRange,
+  &cos_m_gcompare__Array__Array,
+  &cos_m_gcompare__Float__Float,
+  &cos_m_gcompare__Float__Int,
+  &cos_m_gcompare__Float__Long,
+  &cos_m_gcompare__Int__Float,
+  &cos_m_gcompare__Int__Int,
+  &cos_m_gcompare__Int__Long,
+  &cos_m_gcompare__Long__Float,
+  &cos_m_gcompare__Long__Int,
+  &cos_m_gcompare__Long__Long,
+  &cos_m_gcompare__String__String,
+  &cos_m_gconcat__Array__Array,
+  &cos_m_gconcat__ChrVector__ChrVector,
+  &cos_m_gconcat__CpxVector__CpxVector,
+  &cos_m_gconcat__FltVector__FltVector,
+  &cos_m_gconcat__IntVector__IntVector,
+  &cos_m_gconcat__LngVector__LngVector,
+  &cos_m_gconcat__ShtVector__ShtVector,
+  &cos_m_gconcat__String__String,
+  &cos_m_gconcat3__Array__Array__Array,
+  &cos_m_gconcat3__ChrVector__ChrVector__ChrVector,
+  &cos_m_gconcat3__CpxVector__CpxVector__CpxVector,
+  &cos_m_gconcat3__FltVector__FltVector__FltVector,
+  &cos_m_gconcat3__IntVector__IntVector__IntVector,
+  &cos_m_gconcat3__LngVector__LngVector__LngVector,
+  &cos_m_gconcat3__ShtVector__ShtVector__ShtVector,
+  &cos_m_gconcat3__String__String__String,
+  &cos_m_gconcat4__Array__Array__Array__Array,
+  &cos_m_gconcat4__ChrVector__ChrVector__ChrVector__ChrVector,
+  &cos_m_gconcat4__CpxVector__CpxVector__CpxVector__CpxVector,
+  &cos_m_gconcat4__FltVector__FltVector__FltVector__FltVector,
+  &cos_m_gconcat4__IntVector__IntVector__IntVector__IntVector,
+  &cos_m_gconcat4__LngVector__LngVector__LngVector__LngVector,
+  &cos_m_gconcat4__ShtVector__ShtVector__ShtVector__ShtVector,
+  &cos_m_gconcat4__String__String__String__String,
+  &cos_m_gconcatn__Array,
+  &cos_m_gconj__Complex,
+  &cos_m_gconj__FloatingVector,
+  &cos_m_gconjugate__Complex,
+  &cos_m_gconjugate__CpxVector,
+  &cos_m_gcopy__Array,
+  &cos_m_gcopy__Char,
+  &cos_m_gcopy__Complex,
+  &cos_m_gcopy__Float,
+  &cos_m_gcopy__Int,
+  &cos_m_gcopy__Long,
+  &cos_m_gcopy__Range,
+  &cos_m_gcopy__Short,
+  &cos_m_gcopy__Slice,
+  &cos_m_gcopy__String,
+  &cos_m_gcopy__XRange,
+  &cos_m_gcos__Floating,
+  &cos_m_gcos__FloatingVector,
+  &cos_m_gcosh__Floating,
+  &cos_m_gcosh__FloatingVector,
+  &cos_m_gcosine__Complex,
+  &cos_m_gcosine__CpxVector,
+  &cos_m_gcosine__Float,
+  &cos_m_gcosine__FltVector,
+  &cos_m_gcosineh__Complex,
+  &cos_m_gcosineh__CpxVector,
+  &cos_m_gcosineh__Float,
+  &cos_m_gcosineh__FltVector,
+  &cos_m_gcount__Array__Functor,
+  &cos_m_gcount__ChrVector__Functor,
+  &cos_m_gcount__ChrVector__IntFunction1,
+  &cos_m_gcount__CpxVector__CpxFunction1,
+  &cos_m_gcount__CpxVector__Functor,
+  &cos_m_gcount__FltVector__FltFunction1,
+  &cos_m_gcount__FltVector__Functor,
+  &cos_m_gcount__IntVector__Functor,
+  &cos_m_gcount__IntVector__IntFunction1,
+  &cos_m_gcount__LngVector__Functor,
+  &cos_m_gcount__LngVector__LngFunction1,
+  &cos_m_gcount__ShtVector__Functor,
+  &cos_m_gcount__ShtVector__IntFunction1,
+  &cos_m_gcount__String__Functor,
+  &cos_m_gcpx__Complex,
+  &cos_m_gcpx__Float,
+  &cos_m_gcpx__Int,
+  &cos_m_gcpx__Long,
+  &cos_m_gcpxAt__ChrVector__Int,
+  &cos_m_gcpxAt__CpxVector__Int,
+  &cos_m_gcpxAt__FltVector__Int,
+  &cos_m_gcpxAt__IntVector__Int,
+  &cos_m_gcpxAt__LngVector__Int,
+  &cos_m_gcpxAt__ShtVector__Int,
+  &cos_m_gcpxPtr__CpxVector,
+  &cos_m_gdeinit__Array,
+  &cos_m_gdeinit__ArrayFix,
+  &cos_m_gdeinit__ArrayView,
+  &cos_m_gdeinit__ChrVectorFix,
+  &cos_m_gdeinit__ChrVectorView,
+  &cos_m_gdeinit__CpxVectorFix,
+  &cos_m_gdeinit__CpxVectorView,
+  &cos_m_gdeinit__FltVectorFix,
+  &cos_m_gdeinit__FltVectorView,
+  &cos_m_gdeinit__FunExpr0,
+  &cos_m_gdeinit__FunExpr1,
+  &cos_m_gdeinit__FunExpr2,
+  &cos_m_gdeinit__FunExpr3,
+  &cos_m_gdeinit__FunExpr4,
+  &cos_m_gdeinit__FunExpr5,
+  &cos_m_gdeinit__FunExpr6,
+  &cos_m_gdeinit__FunExpr7,
+  &cos_m_gdeinit__FunExpr8,
+  &cos_m_gdeinit__FunExpr9,
+  &cos_m_gdeinit__InputFile,
+  &cos_m_gdeinit__IntVectorFix,
+  &cos_m_gdeinit__IntVectorView,
+  &cos_m_gdeinit__LngVectorFix,
+  &cos_m_gdeinit__LngVectorView,
+  &cos_m_gdeinit__Locker,
+  &cos_m_gdeinit__OutputFile,
+  &cos_m_gdeinit__ShtVectorFix,
+  &cos_m_gdeinit__ShtVectorView,
+  &cos_m_gdeinit__StringFix,
+  &cos_m_gdeinit__Value,
+  &cos_m_gdeinit__ValueSequence,
+  &cos_m_gdeinit__VectorExpr,
+  &cos_m_gdeinitialize__Any__a__226StdioDeinit,
+  &cos_m_gdiff__Array__Collection__Functor,
+  &cos_m_gdiv__FloatingVector__CpxVector,
+  &cos_m_gdiv__Floating__Complex,
+  &cos_m_gdiv__IntegralVector__FloatingVector,
+  &cos_m_gdiv__IntegralVector__LngVector,
+  &cos_m_gdiv__Integral__Floating,
+  &cos_m_gdiv__Integral__Long,
+  &cos_m_gdiv__Number__Number,
+  &cos_m_gdiv__VectorExpr__Vector,
+  &cos_m_gdiv__VectorExpr__VectorExpr,
+  &cos_m_gdiv__Vector__Vector,
+  &cos_m_gdiv__Vector__VectorExpr,
+  &cos_m_gdivBy__Complex__Complex,
+  &cos_m_gdivBy__Complex__Float,
+  &cos_m_gdivBy__Complex__Int,
+  &cos_m_gdivBy__Complex__Long,
+  &cos_m_gdivBy__CpxVector__CpxVector,
+  &cos_m_gdivBy__CpxVector__FltVector,
+  &cos_m_gdivBy__CpxVector__IntVector,
+  &cos_m_gdivBy__CpxVector__LngVector,
+  &cos_m_gdivBy__CpxVector__ShtVector,
+  &cos_m_gdivBy__Float__Float,
+  &cos_m_gdivBy__Float__Int,
+  &cos_m_gdivBy__Float__Long,
+  &cos_m_gdivBy__FltVector__FltVector,
+  &cos_m_gdivBy__FltVector__IntVector,
+  &cos_m_gdivBy__FltVector__LngVector,
+  &cos_m_gdivBy__FltVector__ShtVector,
+  &cos_m_gdivBy__IntVector__IntVector,
+  &cos_m_gdivBy__IntVector__ShtVector,
+  &cos_m_gdivBy__Int__Int,
+  &cos_m_gdivBy__LngVector__IntVector,
+  &cos_m_gdivBy__LngVector__LngVector,
+  &cos_m_gdivBy__LngVector__ShtVector,
+  &cos_m_gdivBy__Long__Int,
+  &cos_m_gdivBy__Long__Long,
+  &cos_m_gdivBy__ShtVector__ShtVector,
+  &cos_m_gdot__CpxVector__CpxVector,
+  &cos_m_gdot__FltVector__FltVector,
+  &cos_m_gdrop__ArrayDyn__Int,
+  &cos_m_gdrop__ChrVectorDyn__Int,
+  &cos_m_gdrop__CpxVectorDyn__Int,
+  &cos_m_gdrop__FltVectorDyn__Int,
+  &cos_m_gdrop__IntVectorDyn__Int,
+  &cos_m_gdrop__LngVectorDyn__Int,
+  &cos_m_gdrop__ShtVectorDyn__Int,
+  &cos_m_gdrop__StringDyn__Int,
+  &cos_m_genlarge__ArrayDyn__Int,
+  &cos_m_genlarge__ChrVectorDyn__Float,
+  &cos_m_genlarge__ChrVectorDyn__Int,
+  &cos_m_genlarge__CpxVectorDyn__Float,
+  &cos_m_genlarge__CpxVectorDyn__Int,
+  &cos_m_genlarge__FltVectorDyn__Float,
+  &cos_m_genlarge__FltVectorDyn__Int,
+  &cos_m_genlarge__IntVectorDyn__Float,
+  &cos_m_genlarge__IntVectorDyn__Int,
+  &cos_m_genlarge__LngVectorDyn__Float,
+  &cos_m_genlarge__LngVectorDyn__Int,
+  &cos_m_genlarge__ShtVectorDyn__Float,
+  &cos_m_genlarge__ShtVectorDyn__Int,
+  &cos_m_genlarge__StringDyn__Int,
+  &cos_m_gevalFun__FunExpr0,
+  &cos_m_gevalFun__FunExpr1,
+  &cos_m_gevalFun__FunExpr11,
+  &cos_m_gevalFun__FunExpr12,
+  &cos_m_gevalFun__FunExpr2,
+  &cos_m_gevalFun__FunExpr21,
+  &cos_m_gevalFun__FunExpr22,
+  &cos_m_gevalFun__FunExpr23,
+  &cos_m_gevalFun__FunExpr24,
+  &cos_m_gevalFun__FunExpr3,
+  &cos_m_gevalFun__FunExpr31,
+  &cos_m_gevalFun__FunExpr32,
+  &cos_m_gevalFun__FunExpr33,
+  &cos_m_gevalFun__FunExpr34,
+  &cos_m_gevalFun__FunExpr35,
+  &cos_m_gevalFun__FunExpr36,
+  &cos_m_gevalFun__FunExpr37,
+  &cos_m_gevalFun__FunExpr38,
+  &cos_m_gevalFun__FunExpr4,
+  &cos_m_gevalFun__FunExpr5,
+  &cos_m_gevalFun__FunExpr6,
+  &cos_m_gevalFun__FunExpr7,
+  &cos_m_gevalFun__FunExpr8,
+  &cos_m_gevalFun__FunExpr9,
+  &cos_m_gevalFun__MsgExpr,
+  &cos_m_gexp__Floating,
+  &cos_m_gexp__FloatingVector,
+  &cos_m_gexponential__Complex,
+  &cos_m_gexponential__CpxVector,
+  &cos_m_gexponential__Float,
+  &cos_m_gexponential__FltVector,
+  &cos_m_gfind__Array__Array,
+  &cos_m_gfind__Array__Functor,
+  &cos_m_gfind__Array__Object,
+  &cos_m_gfind__ChrVector__ChrVector,
+  &cos_m_gfind__ChrVector__Functor,
+  &cos_m_gfind__ChrVector__Object,
+  &cos_m_gfind__CpxVector__CpxVector,
+  &cos_m_gfind__CpxVector__Functor,
+  &cos_m_gfind__CpxVector__Object,
+  &cos_m_gfind__FltVector__FltVector,
+  &cos_m_gfind__FltVector__Functor,
+  &cos_m_gfind__FltVector__Object,
+  &cos_m_gfind__IntVector__Functor,
+  &cos_m_gfind__IntVector__IntVector,
+  &cos_m_gfind__IntVector__Object,
+  &cos_m_gfind__LngVector__Functor,
+  &cos_m_gfind__LngVector__LngVector,
+  &cos_m_gfind__LngVector__Object,
+  &cos_m_gfind__ShtVector__Functor,
+  &cos_m_gfind__ShtVector__Object,
+  &cos_m_gfind__ShtVector__ShtVector,
+  &cos_m_gfind__String__Char,
+  &cos_m_gfind__String__Functor,
+  &cos_m_gfind__String__Object,
+  &cos_m_gfirst__Array,
+  &cos_m_gfirst__ChrVector,
+  &cos_m_gfirst__CpxVector,
+  &cos_m_gfirst__FltVector,
+  &cos_m_gfirst__IntVector,
+  &cos_m_gfirst__LngVector,
+  &cos_m_gfirst__ShtVector,
+  &cos_m_gfirst__String,
+  &cos_m_gflt__Float,
+  &cos_m_gflt__Int,
+  &cos_m_gflt__Long,
+  &cos_m_gfltAt__ChrVector__Int,
+  &cos_m_gfltAt__FltVector__Int,
+  &cos_m_gfltAt__IntVector__Int,
+  &cos_m_gfltAt__LngVector__Int,
+  &cos_m_gfltAt__ShtVector__Int,
+  &cos_m_gfltPtr__FltVector,
+  &cos_m_gflush__InputFile,
+  &cos_m_gflush__OutputFile,
+  &cos_m_gforeach__Array__Functor,
+  &cos_m_gforeach__Array__MsgExpr,
+  &cos_m_gforeach__ChrVector__Functor,
+  &cos_m_gforeach__ChrVector__IntFunction1,
+  &cos_m_gforeach__ChrVector__MsgExpr,
+  &cos_m_gforeach__CpxVector__CpxFunction1,
+  &cos_m_gforeach__CpxVector__Functor,
+  &cos_m_gforeach__CpxVector__MsgExpr,
+  &cos_m_gforeach__FltVector__FltFunction1,
+  &cos_m_gforeach__FltVector__Functor,
+  &cos_m_gforeach__FltVector__MsgExpr,
+  &cos_m_gforeach__IntVector__Functor,
+  &cos_m_gforeach__IntVector__IntFunction1,
+  &cos_m_gforeach__IntVector__MsgExpr,
+  &cos_m_gforeach__LngVector__Functor,
+  &cos_m_gforeach__LngVector__LngFunction1,
+  &cos_m_gforeach__LngVector__MsgExpr,
+  &cos_m_gforeach__Range__Functor,
+  &cos_m_gforeach__Range__IntFunction1,
+  &cos_m_gforeach__ShtVector__Functor,
+  &cos_m_gforeach__ShtVector__IntFunction1,
+  &cos_m_gforeach__ShtVector__MsgExpr,
+  &cos_m_gforeach__Slice__Functor,
+  &cos_m_gforeach__Slice__IntFunction1,
+  &cos_m_gforeach__XRange__FltFunction1,
+  &cos_m_gforeach__XRange__Functor,
+  &cos_m_gforeach2__Array__Array__Functor,
+  &cos_m_gforeach2__Array__Array__MsgExpr,
+  &cos_m_gforeach2__ChrVector__ChrVector__Functor,
+  &cos_m_gforeach2__ChrVector__ChrVector__MsgExpr,
+  &cos_m_gforeach2__CpxVector__CpxVector__Functor,
+  &cos_m_gforeach2__CpxVector__CpxVector__MsgExpr,
+  &cos_m_gforeach2__FltVector__FltVector__Functor,
+  &cos_m_gforeach2__FltVector__FltVector__MsgExpr,
+  &cos_m_gforeach2__IntVector__IntVector__Functor,
+  &cos_m_gforeach2__IntVector__IntVector__MsgExpr,
+  &cos_m_gforeach2__LngVector__LngVector__Functor,
+  &cos_m_gforeach2__LngVector__LngVector__MsgExpr,
+  &cos_m_gforeach2__ShtVector__ShtVector__Functor,
+  &cos_m_gforeach2__ShtVector__ShtVector__MsgExpr,
+  &cos_m_gforeach3__Array__Array__Array__Functor,
+  &cos_m_gforeach3__ChrVector__ChrVector__ChrVector__Functor,
+  &cos_m_gforeach3__CpxVector__CpxVector__CpxVector__Functor,
+  &cos_m_gforeach3__FltVector__FltVector__FltVector__Functor,
+  &cos_m_gforeach3__IntVector__IntVector__IntVector__Functor,
+  &cos_m_gforeach3__LngVector__LngVector__LngVector__Functor,
+  &cos_m_gforeach3__ShtVector__ShtVector__ShtVector__Functor,
+  &cos_m_gforeach4__Array__Array__Array__Array__Functor,
+  &cos_m_gforeach4__ChrVector__ChrVector__ChrVector__ChrVector__Functor,
+  &cos_m_gforeach4__CpxVector__CpxVector__CpxVector__CpxVector__Functor,
+  &cos_m_gforeach4__FltVector__FltVector__FltVector__FltVector__Functor,
+  &cos_m_gforeach4__IntVector__IntVector__IntVector__IntVector__Functor,
+  &cos_m_gforeach4__LngVector__LngVector__LngVector__LngVector__Functor,
+  &cos_m_gforeach4__ShtVector__ShtVector__ShtVector__ShtVector__Functor,
+  &cos_m_gforeachWhile__Array__Functor,
+  &cos_m_gforeachWhile__ChrVector__Functor,
+  &cos_m_gforeachWhile__CpxVector__Functor,
+  &cos_m_gforeachWhile__FltVector__Functor,
+  &cos_m_gforeachWhile__InputStream__Functor,
+  &cos_m_gforeachWhile__IntVector__Functor,
+  &cos_m_gforeachWhile__LngVector__Functor,
+  &cos_m_gforeachWhile__ShtVector__Functor,
+  &cos_m_gget__InputStream__Char,
+  &cos_m_gget__InputStream__Class,
+  &cos_m_gget__InputStream__Float,
+  &cos_m_gget__InputStream__Int,
+  &cos_m_gget__InputStream__Long,
+  &cos_m_gget__InputStream__Short,
+  &cos_m_gget__InputStream__StringDyn,
+  &cos_m_gget__String__Char,
+  &cos_m_gget__String__Class,
+  &cos_m_gget__String__Complex,
+  &cos_m_gget__String__Float,
+  &cos_m_gget__String__Int,
+  &cos_m_gget__String__Long,
+  &cos_m_gget__String__pmString,
+  &cos_m_ggetAt__Array__Array,
+  &cos_m_ggetAt__Array__Int,
+  &cos_m_ggetAt__Array__IntVector,
+  &cos_m_ggetAt__Array__Range,
+  &cos_m_ggetAt__Array__Slice,
+  &cos_m_ggetAt__ChrVector__Int,
+  &cos_m_ggetAt__ChrVector__IntVector,
+  &cos_m_ggetAt__ChrVector__Range,
+  &cos_m_ggetAt__ChrVector__Slice,
+  &cos_m_ggetAt__CpxVector__Int,
+  &cos_m_ggetAt__CpxVector__IntVector,
+  &cos_m_ggetAt__CpxVector__Range,
+  &cos_m_ggetAt__CpxVector__Slice,
+  &cos_m_ggetAt__FltVector__Int,
+  &cos_m_ggetAt__FltVector__IntVector,
+  &cos_m_ggetAt__FltVector__Range,
+  &cos_m_ggetAt__FltVector__Slice,
+  &cos_m_ggetAt__IntVector__Int,
+  &cos_m_ggetAt__IntVector__IntVector,
+  &cos_m_ggetAt__IntVector__Range,
+  &cos_m_ggetAt__IntVector__Slice,
+  &cos_m_ggetAt__LngVector__Int,
+  &cos_m_ggetAt__LngVector__IntVector,
+  &cos_m_ggetAt__LngVector__Range,
+  &cos_m_ggetAt__LngVector__Slice,
+  &cos_m_ggetAt__ShtVector__Int,
+  &cos_m_ggetAt__ShtVector__IntVector,
+  &cos_m_ggetAt__ShtVector__Range,
+  &cos_m_ggetAt__ShtVector__Slice,
+  &cos_m_ggetAt__String__Array,
+  &cos_m_ggetAt__String__Int,
+  &cos_m_ggetAt__String__IntVector,
+  &cos_m_ggetAt__String__Range,
+  &cos_m_ggetAt__String__Slice,
+  &cos_m_ggetAtIdx__Array,
+  &cos_m_ggetAtIdx__ChrVector,
+  &cos_m_ggetAtIdx__CpxVector,
+  &cos_m_ggetAtIdx__FltVector,
+  &cos_m_ggetAtIdx__IntVector,
+  &cos_m_ggetAtIdx__LngVector,
+  &cos_m_ggetAtIdx__ShtVector,
+  &cos_m_ggetAtIdx__String,
+  &cos_m_ggetChr__InputFile,
+  &cos_m_ggetContent__InputStream,
+  &cos_m_ggetData__InputStream,
+  &cos_m_ggetDelim__InputStream,
+  &cos_m_ggetDelims__InputStream,
+  &cos_m_ggetFILE__InputFile,
+  &cos_m_ggetFILE__OutputFile,
+  &cos_m_ggetLine__InputStream,
+  &cos_m_ggetLines__InputStream,
+  &cos_m_ggetWhile__InputStream__Functor,
+  &cos_m_ghypot__Float__Float,
+  &cos_m_giamax__CpxVector,
+  &cos_m_giamax__FltVector,
+  &cos_m_gifind__Array__Array,
+  &cos_m_gifind__Array__Functor,
+  &cos_m_gifind__Array__Object,
+  &cos_m_gifind__ChrVector__ChrVector,
+  &cos_m_gifind__ChrVector__Functor,
+  &cos_m_gifind__ChrVector__Object,
+  &cos_m_gifind__CpxVector__CpxVector,
+  &cos_m_gifind__CpxVector__Functor,
+  &cos_m_gifind__CpxVector__Object,
+  &cos_m_gifind__FltVector__FltVector,
+  &cos_m_gifind__FltVector__Functor,
+  &cos_m_gifind__FltVector__Object,
+  &cos_m_gifind__IntVector__Functor,
+  &cos_m_gifind__IntVector__IntVector,
+  &cos_m_gifind__IntVector__Object,
+  &cos_m_gifind__LngVector__Functor,
+  &cos_m_gifind__LngVector__LngVector,
+  &cos_m_gifind__LngVector__Object,
+  &cos_m_gifind__ShtVector__Functor,
+  &cos_m_gifind__ShtVector__Object,
+  &cos_m_gifind__ShtVector__ShtVector,
+  &cos_m_gifind__String__Char,
+  &cos_m_gifind__String__Functor,
+  &cos_m_gifind__String__Object,
+  &cos_m_gifind__String__String,
+  &cos_m_gimplies__mFalse__mTrueFalse,
+  &cos_m_gimplies__mTrueFalse__mTrue,
+  &cos_m_gimplies__mTrueFalse__mTrueFalse,
+  &cos_m_gimplies__mTrue__mFalse,
+  &cos_m_gindexOf__Array__Array,
+  &cos_m_gindexOf__ChrVector__ChrVector,
+  &cos_m_gindexOf__CpxVector__CpxVector,
+  &cos_m_gindexOf__FltVector__FltVector,
+  &cos_m_gindexOf__IntVector__IntVector,
+  &cos_m_gindexOf__LngVector__LngVector,
+  &cos_m_gindexOf__ShtVector__ShtVector,
+  &cos_m_gindexOf__String__String,
+  &cos_m_ginit__ArrayDyn,
+  &cos_m_ginit__Complex,
+  &cos_m_ginit__Float,
+  &cos_m_ginit__Int,
+  &cos_m_ginit__Long,
+  &cos_m_ginit__StringDyn,
+  &cos_m_ginit__pmArray,
+  &cos_m_ginit__pmChrVector,
+  &cos_m_ginit__pmCpxVector,
+  &cos_m_ginit__pmFltVector,
+  &cos_m_ginit__pmIntVector,
+  &cos_m_ginit__pmLngVector,
+  &cos_m_ginit__pmShtVector,
+  &cos_m_ginit__pmString,
+  &cos_m_ginitWith__ArrayDyn__Int,
+  &cos_m_ginitWith__ChrVectorDyn__Int,
+  &cos_m_ginitWith__Complex__Complex,
+  &cos_m_ginitWith__Complex__Float,
+  &cos_m_ginitWith__Complex__Int,
+  &cos_m_ginitWith__Complex__Long,
+  &cos_m_ginitWith__CpxVectorDyn__Int,
+  &cos_m_ginitWith__Float__Float,
+  &cos_m_ginitWith__Float__Int,
+  &cos_m_ginitWith__Float__Long,
+  &cos_m_ginitWith__FltVectorDyn__Int,
+  &cos_m_ginitWith__FunExpr0__FunExpr0,
+  &cos_m_ginitWith__FunExpr1__FunExpr1,
+  &cos_m_ginitWith__FunExpr2__FunExpr2,
+  &cos_m_ginitWith__FunExpr3__FunExpr3,
+  &cos_m_ginitWith__FunExpr4__FunExpr4,
+  &cos_m_ginitWith__FunExpr5__FunExpr5,
+  &cos_m_ginitWith__FunExpr6__FunExpr6,
+  &cos_m_ginitWith__FunExpr7__FunExpr7,
+  &cos_m_ginitWith__FunExpr8__FunExpr8,
+  &cos_m_ginitWith__FunExpr9__FunExpr9,
+  &cos_m_ginitWith__InputFile__String,
+  &cos_m_ginitWith__InputOutputFile__String,
+  &cos_m_ginitWith__IntVectorDyn__Int,
+  &cos_m_ginitWith__Int__Int,
+  &cos_m_ginitWith__LngVectorDyn__Int,
+  &cos_m_ginitWith__Locker__Object,
+  &cos_m_ginitWith__Long__Int,
+  &cos_m_ginitWith__Long__Long,
+  &cos_m_ginitWith__OutputFile__String,
+  &cos_m_ginitWith__OutputInputFile__String,
+  &cos_m_ginitWith__RWLocker__Object,
+  &cos_m_ginitWith__ShtVectorDyn__Int,
+  &cos_m_ginitWith__SpinLocker__Object,
+  &cos_m_ginitWith__StringDyn__Int,
+  &cos_m_ginitWith__VectorExpr__Vector,
+  &cos_m_ginitWith__VectorExpr__VectorExpr,
+  &cos_m_ginitWith__pmArray__Array,
+  &cos_m_ginitWith__pmArray__Int,
+  &cos_m_ginitWith__pmArray__Range,
+  &cos_m_ginitWith__pmArray__Slice,
+  &cos_m_ginitWith__pmArray__XRange,
+  &cos_m_ginitWith__pmChrVector__ChrVector,
+  &cos_m_ginitWith__pmChrVector__Int,
+  &cos_m_ginitWith__pmChrVector__Range,
+  &cos_m_ginitWith__pmChrVector__Slice,
+  &cos_m_ginitWith__pmChrVector__XRange,
+  &cos_m_ginitWith__pmCpxVector__CpxVector,
+  &cos_m_ginitWith__pmCpxVector__Int,
+  &cos_m_ginitWith__pmCpxVector__Range,
+  &cos_m_ginitWith__pmCpxVector__Slice,
+  &cos_m_ginitWith__pmCpxVector__VectorExpr,
+  &cos_m_ginitWith__pmCpxVector__XRange,
+  &cos_m_ginitWith__pmFltVector__FltVector,
+  &cos_m_ginitWith__pmFltVector__Int,
+  &cos_m_ginitWith__pmFltVector__Range,
+  &cos_m_ginitWith__pmFltVector__Slice,
+  &cos_m_ginitWith__pmFltVector__VectorExpr,
+  &cos_m_ginitWith__pmFltVector__XRange,
+  &cos_m_ginitWith__pmIntVector__Int,
+  &cos_m_ginitWith__pmIntVector__IntVector,
+  &cos_m_ginitWith__pmIntVector__Range,
+  &cos_m_ginitWith__pmIntVector__Slice,
+  &cos_m_ginitWith__pmIntVector__VectorExpr,
+  &cos_m_ginitWith__pmIntVector__XRange,
+  &cos_m_ginitWith__pmLngVector__Int,
+  &cos_m_ginitWith__pmLngVector__LngVector,
+  &cos_m_ginitWith__pmLngVector__Range,
+  &cos_m_ginitWith__pmLngVector__Slice,
+  &cos_m_ginitWith__pmLngVector__VectorExpr,
+  &cos_m_ginitWith__pmLngVector__XRange,
+  &cos_m_ginitWith__pmNumber__Char,
+  &cos_m_ginitWith__pmNumber__Complex,
+  &cos_m_ginitWith__pmNumber__Float,
+  &cos_m_ginitWith__pmNumber__Int,
+  &cos_m_ginitWith__pmNumber__Long,
+  &cos_m_ginitWith__pmNumber__Short,
+  &cos_m_ginitWith__pmShtVector__Int,
+  &cos_m_ginitWith__pmShtVector__Range,
+  &cos_m_ginitWith__pmShtVector__ShtVector,
+  &cos_m_ginitWith__pmShtVector__Slice,
+  &cos_m_ginitWith__pmShtVector__VectorExpr,
+  &cos_m_ginitWith__pmShtVector__XRange,
+  &cos_m_ginitWith__pmString__Int,
+  &cos_m_ginitWith__pmString__String,
+  &cos_m_ginitWith2__ArraySubView__Array__Range,
+  &cos_m_ginitWith2__ArraySubView__Array__Slice,
+  &cos_m_ginitWith2__ArrayView__Array__Range,
+  &cos_m_ginitWith2__ArrayView__Array__Slice,
+  &cos_m_ginitWith2__Complex__Float__Float,
+  &cos_m_ginitWith2__mSubView__Array__Range,
+  &cos_m_ginitWith2__mSubView__Array__Slice,
+  &cos_m_ginitWith2__mSubView__ChrVector__Range,
+  &cos_m_ginitWith2__mSubView__ChrVector__Slice,
+  &cos_m_ginitWith2__mSubView__CpxVector__Range,
+  &cos_m_ginitWith2__mSubView__CpxVector__Slice,
+  &cos_m_ginitWith2__mSubView__FltVector__Range,
+  &cos_m_ginitWith2__mSubView__FltVector__Slice,
+  &cos_m_ginitWith2__mSubView__IntVector__Range,
+  &cos_m_ginitWith2__mSubView__IntVector__Slice,
+  &cos_m_ginitWith2__mSubView__LngVector__Range,
+  &cos_m_ginitWith2__mSubView__LngVector__Slice,
+  &cos_m_ginitWith2__mSubView__ShtVector__Range,
+  &cos_m_ginitWith2__mSubView__ShtVector__Slice,
+  &cos_m_ginitWith2__mView__Array__Range,
+  &cos_m_ginitWith2__mView__Array__Slice,
+  &cos_m_ginitWith2__mView__ChrVector__Range,
+  &cos_m_ginitWith2__mView__ChrVector__Slice,
+  &cos_m_ginitWith2__mView__CpxVector__Range,
+  &cos_m_ginitWith2__mView__CpxVector__Slice,
+  &cos_m_ginitWith2__mView__FltVector__Range,
+  &cos_m_ginitWith2__mView__FltVector__Slice,
+  &cos_m_ginitWith2__mView__IntVector__Range,
+  &cos_m_ginitWith2__mView__IntVector__Slice,
+  &cos_m_ginitWith2__mView__LngVector__Range,
+  &cos_m_ginitWith2__mView__LngVector__Slice,
+  &cos_m_ginitWith2__mView__ShtVector__Range,
+  &cos_m_ginitWith2__mView__ShtVector__Slice,
+  &cos_m_ginitWith2__pmArray__Array__IntVector,
+  &cos_m_ginitWith2__pmArray__Array__Range,
+  &cos_m_ginitWith2__pmArray__Array__Slice,
+  &cos_m_ginitWith2__pmArray__Int__Functor,
+  &cos_m_ginitWith2__pmArray__Int__Object,
+  &cos_m_ginitWith2__pmChrVector__ChrVector__IntVector,
+  &cos_m_ginitWith2__pmChrVector__ChrVector__Range,
+  &cos_m_ginitWith2__pmChrVector__ChrVector__Slice,
+  &cos_m_ginitWith2__pmChrVector__Int__Functor,
+  &cos_m_ginitWith2__pmChrVector__Int__Object,
+  &cos_m_ginitWith2__pmCpxVector__CpxVector__IntVector,
+  &cos_m_ginitWith2__pmCpxVector__CpxVector__Range,
+  &cos_m_ginitWith2__pmCpxVector__CpxVector__Slice,
+  &cos_m_ginitWith2__pmCpxVector__Int__Functor,
+  &cos_m_ginitWith2__pmCpxVector__Int__Object,
+  &cos_m_ginitWith2__pmFltVector__FltVector__IntVector,
+  &cos_m_ginitWith2__pmFltVector__FltVector__Range,
+  &cos_m_ginitWith2__pmFltVector__FltVector__Slice,
+  &cos_m_ginitWith2__pmFltVector__Int__Functor,
+  &cos_m_ginitWith2__pmFltVector__Int__Object,
+  &cos_m_ginitWith2__pmIntVector__IntVector__IntVector,
+  &cos_m_ginitWith2__pmIntVector__IntVector__Range,
+  &cos_m_ginitWith2__pmIntVector__IntVector__Slice,
+  &cos_m_ginitWith2__pmIntVector__Int__Functor,
+  &cos_m_ginitWith2__pmIntVector__Int__Object,
+  &cos_m_ginitWith2__pmLngVector__Int__Functor,
+  &cos_m_ginitWith2__pmLngVector__Int__Object,
+  &cos_m_ginitWith2__pmLngVector__LngVector__IntVector,
+  &cos_m_ginitWith2__pmLngVector__LngVector__Range,
+  &cos_m_ginitWith2__pmLngVector__LngVector__Slice,
+  &cos_m_ginitWith2__pmShtVector__Int__Functor,
+  &cos_m_ginitWith2__pmShtVector__Int__Object,
+  &cos_m_ginitWith2__pmShtVector__ShtVector__IntVector,
+  &cos_m_ginitWith2__pmShtVector__ShtVector__Range,
+  &cos_m_ginitWith2__pmShtVector__ShtVector__Slice,
+  &cos_m_ginitWith2__pmString__Int__Functor,
+  &cos_m_ginitWith2__pmString__Int__Object,
+  &cos_m_ginitWith2__pmString__String__IntVector,
+  &cos_m_ginitWith2__pmString__String__Range,
+  &cos_m_ginitWith2__pmString__String__Slice,
+  &cos_m_ginitWith3__ChrVectorView__ChrVector__Slice__Int,
+  &cos_m_ginitWith3__CpxVectorView__CpxVector__Slice__Int,
+  &cos_m_ginitWith3__FltVectorView__FltVector__Slice__Int,
+  &cos_m_ginitWith3__IntVectorView__IntVector__Slice__Int,
+  &cos_m_ginitWith3__LngVectorView__LngVector__Slice__Int,
+  &cos_m_ginitWith3__ShtVectorView__ShtVector__Slice__Int,
+  &cos_m_ginitWithChr__Char,
+  &cos_m_ginitWithChrPtr__pmChrVector,
+  &cos_m_ginitWithChrPtr__pmString,
+  &cos_m_ginitWithCpx__Complex,
+  &cos_m_ginitWithCpxPtr__pmCpxVector,
+  &cos_m_ginitWithFILE__InputFile__String,
+  &cos_m_ginitWithFILE__OutputFile__String,
+  &cos_m_ginitWithFlt__Float,
+  &cos_m_ginitWithFltPtr__pmFltVector,
+  &cos_m_ginitWithFun0__pmFunctor,
+  &cos_m_ginitWithFun1__pmFunctor,
+  &cos_m_ginitWithFun2__pmFunctor,
+  &cos_m_ginitWithFun3__pmFunctor,
+  &cos_m_ginitWithFun4__pmFunctor,
+  &cos_m_ginitWithFun5__pmFunctor,
+  &cos_m_ginitWithFun6__pmFunctor,
+  &cos_m_ginitWithFun7__pmFunctor,
+  &cos_m_ginitWithFun8__pmFunctor,
+  &cos_m_ginitWithFun9__pmFunctor,
+  &cos_m_ginitWithInt__Int,
+  &cos_m_ginitWithIntPtr__pmIntVector,
+  &cos_m_ginitWithLng__Long,
+  &cos_m_ginitWithLngPtr__pmLngVector,
+  &cos_m_ginitWithLoc__Tracer__Object,
+  &cos_m_ginitWithSht__Short,
+  &cos_m_ginitWithShtPtr__pmShtVector,
+  &cos_m_ginitWithStr__pmString,
+  &cos_m_ginitialize__Any__a__219StdioInit,
+  &cos_m_ginsertAt__ChrVectorDyn__Int__Object,
+  &cos_m_ginsertAt__ChrVectorDyn__Range__Object,
+  &cos_m_ginsertAt__ChrVectorDyn__Slice__ChrVector,
+  &cos_m_ginsertAt__ChrVectorDyn__Slice__Object,
+  &cos_m_ginsertAt__CpxVectorDyn__Int__Object,
+  &cos_m_ginsertAt__CpxVectorDyn__Range__Object,
+  &cos_m_ginsertAt__CpxVectorDyn__Slice__CpxVector,
+  &cos_m_ginsertAt__CpxVectorDyn__Slice__Object,
+  &cos_m_ginsertAt__FltVectorDyn__Int__Object,
+  &cos_m_ginsertAt__FltVectorDyn__Range__Object,
+  &cos_m_ginsertAt__FltVectorDyn__Slice__FltVector,
+  &cos_m_ginsertAt__FltVectorDyn__Slice__Object,
+  &cos_m_ginsertAt__IntVectorDyn__Int__Object,
+  &cos_m_ginsertAt__IntVectorDyn__Range__Object,
+  &cos_m_ginsertAt__IntVectorDyn__Slice__IntVector,
+  &cos_m_ginsertAt__IntVectorDyn__Slice__Object,
+  &cos_m_ginsertAt__LngVectorDyn__Int__Object,
+  &cos_m_ginsertAt__LngVectorDyn__Range__Object,
+  &cos_m_ginsertAt__LngVectorDyn__Slice__LngVector,
+  &cos_m_ginsertAt__LngVectorDyn__Slice__Object,
+  &cos_m_ginsertAt__ShtVectorDyn__Int__Object,
+  &cos_m_ginsertAt__ShtVectorDyn__Range__Object,
+  &cos_m_ginsertAt__ShtVectorDyn__Slice__Object,
+  &cos_m_ginsertAt__ShtVectorDyn__Slice__ShtVector,
+  &cos_m_gint__Int,
+  &cos_m_gint__mFalse,
+  &cos_m_gint__mTrue,
+  &cos_m_gint__mTrueFalse,
+  &cos_m_gintAt__ChrVector__Int,
+  &cos_m_gintAt__IntVector__Int,
+  &cos_m_gintAt__ShtVector__Int,
+  &cos_m_gintPtr__IntVector,
+  &cos_m_gintersect__Array__Collection__Functor,
+  &cos_m_ginv__Floating,
+  &cos_m_ginv__FloatingVector,
+  &cos_m_ginv__VectorExpr,
+  &cos_m_ginvariant__Array,
+  &cos_m_ginvariant__ArrayDyn,
+  &cos_m_ginvariant__ArrayView,
+  &cos_m_ginvariant__ChrVectorDyn,
+  &cos_m_ginvariant__ChrVectorView,
+  &cos_m_ginvariant__CpxVectorDyn,
+  &cos_m_ginvariant__CpxVectorView,
+  &cos_m_ginvariant__FltVectorDyn,
+  &cos_m_ginvariant__FltVectorView,
+  &cos_m_ginvariant__IntVectorDyn,
+  &cos_m_ginvariant__IntVectorView,
+  &cos_m_ginvariant__LngVectorDyn,
+  &cos_m_ginvariant__LngVectorView,
+  &cos_m_ginvariant__ShtVectorDyn,
+  &cos_m_ginvariant__ShtVectorView,
+  &cos_m_ginvariant__StringDyn,
+  &cos_m_ginvert__Complex,
+  &cos_m_ginvert__CpxVector,
+  &cos_m_ginvert__Float,
+  &cos_m_ginvert__FltVector,
+  &cos_m_gisAlnum__Char,
+  &cos_m_gisAlpha__Char,
+  &cos_m_gisBlank__Char,
+  &cos_m_gisCntrl__Char,
+  &cos_m_gisDigit__Char,
+  &cos_m_gisEmpty__Array,
+  &cos_m_gisEmpty__ChrVector,
+  &cos_m_gisEmpty__CpxVector,
+  &cos_m_gisEmpty__FltVector,
+  &cos_m_gisEmpty__InputFile,
+  &cos_m_gisEmpty__IntVector,
+  &cos_m_gisEmpty__LngVector,
+  &cos_m_gisEmpty__OutputFile,
+  &cos_m_gisEmpty__ShtVector,
+  &cos_m_gisEmpty__String,
+  &cos_m_gisEqual__Array__Array,
+  &cos_m_gisEqual__ChrVector__ChrVector,
+  &cos_m_gisEqual__Class__Class,
+  &cos_m_gisEqual__Complex__Complex,
+  &cos_m_gisEqual__Complex__Float,
+  &cos_m_gisEqual__Complex__Int,
+  &cos_m_gisEqual__Complex__Long,
+  &cos_m_gisEqual__CpxVector__CpxVector,
+  &cos_m_gisEqual__Float__Complex,
+  &cos_m_gisEqual__Float__Float,
+  &cos_m_gisEqual__Float__Int,
+  &cos_m_gisEqual__Float__Long,
+  &cos_m_gisEqual__FltVector__FltVector,
+  &cos_m_gisEqual__IntVector__IntVector,
+  &cos_m_gisEqual__Int__Complex,
+  &cos_m_gisEqual__Int__Float,
+  &cos_m_gisEqual__Int__Int,
+  &cos_m_gisEqual__Int__Long,
+  &cos_m_gisEqual__LngVector__LngVector,
+  &cos_m_gisEqual__Long__Complex,
+  &cos_m_gisEqual__Long__Float,
+  &cos_m_gisEqual__Long__Int,
+  &cos_m_gisEqual__Long__Long,
+  &cos_m_gisEqual__Range__Range,
+  &cos_m_gisEqual__ShtVector__ShtVector,
+  &cos_m_gisEqual__Slice__Slice,
+  &cos_m_gisEqual__String__String,
+  &cos_m_gisEqual__XRange__XRange,
+  &cos_m_gisEqual__mFalse__mFalse,
+  &cos_m_gisEqual__mTrueFalse__mTrue,
+  &cos_m_gisEqual__mTrueFalse__mTrueFalse,
+  &cos_m_gisEqual__mTrue__mTrueFalse,
+  &cos_m_gisGraph__Char,
+  &cos_m_gisGreater__Number__Number,
+  &cos_m_gisGreaterOrEqual__Number__Number,
+  &cos_m_gisLesser__Number__Number,
+  &cos_m_gisLesserOrEqual__Number__Number,
+  &cos_m_gisLower__Char,
+  &cos_m_gisNotEqual__Number__Number,
+  &cos_m_gisNotEqual__mFalse__mTrueFalse,
+  &cos_m_gisNotEqual__mTrueFalse__mFalse,
+  &cos_m_gisNotEqual__mTrueFalse__mTrueFalse,
+  &cos_m_gisNotEqual__mTrue__mTrue,
+  &cos_m_gisPrint__Char,
+  &cos_m_gisPunct__Char,
+  &cos_m_gisSorted__Array__Functor,
+  &cos_m_gisSorted__ChrVector__Functor,
+  &cos_m_gisSorted__CpxVector__Functor,
+  &cos_m_gisSorted__FltVector__Functor,
+  &cos_m_gisSorted__IntVector__Functor,
+  &cos_m_gisSorted__LngVector__Functor,
+  &cos_m_gisSorted__ShtVector__Functor,
+  &cos_m_gisSpace__Char,
+  &cos_m_gisUpper__Char,
+  &cos_m_gisXDigit__Char,
+  &cos_m_gisort__Array__Functor,
+  &cos_m_gisort__ChrVector__Functor,
+  &cos_m_gisort__ChrVector__IntFunction2,
+  &cos_m_gisort__ChrVector__pmGreater,
+  &cos_m_gisort__ChrVector__pmLesser,
+  &cos_m_gisort__CpxVector__Functor,
+  &cos_m_gisort__FltVector__FltFunction2,
+  &cos_m_gisort__FltVector__Functor,
+  &cos_m_gisort__FltVector__pmGreater,
+  &cos_m_gisort__FltVector__pmLesser,
+  &cos_m_gisort__IntVector__Functor,
+  &cos_m_gisort__IntVector__IntFunction2,
+  &cos_m_gisort__IntVector__pmGreater,
+  &cos_m_gisort__IntVector__pmLesser,
+  &cos_m_gisort__LngVector__Functor,
+  &cos_m_gisort__LngVector__LngFunction2,
+  &cos_m_gisort__LngVector__pmGreater,
+  &cos_m_gisort__LngVector__pmLesser,
+  &cos_m_gisort__ShtVector__Functor,
+  &cos_m_gisort__ShtVector__IntFunction2,
+  &cos_m_gisort__ShtVector__pmGreater,
+  &cos_m_gisort__ShtVector__pmLesser,
+  &cos_m_glast__Array,
+  &cos_m_glast__ChrVector,
+  &cos_m_glast__CpxVector,
+  &cos_m_glast__FltVector,
+  &cos_m_glast__IntVector,
+  &cos_m_glast__LngVector,
+  &cos_m_glast__ShtVector,
+  &cos_m_glast__String,
+  &cos_m_glng__Int,
+  &cos_m_glng__Long,
+  &cos_m_glngAt__ChrVector__Int,
+  &cos_m_glngAt__IntVector__Int,
+  &cos_m_glngAt__LngVector__Int,
+  &cos_m_glngAt__ShtVector__Int,
+  &cos_m_glngPtr__LngVector,
+  &cos_m_glog__Floating,
+  &cos_m_glog__FloatingVector,
+  &cos_m_glogarithm__Complex,
+  &cos_m_glogarithm__CpxVector,
+  &cos_m_glogarithm__Float,
+  &cos_m_glogarithm__FltVector,
+  &cos_m_gmap__CpxFunction1__CpxVector,
+  &cos_m_gmap__FltFunction1__FltVector,
+  &cos_m_gmap__FltFunction1__XRange,
+  &cos_m_gmap__Functor__Array,
+  &cos_m_gmap__Functor__ChrVector,
+  &cos_m_gmap__Functor__CpxVector,
+  &cos_m_gmap__Functor__FltVector,
+  &cos_m_gmap__Functor__IntVector,
+  &cos_m_gmap__Functor__LngVector,
+  &cos_m_gmap__Functor__Range,
+  &cos_m_gmap__Functor__ShtVector,
+  &cos_m_gmap__Functor__Slice,
+  &cos_m_gmap__Functor__String,
+  &cos_m_gmap__Functor__XRange,
+  &cos_m_gmap__IntFunction1__ChrVector,
+  &cos_m_gmap__IntFunction1__IntVector,
+  &cos_m_gmap__IntFunction1__Range,
+  &cos_m_gmap__IntFunction1__ShtVector,
+  &cos_m_gmap__IntFunction1__Slice,
+  &cos_m_gmap__LngFunction1__LngVector,
+  &cos_m_gmap__MsgExpr__Array,
+  &cos_m_gmap__MsgExpr__ChrVector,
+  &cos_m_gmap__MsgExpr__CpxVector,
+  &cos_m_gmap__MsgExpr__FltVector,
+  &cos_m_gmap__MsgExpr__IntVector,
+  &cos_m_gmap__MsgExpr__LngVector,
+  &cos_m_gmap__MsgExpr__ShtVector,
+  &cos_m_gmap2__CpxFunction2__CpxVector__CpxVector,
+  &cos_m_gmap2__FltFunction2__FltVector__FltVector,
+  &cos_m_gmap2__Functor__Array__Array,
+  &cos_m_gmap2__Functor__ChrVector__ChrVector,
+  &cos_m_gmap2__Functor__CpxVector__CpxVector,
+  &cos_m_gmap2__Functor__FltVector__FltVector,
+  &cos_m_gmap2__Functor__IntVector__IntVector,
+  &cos_m_gmap2__Functor__LngVector__LngVector,
+  &cos_m_gmap2__Functor__ShtVector__ShtVector,
+  &cos_m_gmap2__Functor__String__String,
+  &cos_m_gmap2__IntFunction2__ChrVector__ChrVector,
+  &cos_m_gmap2__IntFunction2__IntVector__IntVector,
+  &cos_m_gmap2__IntFunction2__ShtVector__ShtVector,
+  &cos_m_gmap2__LngFunction2__LngVector__LngVector,
+  &cos_m_gmap2__MsgExpr__Array__Array,
+  &cos_m_gmap2__MsgExpr__ChrVector__ChrVector,
+  &cos_m_gmap2__MsgExpr__CpxVector__CpxVector,
+  &cos_m_gmap2__MsgExpr__FltVector__FltVector,
+  &cos_m_gmap2__MsgExpr__IntVector__IntVector,
+  &cos_m_gmap2__MsgExpr__LngVector__LngVector,
+  &cos_m_gmap2__MsgExpr__ShtVector__ShtVector,
+  &cos_m_gmap3__CpxFunction3__CpxVector__CpxVector__CpxVector,
+  &cos_m_gmap3__FltFunction3__FltVector__FltVector__FltVector,
+  &cos_m_gmap3__Functor__Array__Array__Array,
+  &cos_m_gmap3__Functor__ChrVector__ChrVector__ChrVector,
+  &cos_m_gmap3__Functor__CpxVector__CpxVector__CpxVector,
+  &cos_m_gmap3__Functor__FltVector__FltVector__FltVector,
+  &cos_m_gmap3__Functor__IntVector__IntVector__IntVector,
+  &cos_m_gmap3__Functor__LngVector__LngVector__LngVector,
+  &cos_m_gmap3__Functor__ShtVector__ShtVector__ShtVector,
+  &cos_m_gmap3__Functor__String__String__String,
+  &cos_m_gmap3__IntFunction3__ChrVector__ChrVector__ChrVector,
+  &cos_m_gmap3__IntFunction3__IntVector__IntVector__IntVector,
+  &cos_m_gmap3__IntFunction3__ShtVector__ShtVector__ShtVector,
+  &cos_m_gmap3__LngFunction3__LngVector__LngVector__LngVector,
+  &cos_m_gmap4__CpxFunction4__CpxVector__CpxVector__CpxVector__CpxVector,
+  &cos_m_gmap4__FltFunction4__FltVector__FltVector__FltVector__FltVector,
+  &cos_m_gmap4__Functor__Array__Array__Array__Array,
+  &cos_m_gmap4__Functor__ChrVector__ChrVector__ChrVector__ChrVector,
+  &cos_m_gmap4__Functor__CpxVector__CpxVector__CpxVector__CpxVector,
+  &cos_m_gmap4__Functor__FltVector__FltVector__FltVector__FltVector,
+  &cos_m_gmap4__Functor__IntVector__IntVector__IntVector__IntVector,
+  &cos_m_gmap4__Functor__LngVector__LngVector__LngVector__LngVector,
+  &cos_m_gmap4__Functor__ShtVector__ShtVector__ShtVector__ShtVector,
+  &cos_m_gmap4__Functor__String__String__String__String,
+  &cos_m_gmap4__IntFunction4__ChrVector__ChrVector__ChrVector__ChrVector,
+  &cos_m_gmap4__IntFunction4__IntVector__IntVector__IntVector__IntVector,
+  &cos_m_gmap4__IntFunction4__ShtVector__ShtVector__ShtVector__ShtVector,
+  &cos_m_gmap4__LngFunction4__LngVector__LngVector__LngVector__LngVector,
+  &cos_m_gmapIf__Functor__Array,
+  &cos_m_gmapIf__Functor__ChrVector,
+  &cos_m_gmapIf__Functor__CpxVector,
+  &cos_m_gmapIf__Functor__FltVector,
+  &cos_m_gmapIf__Functor__IntVector,
+  &cos_m_gmapIf__Functor__LngVector,
+  &cos_m_gmapIf__Functor__ShtVector,
+  &cos_m_gmapIf__Functor__String,
+  &cos_m_gmapWhile__Functor__Array,
+  &cos_m_gmapWhile__Functor__ChrVector,
+  &cos_m_gmapWhile__Functor__CpxVector,
+  &cos_m_gmapWhile__Functor__FltVector,
+  &cos_m_gmapWhile__Functor__InputStream,
+  &cos_m_gmapWhile__Functor__IntVector,
+  &cos_m_gmapWhile__Functor__LngVector,
+  &cos_m_gmapWhile__Functor__ShtVector,
+  &cos_m_gmapWhile__Functor__String,
+  &cos_m_gmax__Number__Number,
+  &cos_m_gmerge__Array__Array__Functor,
+  &cos_m_gmin__Number__Number,
+  &cos_m_gminmax__FltVector,
+  &cos_m_gmod__IntegralVector__Integral,
+  &cos_m_gmod__Integral__Integral,
+  &cos_m_gmodulo__IntVector__IntVector,
+  &cos_m_gmodulo__IntVector__ShtVector,
+  &cos_m_gmodulo__Int__Int,
+  &cos_m_gmodulo__LngVector__IntVector,
+  &cos_m_gmodulo__LngVector__LngVector,
+  &cos_m_gmodulo__LngVector__ShtVector,
+  &cos_m_gmodulo__Long__Int,
+  &cos_m_gmodulo__Long__Long,
+  &cos_m_gmodulo__ShtVector__ShtVector,
+  &cos_m_gmul__FloatingVector__CpxVector,
+  &cos_m_gmul__Floating__Complex,
+  &cos_m_gmul__IntegralVector__FloatingVector,
+  &cos_m_gmul__IntegralVector__LngVector,
+  &cos_m_gmul__Integral__Floating,
+  &cos_m_gmul__Integral__Long,
+  &cos_m_gmul__Number__Number,
+  &cos_m_gmul__VectorExpr__Vector,
+  &cos_m_gmul__VectorExpr__VectorExpr,
+  &cos_m_gmul__Vector__Vector,
+  &cos_m_gmul__Vector__VectorExpr,
+  &cos_m_gmulAdd__Float__Complex__Floating,
+  &cos_m_gmulAdd__Float__Float__Complex,
+  &cos_m_gmulAdd__Floating__Floating__Floating,
+  &cos_m_gmulBy__Complex__Complex,
+  &cos_m_gmulBy__Complex__Float,
+  &cos_m_gmulBy__Complex__Int,
+  &cos_m_gmulBy__Complex__Long,
+  &cos_m_gmulBy__CpxVector__CpxVector,
+  &cos_m_gmulBy__CpxVector__FltVector,
+  &cos_m_gmulBy__CpxVector__IntVector,
+  &cos_m_gmulBy__CpxVector__LngVector,
+  &cos_m_gmulBy__CpxVector__ShtVector,
+  &cos_m_gmulBy__Float__Float,
+  &cos_m_gmulBy__Float__Int,
+  &cos_m_gmulBy__Float__Long,
+  &cos_m_gmulBy__FltVector__FltVector,
+  &cos_m_gmulBy__FltVector__IntVector,
+  &cos_m_gmulBy__FltVector__LngVector,
+  &cos_m_gmulBy__FltVector__ShtVector,
+  &cos_m_gmulBy__IntVector__IntVector,
+  &cos_m_gmulBy__IntVector__ShtVector,
+  &cos_m_gmulBy__Int__Int,
+  &cos_m_gmulBy__LngVector__IntVector,
+  &cos_m_gmulBy__LngVector__LngVector,
+  &cos_m_gmulBy__LngVector__ShtVector,
+  &cos_m_gmulBy__Long__Int,
+  &cos_m_gmulBy__Long__Long,
+  &cos_m_gmulBy__ShtVector__ShtVector,
+  &cos_m_gneg__Number,
+  &cos_m_gneg__Vector,
+  &cos_m_gneg__VectorExpr,
+  &cos_m_gneg__pmGreater,
+  &cos_m_gneg__pmLesser,
+  &cos_m_gneg__pmOrdered,
+  &cos_m_gnegate__Complex,
+  &cos_m_gnegate__CpxVector,
+  &cos_m_gnegate__Float,
+  &cos_m_gnegate__FltVector,
+  &cos_m_gnegate__Int,
+  &cos_m_gnegate__IntVector,
+  &cos_m_gnegate__LngVector,
+  &cos_m_gnegate__Long,
+  &cos_m_gnegate__ShtVector,
+  &cos_m_gnegate__pmGreater,
+  &cos_m_gnegate__pmLesser,
+  &cos_m_gnegate__pmOrdered,
+  &cos_m_gnew__pmArray,
+  &cos_m_gnew__pmChrVector,
+  &cos_m_gnew__pmCpxVector,
+  &cos_m_gnew__pmFltVector,
+  &cos_m_gnew__pmIntVector,
+  &cos_m_gnew__pmLngVector,
+  &cos_m_gnew__pmShtVector,
+  &cos_m_gnew__pmString,
+  &cos_m_gnewRng__pmRange,
+  &cos_m_gnewSlc__pmSlice,
+  &cos_m_gnewWith__pmArray__Array,
+  &cos_m_gnewWith__pmArray__Int,
+  &cos_m_gnewWith__pmArray__Range,
+  &cos_m_gnewWith__pmArray__Slice,
+  &cos_m_gnewWith__pmArray__XRange,
+  &cos_m_gnewWith__pmChrVector__ChrVector,
+  &cos_m_gnewWith__pmChrVector__Int,
+  &cos_m_gnewWith__pmChrVector__Range,
+  &cos_m_gnewWith__pmChrVector__Slice,
+  &cos_m_gnewWith__pmChrVector__XRange,
+  &cos_m_gnewWith__pmCpxVector__CpxVector,
+  &cos_m_gnewWith__pmCpxVector__Int,
+  &cos_m_gnewWith__pmCpxVector__Range,
+  &cos_m_gnewWith__pmCpxVector__Slice,
+  &cos_m_gnewWith__pmCpxVector__VectorExpr,
+  &cos_m_gnewWith__pmCpxVector__XRange,
+  &cos_m_gnewWith__pmFltVector__FltVector,
+  &cos_m_gnewWith__pmFltVector__Int,
+  &cos_m_gnewWith__pmFltVector__Range,
+  &cos_m_gnewWith__pmFltVector__Slice,
+  &cos_m_gnewWith__pmFltVector__VectorExpr,
+  &cos_m_gnewWith__pmFltVector__XRange,
+  &cos_m_gnewWith__pmIntVector__Int,
+  &cos_m_gnewWith__pmIntVector__IntVector,
+  &cos_m_gnewWith__pmIntVector__Range,
+  &cos_m_gnewWith__pmIntVector__Slice,
+  &cos_m_gnewWith__pmIntVector__VectorExpr,
+  &cos_m_gnewWith__pmIntVector__XRange,
+  &cos_m_gnewWith__pmLngVector__Int,
+  &cos_m_gnewWith__pmLngVector__LngVector,
+  &cos_m_gnewWith__pmLngVector__Range,
+  &cos_m_gnewWith__pmLngVector__Slice,
+  &cos_m_gnewWith__pmLngVector__VectorExpr,
+  &cos_m_gnewWith__pmLngVector__XRange,
+  &cos_m_gnewWith__pmNumber__Char,
+  &cos_m_gnewWith__pmNumber__Complex,
+  &cos_m_gnewWith__pmNumber__Float,
+  &cos_m_gnewWith__pmNumber__Int,
+  &cos_m_gnewWith__pmNumber__Long,
+  &cos_m_gnewWith__pmNumber__Short,
+  &cos_m_gnewWith__pmShtVector__Int,
+  &cos_m_gnewWith__pmShtVector__Range,
+  &cos_m_gnewWith__pmShtVector__ShtVector,
+  &cos_m_gnewWith__pmShtVector__Slice,
+  &cos_m_gnewWith__pmShtVector__VectorExpr,
+  &cos_m_gnewWith__pmShtVector__XRange,
+  &cos_m_gnewWith__pmString__Int,
+  &cos_m_gnewWith__pmString__String,
+  &cos_m_gnewWith2__mSubView__Array__Range,
+  &cos_m_gnewWith2__mSubView__Array__Slice,
+  &cos_m_gnewWith2__mSubView__ChrVector__Range,
+  &cos_m_gnewWith2__mSubView__ChrVector__Slice,
+  &cos_m_gnewWith2__mSubView__CpxVector__Range,
+  &cos_m_gnewWith2__mSubView__CpxVector__Slice,
+  &cos_m_gnewWith2__mSubView__FltVector__Range,
+  &cos_m_gnewWith2__mSubView__FltVector__Slice,
+  &cos_m_gnewWith2__mSubView__IntVector__Range,
+  &cos_m_gnewWith2__mSubView__IntVector__Slice,
+  &cos_m_gnewWith2__mSubView__LngVector__Range,
+  &cos_m_gnewWith2__mSubView__LngVector__Slice,
+  &cos_m_gnewWith2__mSubView__ShtVector__Range,
+  &cos_m_gnewWith2__mSubView__ShtVector__Slice,
+  &cos_m_gnewWith2__mView__Array__Range,
+  &cos_m_gnewWith2__mView__Array__Slice,
+  &cos_m_gnewWith2__mView__ChrVector__Range,
+  &cos_m_gnewWith2__mView__ChrVector__Slice,
+  &cos_m_gnewWith2__mView__CpxVector__Range,
+  &cos_m_gnewWith2__mView__CpxVector__Slice,
+  &cos_m_gnewWith2__mView__FltVector__Range,
+  &cos_m_gnewWith2__mView__FltVector__Slice,
+  &cos_m_gnewWith2__mView__IntVector__Range,
+  &cos_m_gnewWith2__mView__IntVector__Slice,
+  &cos_m_gnewWith2__mView__LngVector__Range,
+  &cos_m_gnewWith2__mView__LngVector__Slice,
+  &cos_m_gnewWith2__mView__ShtVector__Range,
+  &cos_m_gnewWith2__mView__ShtVector__Slice,
+  &cos_m_gnewWith2__pmArray__Array__IntVector,
+  &cos_m_gnewWith2__pmArray__Array__Range,
+  &cos_m_gnewWith2__pmArray__Array__Slice,
+  &cos_m_gnewWith2__pmArray__Int__Functor,
+  &cos_m_gnewWith2__pmArray__Int__Object,
+  &cos_m_gnewWith2__pmChrVector__ChrVector__IntVector,
+  &cos_m_gnewWith2__pmChrVector__ChrVector__Range,
+  &cos_m_gnewWith2__pmChrVector__ChrVector__Slice,
+  &cos_m_gnewWith2__pmChrVector__Int__Functor,
+  &cos_m_gnewWith2__pmChrVector__Int__Object,
+  &cos_m_gnewWith2__pmCpxVector__CpxVector__IntVector,
+  &cos_m_gnewWith2__pmCpxVector__CpxVector__Range,
+  &cos_m_gnewWith2__pmCpxVector__CpxVector__Slice,
+  &cos_m_gnewWith2__pmCpxVector__Int__Functor,
+  &cos_m_gnewWith2__pmCpxVector__Int__Object,
+  &cos_m_gnewWith2__pmFltVector__FltVector__IntVector,
+  &cos_m_gnewWith2__pmFltVector__FltVector__Range,
+  &cos_m_gnewWith2__pmFltVector__FltVector__Slice,
+  &cos_m_gnewWith2__pmFltVector__Int__Functor,
+  &cos_m_gnewWith2__pmFltVector__Int__Object,
+  &cos_m_gnewWith2__pmIntVector__IntVector__IntVector,
+  &cos_m_gnewWith2__pmIntVector__IntVector__Range,
+  &cos_m_gnewWith2__pmIntVector__IntVector__Slice,
+  &cos_m_gnewWith2__pmIntVector__Int__Functor,
+  &cos_m_gnewWith2__pmIntVector__Int__Object,
+  &cos_m_gnewWith2__pmLngVector__Int__Functor,
+  &cos_m_gnewWith2__pmLngVector__Int__Object,
+  &cos_m_gnewWith2__pmLngVector__LngVector__IntVector,
+  &cos_m_gnewWith2__pmLngVector__LngVector__Range,
+  &cos_m_gnewWith2__pmLngVector__LngVector__Slice,
+  &cos_m_gnewWith2__pmShtVector__Int__Functor,
+  &cos_m_gnewWith2__pmShtVector__Int__Object,
+  &cos_m_gnewWith2__pmShtVector__ShtVector__IntVector,
+  &cos_m_gnewWith2__pmShtVector__ShtVector__Range,
+  &cos_m_gnewWith2__pmShtVector__ShtVector__Slice,
+  &cos_m_gnewWith2__pmString__Int__Functor,
+  &cos_m_gnewWith2__pmString__Int__Object,
+  &cos_m_gnewWith2__pmString__String__IntVector,
+  &cos_m_gnewWith2__pmString__String__Range,
+  &cos_m_gnewWith2__pmString__String__Slice,
+  &cos_m_gnewWithStr__pmString,
+  &cos_m_gnewXRng__pmXRange,
+  &cos_m_gnorm2__CpxVector,
+  &cos_m_gnorm2__FltVector,
+  &cos_m_gnot__mFalse,
+  &cos_m_gnot__mTrue,
+  &cos_m_gnot__mTrueFalse,
+  &cos_m_gobjPtr__Array,
+  &cos_m_gor__mFalse__mFalse,
+  &cos_m_gor__mTrueFalse__mTrue,
+  &cos_m_gor__mTrueFalse__mTrueFalse,
+  &cos_m_gor__mTrue__mTrueFalse,
+  &cos_m_gpermute__Array__IntVector,
+  &cos_m_gpermute__ChrVector__IntVector,
+  &cos_m_gpermute__CpxVector__IntVector,
+  &cos_m_gpermute__FltVector__IntVector,
+  &cos_m_gpermute__IntVector__IntVector,
+  &cos_m_gpermute__LngVector__IntVector,
+  &cos_m_gpermute__ShtVector__IntVector,
+  &cos_m_gpop__ArrayDyn,
+  &cos_m_gpop__ChrVectorDyn,
+  &cos_m_gpop__CpxVectorDyn,
+  &cos_m_gpop__FltVectorDyn,
+  &cos_m_gpop__IntVectorDyn,
+  &cos_m_gpop__LngVectorDyn,
+  &cos_m_gpop__ShtVectorDyn,
+  &cos_m_gpop__StringDyn,
+  &cos_m_gpopBack__ArrayDyn,
+  &cos_m_gpopBack__ChrVectorDyn,
+  &cos_m_gpopBack__CpxVectorDyn,
+  &cos_m_gpopBack__FltVectorDyn,
+  &cos_m_gpopBack__IntVectorDyn,
+  &cos_m_gpopBack__LngVectorDyn,
+  &cos_m_gpopBack__ShtVectorDyn,
+  &cos_m_gpopBack__StringDyn,
+  &cos_m_gpopFront__ArrayDyn,
+  &cos_m_gpopFront__ChrVectorDyn,
+  &cos_m_gpopFront__CpxVectorDyn,
+  &cos_m_gpopFront__FltVectorDyn,
+  &cos_m_gpopFront__IntVectorDyn,
+  &cos_m_gpopFront__LngVectorDyn,
+  &cos_m_gpopFront__ShtVectorDyn,
+  &cos_m_gpopFront__StringDyn,
+  &cos_m_gpow__FloatingVector__Floating,
+  &cos_m_gpow__FloatingVector__Int,
+  &cos_m_gpow__Floating__Floating,
+  &cos_m_gpow__Floating__Int,
+  &cos_m_gpower__Complex__Complex,
+  &cos_m_gpower__Complex__Float,
+  &cos_m_gpower__Complex__Int,
+  &cos_m_gpower__CpxVector__Floating,
+  &cos_m_gpower__CpxVector__Int,
+  &cos_m_gpower__Float__Float,
+  &cos_m_gpower__Float__Int,
+  &cos_m_gpower__FltVector__Float,
+  &cos_m_gpower__FltVector__Int,
+  &cos_m_gprepend__ArrayDyn__Array,
+  &cos_m_gprepend__ArrayDyn__Object,
+  &cos_m_gprepend__ChrVectorDyn__Char,
+  &cos_m_gprepend__ChrVectorDyn__ChrVector,
+  &cos_m_gprepend__ChrVectorDyn__Object,
+  &cos_m_gprepend__CpxVectorDyn__Complex,
+  &cos_m_gprepend__CpxVectorDyn__CpxVector,
+  &cos_m_gprepend__CpxVectorDyn__Object,
+  &cos_m_gprepend__FltVectorDyn__Float,
+  &cos_m_gprepend__FltVectorDyn__FltVector,
+  &cos_m_gprepend__FltVectorDyn__Object,
+  &cos_m_gprepend__IntVectorDyn__Int,
+  &cos_m_gprepend__IntVectorDyn__IntVector,
+  &cos_m_gprepend__IntVectorDyn__Object,
+  &cos_m_gprepend__LngVectorDyn__LngVector,
+  &cos_m_gprepend__LngVectorDyn__Long,
+  &cos_m_gprepend__LngVectorDyn__Object,
+  &cos_m_gprepend__ShtVectorDyn__Object,
+  &cos_m_gprepend__ShtVectorDyn__Short,
+  &cos_m_gprepend__ShtVectorDyn__ShtVector,
+  &cos_m_gprepend__StringDyn__Char,
+  &cos_m_gprepend__StringDyn__Object,
+  &cos_m_gprepend__StringDyn__String,
+  &cos_m_gprod__CpxVector,
+  &cos_m_gprod__FltVector,
+  &cos_m_gpush__ArrayDyn__Object,
+  &cos_m_gpush__ChrVectorDyn__Char,
+  &cos_m_gpush__ChrVectorDyn__Object,
+  &cos_m_gpush__CpxVectorDyn__Complex,
+  &cos_m_gpush__CpxVectorDyn__Object,
+  &cos_m_gpush__FltVectorDyn__Float,
+  &cos_m_gpush__FltVectorDyn__Object,
+  &cos_m_gpush__IntVectorDyn__Int,
+  &cos_m_gpush__IntVectorDyn__Object,
+  &cos_m_gpush__LngVectorDyn__Long,
+  &cos_m_gpush__LngVectorDyn__Object,
+  &cos_m_gpush__ShtVectorDyn__Object,
+  &cos_m_gpush__ShtVectorDyn__Short,
+  &cos_m_gpush__StringDyn__Char,
+  &cos_m_gpush__StringDyn__Object,
+  &cos_m_gpushBack__ArrayDyn__Object,
+  &cos_m_gpushBack__ChrVectorDyn__Char,
+  &cos_m_gpushBack__ChrVectorDyn__Object,
+  &cos_m_gpushBack__CpxVectorDyn__Complex,
+  &cos_m_gpushBack__CpxVectorDyn__Object,
+  &cos_m_gpushBack__FltVectorDyn__Float,
+  &cos_m_gpushBack__FltVectorDyn__Object,
+  &cos_m_gpushBack__IntVectorDyn__Int,
+  &cos_m_gpushBack__IntVectorDyn__Object,
+  &cos_m_gpushBack__LngVectorDyn__Long,
+  &cos_m_gpushBack__LngVectorDyn__Object,
+  &cos_m_gpushBack__ShtVectorDyn__Object,
+  &cos_m_gpushBack__ShtVectorDyn__Short,
+  &cos_m_gpushBack__StringDyn__Char,
+  &cos_m_gpushBack__StringDyn__Object,
+  &cos_m_gpushFront__ArrayDyn__Object,
+  &cos_m_gpushFront__ChrVectorDyn__Char,
+  &cos_m_gpushFront__ChrVectorDyn__Object,
+  &cos_m_gpushFront__CpxVectorDyn__Complex,
+  &cos_m_gpushFront__CpxVectorDyn__Object,
+  &cos_m_gpushFront__FltVectorDyn__Float,
+  &cos_m_gpushFront__FltVectorDyn__Object,
+  &cos_m_gpushFront__IntVectorDyn__Int,
+  &cos_m_gpushFront__IntVectorDyn__Object,
+  &cos_m_gpushFront__LngVectorDyn__Long,
+  &cos_m_gpushFront__LngVectorDyn__Object,
+  &cos_m_gpushFront__ShtVectorDyn__Object,
+  &cos_m_gpushFront__ShtVectorDyn__Short,
+  &cos_m_gpushFront__StringDyn__Char,
+  &cos_m_gpushFront__StringDyn__Object,
+  &cos_m_gput__OutputStream__Char,
+  &cos_m_gput__OutputStream__Float,
+  &cos_m_gput__OutputStream__Int,
+  &cos_m_gput__OutputStream__Long,
+  &cos_m_gput__OutputStream__String,
+  &cos_m_gput__String__Char,
+  &cos_m_gput__String__Complex,
+  &cos_m_gput__String__Float,
+  &cos_m_gput__String__Int,
+  &cos_m_gput__String__Long,
+  &cos_m_gputAt__Array__Array__Array,
+  &cos_m_gputAt__Array__Array__Object,
+  &cos_m_gputAt__Array__IntVector__Array,
+  &cos_m_gputAt__Array__IntVector__Object,
+  &cos_m_gputAt__Array__Int__Object,
+  &cos_m_gputAt__Array__Range__Array,
+  &cos_m_gputAt__Array__Range__Object,
+  &cos_m_gputAt__Array__Slice__Array,
+  &cos_m_gputAt__Array__Slice__Object,
+  &cos_m_gputAt__ChrVector__IntVector__ChrVector,
+  &cos_m_gputAt__ChrVector__IntVector__Object,
+  &cos_m_gputAt__ChrVector__Int__Char,
+  &cos_m_gputAt__ChrVector__Int__Object,
+  &cos_m_gputAt__ChrVector__Range__Object,
+  &cos_m_gputAt__ChrVector__Slice__ChrVector,
+  &cos_m_gputAt__ChrVector__Slice__Object,
+  &cos_m_gputAt__CpxVector__IntVector__CpxVector,
+  &cos_m_gputAt__CpxVector__IntVector__Object,
+  &cos_m_gputAt__CpxVector__Int__Char,
+  &cos_m_gputAt__CpxVector__Int__Complex,
+  &cos_m_gputAt__CpxVector__Int__Float,
+  &cos_m_gputAt__CpxVector__Int__Int,
+  &cos_m_gputAt__CpxVector__Int__Long,
+  &cos_m_gputAt__CpxVector__Int__Object,
+  &cos_m_gputAt__CpxVector__Int__Short,
+  &cos_m_gputAt__CpxVector__Range__Object,
+  &cos_m_gputAt__CpxVector__Range__VectorExpr,
+  &cos_m_gputAt__CpxVector__Slice__CpxVector,
+  &cos_m_gputAt__CpxVector__Slice__Object,
+  &cos_m_gputAt__CpxVector__Slice__VectorExpr,
+  &cos_m_gputAt__FltVector__IntVector__FltVector,
+  &cos_m_gputAt__FltVector__IntVector__Object,
+  &cos_m_gputAt__FltVector__Int__Char,
+  &cos_m_gputAt__FltVector__Int__Float,
+  &cos_m_gputAt__FltVector__Int__Int,
+  &cos_m_gputAt__FltVector__Int__Long,
+  &cos_m_gputAt__FltVector__Int__Object,
+  &cos_m_gputAt__FltVector__Int__Short,
+  &cos_m_gputAt__FltVector__Range__Object,
+  &cos_m_gputAt__FltVector__Range__VectorExpr,
+  &cos_m_gputAt__FltVector__Slice__FltVector,
+  &cos_m_gputAt__FltVector__Slice__Object,
+  &cos_m_gputAt__FltVector__Slice__VectorExpr,
+  &cos_m_gputAt__IntVector__IntVector__IntVector,
+  &cos_m_gputAt__IntVector__IntVector__Object,
+  &cos_m_gputAt__IntVector__Int__Char,
+  &cos_m_gputAt__IntVector__Int__Int,
+  &cos_m_gputAt__IntVector__Int__Object,
+  &cos_m_gputAt__IntVector__Int__Short,
+  &cos_m_gputAt__IntVector__Range__Object,
+  &cos_m_gputAt__IntVector__Range__VectorExpr,
+  &cos_m_gputAt__IntVector__Slice__IntVector,
+  &cos_m_gputAt__IntVector__Slice__Object,
+  &cos_m_gputAt__IntVector__Slice__VectorExpr,
+  &cos_m_gputAt__LngVector__IntVector__LngVector,
+  &cos_m_gputAt__LngVector__IntVector__Object,
+  &cos_m_gputAt__LngVector__Int__Char,
+  &cos_m_gputAt__LngVector__Int__Int,
+  &cos_m_gputAt__LngVector__Int__Long,
+  &cos_m_gputAt__LngVector__Int__Object,
+  &cos_m_gputAt__LngVector__Int__Short,
+  &cos_m_gputAt__LngVector__Range__Object,
+  &cos_m_gputAt__LngVector__Range__VectorExpr,
+  &cos_m_gputAt__LngVector__Slice__LngVector,
+  &cos_m_gputAt__LngVector__Slice__Object,
+  &cos_m_gputAt__LngVector__Slice__VectorExpr,
+  &cos_m_gputAt__ShtVector__IntVector__Object,
+  &cos_m_gputAt__ShtVector__IntVector__ShtVector,
+  &cos_m_gputAt__ShtVector__Int__Char,
+  &cos_m_gputAt__ShtVector__Int__Object,
+  &cos_m_gputAt__ShtVector__Int__Short,
+  &cos_m_gputAt__ShtVector__Range__Object,
+  &cos_m_gputAt__ShtVector__Range__VectorExpr,
+  &cos_m_gputAt__ShtVector__Slice__Object,
+  &cos_m_gputAt__ShtVector__Slice__ShtVector,
+  &cos_m_gputAt__ShtVector__Slice__VectorExpr,
+  &cos_m_gputAt__String__Array__Array,
+  &cos_m_gputAt__String__Array__Object,
+  &cos_m_gputAt__String__IntVector__Object,
+  &cos_m_gputAt__String__IntVector__String,
+  &cos_m_gputAt__String__Int__Char,
+  &cos_m_gputAt__String__Int__Object,
+  &cos_m_gputAt__String__Range__Array,
+  &cos_m_gputAt__String__Range__Object,
+  &cos_m_gputAt__String__Slice__Object,
+  &cos_m_gputAt__String__Slice__String,
+  &cos_m_gputAtIdx__Array__Object,
+  &cos_m_gputAtIdx__ChrVector__Object,
+  &cos_m_gputAtIdx__CpxVector__Object,
+  &cos_m_gputAtIdx__FltVector__Object,
+  &cos_m_gputAtIdx__IntVector__Object,
+  &cos_m_gputAtIdx__LngVector__Object,
+  &cos_m_gputAtIdx__ShtVector__Object,
+  &cos_m_gputAtIdx__String__Object,
+  &cos_m_gputChr__OutputFile,
+  &cos_m_gputData__OutputStream,
+  &cos_m_gputLn__OutputStream__Object,
+  &cos_m_gputStr__OutputStream,
+  &cos_m_gputStrLn__OutputStream,
+  &cos_m_gputnChr__OutputStream,
+  &cos_m_greduce__Array__Functor,
+  &cos_m_greduce__ChrVector__Functor,
+  &cos_m_greduce__ChrVector__IntFunction2,
+  &cos_m_greduce__CpxVector__CpxFunction2,
+  &cos_m_greduce__CpxVector__Functor,
+  &cos_m_greduce__FltVector__FltFunction2,
+  &cos_m_greduce__FltVector__Functor,
+  &cos_m_greduce__IntVector__Functor,
+  &cos_m_greduce__IntVector__IntFunction2,
+  &cos_m_greduce__LngVector__Functor,
+  &cos_m_greduce__LngVector__LngFunction2,
+  &cos_m_greduce__ShtVector__Functor,
+  &cos_m_greduce__ShtVector__IntFunction2,
+  &cos_m_greduce__String__Functor,
+  &cos_m_greduce1__Array__Functor__Object,
+  &cos_m_greduce1__ChrVector__Functor__Object,
+  &cos_m_greduce1__ChrVector__IntFunction2__Object,
+  &cos_m_greduce1__CpxVector__CpxFunction2__Object,
+  &cos_m_greduce1__CpxVector__Functor__Object,
+  &cos_m_greduce1__FltVector__FltFunction2__Object,
+  &cos_m_greduce1__FltVector__Functor__Object,
+  &cos_m_greduce1__IntVector__Functor__Object,
+  &cos_m_greduce1__IntVector__IntFunction2__Object,
+  &cos_m_greduce1__LngVector__Functor__Object,
+  &cos_m_greduce1__LngVector__LngFunction2__Object,
+  &cos_m_greduce1__ShtVector__Functor__Object,
+  &cos_m_greduce1__ShtVector__IntFunction2__Object,
+  &cos_m_greduce1__String__Functor__Object,
+  &cos_m_greduce2__Array__Functor__Object__Object,
+  &cos_m_greduce2__ChrVector__Functor__Object__Object,
+  &cos_m_greduce2__CpxVector__Functor__Object__Object,
+  &cos_m_greduce2__FltVector__Functor__Object__Object,
+  &cos_m_greduce2__IntVector__Functor__Object__Object,
+  &cos_m_greduce2__LngVector__Functor__Object__Object,
+  &cos_m_greduce2__ShtVector__Functor__Object__Object,
+  &cos_m_greject__Array__Functor,
+  &cos_m_greject__ChrVector__Functor,
+  &cos_m_greject__ChrVector__IntFunction1,
+  &cos_m_greject__CpxVector__CpxFunction1,
+  &cos_m_greject__CpxVector__Functor,
+  &cos_m_greject__FltVector__FltFunction1,
+  &cos_m_greject__FltVector__Functor,
+  &cos_m_greject__IntVector__Functor,
+  &cos_m_greject__IntVector__IntFunction1,
+  &cos_m_greject__LngVector__Functor,
+  &cos_m_greject__LngVector__LngFunction1,
+  &cos_m_greject__ShtVector__Functor,
+  &cos_m_greject__ShtVector__IntFunction1,
+  &cos_m_greject__String__Functor,
+  &cos_m_grejectWhile__Array__Functor,
+  &cos_m_grejectWhile__ChrVector__Functor,
+  &cos_m_grejectWhile__CpxVector__Functor,
+  &cos_m_grejectWhile__FltVector__Functor,
+  &cos_m_grejectWhile__IntVector__Functor,
+  &cos_m_grejectWhile__LngVector__Functor,
+  &cos_m_grejectWhile__ShtVector__Functor,
+  &cos_m_grejectWhile__String__Functor,
+  &cos_m_gremoveAt__ChrVectorDyn__Int,
+  &cos_m_gremoveAt__ChrVectorDyn__Range,
+  &cos_m_gremoveAt__ChrVectorDyn__Slice,
+  &cos_m_gremoveAt__CpxVectorDyn__Int,
+  &cos_m_gremoveAt__CpxVectorDyn__Range,
+  &cos_m_gremoveAt__CpxVectorDyn__Slice,
+  &cos_m_gremoveAt__FltVectorDyn__Int,
+  &cos_m_gremoveAt__FltVectorDyn__Range,
+  &cos_m_gremoveAt__FltVectorDyn__Slice,
+  &cos_m_gremoveAt__IntVectorDyn__Int,
+  &cos_m_gremoveAt__IntVectorDyn__Range,
+  &cos_m_gremoveAt__IntVectorDyn__Slice,
+  &cos_m_gremoveAt__LngVectorDyn__Int,
+  &cos_m_gremoveAt__LngVectorDyn__Range,
+  &cos_m_gremoveAt__LngVectorDyn__Slice,
+  &cos_m_gremoveAt__ShtVectorDyn__Int,
+  &cos_m_gremoveAt__ShtVectorDyn__Range,
+  &cos_m_gremoveAt__ShtVectorDyn__Slice,
+  &cos_m_grepeat__Char__Int,
+  &cos_m_grepeat__Complex__Int,
+  &cos_m_grepeat__Float__Int,
+  &cos_m_grepeat__Int__Int,
+  &cos_m_grepeat__Long__Int,
+  &cos_m_grepeat__Object__Int,
+  &cos_m_grepeat__Short__Int,
+  &cos_m_greverse__Array,
+  &cos_m_greverse__ChrVector,
+  &cos_m_greverse__CpxVector,
+  &cos_m_greverse__FltVector,
+  &cos_m_greverse__IntVector,
+  &cos_m_greverse__LngVector,
+  &cos_m_greverse__ShtVector,
+  &cos_m_greverse__String,
+  &cos_m_greverse__pmGreater,
+  &cos_m_greverse__pmLesser,
+  &cos_m_greverse__pmOrdered,
+  &cos_m_gscal__CpxVector__Number,
+  &cos_m_gscal__FltVector__Number,
+  &cos_m_gseek__InputFile,
+  &cos_m_gseek__OutputFile,
+  &cos_m_gselect__Array__Functor,
+  &cos_m_gselect__ChrVector__Functor,
+  &cos_m_gselect__ChrVector__IntFunction1,
+  &cos_m_gselect__CpxVector__CpxFunction1,
+  &cos_m_gselect__CpxVector__Functor,
+  &cos_m_gselect__FltVector__FltFunction1,
+  &cos_m_gselect__FltVector__Functor,
+  &cos_m_gselect__IntVector__Functor,
+  &cos_m_gselect__IntVector__IntFunction1,
+  &cos_m_gselect__LngVector__Functor,
+  &cos_m_gselect__LngVector__LngFunction1,
+  &cos_m_gselect__ShtVector__Functor,
+  &cos_m_gselect__ShtVector__IntFunction1,
+  &cos_m_gselect__String__Functor,
+  &cos_m_gselectWhile__Array__Functor,
+  &cos_m_gselectWhile__ChrVector__Functor,
+  &cos_m_gselectWhile__CpxVector__Functor,
+  &cos_m_gselectWhile__FltVector__Functor,
+  &cos_m_gselectWhile__IntVector__Functor,
+  &cos_m_gselectWhile__LngVector__Functor,
+  &cos_m_gselectWhile__ShtVector__Functor,
+  &cos_m_gselectWhile__String__Functor,
+  &cos_m_gsht__Short,
+  &cos_m_gshtAt__ChrVector__Int,
+  &cos_m_gshtAt__ShtVector__Int,
+  &cos_m_gshtPtr__ShtVector,
+  &cos_m_gsin__Floating,
+  &cos_m_gsin__FloatingVector,
+  &cos_m_gsine__Complex,
+  &cos_m_gsine__CpxVector,
+  &cos_m_gsine__Float,
+  &cos_m_gsine__FltVector,
+  &cos_m_gsineh__Complex,
+  &cos_m_gsineh__CpxVector,
+  &cos_m_gsineh__Float,
+  &cos_m_gsineh__FltVector,
+  &cos_m_gsinh__Floating,
+  &cos_m_gsinh__FloatingVector,
+  &cos_m_gsize__Array,
+  &cos_m_gsize__ChrVector,
+  &cos_m_gsize__CpxVector,
+  &cos_m_gsize__FltVector,
+  &cos_m_gsize__IntVector,
+  &cos_m_gsize__LngVector,
+  &cos_m_gsize__Range,
+  &cos_m_gsize__ShtVector,
+  &cos_m_gsize__Slice,
+  &cos_m_gsize__String,
+  &cos_m_gsize__VectorExpr,
+  &cos_m_gsize__XRange,
+  &cos_m_gskipDelim__InputStream,
+  &cos_m_gskipDelims__InputStream,
+  &cos_m_gskipLine__InputStream,
+  &cos_m_gskipWhile__InputStream__Functor,
+  &cos_m_gskipnChr__InputStream,
+  &cos_m_gsort__ArrayView__Functor,
+  &cos_m_gsort__Array__Functor,
+  &cos_m_gsort__ChrVectorView__Functor,
+  &cos_m_gsort__ChrVectorView__IntFunction2,
+  &cos_m_gsort__ChrVector__Functor,
+  &cos_m_gsort__ChrVector__IntFunction2,
+  &cos_m_gsort__ChrVector__pmGreater,
+  &cos_m_gsort__ChrVector__pmLesser,
+  &cos_m_gsort__CpxVectorView__Functor,
+  &cos_m_gsort__CpxVector__Functor,
+  &cos_m_gsort__FltVectorView__FltFunction2,
+  &cos_m_gsort__FltVectorView__Functor,
+  &cos_m_gsort__FltVector__FltFunction2,
+  &cos_m_gsort__FltVector__Functor,
+  &cos_m_gsort__FltVector__pmGreater,
+  &cos_m_gsort__FltVector__pmLesser,
+  &cos_m_gsort__IntVectorView__Functor,
+  &cos_m_gsort__IntVectorView__IntFunction2,
+  &cos_m_gsort__IntVector__Functor,
+  &cos_m_gsort__IntVector__IntFunction2,
+  &cos_m_gsort__IntVector__pmGreater,
+  &cos_m_gsort__IntVector__pmLesser,
+  &cos_m_gsort__LngVectorView__Functor,
+  &cos_m_gsort__LngVectorView__LngFunction2,
+  &cos_m_gsort__LngVector__Functor,
+  &cos_m_gsort__LngVector__LngFunction2,
+  &cos_m_gsort__LngVector__pmGreater,
+  &cos_m_gsort__LngVector__pmLesser,
+  &cos_m_gsort__ShtVectorView__Functor,
+  &cos_m_gsort__ShtVectorView__IntFunction2,
+  &cos_m_gsort__ShtVector__Functor,
+  &cos_m_gsort__ShtVector__IntFunction2,
+  &cos_m_gsort__ShtVector__pmGreater,
+  &cos_m_gsort__ShtVector__pmLesser,
+  &cos_m_gsplit__Array__Functor,
+  &cos_m_gsplit__String__Object,
+  &cos_m_gsqr__Number,
+  &cos_m_gsqr__Vector,
+  &cos_m_gsqr__VectorExpr,
+  &cos_m_gsqrErr__Integral__Number,
+  &cos_m_gsqrErr__Number__Number,
+  &cos_m_gsqroot__Complex,
+  &cos_m_gsqroot__CpxVector,
+  &cos_m_gsqroot__Float,
+  &cos_m_gsqroot__FltVector,
+  &cos_m_gsqrt__Floating,
+  &cos_m_gsqrt__FloatingVector,
+  &cos_m_gsquare__CpxVector,
+  &cos_m_gsquare__FltVector,
+  &cos_m_gsquare__IntVector,
+  &cos_m_gsquare__LngVector,
+  &cos_m_gsquare__ShtVector,
+  &cos_m_gstr__FunExpr,
+  &cos_m_gstr__InputFile,
+  &cos_m_gstr__MsgExpr,
+  &cos_m_gstr__OutputFile,
+  &cos_m_gstr__String,
+  &cos_m_gstride__Array,
+  &cos_m_gstrip__String,
+  &cos_m_gstrip__StringDyn,
+  &cos_m_gsub__FloatingVector__CpxVector,
+  &cos_m_gsub__Floating__Complex,
+  &cos_m_gsub__IntegralVector__FloatingVector,
+  &cos_m_gsub__IntegralVector__LngVector,
+  &cos_m_gsub__Integral__Floating,
+  &cos_m_gsub__Integral__Long,
+  &cos_m_gsub__Number__Number,
+  &cos_m_gsub__VectorExpr__Vector,
+  &cos_m_gsub__VectorExpr__VectorExpr,
+  &cos_m_gsub__Vector__Vector,
+  &cos_m_gsub__Vector__VectorExpr,
+  &cos_m_gsubTo__Complex__Complex,
+  &cos_m_gsubTo__Complex__Float,
+  &cos_m_gsubTo__Complex__Int,
+  &cos_m_gsubTo__Complex__Long,
+  &cos_m_gsubTo__CpxVector__CpxVector,
+  &cos_m_gsubTo__CpxVector__FltVector,
+  &cos_m_gsubTo__CpxVector__IntVector,
+  &cos_m_gsubTo__CpxVector__LngVector,
+  &cos_m_gsubTo__CpxVector__ShtVector,
+  &cos_m_gsubTo__Float__Float,
+  &cos_m_gsubTo__Float__Int,
+  &cos_m_gsubTo__Float__Long,
+  &cos_m_gsubTo__FltVector__FltVector,
+  &cos_m_gsubTo__FltVector__IntVector,
+  &cos_m_gsubTo__FltVector__LngVector,
+  &cos_m_gsubTo__FltVector__ShtVector,
+  &cos_m_gsubTo__IntVector__IntVector,
+  &cos_m_gsubTo__IntVector__ShtVector,
+  &cos_m_gsubTo__Int__Int,
+  &cos_m_gsubTo__LngVector__IntVector,
+  &cos_m_gsubTo__LngVector__LngVector,
+  &cos_m_gsubTo__LngVector__ShtVector,
+  &cos_m_gsubTo__Long__Int,
+  &cos_m_gsubTo__Long__Long,
+  &cos_m_gsubTo__ShtVector__ShtVector,
+  &cos_m_gsum__CpxVector,
+  &cos_m_gsum__FltVector,
+  &cos_m_gswap__Array__Array,
+  &cos_m_gtan__Floating,
+  &cos_m_gtan__FloatingVector,
+  &cos_m_gtangent__Complex,
+  &cos_m_gtangent__CpxVector,
+  &cos_m_gtangent__Float,
+  &cos_m_gtangent__FltVector,
+  &cos_m_gtangenth__Complex,
+  &cos_m_gtangenth__CpxVector,
+  &cos_m_gtangenth__Float,
+  &cos_m_gtangenth__FltVector,
+  &cos_m_gtanh__Floating,
+  &cos_m_gtanh__FloatingVector,
+  &cos_m_gtell__InputFile,
+  &cos_m_gtell__OutputFile,
+  &cos_m_gtoLower__Char,
+  &cos_m_gtoUpper__Char,
+  &cos_m_gtop__Array,
+  &cos_m_gtop__ChrVector,
+  &cos_m_gtop__CpxVector,
+  &cos_m_gtop__FltVector,
+  &cos_m_gtop__IntVector,
+  &cos_m_gtop__LngVector,
+  &cos_m_gtop__ShtVector,
+  &cos_m_gtop__String,
+  &cos_m_gtopBack__Array,
+  &cos_m_gtopBack__ChrVector,
+  &cos_m_gtopBack__CpxVector,
+  &cos_m_gtopBack__FltVector,
+  &cos_m_gtopBack__IntVector,
+  &cos_m_gtopBack__LngVector,
+  &cos_m_gtopBack__ShtVector,
+  &cos_m_gtopBack__String,
+  &cos_m_gtopFront__Array,
+  &cos_m_gtopFront__ChrVector,
+  &cos_m_gtopFront__CpxVector,
+  &cos_m_gtopFront__FltVector,
+  &cos_m_gtopFront__IntVector,
+  &cos_m_gtopFront__LngVector,
+  &cos_m_gtopFront__ShtVector,
+  &cos_m_gtopFront__String,
+  &cos_m_gungetChr__InputFile,
+  &cos_m_gunique__Array__Functor,
+  &cos_m_gunique__ChrVector__Functor,
+  &cos_m_gunique__CpxVector__Functor,
+  &cos_m_gunique__FltVector__Functor,
+  &cos_m_gunique__IntVector__Functor,
+  &cos_m_gunique__LngVector__Functor,
+  &cos_m_gunique__ShtVector__Functor,
+  &cos_m_gunique__String__Functor,
+  &cos_m_gunrecognizedMessage1__InputOutputFile,
+  &cos_m_gunrecognizedMessage1__Locker,
+  &cos_m_gunrecognizedMessage1__OutputInputFile,
+  &cos_m_gunrecognizedMessage1__Tracer,
+  &cos_m_gunrecognizedMessage2__InputOutputFile__Object,
+  &cos_m_gunrecognizedMessage2__Locker__Locker,
+  &cos_m_gunrecognizedMessage2__Locker__Object,
+  &cos_m_gunrecognizedMessage2__Object__Locker,
+  &cos_m_gunrecognizedMessage2__Object__Tracer,
+  &cos_m_gunrecognizedMessage2__OutputInputFile__Object,
+  &cos_m_gunrecognizedMessage2__Tracer__Object,
+  &cos_m_gunrecognizedMessage3__InputOutputFile__Object__Object,
+  &cos_m_gunrecognizedMessage3__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage3__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage3__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage3__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage3__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage3__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage3__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage3__Object__Object__Tracer,
+  &cos_m_gunrecognizedMessage3__Object__Tracer__Object,
+  &cos_m_gunrecognizedMessage3__OutputInputFile__Object__Object,
+  &cos_m_gunrecognizedMessage3__Tracer__Object__Object,
+  &cos_m_gunrecognizedMessage4__Locker__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage4__Locker__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage4__Locker__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage4__Locker__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage4__Locker__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage4__Locker__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage4__Locker__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage4__Locker__Object__Object__Object,
+  &cos_m_gunrecognizedMessage4__Object__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage4__Object__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage4__Object__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage4__Object__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage4__Object__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage4__Object__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage4__Object__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage4__Object__Object__Object__Tracer,
+  &cos_m_gunrecognizedMessage4__Object__Object__Tracer__Object,
+  &cos_m_gunrecognizedMessage4__Object__Tracer__Object__Object,
+  &cos_m_gunrecognizedMessage4__Tracer__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Locker__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Locker__Object__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Locker__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Locker__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Object__Locker__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Locker__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Object__Locker__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Locker__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Locker__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Object__Locker,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Object__Tracer,
+  &cos_m_gunrecognizedMessage5__Object__Object__Object__Tracer__Object,
+  &cos_m_gunrecognizedMessage5__Object__Object__Tracer__Object__Object,
+  &cos_m_gunrecognizedMessage5__Object__Tracer__Object__Object__Object,
+  &cos_m_gunrecognizedMessage5__Tracer__Object__Object__Object__Object,
+  &cos_m_gxor__mFalse__mTrueFalse,
+  &cos_m_gxor__mTrueFalse__mFalse,
+  &cos_m_gxor__mTrueFalse__mTrueFalse,
+  &cos_m_gxor__mTrue__mTrue,
+  &cos_m_gzip__Array__Array,
+  &cos_m_gzip__ChrVector__ChrVector,
+  &cos_m_gzip__CpxVector__CpxVector,
+  &cos_m_gzip__FltVector__FltVector,
+  &cos_m_gzip__IntVector__IntVector,
+  &cos_m_gzip__LngVector__LngVector,
+  &cos_m_gzip__ShtVector__ShtVector,
+  &cos_m_gzip__String__String,
+  &cos_m_gzip3__Array__Array__Array,
+  &cos_m_gzip3__ChrVector__ChrVector__ChrVector,
+  &cos_m_gzip3__CpxVector__CpxVector__CpxVector,
+  &cos_m_gzip3__FltVector__FltVector__FltVector,
+  &cos_m_gzip3__IntVector__IntVector__IntVector,
+  &cos_m_gzip3__LngVector__LngVector__LngVector,
+  &cos_m_gzip3__ShtVector__ShtVector__ShtVector,
+  &cos_m_gzip3__String__String__String,
+  &cos_m_gzip4__Array__Array__Array__Array,
+  &cos_m_gzip4__ChrVector__ChrVector__ChrVector__ChrVector,
+  &cos_m_gzip4__CpxVector__CpxVector__CpxVector__CpxVector,
+  &cos_m_gzip4__FltVector__FltVector__FltVector__FltVector,
+  &cos_m_gzip4__IntVector__IntVector__IntVector__IntVector,
+  &cos_m_gzip4__LngVector__LngVector__LngVector__LngVector,
+  &cos_m_gzip4__ShtVector__ShtVector__ShtVector__ShtVector,
+  &cos_m_gzipn__Array,
+  0
+};
+
+void cos_symbol_register(struct Any**, const char*);
+
+void cos_symbol_initCosBase(void);
+
+void cos_symbol_initCosStd(void);
+void cos_symbol_initCosStd(void)
+{
+   static int done = 0;
+   
+   if (!done) {
+     done = 1;
+     cos_symbol_initCosBase();
+     cos_symbol_register(symtbl,"CosStd");
+   }
+}
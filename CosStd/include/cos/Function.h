@@ -22,6 +22,15 @@
 
 #include <cos/Functor.h>
 
+/* NOTE-USER: typed functions
+   Typed functions wrap C functions on numbers, e.g. aFltFct(sin,x). Numeric
+   vectors call them directly, without boxing, in gmap, gapply, gselect,
+   greject, greduce, gaccumulate, gall, gany, gcount and gsort when the
+   function type matches the element type (IntFunction for char, short and
+   int vectors). Predicates return non-zero for true, comparators return a
+   negative, zero or positive value.
+*/
+
 // ----- aliases
 
 typedef I32 (*I32FCT0)(void);
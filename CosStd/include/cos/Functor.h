@@ -46,6 +46,13 @@ defclass(FunExpr, Functor)
   I32 max;
 endclass
 
+/* NOTE-USER: Message expression
+   aMsg(gen) applies the generic gen to its rank first arguments, e.g.
+   gmap(aMsg(gsqr), arr) or gmap2(aMsg(gadd), arr1, arr2). The generic must
+   have receivers only and return OBJ or void. Collections evaluate message
+   expressions with batched sends (one lookup per run of receivers of the
+   same classes, see cos_method_send1).
+*/
 defclass(MsgExpr, Functor)
   SEL sel;
   U32 msk;
@@ -153,12 +160,14 @@ endclass
 
 #define aFunctor(...)   ( (OBJ)atFunctor   (__VA_ARGS__) )
 #define aFunArg(A)      ( (OBJ)atFunArg    (A)           )
+#define aMsgExpr(G)     ( (OBJ)atMsgExpr   (G)           )
 
 // --- shortcuts
 
 #ifndef COS_NOSHORTCUT
 #define aFun(...)   aFunctor(__VA_ARGS__)
 #define aArg(A)     aFunArg (A)
+#define aMsg(G)     aMsgExpr(G)
 #endif
 
 // --- placeholders
@@ -200,6 +209,9 @@ endclass
 #define atFunArg(IDX) \
   ( &(struct FunArg){ { cos_object_auto(FunArg) }, (IDX) } )
 
+#define atMsgExpr(G) MsgExpr_init( \
+  &(struct MsgExpr) { { cos_object_auto(MsgExpr) }, genericref(G), 0, 0 })
+
 // ----- initializers
 
 struct Functor* FunExpr_init1(struct FunExpr1*);
@@ -211,5 +223,6 @@ struct Functor* FunExpr_init6(struct FunExpr6*);
 struct Functor* FunExpr_init7(struct FunExpr7*);
 struct Functor* FunExpr_init8(struct FunExpr8*);
 struct Functor* FunExpr_init9(struct FunExpr9*);
+struct Functor* MsgExpr_init (struct MsgExpr *);
 
 #endif // COS_FUNCTOR_H
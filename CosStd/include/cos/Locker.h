@@ -22,12 +22,29 @@
 
 #include <cos/Proxy.h>
 
+/* NOTE-USER: Locker variants
+   - Locker forwards the messages to the locked object under a mutex.
+   - RWLocker forwards the read-only messages under a shared lock and the
+     others under an exclusive lock. Read-only messages must not modify
+     their receivers (including their reference counter), gsize, ggetAt,
+     gisEqual and the like are registered by default, others are registered
+     with Locker_readOnly before being sent concurrently.
+   - SpinLocker forwards the messages under a spin lock yielding the CPU
+     after a while, for very short critical sections (e.g. getters).
+   All variants sort multiple lockers by address before locking them.
+*/
+
 #if COS_HAS_POSIX
 
 #include <pthread.h>
 
 defclass(Locker, Proxy)
-  pthread_mutex_t lock;
+  union {
+    pthread_mutex_t  mutex;
+    pthread_rwlock_t rwlock;
+    int              spin;
+  } lock;
+  int kind;
 endclass
 
 #else
@@ -37,4 +54,14 @@ endclass
 
 #endif
 
+defclass(RWLocker, Locker)
+endclass
+
+defclass(SpinLocker, Locker)
+endclass
+
+// read-only messages of RWLocker (thread safe)
+void Locker_readOnly  (SEL);
+BOOL Locker_isReadOnly(SEL);
+
 #endif // COS_LOCKER_H
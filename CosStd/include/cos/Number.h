@@ -114,7 +114,10 @@ BOOL complex_equalEps(C64,C64,F64);
 static inline C64
 complex_make(F64 x, F64 y)
 {
-  return *(F64[]){ x, y };
+  C64 z;
+  ((F64*)&z)[0] = x;
+  ((F64*)&z)[1] = y;
+  return z;
 }
 
 static inline F64
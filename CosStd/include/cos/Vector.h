@@ -68,6 +68,16 @@ endclass
 defclass(FloatingVector, Vector)
 endclass
 
+/* NOTE-USER: Vector kernels
+   Element-wise numerics of unit-stride vectors (e.g. gaddTo, gnegate, gsqroot)
+   use vectorized kernels selected from the CPU features (AVX2 on x86 if
+   available, the default target otherwise, e.g. SSE2). Vector_simdLevel(lvl)
+   sets the level of the kernels (0 = strided loops only, 1 = default target,
+   2 = AVX2) up to the CPU level, and returns the level in use. A negative
+   level only queries it. Not thread safe.
+*/
+int Vector_simdLevel(int lvl);
+
 /***********************************************************
  * Implementation (private)
  */
@@ -0,0 +1,87 @@
+#ifndef COS_VECTOREXPR_H
+#define COS_VECTOREXPR_H
+
+/**
+ * C Object System
+ * COS Vector expression
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Vector.h>
+
+/* NOTE-USER: Vector expressions
+   Vector expressions record element-wise numerics on vectors without
+   temporary vectors, and evaluate the whole expression in a single pass
+   over blocks of elements when assigned or materialized.
+
+   aVectorExpr(vector)                  -> Vector expression (automatic)
+   gnewWith   (VectorExpr,vector)       -> Vector expression
+
+   gabs, gneg, gsqr, ginv(expr)         -> Vector expression (node)
+   gadd, gsub, gmul, gdiv(expr,expr)    -> Vector expression (node)
+   gadd, gsub, gmul, gdiv(expr,vector)  -> Vector expression (node)
+   gadd, gsub, gmul, gdiv(vector,expr)  -> Vector expression (node)
+
+   gassign (vector,expr)                -> vector        (evaluation)
+   gputAt  (vector,slice,expr)          -> vector        (evaluation)
+   gputAt  (vector,range,expr)          -> vector        (evaluation)
+   gnewWith(TVector,expr)               -> Block vector  (evaluation)
+
+   where:
+   - vectors are ShtVector, IntVector, LngVector, FltVector or CpxVector
+   - nodes follow the promotion rules of vector numerics (integral, floating,
+     complex), integral intermediates are computed as I64
+   - ginv of integral and gabs of complex are floating
+   - the destination cannot be of a lower kind than the expression
+   - vectors are read at evaluation (automatic vectors are copied when the
+     expression is built), the destination can be an operand
+   e.g.
+     gassign(a, gadd(gmul(aVectorExpr(b), c), d)); // a = b*c+d, one pass
+*/
+
+defclass(VectorExpr)
+  OBJ lhs;   // vector (leaf) or expression
+  OBJ rhs;   // expression (binary node) or 0
+  U32 size;
+  U32 depth; // number of blocks needed for evaluation
+  I32 op;
+  I32 type;  // element type of the result
+  FINAL_CLASS
+endclass
+
+// ----- automatic constructor
+
+#define aVectorExpr(vector)  ( (OBJ)atVectorExpr(vector) )
+
+// --- shortcuts
+
+#ifndef COS_NOSHORTCUT
+
+#define aVExp(vector)  aVectorExpr(vector)
+
+#endif
+
+/***********************************************************
+ * Implementation (private)
+ */
+
+struct VectorExpr* VectorExpr_init(struct VectorExpr*, OBJ);
+
+#define atVectorExpr(vector) VectorExpr_init( \
+  &(struct VectorExpr) { cos_object_auto(VectorExpr), 0,0,0,0,0,0 }, \
+  vector)
+
+#endif // COS_VECTOREXPR_H
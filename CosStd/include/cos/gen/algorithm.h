@@ -29,6 +29,7 @@ defgeneric(OBJ, gfind , _1, fun); // return object
 defgeneric(OBJ, gifind, _1, fun); // return res such that ggetAt(_1,res) get object
 
 // sorting (fun must return Ordered)
+// real numeric vectors also accept Lesser or Greater (stable, see Vector_srt.c)
 defgeneric(OBJ, gsort    , _1, fun); // in place
 defgeneric(OBJ, gisort   , _1, fun); // return an array of indexes/keys
 defgeneric(OBJ, gisSorted, _1, fun); // return True or False
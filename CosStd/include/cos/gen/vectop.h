@@ -25,4 +25,17 @@
 defgeneric(OBJ, (G_sum ) gsum , _1);
 defgeneric(OBJ, (G_prod) gprod, _1);
 
+/* NOTE-USER: BLAS-1
+   Vector arguments have the same size and type (FltVector or CpxVector),
+   scalars are numbers. Sums are compensated (Kahan), complex gdot is not
+   conjugated and complex giamax uses |re|+|im| like BLAS. gminmax and
+   giamax skip NaN, giamax returns Nil if there is no number.
+*/
+defgeneric(OBJ, gdot   , _1, _2);     // sum(_1*_2)
+defgeneric(OBJ, gnorm2 , _1);         // sqrt(sum(|_1|^2)) without overflow
+defgeneric(OBJ, gaxpy  , _1, _2, _3); // _1 += _2*_3, return _1
+defgeneric(OBJ, gscal  , _1, _2);     // _1 *= _2   , return _1
+defgeneric(OBJ, gminmax, _1);         // FltVector(min(_1),max(_1))
+defgeneric(OBJ, giamax , _1);         // index of the first max |_1|
+
 #endif // COS_GEN_VECTOP_H
@@ -55,9 +55,11 @@ defmethod(OBJ, gisEqual, Array, Array)
   I32  val2_s = self2->stride;
   OBJ *val2   = self2->object;
   OBJ *end    = val + val_s*(ptrdiff_t)val_n;
+
+  COS_SITE_DCL(eq,2);
   
   while (val != end) {
-    if (gisEqual(*val,*val2) != True)
+    if (COS_SITE_SEND(eq,gisEqual,*val,*val2) != True)
       retmethod(False);
       
     val  += val_s;
@@ -452,8 +454,10 @@ findVal(OBJ *val, U32 val_n, I32 val_s, OBJ _2)
 
   OBJ *end = val + val_s*(ptrdiff_t)val_n;
 
+  COS_SITE_DCL(eq,2);
+
   while (val != end) {
-    if (gisEqual(_2, *val) == True)
+    if (COS_SITE_SEND(eq,gisEqual,_2,*val) == True)
       return val;
     val += val_s;
   }
@@ -489,16 +493,17 @@ static OBJ*
 KnuthMorrisPratt(OBJ *val, U32 val_n, I32 val_s, OBJ *pat, I32 pat_n, I32 pat_s)
 {
   CARRAY_CREATE(I32,kmpNext,pat_n);
+  COS_SITE_DCL(eq,2);
 
   { // preprocessing
     I32 i = 0, j = kmpNext[0] = -1;
 
     while (i < pat_n) {
-      while (j > -1 && gisEqual(pat[i*pat_s],pat[j*pat_s]) == False)
+      while (j > -1 && COS_SITE_SEND(eq,gisEqual,pat[i*pat_s],pat[j*pat_s]) == False)
         j = kmpNext[j];
       i++;
       j++;
-      if (gisEqual(pat[i*pat_s],pat[j*pat_s]) == True)
+      if (COS_SITE_SEND(eq,gisEqual,pat[i*pat_s],pat[j*pat_s]) == True)
         kmpNext[i] = kmpNext[j];
       else
         kmpNext[i] = j;
@@ -510,7 +515,7 @@ KnuthMorrisPratt(OBJ *val, U32 val_n, I32 val_s, OBJ *pat, I32 pat_n, I32 pat_s)
     U32 j = 0;
 
     while (j < val_n) {
-      while (i > -1 && gisEqual(pat[i*pat_s],val[j*val_s]) == False)
+      while (i > -1 && COS_SITE_SEND(eq,gisEqual,pat[i*pat_s],val[j*val_s]) == False)
         i = kmpNext[i];
       i++;
       j++;
@@ -398,6 +398,140 @@ defmethod(OBJ, gmap4, Functor, Array, Array, Array, Array)
   retmethod(_arr);
 endmethod
 
+// ----- foreach, apply, map with message expression (batched send)
+
+enum { MSG_CHUNK = 64 };
+
+defmethod(void, gforeach, Array, MsgExpr)
+  if (self2->max != -1) // not unary
+    next_method(self, self2);
+  else
+    cos_method_send1(self2->sel, self->size,
+                     self->object, self->stride, 0, 0, 0);
+endmethod
+
+defmethod(void, gforeach2, Array, Array, MsgExpr)
+  U32 size = self->size < self2->size ? self->size : self2->size;
+
+  if (self3->max != -2) // not binary
+    next_method(self, self2, self3);
+  else
+    cos_method_send2(self3->sel, size,
+                     self ->object, self ->stride,
+                     self2->object, self2->stride, 0, 0, 0);
+endmethod
+
+defmethod(OBJ, gapply, MsgExpr, Array)
+  if (self->max != -1 || !COS_GEN_ORET(self->sel)) // not unary or no result
+    next_method(self, self2);
+
+  else {
+    U32  size  = self2->size;
+    I32  val_s = self2->stride;
+    OBJ *val   = self2->object;
+    OBJ  res[MSG_CHUNK], old;
+    U32  i, n;
+
+    for (; size; size -= n) {
+      n = size < MSG_CHUNK ? size : MSG_CHUNK;
+      cos_method_send1(self->sel, n, val, val_s, 0, res, 1);
+
+      for (i = 0; i < n; i++, val += val_s)
+        if (res[i] != *val)
+          old = *val, *val = gretain(res[i]), grelease(old);
+    }
+
+    retmethod(_2);
+  }
+endmethod
+
+defmethod(OBJ, gapply2, MsgExpr, Array, Array)
+  if (self->max != -2 || !COS_GEN_ORET(self->sel)) // not binary or no result
+    next_method(self, self2, self3);
+
+  else {
+    U32  size   = self2->size < self3->size ? self2->size : self3->size;
+    I32  val_s  = self2->stride;
+    OBJ *val    = self2->object;
+    I32  val2_s = self3->stride;
+    OBJ *val2   = self3->object;
+    OBJ  res[MSG_CHUNK], old;
+    U32  i, n;
+
+    for (; size; size -= n) {
+      n = size < MSG_CHUNK ? size : MSG_CHUNK;
+      cos_method_send2(self->sel, n, val, val_s, val2, val2_s, 0, res, 1);
+
+      for (i = 0; i < n; i++, val += val_s)
+        if (res[i] != *val)
+          old = *val, *val = gretain(res[i]), grelease(old);
+
+      val2 += val2_s*(ptrdiff_t)n;
+    }
+
+    retmethod(_2);
+  }
+endmethod
+
+defmethod(OBJ, gmap, MsgExpr, Array)
+  if (self->max != -1 || !COS_GEN_ORET(self->sel)) // not unary or no result
+    next_method(self, self2);
+
+  else {
+    U32  size  = self2->size;
+    I32  val_s = self2->stride;
+    OBJ *val   = self2->object;
+    U32  i, n;
+
+    struct Array* arr = Array_alloc(size);
+    OBJ _arr = gautoRelease( (OBJ)arr );
+
+    U32 *dst_n = &arr->size;
+    OBJ *dst   = arr->object;
+
+    for (; size; size -= n, val += val_s*(ptrdiff_t)n) {
+      n = size < MSG_CHUNK ? size : MSG_CHUNK;
+      cos_method_send1(self->sel, n, val, val_s, 0, dst, 1);
+
+      for (i = 0; i < n; i++)
+        *dst = gretain(*dst), ++dst, ++*dst_n;
+    }
+
+    retmethod(_arr);
+  }
+endmethod
+
+defmethod(OBJ, gmap2, MsgExpr, Array, Array)
+  if (self->max != -2 || !COS_GEN_ORET(self->sel)) // not binary or no result
+    next_method(self, self2, self3);
+
+  else {
+    U32  size   = self2->size < self3->size ? self2->size : self3->size;
+    I32  val_s  = self2->stride;
+    OBJ *val    = self2->object;
+    I32  val2_s = self3->stride;
+    OBJ *val2   = self3->object;
+    U32  i, n;
+
+    struct Array* arr = Array_alloc(size);
+    OBJ _arr = gautoRelease( (OBJ)arr );
+
+    U32 *dst_n = &arr->size;
+    OBJ *dst   = arr->object;
+
+    for (; size; size -= n, val  += val_s *(ptrdiff_t)n,
+                            val2 += val2_s*(ptrdiff_t)n) {
+      n = size < MSG_CHUNK ? size : MSG_CHUNK;
+      cos_method_send2(self->sel, n, val, val_s, val2, val2_s, 0, dst, 1);
+
+      for (i = 0; i < n; i++)
+        *dst = gretain(*dst), ++dst, ++*dst_n;
+    }
+
+    retmethod(_arr);
+  }
+endmethod
+
 // ----- select, reject
 
 defmethod(OBJ, gselect, Array, Functor)
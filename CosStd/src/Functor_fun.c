@@ -57,6 +57,20 @@ DEFFUNC(7)
 DEFFUNC(8)
 DEFFUNC(9)
 
+struct Functor*
+MsgExpr_init(struct MsgExpr *msg)
+{
+  SEL sel = msg->sel;
+
+  ensure( !COS_GEN_NARG(sel) && !COS_GEN_VARG(sel) &&
+          (COS_GEN_ORET(sel) || COS_GEN_VRET(sel)),
+          "message expression requires receivers only and OBJ or void return" );
+
+  msg->max = -(I32)COS_GEN_RNK(sel);
+
+  return &msg->Functor;
+}
+
 // ----- ctors
 
 #undef  DEFMETHOD
@@ -156,6 +170,10 @@ defmethod(STR, gstr, FunExpr)
   retmethod(self->str);
 endmethod
 
+defmethod(STR, gstr, MsgExpr)
+  retmethod(self->sel->str);
+endmethod
+
 // --------------------------------------------------------
 // ---- eval
 
@@ -615,3 +633,40 @@ defmethod(OBJ, gevalFun, FunExpr9)
   }
 endmethod
 
+// ----- message
+
+defmethod(OBJ, gevalFun, MsgExpr)
+  struct cos_functor_context *cxt = cos_functor_context();
+  OBJ *var = cxt->top;
+  I32 narg = cxt->stk - cxt->top;
+  SEL  sel = self->sel;
+  OBJ  res = Nil;
+
+  ensure(narg <= self->max, "message expression requires all its arguments");
+
+  switch(-self->max) {
+    case 1: cos_method_fastLookup1(sel, cos_object_id(var[-1]))
+              (sel, var[-1], 0, &res); break;
+    case 2: cos_method_fastLookup2(sel, cos_object_id(var[-1]),
+                                        cos_object_id(var[-2]))
+              (sel, var[-1], var[-2], 0, &res); break;
+    case 3: cos_method_fastLookup3(sel, cos_object_id(var[-1]),
+                                        cos_object_id(var[-2]),
+                                        cos_object_id(var[-3]))
+              (sel, var[-1], var[-2], var[-3], 0, &res); break;
+    case 4: cos_method_fastLookup4(sel, cos_object_id(var[-1]),
+                                        cos_object_id(var[-2]),
+                                        cos_object_id(var[-3]),
+                                        cos_object_id(var[-4]))
+              (sel, var[-1], var[-2], var[-3], var[-4], 0, &res); break;
+    case 5: cos_method_fastLookup5(sel, cos_object_id(var[-1]),
+                                        cos_object_id(var[-2]),
+                                        cos_object_id(var[-3]),
+                                        cos_object_id(var[-4]),
+                                        cos_object_id(var[-5]))
+              (sel, var[-1], var[-2], var[-3], var[-4], var[-5], 0, &res); break;
+    default : ensure(0, "invalid MsgExpr rank");
+  }
+
+  retmethod(res);
+endmethod
@@ -21,13 +21,132 @@
 #include <cos/Locker.h>
 #include <cos/gen/object.h>
 #include <cos/gen/message.h>
+#include <cos/gen/value.h>
+#include <cos/gen/relop.h>
+#include <cos/gen/accessor.h>
+#include <cos/gen/sequence.h>
+#include <cos/gen/algorithm.h>
+#include <cos/gen/collection.h>
+
+#include <stdlib.h>
 
 // -----
 
 makclass(Locker,Proxy);
+makclass(RWLocker,Locker);
+makclass(SpinLocker,Locker);
 
 // -----
 
+useclass(ExBadAlloc);
+
+// ----- read-only messages (set of generic ids, open addressing)
+
+/* NOTE-INFO: read-only messages
+ * RWLocker looks up the set without lock while Locker_readOnly may register
+ * messages. Registrations are serialized, ids are stored atomically in free
+ * cells and a larger set is filled before being published. Replaced sets are
+ * kept (chained to the new one) since a concurrent lookup may still probe
+ * them, their total size is below the size of the current set.
+ */
+
+struct rdo {
+  struct rdo *old;
+  U32 msk, cnt;
+  U32 id[];
+};
+
+static struct rdo *rdo_set;
+
+#ifdef __GNUC__
+#define RDO_LOAD(p)    __atomic_load_n (&(p), __ATOMIC_ACQUIRE)
+#define RDO_STORE(p,v) __atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+#define RDO_LOAD(p)    (p)
+#define RDO_STORE(p,v) ((p) = (v))
+#endif
+
+#define RDO_PEEK(p) (*(volatile U32*)&(p)) // cells are filled once
+
+#if COS_HAS_POSIX
+static pthread_mutex_t rdo_lock = PTHREAD_MUTEX_INITIALIZER;
+#define RDO_LOCK()   pthread_mutex_lock  (&rdo_lock)
+#define RDO_UNLOCK() pthread_mutex_unlock(&rdo_lock)
+#else
+#define RDO_LOCK()   ((void)0)
+#define RDO_UNLOCK() ((void)0)
+#endif
+
+static void
+rdo_put(struct rdo *set, U32 id)
+{
+  U32 i = id & set->msk;
+
+  while (set->id[i] && set->id[i] != id)
+    i = (i+1) & set->msk;
+
+  if (!set->id[i])
+    RDO_STORE(set->id[i], id), ++set->cnt;
+}
+
+static struct rdo*
+rdo_enlarge(struct rdo *old)
+{
+  U32 msk = old ? 2*old->msk+1 : 63;
+  struct rdo *set = calloc(1, sizeof *set + (msk+1) * sizeof *set->id);
+  U32 i;
+
+  if (set) {
+    set->old = old;
+    set->msk = msk;
+
+    if (old)
+      for (i = 0; i <= old->msk; i++)
+        if (old->id[i]) rdo_put(set, old->id[i]);
+
+    RDO_STORE(rdo_set, set);
+  }
+
+  return set;
+}
+
+void
+Locker_readOnly(SEL sel)
+{
+  struct rdo *set;
+
+  if (Locker_isReadOnly(sel))
+    return;
+
+  RDO_LOCK();
+
+  set = rdo_set;
+  if (!set || 2*(set->cnt+1) > set->msk+1)
+    set = rdo_enlarge(set);
+
+  if (set)
+    rdo_put(set, sel->Behavior.id);
+
+  RDO_UNLOCK();
+
+  if (!set)
+    THROW(ExBadAlloc);
+}
+
+BOOL
+Locker_isReadOnly(SEL sel)
+{
+  struct rdo *set = RDO_LOAD(rdo_set);
+  U32 id = sel->Behavior.id, i, cel;
+
+  if (set)
+    for (i = id & set->msk; (cel = RDO_PEEK(set->id[i])); i = (i+1) & set->msk)
+      if (cel == id)
+        return YES;
+
+  return NO;
+}
+
 #if !COS_HAS_POSIX    // ----------------------------------------------
 
 defmethod(OBJ, galloc, pmLocker)
@@ -38,37 +157,147 @@ defmethod(OBJ, ginitWith, pmLocker, Object)
   retmethod(_2);
 endmethod
 
+defmethod(OBJ, galloc, pmRWLocker)
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, ginitWith, pmRWLocker, Object)
+  retmethod(_2);
+endmethod
+
+defmethod(OBJ, galloc, pmSpinLocker)
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, ginitWith, pmSpinLocker, Object)
+  retmethod(_2);
+endmethod
+
 #else // if COS_HAS_POSIX ---------------------------------------------
 
+#include <sched.h>
+
+enum { MUTEX, RWLOCK, SPIN };
+
+/* NOTE-CONF: Spin locks
+ * The spin count before yielding the CPU, which should be a bit longer than
+ * the critical sections (i.e. the forwarded messages) of SpinLocker.
+ */
+#ifndef COS_LOCKER_SPIN
+#define COS_LOCKER_SPIN 1024
+#endif
+
+// ----- default read-only messages
+
+static pthread_once_t rdo_once = PTHREAD_ONCE_INIT;
+
+static void
+rdo_init(void)
+{
+  SEL sel[] = {
+    genericref(gsize, gisEmpty, gcapacity, gcount),
+    genericref(gint, glng, gflt, gcpx, gintAt, glngAt, gfltAt, gcpxAt),
+    genericref(ggetAt, gfirst, glast),
+    genericref(gisEqual, gcompare, gfind, gifind, gindexOf)
+  };
+  U32 i;
+
+  for (i = 0; i < COS_ARRLEN(sel); i++)
+    Locker_readOnly(sel[i]);
+}
+
 // ----- ctor/dtor
 
 defmethod(OBJ, ginitWith, Locker, Object)
   next_method(self,self2);
-  pthread_mutex_init(&self->lock,0);
+  pthread_mutex_init(&self->lock.mutex,0);
+  self->kind = MUTEX;
+endmethod
+
+defmethod(OBJ, ginitWith, RWLocker, Object)
+  next_method(self,self2);
+  pthread_once(&rdo_once, rdo_init);
+  pthread_mutex_destroy(&self->Locker.lock.mutex);
+  pthread_rwlock_init(&self->Locker.lock.rwlock,0);
+  self->Locker.kind = RWLOCK;
+endmethod
+
+defmethod(OBJ, ginitWith, SpinLocker, Object)
+  next_method(self,self2);
+#ifdef __GNUC__ // spin locks require GCC atomic builtins
+  pthread_mutex_destroy(&self->Locker.lock.mutex);
+  self->Locker.lock.spin = 0;
+  self->Locker.kind = SPIN;
+#endif
 endmethod
 
 defmethod(OBJ, gdeinit, Locker)
-  pthread_mutex_destroy(&self->lock);
+  switch (self->kind) {
+  case RWLOCK: pthread_rwlock_destroy(&self->lock.rwlock); break;
+  case SPIN  : break;
+  default    : pthread_mutex_destroy(&self->lock.mutex);
+  }
   next_method(self);
 endmethod
 
 #undef  SORT
 #undef  LOCK
 #define SORT(l1,l2) if (l1 >  l2) { struct Locker *tmp=l1; l1=l2, l2=tmp; }
-#define LOCK(l1,l2) if (l1 != l2) { lock(l2); }
+#define LOCK(l1,l2) if (l1 != l2) { lock(_sel,l2); }
 
 // ----- rank1-{lock,unlock,clear,chkret}
 
 static inline void
-lock(struct Locker *l)
+spin_lock(int *spin)
 {
-  pthread_mutex_lock(&l->lock);
+#ifdef __GNUC__
+  U32 n = 0;
+
+  while (__atomic_exchange_n(spin, 1, __ATOMIC_ACQUIRE))
+    while (__atomic_load_n(spin, __ATOMIC_RELAXED))
+      if (++n % COS_LOCKER_SPIN == 0)
+        sched_yield();
+#else
+  COS_UNUSED(spin);
+#endif
+}
+
+static inline void
+spin_unlock(int *spin)
+{
+#ifdef __GNUC__
+  __atomic_store_n(spin, 0, __ATOMIC_RELEASE);
+#else
+  COS_UNUSED(spin);
+#endif
+}
+
+static inline void
+lock(SEL _sel, struct Locker *l)
+{
+  switch (l->kind) {
+  case RWLOCK:
+    if (Locker_isReadOnly(_sel))
+      pthread_rwlock_rdlock(&l->lock.rwlock);
+    else
+      pthread_rwlock_wrlock(&l->lock.rwlock);
+    break;
+  case SPIN:
+    spin_lock(&l->lock.spin);
+    break;
+  default:
+    pthread_mutex_lock(&l->lock.mutex);
+  }
 }
 
 static inline void
 unlock(struct Locker *l)
 {
-  pthread_mutex_unlock(&l->lock);
+  switch (l->kind) {
+  case RWLOCK: pthread_rwlock_unlock(&l->lock.rwlock); break;
+  case SPIN  : spin_unlock(&l->lock.spin); break;
+  default    : pthread_mutex_unlock(&l->lock.mutex);
+  }
 }
 
 static inline void
@@ -80,10 +309,10 @@ clear(OBJ obj)
 // ----- rank2-{lock,unlock,chkret}
 
 static inline void
-lock2(struct Locker *l1, struct Locker *l2)
+lock2(SEL _sel, struct Locker *l1, struct Locker *l2)
 {
   SORT(l1,l2);
-  lock(l1);
+  lock(_sel,l1);
   LOCK(l1,l2);
 }
 
@@ -94,15 +323,24 @@ unlock2(struct Locker *l1, struct Locker *l2)
   if (l1 != l2) unlock(l2);
 }
 
+static inline void
+chkret2(SEL sel, OBJ *ret, struct Locker *l1, struct Locker *l2)
+{
+  if (COS_GEN_ISOBJ(sel)) {
+         if (*ret == l1->Proxy.obj) *ret = (OBJ)l1;
+    else if (*ret == l2->Proxy.obj) *ret = (OBJ)l2;
+  }
+}
+
 // ----- rank3-{lock,unlock,chkret}
 
 static inline void
-lock3(struct Locker *l1, struct Locker *l2, struct Locker *l3)
+lock3(SEL _sel, struct Locker *l1, struct Locker *l2, struct Locker *l3)
 {
   SORT(l1,l2);
   SORT(l1,l3);
   SORT(l2,l3);
-  lock(l1);
+  lock(_sel,l1);
   LOCK(l1,l2);
   LOCK(l2,l3);
 }
@@ -115,16 +353,26 @@ unlock3(struct Locker *l1, struct Locker *l2, struct Locker *l3)
   if (l1 != l3 && l2 != l3) unlock(l3);
 }
 
+static inline void
+chkret3(SEL sel, OBJ *ret, struct Locker *l1, struct Locker *l2, struct Locker *l3)
+{
+  if (COS_GEN_ISOBJ(sel)) {
+         if (*ret == l1->Proxy.obj) *ret = (OBJ)l1;
+    else if (*ret == l2->Proxy.obj) *ret = (OBJ)l2;
+    else if (*ret == l3->Proxy.obj) *ret = (OBJ)l3;
+  }
+}
+
 // ----- rank4-{lock,unlock,chkret}
 
 static inline void
-lock4(struct Locker *l1, struct Locker *l2, struct Locker *l3,
+lock4(SEL _sel, struct Locker *l1, struct Locker *l2, struct Locker *l3,
       struct Locker *l4)
 { // Batcher's Merge-Exchange N=4 (5 compare, 3 parallel steps)
   SORT(l1,l3); SORT(l2,l4);
   SORT(l1,l2); SORT(l3,l4);
   SORT(l2,l3);
-  lock(l1);
+  lock(_sel,l1);
   LOCK(l1,l2); LOCK(l3,l4);
   LOCK(l2,l3);
 }
@@ -139,10 +387,21 @@ unlock4(struct Locker *l1, struct Locker *l2, struct Locker *l3,
   if (l1 != l4 && l2 != l4 && l3 != l4) unlock(l4);
 }
 
+static inline void
+chkret4(SEL sel, OBJ *ret, struct Locker *l1, struct Locker *l2, struct Locker *l3, struct Locker *l4)
+{
+  if (COS_GEN_ISOBJ(sel)) {
+         if (*ret == l1->Proxy.obj) *ret = (OBJ)l1;
+    else if (*ret == l2->Proxy.obj) *ret = (OBJ)l2;
+    else if (*ret == l3->Proxy.obj) *ret = (OBJ)l3;
+    else if (*ret == l4->Proxy.obj) *ret = (OBJ)l4;
+  }
+}
+
 // ----- rank5-{lock,unlock,chkret}
 
 static inline void
-lock5(struct Locker *l1, struct Locker *l2, struct Locker *l3,
+lock5(SEL _sel, struct Locker *l1, struct Locker *l2, struct Locker *l3,
       struct Locker *l4, struct Locker *l5)
 { // Batcher's Merge-Exchange N=5 (9 compare, 5 parallel steps)
   SORT(l1,l5); SORT(l2,l4);
@@ -150,7 +409,7 @@ lock5(struct Locker *l1, struct Locker *l2, struct Locker *l3,
   SORT(l3,l5); SORT(l1,l2);
   SORT(l3,l4); SORT(l2,l5);
   SORT(l2,l3); SORT(l4,l5);
-  lock(l1);
+  lock(_sel,l1);
   LOCK(l1,l2); LOCK(l3,l4);
   LOCK(l2,l3); LOCK(l4,l5);
 }
@@ -165,14 +424,33 @@ unlock5(struct Locker *l1, struct Locker *l2, struct Locker *l3,
   if (l1 != l4 && l2 != l4 && l3 != l4) unlock(l4);
   if (l1 != l5 && l2 != l5 && l3 != l5 && l4 != l5) unlock(l5);
 }
+
+static inline void
+chkret5(SEL sel, OBJ *ret, struct Locker *l1, struct Locker *l2, struct Locker *l3, struct Locker *l4, struct Locker *l5)
+{
+  if (COS_GEN_ISOBJ(sel)) {
+         if (*ret == l1->Proxy.obj) *ret = (OBJ)l1;
+    else if (*ret == l2->Proxy.obj) *ret = (OBJ)l2;
+    else if (*ret == l3->Proxy.obj) *ret = (OBJ)l3;
+    else if (*ret == l4->Proxy.obj) *ret = (OBJ)l4;
+    else if (*ret == l5->Proxy.obj) *ret = (OBJ)l5;
+  }
+}
  
 // ----- error/forward (1+3+7+15+31=57 cases)
 
+/* NOTE-INFO: multiple lockers
+   The next methods of the methods specialized on several Locker are the
+   methods specialized on fewer Locker, which would lock again the lockers
+   already held. So these methods forward the message to the locked objects
+   themselves, as the Proxy methods do.
+*/
+
 // ----- rank 1 (2^1-1=1 case)
 
 defmethod(void, gunrecognizedMessage1, Locker)
   OPRT(_1,clear);
-  lock(self);
+  lock(_sel,self);
   next_method(self);
   unlock(self);
   UNPRT(_1);
@@ -182,7 +460,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage2, Locker, Object)
   OPRT(_1,clear);
-  lock(self);
+  lock(_sel,self);
   next_method(self,self2);
   unlock(self);
   UNPRT(_1);
@@ -190,7 +468,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage2, Object, Locker)
   OPRT(_2,clear);
-  lock(self2);
+  lock(_sel,self2);
   next_method(self,self2);
   unlock(self2);
   UNPRT(_2);
@@ -199,8 +477,9 @@ endmethod
 
 defmethod(void, gunrecognizedMessage2, Locker, Locker)
   OPRT(_1,clear); OPRT(_2,clear);
-  lock2(self,self2);
-  next_method(self,self2);
+  lock2(_sel,self,self2);
+  forward_message(self->Proxy.obj,self2->Proxy.obj);
+  chkret2(_sel,_ret,self,self2);
   unlock2(self,self2);
   UNPRT(_1);
 endmethod
@@ -209,7 +488,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage3, Locker, Object, Object)
   OPRT(_1,clear);
-  lock(self);
+  lock(_sel,self);
   next_method(self,self2,self3);
   unlock(self);
   UNPRT(_1);
@@ -217,7 +496,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage3, Object, Locker, Object)
   OPRT(_2,clear);
-  lock(self2);
+  lock(_sel,self2);
   next_method(self,self2,self3);
   unlock(self2);
   UNPRT(_2);
@@ -225,7 +504,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage3, Object, Object, Locker)
   OPRT(_3,clear);
-  lock(self3);
+  lock(_sel,self3);
   next_method(self,self2,self3);
   unlock(self3);
   UNPRT(_3);
@@ -234,24 +513,27 @@ endmethod
 
 defmethod(void, gunrecognizedMessage3, Locker, Locker, Object)
   OPRT(_1,clear); OPRT(_2,clear);
-  lock2(self,self2);
-  next_method(self,self2,self3);
+  lock2(_sel,self,self2);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3);
+  chkret2(_sel,_ret,self,self2);
   unlock2(self,self2);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage3, Locker, Object, Locker)
   OPRT(_1,clear); OPRT(_3,clear);
-  lock2(self,self3);
-  next_method(self,self2,self3);
+  lock2(_sel,self,self3);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj);
+  chkret2(_sel,_ret,self,self3);
   unlock2(self,self3);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage3, Object, Locker, Locker)
   OPRT(_2,clear); OPRT(_3,clear);
-  lock2(self2,self3);
-  next_method(self,self2,self3);
+  lock2(_sel,self2,self3);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj);
+  chkret2(_sel,_ret,self2,self3);
   unlock2(self2,self3);
   UNPRT(_2);
 endmethod
@@ -259,8 +541,9 @@ endmethod
 
 defmethod(void, gunrecognizedMessage3, Locker, Locker, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear);
-  lock3(self,self2,self3);
-  next_method(self,self2,self3);
+  lock3(_sel,self,self2,self3);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj);
+  chkret3(_sel,_ret,self,self2,self3);
   unlock3(self,self2,self3);
   UNPRT(_1);
 endmethod
@@ -269,7 +552,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Object, Object, Object)
   OPRT(_1,clear);
-  lock(self);
+  lock(_sel,self);
   next_method(self,self2,self3,self4);
   unlock(self);
   UNPRT(_1);
@@ -277,7 +560,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Locker, Object, Object)
   OPRT(_2,clear);
-  lock(self2);
+  lock(_sel,self2);
   next_method(self,self2,self3,self4);
   unlock(self2);
   UNPRT(_2);
@@ -285,7 +568,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Object, Locker, Object)
   OPRT(_3,clear);
-  lock(self3);
+  lock(_sel,self3);
   next_method(self,self2,self3,self4);
   unlock(self3);
   UNPRT(_3);
@@ -293,7 +576,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Object, Object, Locker)
   OPRT(_4,clear);
-  lock(self4);
+  lock(_sel,self4);
   next_method(self,self2,self3,self4);
   unlock(self4);
   UNPRT(_4);
@@ -302,48 +585,54 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Locker, Object, Object)
   OPRT(_1,clear); OPRT(_2,clear);
-  lock2(self,self2);
-  next_method(self,self2,self3,self4);
+  lock2(_sel,self,self2);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3,_4);
+  chkret2(_sel,_ret,self,self2);
   unlock2(self,self2);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Object, Locker, Object)
   OPRT(_1,clear); OPRT(_3,clear);
-  lock2(self,self3);
-  next_method(self,self2,self3,self4);
+  lock2(_sel,self,self3);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj,_4);
+  chkret2(_sel,_ret,self,self3);
   unlock2(self,self3);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Object, Object, Locker)
   OPRT(_1,clear); OPRT(_4,clear);
-  lock2(self,self4);
-  next_method(self,self2,self3,self4);
+  lock2(_sel,self,self4);
+  forward_message(self->Proxy.obj,_2,_3,self4->Proxy.obj);
+  chkret2(_sel,_ret,self,self4);
   unlock2(self,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Locker, Locker, Object)
   OPRT(_2,clear); OPRT(_3,clear);
-  lock2(self2,self3);
-  next_method(self,self2,self3,self4);
+  lock2(_sel,self2,self3);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj,_4);
+  chkret2(_sel,_ret,self2,self3);
   unlock2(self2,self3);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Locker, Object, Locker)
   OPRT(_2,clear); OPRT(_4,clear);
-  lock2(self2,self4);
-  next_method(self,self2,self3,self4);
+  lock2(_sel,self2,self4);
+  forward_message(_1,self2->Proxy.obj,_3,self4->Proxy.obj);
+  chkret2(_sel,_ret,self2,self4);
   unlock2(self2,self4);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Object, Locker, Locker)
   OPRT(_3,clear); OPRT(_4,clear);
-  lock2(self3,self4);
-  next_method(self,self2,self3,self4);
+  lock2(_sel,self3,self4);
+  forward_message(_1,_2,self3->Proxy.obj,self4->Proxy.obj);
+  chkret2(_sel,_ret,self3,self4);
   unlock2(self3,self4);
   UNPRT(_3);
 endmethod
@@ -351,32 +640,36 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Locker, Locker, Object)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear);
-  lock3(self,self2,self3);
-  next_method(self,self2,self3,self4);
+  lock3(_sel,self,self2,self3);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj,_4);
+  chkret3(_sel,_ret,self,self2,self3);
   unlock3(self,self2,self3);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Locker, Object, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_4,clear);
-  lock3(self,self2,self4);
-  next_method(self,self2,self3,self4);
+  lock3(_sel,self,self2,self4);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3,self4->Proxy.obj);
+  chkret3(_sel,_ret,self,self2,self4);
   unlock3(self,self2,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Object, Locker, Locker)
   OPRT(_1,clear); OPRT(_3,clear); OPRT(_4,clear);
-  lock3(self,self3,self4);
-  next_method(self,self2,self3,self4);
+  lock3(_sel,self,self3,self4);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj,self4->Proxy.obj);
+  chkret3(_sel,_ret,self,self3,self4);
   unlock3(self,self3,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage4, Object, Locker, Locker, Locker)
   OPRT(_2,clear); OPRT(_3,clear); OPRT(_4,clear);
-  lock3(self2,self3,self4);
-  next_method(self,self2,self3,self4);
+  lock3(_sel,self2,self3,self4);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj,self4->Proxy.obj);
+  chkret3(_sel,_ret,self2,self3,self4);
   unlock3(self2,self3,self4);
   UNPRT(_2);
 endmethod
@@ -384,8 +677,9 @@ endmethod
 
 defmethod(void, gunrecognizedMessage4, Locker, Locker, Locker, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear); OPRT(_4,clear);
-  lock4(self,self2,self3,self4);
-  next_method(self,self2,self3,self4);
+  lock4(_sel,self,self2,self3,self4);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj,self4->Proxy.obj);
+  chkret4(_sel,_ret,self,self2,self3,self4);
   unlock4(self,self2,self3,self4);
   UNPRT(_1);
 endmethod
@@ -394,7 +688,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Object, Object, Object)
   OPRT(_1,clear);
-  lock(self);
+  lock(_sel,self);
   next_method(self,self2,self3,self4,self5);
   unlock(self);
   UNPRT(_1);
@@ -402,7 +696,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Object, Object, Object)
   OPRT(_2,clear);
-  lock(self2);
+  lock(_sel,self2);
   next_method(self,self2,self3,self4,self5);
   unlock(self2);
   UNPRT(_2);
@@ -410,7 +704,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Locker, Object, Object)
   OPRT(_3,clear);
-  lock(self3);
+  lock(_sel,self3);
   next_method(self,self2,self3,self4,self5);
   unlock(self3);
   UNPRT(_3);
@@ -418,7 +712,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Object, Locker, Object)
   OPRT(_4,clear);
-  lock(self4);
+  lock(_sel,self4);
   next_method(self,self2,self3,self4,self5);
   unlock(self4);
   UNPRT(_4);
@@ -426,7 +720,7 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Object, Object, Locker)
   OPRT(_5,clear);
-  lock(self5);
+  lock(_sel,self5);
   next_method(self,self2,self3,self4,self5);
   unlock(self5);
   UNPRT(_5);
@@ -435,80 +729,90 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Object, Object, Object)
   OPRT(_1,clear); OPRT(_2,clear);
-  lock2(self,self2);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self,self2);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3,_4,_5);
+  chkret2(_sel,_ret,self,self2);
   unlock2(self,self2);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Locker, Object, Object)
   OPRT(_1,clear); OPRT(_3,clear);
-  lock2(self,self3);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self,self3);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj,_4,_5);
+  chkret2(_sel,_ret,self,self3);
   unlock2(self,self3);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Object, Locker, Object)
   OPRT(_1,clear); OPRT(_4,clear);
-  lock2(self,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self,self4);
+  forward_message(self->Proxy.obj,_2,_3,self4->Proxy.obj,_5);
+  chkret2(_sel,_ret,self,self4);
   unlock2(self,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Object, Object, Locker)
   OPRT(_1,clear); OPRT(_5,clear);
-  lock2(self,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self,self5);
+  forward_message(self->Proxy.obj,_2,_3,_4,self5->Proxy.obj);
+  chkret2(_sel,_ret,self,self5);
   unlock2(self,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Locker, Object, Object)
   OPRT(_2,clear); OPRT(_3,clear);
-  lock2(self2,self3);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self2,self3);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj,_4,_5);
+  chkret2(_sel,_ret,self2,self3);
   unlock2(self2,self3);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Object, Locker, Object)
   OPRT(_2,clear); OPRT(_4,clear);
-  lock2(self2,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self2,self4);
+  forward_message(_1,self2->Proxy.obj,_3,self4->Proxy.obj,_5);
+  chkret2(_sel,_ret,self2,self4);
   unlock2(self2,self4);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Object, Object, Locker)
   OPRT(_2,clear); OPRT(_5,clear);
-  lock2(self2,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self2,self5);
+  forward_message(_1,self2->Proxy.obj,_3,_4,self5->Proxy.obj);
+  chkret2(_sel,_ret,self2,self5);
   unlock2(self2,self5);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Locker, Locker, Object)
   OPRT(_3,clear); OPRT(_4,clear);
-  lock2(self3,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self3,self4);
+  forward_message(_1,_2,self3->Proxy.obj,self4->Proxy.obj,_5);
+  chkret2(_sel,_ret,self3,self4);
   unlock2(self3,self4);
   UNPRT(_3);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Locker, Object, Locker)
   OPRT(_3,clear); OPRT(_5,clear);
-  lock2(self3,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self3,self5);
+  forward_message(_1,_2,self3->Proxy.obj,_4,self5->Proxy.obj);
+  chkret2(_sel,_ret,self3,self5);
   unlock2(self3,self5);
   UNPRT(_3);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Object, Locker, Locker)
   OPRT(_4,clear); OPRT(_5,clear);
-  lock2(self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock2(_sel,self4,self5);
+  forward_message(_1,_2,_3,self4->Proxy.obj,self5->Proxy.obj);
+  chkret2(_sel,_ret,self4,self5);
   unlock2(self4,self5);
   UNPRT(_4);
 endmethod
@@ -516,80 +820,90 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Locker, Object, Object)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear);
-  lock3(self,self2,self3);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self,self2,self3);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj,_4,_5);
+  chkret3(_sel,_ret,self,self2,self3);
   unlock3(self,self2,self3);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Object, Locker, Object)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_4,clear);
-  lock3(self,self2,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self,self2,self4);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3,self4->Proxy.obj,_5);
+  chkret3(_sel,_ret,self,self2,self4);
   unlock3(self,self2,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Object, Object, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_5,clear);
-  lock3(self,self2,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self,self2,self5);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3,_4,self5->Proxy.obj);
+  chkret3(_sel,_ret,self,self2,self5);
   unlock3(self,self2,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Locker, Locker, Object)
   OPRT(_1,clear); OPRT(_3,clear); OPRT(_4,clear);
-  lock3(self,self3,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self,self3,self4);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj,self4->Proxy.obj,_5);
+  chkret3(_sel,_ret,self,self3,self4);
   unlock3(self,self3,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Locker, Object, Locker)
   OPRT(_1,clear); OPRT(_3,clear); OPRT(_5,clear);
-  lock3(self,self3,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self,self3,self5);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj,_4,self5->Proxy.obj);
+  chkret3(_sel,_ret,self,self3,self5);
   unlock3(self,self3,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Object, Locker, Locker)
   OPRT(_1,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock3(self,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self,self4,self5);
+  forward_message(self->Proxy.obj,_2,_3,self4->Proxy.obj,self5->Proxy.obj);
+  chkret3(_sel,_ret,self,self4,self5);
   unlock3(self,self4,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Locker, Locker, Object)
   OPRT(_2,clear); OPRT(_3,clear); OPRT(_4,clear);
-  lock3(self2,self3,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self2,self3,self4);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj,self4->Proxy.obj,_5);
+  chkret3(_sel,_ret,self2,self3,self4);
   unlock3(self2,self3,self4);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Locker, Object, Locker)
   OPRT(_2,clear); OPRT(_3,clear); OPRT(_5,clear);
-  lock3(self2,self3,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self2,self3,self5);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj,_4,self5->Proxy.obj);
+  chkret3(_sel,_ret,self2,self3,self5);
   unlock3(self2,self3,self5);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Object, Locker, Locker)
   OPRT(_2,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock3(self2,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self2,self4,self5);
+  forward_message(_1,self2->Proxy.obj,_3,self4->Proxy.obj,self5->Proxy.obj);
+  chkret3(_sel,_ret,self2,self4,self5);
   unlock3(self2,self4,self5);
   UNPRT(_2);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Object, Locker, Locker, Locker)
   OPRT(_3,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock3(self3,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock3(_sel,self3,self4,self5);
+  forward_message(_1,_2,self3->Proxy.obj,self4->Proxy.obj,self5->Proxy.obj);
+  chkret3(_sel,_ret,self3,self4,self5);
   unlock3(self3,self4,self5);
   UNPRT(_3);
 endmethod
@@ -597,40 +911,45 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Locker, Locker, Object)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear); OPRT(_4,clear);
-  lock4(self,self2,self3,self4);
-  next_method(self,self2,self3,self4,self5);
+  lock4(_sel,self,self2,self3,self4);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj,self4->Proxy.obj,_5);
+  chkret4(_sel,_ret,self,self2,self3,self4);
   unlock4(self,self2,self3,self4);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Locker, Object, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear); OPRT(_5,clear);
-  lock4(self,self2,self3,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock4(_sel,self,self2,self3,self5);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj,_4,self5->Proxy.obj);
+  chkret4(_sel,_ret,self,self2,self3,self5);
   unlock4(self,self2,self3,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Object, Locker, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock4(self,self2,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock4(_sel,self,self2,self4,self5);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,_3,self4->Proxy.obj,self5->Proxy.obj);
+  chkret4(_sel,_ret,self,self2,self4,self5);
   unlock4(self,self2,self4,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Object, Locker, Locker, Locker)
   OPRT(_1,clear); OPRT(_3,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock4(self,self3,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock4(_sel,self,self3,self4,self5);
+  forward_message(self->Proxy.obj,_2,self3->Proxy.obj,self4->Proxy.obj,self5->Proxy.obj);
+  chkret4(_sel,_ret,self,self3,self4,self5);
   unlock4(self,self3,self4,self5);
   UNPRT(_1);
 endmethod
 
 defmethod(void, gunrecognizedMessage5, Object, Locker, Locker, Locker, Locker)
   OPRT(_2,clear); OPRT(_3,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock4(self2,self3,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock4(_sel,self2,self3,self4,self5);
+  forward_message(_1,self2->Proxy.obj,self3->Proxy.obj,self4->Proxy.obj,self5->Proxy.obj);
+  chkret4(_sel,_ret,self2,self3,self4,self5);
   unlock4(self2,self3,self4,self5);
   UNPRT(_2);
 endmethod
@@ -638,8 +957,9 @@ endmethod
 
 defmethod(void, gunrecognizedMessage5, Locker, Locker, Locker, Locker, Locker)
   OPRT(_1,clear); OPRT(_2,clear); OPRT(_3,clear); OPRT(_4,clear); OPRT(_5,clear);
-  lock5(self,self2,self3,self4,self5);
-  next_method(self,self2,self3,self4,self5);
+  lock5(_sel,self,self2,self3,self4,self5);
+  forward_message(self->Proxy.obj,self2->Proxy.obj,self3->Proxy.obj,self4->Proxy.obj,self5->Proxy.obj);
+  chkret5(_sel,_ret,self,self2,self3,self4,self5);
   unlock5(self,self2,self3,self4,self5);
   UNPRT(_1);
 endmethod
@@ -62,6 +62,8 @@
 #include <cos/CpxVector.h>
 #include <cos/Function.h>
 
+#include <complex.h>
+
 makclass(CpxVector, FloatingVector);
 
 // vector templates
@@ -76,6 +78,6 @@ makclass(CpxVector, FloatingVector);
 #include "./tmpl/Vector_acc.c"
 #include "./tmpl/Vector_alg.c"
 #include "./tmpl/Vector_fun.c"
-// #include "./tmpl/Vector_fct.c"
+#include "./tmpl/Vector_fct.c"
 // #include "./tmpl/Vector_vfn.c"
 
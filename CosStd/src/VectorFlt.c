@@ -62,6 +62,8 @@
 #include <cos/FltVector.h>
 #include <cos/Function.h>
 
+#include <math.h>
+
 makclass(FltVector, FloatingVector);
 
 // vector templates
@@ -76,6 +78,7 @@ makclass(FltVector, FloatingVector);
 #include "./tmpl/Vector_acc.c"
 #include "./tmpl/Vector_alg.c"
 #include "./tmpl/Vector_fun.c"
-// #include "./tmpl/Vector_fct.c"
+#include "./tmpl/Vector_fct.c"
+#include "./tmpl/Vector_srt.c"
 // #include "./tmpl/Vector_vfn.c"
 
@@ -76,6 +76,7 @@ makclass(ShtVector, IntegralVector);
 #include "./tmpl/Vector_acc.c"
 #include "./tmpl/Vector_alg.c"
 #include "./tmpl/Vector_fun.c"
-// #include "./tmpl/Vector_fct.c"
+#include "./tmpl/Vector_fct.c"
+#include "./tmpl/Vector_srt.c"
 // #include "./tmpl/Vector_vfn.c"
 
@@ -28,35 +28,56 @@
 #include <cos/gen/vectop.h>
 #include <cos/gen/value.h>
 
+#include "Vector_krn.h"
+
 #include <math.h>
+#include <float.h>
 #include <complex.h>
 
 // ----- sum (Kahan formula)
 
-#undef  DEFMETHOD
-#define DEFMETHOD(T,E,O) \
-\
-defmethod(OBJ, gsum, T) \
-  E  *val   = self->value; \
-  I32 val_s = self->stride; \
-  E  *end   = self->value + self->size*self->stride; \
-  E c, s, t, v, y; \
-\
-  s = c = 0; \
-  while (val != end) { \
-    v = *val; \
-    y = v - c; \
-    t = s + y; \
-    c = (t - s) - y; \
-    s = t; \
-    val += val_s; \
-  } \
-\
-  retmethod(gautoRelease(O(s))); \
+defmethod(OBJ, gsum, FltVector)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  F64 *val   = self->value;
+  F64 *end   = val + val_s*(I32)size;
+  F64  c, s, r[2];
+
+  if (val_s == 1 && vector_krn) {
+    vector_sumF64(val, size, r);
+    retmethod(gautoRelease(aFloat(r[0]+r[1])));
+  }
+
+  s = c = 0;
+  while (val != end) {
+    KAHAN(s, c, *val);
+    val += val_s;
+  }
+
+  retmethod(gautoRelease(aFloat(s)));
 endmethod
 
-DEFMETHOD(FltVector, F64, aFloat  )
-DEFMETHOD(CpxVector, C64, aComplex)
+defmethod(OBJ, gsum, CpxVector)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  F64 *val   = (F64*)self->value;
+  F64 *end   = val + 2*val_s*(I32)size;
+  F64  cr, sr, ci, si, r[2];
+
+  if (val_s == 1 && vector_krn) {
+    vector_sumF64(val, 2*size, r);
+    retmethod(gautoRelease(aComplex(r[0], r[1])));
+  }
+
+  sr = cr = si = ci = 0;
+  while (val != end) {
+    KAHAN(sr, cr, val[0]);
+    KAHAN(si, ci, val[1]);
+    val += 2*val_s;
+  }
+
+  retmethod(gautoRelease(aComplex(sr, si)));
+endmethod
 
 // ----- prod
 
@@ -80,6 +101,303 @@ endmethod
 DEFMETHOD(FltVector, F64, aFloat  )
 DEFMETHOD(CpxVector, C64, aComplex)
 
+// ----- BLAS-1
+
+/* NOTE-INFO: BLAS-1
+   Unit-stride vectors use the kernels of Vector_krn.c, complex vectors are
+   seen as pairs of F64. Strided vectors (views) use the same compensated
+   algorithms in scalar loops.
+*/
+
+static F64
+sumsqr(const F64 *val, U32 size, I32 val_s, U32 m, F64 scl)
+{ // m = parts per element (1 real, 2 complex)
+  const F64 *end = val + val_s*(I32)size;
+  F64 c, s, v, w;
+
+  s = c = 0;
+  while (val != end) {
+    v = val[0]*scl, w = m > 1 ? val[1]*scl : 0;
+    KAHAN(s, c, v*v + w*w);
+    val += val_s;
+  }
+
+  return s;
+}
+
+static F64
+amax(const F64 *val, U32 size, I32 val_s, U32 m)
+{
+  const F64 *end = val + val_s*(I32)size;
+  F64 a = 0;
+  U32 j;
+
+  if (val_s == (I32)m && vector_krn)
+    return vector_amaxF64(val, m*size);
+
+  while (val != end) {
+    for (j = 0; j < m; j++)
+      if (fabs(val[j]) > a) a = fabs(val[j]);
+    val += val_s;
+  }
+
+  return a;
+}
+
+static F64
+norm2(const F64 *val, U32 size, I32 val_s, U32 m)
+{ // val_s in F64
+  F64 ss, a, r[2];
+
+  if (val_s == (I32)m && vector_krn)
+    vector_dotF64(val, val, m*size, r), ss = r[0] + r[1];
+  else
+    ss = sumsqr(val, size, val_s, m, 1);
+
+  if (ss >= DBL_MIN && ss <= DBL_MAX)
+    return sqrt(ss);
+
+  // overflow (inf or NaN from compensation), underflow or NaN elements,
+  // scale by the largest part
+  a = amax(val, size, val_s, m);
+  if (!(a > 0)) // zero or NaN only
+    return isnan(ss) ? ss : 0;
+  if (a > DBL_MAX)
+    return a;
+
+  return a * sqrt(sumsqr(val, size, val_s, m, 1/a));
+}
+
+// --- dot
+
+defmethod(OBJ, gdot, FltVector, FltVector)
+  ensure(self->size == self2->size, "incompatible vector sizes");
+
+  U32  size   = self->size;
+  I32  val_s  = self->stride;
+  F64 *val    = self->value;
+  I32  val2_s = self2->stride;
+  F64 *val2   = self2->value;
+  F64 *end    = val + val_s*(I32)size;
+  F64  c, s, r[2];
+
+  if (val_s == 1 && val2_s == 1 && vector_krn) {
+    vector_dotF64(val, val2, size, r);
+    retmethod(gautoRelease(aFloat(r[0]+r[1])));
+  }
+
+  s = c = 0;
+  while (val != end) {
+    KAHAN(s, c, *val * *val2);
+    val  += val_s;
+    val2 += val2_s;
+  }
+
+  retmethod(gautoRelease(aFloat(s)));
+endmethod
+
+defmethod(OBJ, gdot, CpxVector, CpxVector)
+  ensure(self->size == self2->size, "incompatible vector sizes");
+
+  U32  size   = self->size;
+  I32  val_s  = self->stride;
+  F64 *val    = (F64*)self->value;
+  I32  val2_s = self2->stride;
+  F64 *val2   = (F64*)self2->value;
+  F64 *end    = val + 2*val_s*(I32)size;
+  F64  cr, sr, ci, si, r[2], x[2];
+
+  if (val_s == 1 && val2_s == 1 && vector_krn) {
+    vector_dotF64 (val, val2, 2*size, r);
+    vector_dotxF64(val, val2, 2*size, x);
+    retmethod(gautoRelease(aComplex(r[0]-r[1], x[0]+x[1])));
+  }
+
+  sr = cr = si = ci = 0;
+  while (val != end) {
+    KAHAN(sr, cr, val[0]*val2[0] - val[1]*val2[1]);
+    KAHAN(si, ci, val[0]*val2[1] + val[1]*val2[0]);
+    val  += 2*val_s;
+    val2 += 2*val2_s;
+  }
+
+  retmethod(gautoRelease(aComplex(sr, si)));
+endmethod
+
+// --- norm2
+
+defmethod(OBJ, gnorm2, FltVector)
+  retmethod(gautoRelease(aFloat(norm2(self->value, self->size, self->stride, 1))));
+endmethod
+
+defmethod(OBJ, gnorm2, CpxVector)
+  retmethod(gautoRelease(aFloat(norm2((F64*)self->value, self->size, 2*self->stride, 2))));
+endmethod
+
+// --- axpy
+
+defmethod(OBJ, gaxpy, FltVector, Number, FltVector)
+  ensure(self->size == self3->size, "incompatible vector sizes");
+
+  U32  size   = self->size;
+  I32  val_s  = self->stride;
+  F64 *val    = self->value;
+  I32  val2_s = self3->stride;
+  F64 *val2   = self3->value;
+  F64 *end    = val + val_s*(I32)size;
+  F64  a      = gflt(_2);
+
+  if (val_s == 1 && val2_s == 1 && vector_krn) {
+    vector_axpyF64(val, a, val2, size);
+    retmethod(_1);
+  }
+
+  while (val != end) {
+    *val += a * *val2;
+    val  += val_s;
+    val2 += val2_s;
+  }
+
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gaxpy, CpxVector, Number, CpxVector)
+  ensure(self->size == self3->size, "incompatible vector sizes");
+
+  U32  size   = self->size;
+  I32  val_s  = self->stride;
+  F64 *val    = (F64*)self->value;
+  I32  val2_s = self3->stride;
+  F64 *val2   = (F64*)self3->value;
+  F64 *end    = val + 2*val_s*(I32)size;
+  C64  a      = gcpx(_2);
+  F64  ar     = creal(a), ai = cimag(a), xr, xi;
+
+  if (val_s == 1 && val2_s == 1 && vector_krn) {
+    vector_axpycF64(val, ar, ai, val2, size);
+    retmethod(_1);
+  }
+
+  while (val != end) {
+    xr = val2[0], xi = val2[1];
+    val[0] += ar*xr - ai*xi;
+    val[1] += ar*xi + ai*xr;
+    val  += 2*val_s;
+    val2 += 2*val2_s;
+  }
+
+  retmethod(_1);
+endmethod
+
+// --- scal
+
+defmethod(OBJ, gscal, FltVector, Number)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  F64 *val   = self->value;
+  F64 *end   = val + val_s*(I32)size;
+  F64  a     = gflt(_2);
+
+  if (val_s == 1 && vector_krn) {
+    vector_scalF64(val, a, size);
+    retmethod(_1);
+  }
+
+  while (val != end) {
+    *val *= a;
+    val += val_s;
+  }
+
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gscal, CpxVector, Number)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  F64 *val   = (F64*)self->value;
+  F64 *end   = val + 2*val_s*(I32)size;
+  C64  a     = gcpx(_2);
+  F64  ar    = creal(a), ai = cimag(a), xr, xi;
+
+  if (val_s == 1 && vector_krn) {
+    vector_scalcF64(val, ar, ai, size);
+    retmethod(_1);
+  }
+
+  while (val != end) {
+    xr = val[0], xi = val[1];
+    val[0] = ar*xr - ai*xi;
+    val[1] = ar*xi + ai*xr;
+    val += 2*val_s;
+  }
+
+  retmethod(_1);
+endmethod
+
+// --- minmax, iamax
+
+defmethod(OBJ, gminmax, FltVector)
+  ensure(self->size > 0, "empty vector");
+
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  F64 *val   = self->value;
+  F64 *end   = val + val_s*(I32)size;
+  F64  r[2]  = { HUGE_VAL, -HUGE_VAL };
+
+  if (val_s == 1 && vector_krn)
+    vector_minmaxF64(val, size, r);
+  else
+    while (val != end) {
+      if (*val < r[0]) r[0] = *val;
+      if (*val > r[1]) r[1] = *val;
+      val += val_s;
+    }
+
+  if (r[0] > r[1]) // only NaN
+    r[0] = r[1] = NAN;
+
+  struct FltVector *vec = FltVector_alloc(2);
+  vec->value[0] = r[0];
+  vec->value[1] = r[1];
+  vec->size = 2;
+
+  retmethod(gautoRelease((OBJ)vec));
+endmethod
+
+defmethod(OBJ, giamax, FltVector)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  F64 *val   = self->value;
+  F64  a     = -1;
+  U32  i, k  = size;
+
+  if (val_s == 1 && vector_krn) {
+    a = vector_amaxF64(val, size);
+    for (i = 0; i < size; i++)
+      if (fabs(val[i]) >= a) { k = i; break; }
+  } else
+    for (i = 0; i < size; i++, val += val_s)
+      if (fabs(*val) > a) a = fabs(*val), k = i;
+
+  retmethod(k < size ? gautoRelease(aInt(k)) : Nil);
+endmethod
+
+defmethod(OBJ, giamax, CpxVector)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  C64 *val   = self->value;
+  F64  a     = -1, b;
+  U32  i, k  = size;
+
+  for (i = 0; i < size; i++, val += val_s) {
+    b = fabs(creal(*val)) + fabs(cimag(*val));
+    if (b > a) a = b, k = i;
+  }
+
+  retmethod(k < size ? gautoRelease(aInt(k)) : Nil);
+endmethod
+
 // ----- absolute, conjugate and argument
 
 #undef  DEFMETHOD
@@ -105,12 +423,18 @@ DEFMETHOD(gargument , carg)
 // ----- math methods
 
 #undef  DEFMETHOD
-#define DEFMETHOD(gen,fun) \
+#define DEFMETHOD(gen,fun,K) \
 \
 defmethod(OBJ, gen, FltVector) \
   F64 *val   = self->value; \
   I32  val_s = self->stride; \
   F64 *end   = self->value + self->size*self->stride; \
+\
+  COS_PP_IF(COS_PP_ISNZERO(K))( \
+  if (val_s == 1 && vector_krn) { \
+    COS_PP_CAT3(vector_,K,F64)(val, self->size); \
+    retmethod(_1); \
+  }, /* no kernel */) \
 \
   while (val != end) { \
     *val = fun(*val); \
@@ -133,25 +457,25 @@ defmethod(OBJ, gen, CpxVector) \
   retmethod(_1); \
 endmethod
 
-DEFMETHOD(gexponential, exp )
-DEFMETHOD(glogarithm  , log )
-DEFMETHOD(gsqroot     , sqrt)
+DEFMETHOD(gexponential, exp , 0)
+DEFMETHOD(glogarithm  , log , 0)
+DEFMETHOD(gsqroot     , sqrt, sqrt)
 
-DEFMETHOD(gcosine     , cos )
-DEFMETHOD(gsine       , sin )
-DEFMETHOD(gtangent    , tan )
+DEFMETHOD(gcosine     , cos , 0)
+DEFMETHOD(gsine       , sin , 0)
+DEFMETHOD(gtangent    , tan , 0)
 
-DEFMETHOD(gacosine    , acos )
-DEFMETHOD(gasine      , asin )
-DEFMETHOD(gatangent   , atan )
+DEFMETHOD(gacosine    , acos , 0)
+DEFMETHOD(gasine      , asin , 0)
+DEFMETHOD(gatangent   , atan , 0)
 
-DEFMETHOD(gcosineh    , cosh )
-DEFMETHOD(gsineh      , sinh )
-DEFMETHOD(gtangenth   , tanh )
+DEFMETHOD(gcosineh    , cosh , 0)
+DEFMETHOD(gsineh      , sinh , 0)
+DEFMETHOD(gtangenth   , tanh , 0)
 
-DEFMETHOD(gacosineh   , acosh )
-DEFMETHOD(gasineh     , asinh )
-DEFMETHOD(gatangenth  , atanh )
+DEFMETHOD(gacosineh   , acosh , 0)
+DEFMETHOD(gasineh     , asinh , 0)
+DEFMETHOD(gatangenth  , atanh , 0)
 
 // ----- power
 
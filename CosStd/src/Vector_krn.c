@@ -0,0 +1,422 @@
+/**
+ * C Object System
+ * COS Vector kernels
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Object.h>
+#include <cos/Vector.h>
+
+#include "Vector_krn.h"
+
+#include <math.h>
+
+/* NOTE-INFO: unit-stride kernels
+ * Kernels are plain loops over contiguous values that the compiler
+ * vectorizes for the default target (e.g. SSE2 on x86-64) and, on x86,
+ * once more for AVX2. The AVX2 clones are installed on first use if the
+ * CPU supports them, once for all threads (pthread_once). Binary kernels don't assume distinct arguments,
+ * the compiler checks overlaps at runtime. sqrt uses intrinsics because
+ * libm sqrt isn't vectorized (errno).
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KRN_X86 1
+#define KRN_AVX2(...) __attribute__((__target__("avx2"))) __VA_ARGS__
+#include <immintrin.h>
+#else
+#define KRN_X86 0
+#define KRN_AVX2(...)
+#endif
+
+BOOL vector_krn = YES;
+
+static int krn_max = -1; // best level supported by the CPU (-1 = unknown)
+static int krn_lvl;      // level in use
+
+static void krn_init(void);
+
+// ----- element-wise operations
+
+#define ABS(v)  ((v) < 0 ? -(v) : (v))
+#define NEG(v)  (-(v))
+#define SQR(v)  ((v)*(v))
+#define INV(v)  (1/(v))
+
+#define KRN_LIST(K1,K2) \
+  K1(abs,I32,ABS) K1(abs,I64,ABS) K1(abs,F64,ABS) \
+  K1(neg,I32,NEG) K1(neg,I64,NEG) K1(neg,F64,NEG) \
+  K1(sqr,I32,SQR) K1(sqr,I64,SQR) K1(sqr,F64,SQR) \
+  K1(inv,F64,INV) \
+  K2(add,I32,+= ) K2(add,I64,+= ) K2(add,F64,+= ) \
+  K2(sub,I32,-= ) K2(sub,I64,-= ) K2(sub,F64,-= ) \
+  K2(mul,I32,*= ) K2(mul,I64,*= ) K2(mul,F64,*= ) \
+  K2(div,F64,/= )
+
+// ----- unary kernels
+
+#undef  DEFKRN1
+#define DEFKRN1(OP,E,F) \
+\
+static void \
+OP##E(E *val, U32 n) \
+{ \
+  U32 i; \
+\
+  for (i = 0; i < n; i++) \
+    val[i] = F(val[i]); \
+} \
+\
+KRN_AVX2(static void \
+OP##E##_avx2(E *val, U32 n) \
+{ \
+  U32 i; \
+\
+  for (i = 0; i < n; i++) \
+    val[i] = F(val[i]); \
+}) \
+\
+static void \
+OP##E##_ini(E *val, U32 n) \
+{ \
+  krn_init(); \
+  vector_##OP##E(val, n); \
+} \
+\
+void (*vector_##OP##E)(E*,U32) = OP##E##_ini;
+
+// ----- binary kernels
+
+#undef  DEFKRN2
+#define DEFKRN2(OP,E,F) \
+\
+static void \
+OP##E(E *dst, const E *src, U32 n) \
+{ \
+  U32 i; \
+\
+  for (i = 0; i < n; i++) \
+    dst[i] F src[i]; \
+} \
+\
+KRN_AVX2(static void \
+OP##E##_avx2(E *dst, const E *src, U32 n) \
+{ \
+  U32 i; \
+\
+  for (i = 0; i < n; i++) \
+    dst[i] F src[i]; \
+}) \
+\
+static void \
+OP##E##_ini(E *dst, const E *src, U32 n) \
+{ \
+  krn_init(); \
+  vector_##OP##E(dst, src, n); \
+} \
+\
+void (*vector_##OP##E)(E*,const E*,U32) = OP##E##_ini;
+
+KRN_LIST(DEFKRN1,DEFKRN2)
+
+// ----- square root
+
+static void
+sqrtF64(F64 *val, U32 n)
+{
+  U32 i = 0;
+
+#if KRN_X86 && defined(__SSE2__)
+  for (; i+2 <= n; i += 2)
+    _mm_storeu_pd(val+i, _mm_sqrt_pd(_mm_loadu_pd(val+i)));
+#endif
+
+  for (; i < n; i++)
+    val[i] = sqrt(val[i]);
+}
+
+#if KRN_X86
+KRN_AVX2(static void
+sqrtF64_avx2(F64 *val, U32 n)
+{
+  U32 i = 0;
+
+  for (; i+4 <= n; i += 4)
+    _mm256_storeu_pd(val+i, _mm256_sqrt_pd(_mm256_loadu_pd(val+i)));
+
+  for (; i < n; i++)
+    val[i] = sqrt(val[i]);
+})
+#endif
+
+static void
+sqrtF64_ini(F64 *val, U32 n)
+{
+  krn_init();
+  vector_sqrtF64(val, n);
+}
+
+void (*vector_sqrtF64)(F64*,U32) = sqrtF64_ini;
+
+// ----- reductions and BLAS-1
+
+/* NOTE-INFO: compensated reductions
+ * Sums use KRN_LANES independent Kahan accumulators, interleaved with the
+ * elements, so they vectorize without reassociation and keep the accuracy
+ * of the serial Kahan sum. Lanes of the same parity are merged separately,
+ * which gives the real and imaginary parts of complex values stored as
+ * pairs of F64. min, max and amax skip NaN.
+ */
+
+#define KRN_LANES 8
+
+#define KRN_SUM(V) /* V(i) is the value of the element i */ \
+  F64 s[KRN_LANES] = { 0 }, c[KRN_LANES] = { 0 }; \
+  U32 i, k; \
+\
+  for (i = 0; i+KRN_LANES <= n; i += KRN_LANES) \
+    for (k = 0; k < KRN_LANES; k++) \
+      KAHAN(s[k], c[k], V(i+k)); \
+\
+  for (; i < n; i++) \
+    KAHAN(s[i%KRN_LANES], c[i%KRN_LANES], V(i)); \
+\
+  for (i = 0; i < 2; i++) { \
+    F64 r = 0, rc = 0; \
+    for (k = i; k < KRN_LANES; k += 2) { \
+      KAHAN(r, rc, s[k]); \
+      KAHAN(r, rc, -c[k]); \
+    } \
+    res[i] = r; \
+  }
+
+#define SUM(i)  (x[i])
+#define DOT(i)  (x[i]*y[i])
+#define DOTX(i) (x[i]*y[(i)^1])
+
+static cos_inline void
+sum_krn(const F64 *x, U32 n, F64 res[2])
+{
+  KRN_SUM(SUM)
+}
+
+static cos_inline void
+dot_krn(const F64 *x, const F64 *y, U32 n, F64 res[2])
+{
+  KRN_SUM(DOT)
+}
+
+static cos_inline void
+dotx_krn(const F64 *x, const F64 *y, U32 n, F64 res[2])
+{
+  KRN_SUM(DOTX)
+}
+
+static cos_inline void
+axpy_krn(F64 *y, F64 a, const F64 *x, U32 n)
+{
+  U32 i;
+
+  for (i = 0; i < n; i++)
+    y[i] += a*x[i];
+}
+
+static cos_inline void
+axpyc_krn(F64 *y, F64 ar, F64 ai, const F64 *x, U32 n)
+{
+  U32 i;
+
+  for (i = 0; i < 2*n; i += 2) {
+    F64 xr = x[i], xi = x[i+1];
+    y[i  ] += ar*xr - ai*xi;
+    y[i+1] += ar*xi + ai*xr;
+  }
+}
+
+static cos_inline void
+scal_krn(F64 *x, F64 a, U32 n)
+{
+  U32 i;
+
+  for (i = 0; i < n; i++)
+    x[i] *= a;
+}
+
+static cos_inline void
+scalc_krn(F64 *x, F64 ar, F64 ai, U32 n)
+{
+  U32 i;
+
+  for (i = 0; i < 2*n; i += 2) {
+    F64 xr = x[i], xi = x[i+1];
+    x[i  ] = ar*xr - ai*xi;
+    x[i+1] = ar*xi + ai*xr;
+  }
+}
+
+static cos_inline void
+minmax_krn(const F64 *x, U32 n, F64 res[2])
+{
+  F64 mn[KRN_LANES], mx[KRN_LANES];
+  U32 i, k;
+
+  for (k = 0; k < KRN_LANES; k++)
+    mn[k] = HUGE_VAL, mx[k] = -HUGE_VAL;
+
+  for (i = 0; i+KRN_LANES <= n; i += KRN_LANES)
+    for (k = 0; k < KRN_LANES; k++) {
+      mn[k] = x[i+k] < mn[k] ? x[i+k] : mn[k];
+      mx[k] = x[i+k] > mx[k] ? x[i+k] : mx[k];
+    }
+
+  for (; i < n; i++) {
+    mn[0] = x[i] < mn[0] ? x[i] : mn[0];
+    mx[0] = x[i] > mx[0] ? x[i] : mx[0];
+  }
+
+  for (k = 1; k < KRN_LANES; k++) {
+    mn[0] = mn[k] < mn[0] ? mn[k] : mn[0];
+    mx[0] = mx[k] > mx[0] ? mx[k] : mx[0];
+  }
+
+  res[0] = mn[0], res[1] = mx[0];
+}
+
+static cos_inline F64
+amax_krn(const F64 *x, U32 n)
+{
+  F64 mx[KRN_LANES] = { 0 };
+  U32 i, k;
+
+  for (i = 0; i+KRN_LANES <= n; i += KRN_LANES)
+    for (k = 0; k < KRN_LANES; k++)
+      mx[k] = fabs(x[i+k]) > mx[k] ? fabs(x[i+k]) : mx[k];
+
+  for (; i < n; i++)
+    mx[0] = fabs(x[i]) > mx[0] ? fabs(x[i]) : mx[0];
+
+  for (k = 1; k < KRN_LANES; k++)
+    mx[0] = mx[k] > mx[0] ? mx[k] : mx[0];
+
+  return mx[0];
+}
+
+#undef SUM
+#undef DOT
+#undef DOTX
+
+#define KRNR_LIST(K) \
+  K(F64 , amax  ,(const F64 *x, U32 n)                          ,(x,n))
+
+#define KRNV_LIST(K) \
+  K(void, sum   ,(const F64 *x, U32 n, F64 *r)                  ,(x,n,r)) \
+  K(void, dot   ,(const F64 *x, const F64 *y, U32 n, F64 *r)    ,(x,y,n,r)) \
+  K(void, dotx  ,(const F64 *x, const F64 *y, U32 n, F64 *r)    ,(x,y,n,r)) \
+  K(void, axpy  ,(F64 *y, F64 a, const F64 *x, U32 n)           ,(y,a,x,n)) \
+  K(void, axpyc ,(F64 *y, F64 ar, F64 ai, const F64 *x, U32 n)  ,(y,ar,ai,x,n)) \
+  K(void, scal  ,(F64 *x, F64 a, U32 n)                         ,(x,a,n)) \
+  K(void, scalc ,(F64 *x, F64 ar, F64 ai, U32 n)                ,(x,ar,ai,n)) \
+  K(void, minmax,(const F64 *x, U32 n, F64 *r)                  ,(x,n,r))
+
+#undef  DEFKRNR
+#define DEFKRNR(R,OP,P,A) \
+\
+static R OP##F64 P { return OP##_krn A; } \
+KRN_AVX2(static R OP##F64_avx2 P { return OP##_krn A; }) \
+static R OP##F64_ini P { krn_init(); return vector_##OP##F64 A; } \
+R (*vector_##OP##F64) P = OP##F64_ini;
+
+#undef  DEFKRNV
+#define DEFKRNV(R,OP,P,A) \
+\
+static R OP##F64 P { OP##_krn A; } \
+KRN_AVX2(static R OP##F64_avx2 P { OP##_krn A; }) \
+static R OP##F64_ini P { krn_init(); vector_##OP##F64 A; } \
+R (*vector_##OP##F64) P = OP##F64_ini;
+
+KRNR_LIST(DEFKRNR)
+KRNV_LIST(DEFKRNV)
+
+// ----- kernels selection
+
+#undef  SETKRN
+#if KRN_X86
+#define SETKRN(OP,E,F) vector_##OP##E = lvl > 1 ? OP##E##_avx2 : OP##E;
+#else
+#define SETKRN(OP,E,F) vector_##OP##E = OP##E;
+#endif
+
+static void
+krn_set(int lvl)
+{
+  KRN_LIST(SETKRN,SETKRN)
+  SETKRN(sqrt,F64,_)
+
+#undef  SETKRNF
+#define SETKRNF(R,OP,P,A) SETKRN(OP,F64,_)
+
+  KRNR_LIST(SETKRNF)
+  KRNV_LIST(SETKRNF)
+
+  vector_krn = lvl > 0;
+  krn_lvl    = lvl;
+}
+
+static void
+krn_detect(void)
+{
+#if KRN_X86
+  __builtin_cpu_init();
+  krn_max = __builtin_cpu_supports("avx2") ? 2 : 1;
+#else
+  krn_max = 1;
+#endif
+
+  krn_set(krn_max);
+}
+
+#if COS_HAS_POSIX
+
+#include <pthread.h>
+
+static pthread_once_t krn_once = PTHREAD_ONCE_INIT;
+
+static void
+krn_init(void)
+{
+  pthread_once(&krn_once, krn_detect);
+}
+
+#else
+
+static void
+krn_init(void)
+{
+  if (krn_max < 0) krn_detect();
+}
+
+#endif
+
+int
+Vector_simdLevel(int lvl)
+{
+  krn_init();
+
+  if (lvl >= 0)
+    krn_set(lvl < krn_max ? lvl : krn_max);
+
+  return krn_lvl;
+}
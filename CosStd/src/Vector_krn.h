@@ -0,0 +1,62 @@
+#ifndef COS_VECTOR_KRN_H
+#define COS_VECTOR_KRN_H
+
+/**
+ * C Object System
+ * COS Vector kernels
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* NOTE-INFO: unit-stride kernels
+   Kernels apply element-wise operations to contiguous values. They are
+   selected at load time from the CPU features (see Vector_krn.c) and must
+   be used only when Vector_simdLevel is not zero (i.e. vector_krn is true).
+*/
+
+extern BOOL vector_krn;
+
+#define KRN1(OP,E) extern void (*vector_##OP##E)(E*,U32);
+#define KRN2(OP,E) extern void (*vector_##OP##E)(E*,const E*,U32);
+
+KRN1(abs,I32) KRN1(abs,I64) KRN1(abs,F64)
+KRN1(neg,I32) KRN1(neg,I64) KRN1(neg,F64)
+KRN1(sqr,I32) KRN1(sqr,I64) KRN1(sqr,F64)
+KRN1(inv,F64) KRN1(sqrt,F64)
+
+KRN2(add,I32) KRN2(add,I64) KRN2(add,F64)
+KRN2(sub,I32) KRN2(sub,I64) KRN2(sub,F64)
+KRN2(mul,I32) KRN2(mul,I64) KRN2(mul,F64)
+KRN2(div,F64)
+
+// reductions (res[0] and res[1] are for the even and odd elements) and BLAS-1
+extern void (*vector_sumF64   )(const F64*,U32,F64 res[2]);
+extern void (*vector_dotF64   )(const F64*,const F64*,U32,F64 res[2]);
+extern void (*vector_dotxF64  )(const F64*,const F64*,U32,F64 res[2]); // x[i]*y[i^1]
+extern void (*vector_axpyF64  )(F64*,F64,const F64*,U32);
+extern void (*vector_axpycF64 )(F64*,F64,F64,const F64*,U32); // complex pairs
+extern void (*vector_scalF64  )(F64*,F64,U32);
+extern void (*vector_scalcF64 )(F64*,F64,F64,U32);            // complex pairs
+extern void (*vector_minmaxF64)(const F64*,U32,F64 res[2]);
+extern F64  (*vector_amaxF64  )(const F64*,U32);
+
+#undef KRN1
+#undef KRN2
+
+// compensated summation (Kahan): s += v, c accumulates the lost low part
+#define KAHAN(s,c,v) \
+  do { F64 y_ = (v) - (c), t_ = (s) + y_; (c) = (t_ - (s)) - y_; (s) = t_; } while (0)
+
+#endif // COS_VECTOR_KRN_H
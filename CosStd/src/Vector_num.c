@@ -27,15 +27,23 @@
 #include <cos/gen/numop.h>
 #include <cos/gen/object.h>
 
+#include "Vector_krn.h"
+
 // ----- absolute
 
 #undef  DEFMETHOD
-#define DEFMETHOD(T, V) \
+#define DEFMETHOD(T, V, K) \
 \
 defmethod(OBJ, gabsolute, T) \
   V  *val   = self->value; \
   I32 val_s = self->stride; \
   V  *end   = self->value + self->size*self->stride; \
+\
+  COS_PP_IF(COS_PP_ISNZERO(K))( \
+  if (val_s == 1 && vector_krn) { \
+    COS_PP_CAT3(vector_,K,V)(val, self->size); \
+    retmethod(_1); \
+  }, /* no kernel */) \
 \
   while (val != end) { \
     if (*val < 0) *val = -*val; \
@@ -45,21 +53,27 @@ defmethod(OBJ, gabsolute, T) \
   retmethod(_1); \
 endmethod
 
-DEFMETHOD(ShtVector, I16)
-DEFMETHOD(IntVector, I32)
-DEFMETHOD(LngVector, I64)
-DEFMETHOD(FltVector, F64)
+DEFMETHOD(ShtVector, I16, 0)
+DEFMETHOD(IntVector, I32, abs)
+DEFMETHOD(LngVector, I64, abs)
+DEFMETHOD(FltVector, F64, abs)
 
 
 // ----- negate
 
 #undef  DEFMETHOD
-#define DEFMETHOD(T, V) \
+#define DEFMETHOD(T, V, K) \
 \
 defmethod(OBJ, gnegate, T) \
   V  *val   = self->value; \
   I32 val_s = self->stride; \
   V  *end   = self->value + self->size*self->stride; \
+\
+  COS_PP_IF(COS_PP_ISNZERO(K))( \
+  if (val_s == 1 && vector_krn) { \
+    COS_PP_CAT3(vector_,K,V)(val, self->size); \
+    retmethod(_1); \
+  }, /* no kernel */) \
 \
   while (val != end) { \
     *val = -*val; \
@@ -69,21 +83,27 @@ defmethod(OBJ, gnegate, T) \
   retmethod(_1); \
 endmethod
 
-DEFMETHOD(ShtVector, I16)
-DEFMETHOD(IntVector, I32)
-DEFMETHOD(LngVector, I64)
-DEFMETHOD(FltVector, F64)
-DEFMETHOD(CpxVector, C64)
+DEFMETHOD(ShtVector, I16, 0)
+DEFMETHOD(IntVector, I32, neg)
+DEFMETHOD(LngVector, I64, neg)
+DEFMETHOD(FltVector, F64, neg)
+DEFMETHOD(CpxVector, C64, 0)
 
 // ----- square
 
 #undef  DEFMETHOD
-#define DEFMETHOD(T, V) \
+#define DEFMETHOD(T, V, K) \
 \
 defmethod(OBJ, gsquare, T) \
   V  *val   = self->value; \
   I32 val_s = self->stride; \
   V  *end   = self->value + self->size*self->stride; \
+\
+  COS_PP_IF(COS_PP_ISNZERO(K))( \
+  if (val_s == 1 && vector_krn) { \
+    COS_PP_CAT3(vector_,K,V)(val, self->size); \
+    retmethod(_1); \
+  }, /* no kernel */) \
 \
   while (val != end) { \
     *val *= *val; \
@@ -93,21 +113,27 @@ defmethod(OBJ, gsquare, T) \
   retmethod(_1); \
 endmethod
 
-DEFMETHOD(ShtVector, I16)
-DEFMETHOD(IntVector, I32)
-DEFMETHOD(LngVector, I64)
-DEFMETHOD(FltVector, F64)
-DEFMETHOD(CpxVector, C64)
+DEFMETHOD(ShtVector, I16, 0)
+DEFMETHOD(IntVector, I32, sqr)
+DEFMETHOD(LngVector, I64, sqr)
+DEFMETHOD(FltVector, F64, sqr)
+DEFMETHOD(CpxVector, C64, 0)
 
 // ----- invert
 
 #undef  DEFMETHOD
-#define DEFMETHOD(T, V) \
+#define DEFMETHOD(T, V, K) \
 \
 defmethod(OBJ, ginvert, T) \
   V  *val   = self->value; \
   I32 val_s = self->stride; \
   V  *end   = self->value + self->size*self->stride; \
+\
+  COS_PP_IF(COS_PP_ISNZERO(K))( \
+  if (val_s == 1 && vector_krn) { \
+    COS_PP_CAT3(vector_,K,V)(val, self->size); \
+    retmethod(_1); \
+  }, /* no kernel */) \
 \
   while (val != end) { \
     *val = 1 / *val; \
@@ -117,13 +143,13 @@ defmethod(OBJ, ginvert, T) \
   retmethod(_1); \
 endmethod
 
-DEFMETHOD(FltVector, F64)
-DEFMETHOD(CpxVector, C64)
+DEFMETHOD(FltVector, F64, inv)
+DEFMETHOD(CpxVector, C64, 0)
 
 // ----- addTo, subTo, mulTo, divTo, modulo
 
 #undef  DEFMETHOD
-#define DEFMETHOD(MTH,T1,V1,OP,T2,V2) \
+#define DEFMETHOD(MTH,T1,V1,OP,T2,V2,K) \
 defmethod(OBJ, MTH, T1, T2) \
   PRE \
     ensure(self->size == self2->size, "incompatible vector sizes"); \
@@ -133,6 +159,12 @@ defmethod(OBJ, MTH, T1, T2) \
     V2 *src   = self2->value; \
     I32 src_s = self2->stride; \
     V1 *end   = self->value + self->size*self->stride; \
+\
+    COS_PP_IF(COS_PP_ISNZERO(K))( \
+    if (dst_s == 1 && src_s == 1 && vector_krn) { \
+      COS_PP_CAT3(vector_,K,V1)(dst, src, self->size); \
+      retmethod(_1); \
+    }, /* no kernel */) \
 \
     while (dst != end) { \
       *dst OP *src; \
@@ -143,76 +175,76 @@ defmethod(OBJ, MTH, T1, T2) \
     retmethod(_1); \
 endmethod
 
-DEFMETHOD(gaddTo, ShtVector, I16, +=, ShtVector, I16)
-DEFMETHOD(gaddTo, IntVector, I32, +=, ShtVector, I16)
-DEFMETHOD(gaddTo, IntVector, I32, +=, IntVector, I32)
-DEFMETHOD(gaddTo, LngVector, I64, +=, ShtVector, I16)
-DEFMETHOD(gaddTo, LngVector, I64, +=, IntVector, I32)
-DEFMETHOD(gaddTo, LngVector, I64, +=, LngVector, I64)
-DEFMETHOD(gaddTo, FltVector, F64, +=, ShtVector, I16)
-DEFMETHOD(gaddTo, FltVector, F64, +=, IntVector, I32)
-DEFMETHOD(gaddTo, FltVector, F64, +=, LngVector, I64)
-DEFMETHOD(gaddTo, FltVector, F64, +=, FltVector, F64)
-DEFMETHOD(gaddTo, CpxVector, C64, +=, ShtVector, I16)
-DEFMETHOD(gaddTo, CpxVector, C64, +=, IntVector, I32)
-DEFMETHOD(gaddTo, CpxVector, C64, +=, LngVector, I64)
-DEFMETHOD(gaddTo, CpxVector, C64, +=, FltVector, F64)
-DEFMETHOD(gaddTo, CpxVector, C64, +=, CpxVector, C64)
-
-DEFMETHOD(gsubTo, ShtVector, I16, -=, ShtVector, I16)
-DEFMETHOD(gsubTo, IntVector, I32, -=, ShtVector, I16)
-DEFMETHOD(gsubTo, IntVector, I32, -=, IntVector, I32)
-DEFMETHOD(gsubTo, LngVector, I64, -=, ShtVector, I16)
-DEFMETHOD(gsubTo, LngVector, I64, -=, IntVector, I32)
-DEFMETHOD(gsubTo, LngVector, I64, -=, LngVector, I64)
-DEFMETHOD(gsubTo, FltVector, F64, -=, ShtVector, I16)
-DEFMETHOD(gsubTo, FltVector, F64, -=, IntVector, I32)
-DEFMETHOD(gsubTo, FltVector, F64, -=, LngVector, I64)
-DEFMETHOD(gsubTo, FltVector, F64, -=, FltVector, F64)
-DEFMETHOD(gsubTo, CpxVector, C64, -=, ShtVector, I16)
-DEFMETHOD(gsubTo, CpxVector, C64, -=, IntVector, I32)
-DEFMETHOD(gsubTo, CpxVector, C64, -=, LngVector, I64)
-DEFMETHOD(gsubTo, CpxVector, C64, -=, FltVector, F64)
-DEFMETHOD(gsubTo, CpxVector, C64, -=, CpxVector, C64)
-
-DEFMETHOD(gmulBy, ShtVector, I16, *=, ShtVector, I16)
-DEFMETHOD(gmulBy, IntVector, I32, *=, ShtVector, I16)
-DEFMETHOD(gmulBy, IntVector, I32, *=, IntVector, I32)
-DEFMETHOD(gmulBy, LngVector, I64, *=, ShtVector, I16)
-DEFMETHOD(gmulBy, LngVector, I64, *=, IntVector, I32)
-DEFMETHOD(gmulBy, LngVector, I64, *=, LngVector, I64)
-DEFMETHOD(gmulBy, FltVector, F64, *=, ShtVector, I16)
-DEFMETHOD(gmulBy, FltVector, F64, *=, IntVector, I32)
-DEFMETHOD(gmulBy, FltVector, F64, *=, LngVector, I64)
-DEFMETHOD(gmulBy, FltVector, F64, *=, FltVector, F64)
-DEFMETHOD(gmulBy, CpxVector, C64, *=, ShtVector, I16)
-DEFMETHOD(gmulBy, CpxVector, C64, *=, IntVector, I32)
-DEFMETHOD(gmulBy, CpxVector, C64, *=, LngVector, I64)
-DEFMETHOD(gmulBy, CpxVector, C64, *=, FltVector, F64)
-DEFMETHOD(gmulBy, CpxVector, C64, *=, CpxVector, C64)
-
-DEFMETHOD(gdivBy, ShtVector, I16, /=, ShtVector, I16)
-DEFMETHOD(gdivBy, IntVector, I32, /=, ShtVector, I16)
-DEFMETHOD(gdivBy, IntVector, I32, /=, IntVector, I32)
-DEFMETHOD(gdivBy, LngVector, I64, /=, ShtVector, I16)
-DEFMETHOD(gdivBy, LngVector, I64, /=, IntVector, I32)
-DEFMETHOD(gdivBy, LngVector, I64, /=, LngVector, I64)
-DEFMETHOD(gdivBy, FltVector, F64, /=, ShtVector, I16)
-DEFMETHOD(gdivBy, FltVector, F64, /=, IntVector, I32)
-DEFMETHOD(gdivBy, FltVector, F64, /=, LngVector, I64)
-DEFMETHOD(gdivBy, FltVector, F64, /=, FltVector, F64)
-DEFMETHOD(gdivBy, CpxVector, C64, /=, ShtVector, I16)
-DEFMETHOD(gdivBy, CpxVector, C64, /=, IntVector, I32)
-DEFMETHOD(gdivBy, CpxVector, C64, /=, LngVector, I64)
-DEFMETHOD(gdivBy, CpxVector, C64, /=, FltVector, F64)
-DEFMETHOD(gdivBy, CpxVector, C64, /=, CpxVector, C64)
-
-DEFMETHOD(gmodulo, ShtVector, I16, %=, ShtVector, I16)
-DEFMETHOD(gmodulo, IntVector, I32, %=, ShtVector, I16)
-DEFMETHOD(gmodulo, IntVector, I32, %=, IntVector, I32)
-DEFMETHOD(gmodulo, LngVector, I64, %=, ShtVector, I16)
-DEFMETHOD(gmodulo, LngVector, I64, %=, IntVector, I32)
-DEFMETHOD(gmodulo, LngVector, I64, %=, LngVector, I64)
+DEFMETHOD(gaddTo, ShtVector, I16, +=, ShtVector, I16, 0)
+DEFMETHOD(gaddTo, IntVector, I32, +=, ShtVector, I16, 0)
+DEFMETHOD(gaddTo, IntVector, I32, +=, IntVector, I32, add)
+DEFMETHOD(gaddTo, LngVector, I64, +=, ShtVector, I16, 0)
+DEFMETHOD(gaddTo, LngVector, I64, +=, IntVector, I32, 0)
+DEFMETHOD(gaddTo, LngVector, I64, +=, LngVector, I64, add)
+DEFMETHOD(gaddTo, FltVector, F64, +=, ShtVector, I16, 0)
+DEFMETHOD(gaddTo, FltVector, F64, +=, IntVector, I32, 0)
+DEFMETHOD(gaddTo, FltVector, F64, +=, LngVector, I64, 0)
+DEFMETHOD(gaddTo, FltVector, F64, +=, FltVector, F64, add)
+DEFMETHOD(gaddTo, CpxVector, C64, +=, ShtVector, I16, 0)
+DEFMETHOD(gaddTo, CpxVector, C64, +=, IntVector, I32, 0)
+DEFMETHOD(gaddTo, CpxVector, C64, +=, LngVector, I64, 0)
+DEFMETHOD(gaddTo, CpxVector, C64, +=, FltVector, F64, 0)
+DEFMETHOD(gaddTo, CpxVector, C64, +=, CpxVector, C64, 0)
+
+DEFMETHOD(gsubTo, ShtVector, I16, -=, ShtVector, I16, 0)
+DEFMETHOD(gsubTo, IntVector, I32, -=, ShtVector, I16, 0)
+DEFMETHOD(gsubTo, IntVector, I32, -=, IntVector, I32, sub)
+DEFMETHOD(gsubTo, LngVector, I64, -=, ShtVector, I16, 0)
+DEFMETHOD(gsubTo, LngVector, I64, -=, IntVector, I32, 0)
+DEFMETHOD(gsubTo, LngVector, I64, -=, LngVector, I64, sub)
+DEFMETHOD(gsubTo, FltVector, F64, -=, ShtVector, I16, 0)
+DEFMETHOD(gsubTo, FltVector, F64, -=, IntVector, I32, 0)
+DEFMETHOD(gsubTo, FltVector, F64, -=, LngVector, I64, 0)
+DEFMETHOD(gsubTo, FltVector, F64, -=, FltVector, F64, sub)
+DEFMETHOD(gsubTo, CpxVector, C64, -=, ShtVector, I16, 0)
+DEFMETHOD(gsubTo, CpxVector, C64, -=, IntVector, I32, 0)
+DEFMETHOD(gsubTo, CpxVector, C64, -=, LngVector, I64, 0)
+DEFMETHOD(gsubTo, CpxVector, C64, -=, FltVector, F64, 0)
+DEFMETHOD(gsubTo, CpxVector, C64, -=, CpxVector, C64, 0)
+
+DEFMETHOD(gmulBy, ShtVector, I16, *=, ShtVector, I16, 0)
+DEFMETHOD(gmulBy, IntVector, I32, *=, ShtVector, I16, 0)
+DEFMETHOD(gmulBy, IntVector, I32, *=, IntVector, I32, mul)
+DEFMETHOD(gmulBy, LngVector, I64, *=, ShtVector, I16, 0)
+DEFMETHOD(gmulBy, LngVector, I64, *=, IntVector, I32, 0)
+DEFMETHOD(gmulBy, LngVector, I64, *=, LngVector, I64, mul)
+DEFMETHOD(gmulBy, FltVector, F64, *=, ShtVector, I16, 0)
+DEFMETHOD(gmulBy, FltVector, F64, *=, IntVector, I32, 0)
+DEFMETHOD(gmulBy, FltVector, F64, *=, LngVector, I64, 0)
+DEFMETHOD(gmulBy, FltVector, F64, *=, FltVector, F64, mul)
+DEFMETHOD(gmulBy, CpxVector, C64, *=, ShtVector, I16, 0)
+DEFMETHOD(gmulBy, CpxVector, C64, *=, IntVector, I32, 0)
+DEFMETHOD(gmulBy, CpxVector, C64, *=, LngVector, I64, 0)
+DEFMETHOD(gmulBy, CpxVector, C64, *=, FltVector, F64, 0)
+DEFMETHOD(gmulBy, CpxVector, C64, *=, CpxVector, C64, 0)
+
+DEFMETHOD(gdivBy, ShtVector, I16, /=, ShtVector, I16, 0)
+DEFMETHOD(gdivBy, IntVector, I32, /=, ShtVector, I16, 0)
+DEFMETHOD(gdivBy, IntVector, I32, /=, IntVector, I32, 0)
+DEFMETHOD(gdivBy, LngVector, I64, /=, ShtVector, I16, 0)
+DEFMETHOD(gdivBy, LngVector, I64, /=, IntVector, I32, 0)
+DEFMETHOD(gdivBy, LngVector, I64, /=, LngVector, I64, 0)
+DEFMETHOD(gdivBy, FltVector, F64, /=, ShtVector, I16, 0)
+DEFMETHOD(gdivBy, FltVector, F64, /=, IntVector, I32, 0)
+DEFMETHOD(gdivBy, FltVector, F64, /=, LngVector, I64, 0)
+DEFMETHOD(gdivBy, FltVector, F64, /=, FltVector, F64, div)
+DEFMETHOD(gdivBy, CpxVector, C64, /=, ShtVector, I16, 0)
+DEFMETHOD(gdivBy, CpxVector, C64, /=, IntVector, I32, 0)
+DEFMETHOD(gdivBy, CpxVector, C64, /=, LngVector, I64, 0)
+DEFMETHOD(gdivBy, CpxVector, C64, /=, FltVector, F64, 0)
+DEFMETHOD(gdivBy, CpxVector, C64, /=, CpxVector, C64, 0)
+
+DEFMETHOD(gmodulo, ShtVector, I16, %=, ShtVector, I16, 0)
+DEFMETHOD(gmodulo, IntVector, I32, %=, ShtVector, I16, 0)
+DEFMETHOD(gmodulo, IntVector, I32, %=, IntVector, I32, 0)
+DEFMETHOD(gmodulo, LngVector, I64, %=, ShtVector, I16, 0)
+DEFMETHOD(gmodulo, LngVector, I64, %=, IntVector, I32, 0)
+DEFMETHOD(gmodulo, LngVector, I64, %=, LngVector, I64, 0)
 
 // ----- power
 
@@ -0,0 +1,558 @@
+/**
+ * C Object System
+ * COS Vector expression
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/VectorExpr.h>
+#include <cos/ShtVector.h>
+#include <cos/IntVector.h>
+#include <cos/LngVector.h>
+#include <cos/FltVector.h>
+#include <cos/CpxVector.h>
+#include <cos/Number.h>
+#include <cos/Range.h>
+#include <cos/Slice.h>
+
+#include <cos/gen/accessor.h>
+#include <cos/gen/numop.h>
+#include <cos/gen/object.h>
+#include <cos/gen/value.h>
+
+#include "Vector_krn.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <complex.h>
+
+/* NOTE-INFO: fused evaluation
+ * An expression is a tree of nodes whose leaves are vectors. Evaluation
+ * walks the tree once per block of VECTOR_EXPR_BLOCK elements: a leaf
+ * loads its block from its vector, a node combines the blocks of its
+ * operands in place. Blocks hold I64, F64 or C64 (the kind of the node)
+ * and are promoted in place when the kinds of the operands differ. A node
+ * evaluates its lhs into its own block and its rhs into the next one,
+ * so an expression needs 1+depth blocks whatever its size, which stay
+ * in the cache while the vectors are read and written once.
+ */
+
+#ifndef VECTOR_EXPR_BLOCK
+#define VECTOR_EXPR_BLOCK 256
+#endif
+
+STATIC_ASSERT(vector_expr_block_is_too_small, VECTOR_EXPR_BLOCK >= 16);
+
+makclass(VectorExpr);
+
+// -----
+
+useclass(VectorExpr, ExBadAlloc);
+
+// ----- element types, kinds and operations
+
+enum { SHT, INT, LNG, FLT, CPX };
+enum { LEAF, ABS, NEG, SQR, INV, ADD, SUB, MUL, DIV };
+
+enum { B = VECTOR_EXPR_BLOCK };
+
+#define KIND(t)  ((t) < LNG ? LNG : (t))
+#define MAX(a,b) ((a) > (b) ? (a) : (b))
+
+union blk {
+  I64 i[B];
+  F64 f[B];
+  C64 c[B];
+};
+
+// ----- vector descriptor
+
+struct vec {
+  void *val;
+  U32   size;
+  I32   stride;
+  I32   type;
+};
+
+static const size_t vec_esz[] = {
+  sizeof(I16), sizeof(I32), sizeof(I64), sizeof(F64), sizeof(C64)
+};
+
+static I32
+vec_type(OBJ vec)
+{
+  if (cos_object_isKindOf(vec, classref(ShtVector))) return SHT;
+  if (cos_object_isKindOf(vec, classref(IntVector))) return INT;
+  if (cos_object_isKindOf(vec, classref(LngVector))) return LNG;
+  if (cos_object_isKindOf(vec, classref(FltVector))) return FLT;
+  if (cos_object_isKindOf(vec, classref(CpxVector))) return CPX;
+  return -1;
+}
+
+#undef  VEC
+#define VEC(T) { \
+  struct T *v = CAST(struct T*, vec); \
+  d->val = v->value, d->size = v->size, d->stride = v->stride; \
+} break
+
+static struct vec*
+vec_init(struct vec *d, OBJ vec, I32 type)
+{
+  d->type = type;
+
+  switch (type) {
+  case SHT: VEC(ShtVector);
+  case INT: VEC(IntVector);
+  case LNG: VEC(LngVector);
+  case FLT: VEC(FltVector);
+  case CPX: VEC(CpxVector);
+  default : ensure(0, "invalid vector expression operand");
+  }
+
+  return d;
+}
+
+static BOOL
+vec_overlap(const struct vec *d1, const struct vec *d2, U32 n)
+{
+  size_t s1 = vec_esz[d1->type], s2 = vec_esz[d2->type];
+  char  *p1 = d1->val, *p2 = d2->val;
+  char  *q1 = p1 + (ptrdiff_t)(n-1)*d1->stride*(ptrdiff_t)s1;
+  char  *q2 = p2 + (ptrdiff_t)(n-1)*d2->stride*(ptrdiff_t)s2;
+
+  if (!n || (p1 == p2 && d1->stride == d2->stride && s1 == s2))
+    return NO; // same elements, element-wise is safe
+
+  if (p1 > q1) { char *p = p1; p1 = q1; q1 = p; }
+  if (p2 > q2) { char *p = p2; p2 = q2; q2 = p; }
+
+  return p1 < q2+s2 && p2 < q1+s1;
+}
+
+// ----- block load/store/promote
+
+#undef  LOAD
+#define LOAD(E,M) { \
+  const E *src = (const E*)d->val + (ptrdiff_t)i*d->stride; \
+  I32 src_s = d->stride; \
+\
+  if (src_s == 1) \
+    for (j = 0; j < n; j++) out->M[j] = src[j]; \
+  else \
+    for (j = 0; j < n; j++, src += src_s) out->M[j] = *src; \
+} break
+
+static void
+vec_load(const struct vec *d, U32 i, U32 n, union blk *out)
+{
+  U32 j;
+
+  switch (d->type) {
+  case SHT: LOAD(I16,i);
+  case INT: LOAD(I32,i);
+  case LNG: LOAD(I64,i);
+  case FLT: LOAD(F64,f);
+  case CPX: LOAD(C64,c);
+  }
+}
+
+#undef  STORE
+#define STORE(E,M) { \
+  E  *dst   = (E*)d->val + (ptrdiff_t)i*d->stride; \
+  I32 dst_s = d->stride; \
+\
+  if (dst_s == 1) \
+    for (j = 0; j < n; j++) dst[j] = in->M[j]; \
+  else \
+    for (j = 0; j < n; j++, dst += dst_s) *dst = in->M[j]; \
+} break
+
+static void
+vec_store(const struct vec *d, U32 i, U32 n, const union blk *in)
+{
+  U32 j;
+
+  switch (d->type) {
+  case SHT: STORE(I16,i);
+  case INT: STORE(I32,i);
+  case LNG: STORE(I64,i);
+  case FLT: STORE(F64,f);
+  case CPX: STORE(C64,c);
+  }
+}
+
+static void
+blk_promote(union blk *b, I32 from, I32 to, U32 n)
+{
+  U32 j;
+
+  if (from == to) return;
+
+  // same size or backward (C64 are wider)
+  if (to == FLT)
+    for (j = 0; j < n; j++) { F64 v = b->i[j]; b->f[j] = v; }
+  else if (from == LNG)
+    for (j = n; j-- > 0; )  { C64 v = b->i[j]; b->c[j] = v; }
+  else
+    for (j = n; j-- > 0; )  { C64 v = b->f[j]; b->c[j] = v; }
+}
+
+// ----- block evaluation
+
+#define ABS_(v) ((v) < 0 ? -(v) : (v))
+#define NEG_(v) (-(v))
+#define SQR_(v) ((v)*(v))
+#define INV_(v) (1/(v))
+
+#undef  UNR
+#define UNR(M,F) \
+  for (j = 0; j < n; j++) out->M[j] = F(out->M[j])
+
+#undef  BIN
+#define BIN(M,OP) \
+  for (j = 0; j < n; j++) out->M[j] OP rhs->M[j]
+
+#undef  KRN1
+#define KRN1(OP,E,M,F) \
+  if (vector_krn) vector_##OP##E(out->M, n); else UNR(M,F)
+
+#undef  KRN2
+#define KRN2(OP,E,M,F) \
+  if (vector_krn) vector_##OP##E(out->M, rhs->M, n); else BIN(M,F)
+
+static void
+xpr_eval(const struct VectorExpr *x, U32 i, U32 n,
+         union blk *out, union blk *tmp)
+{
+  const struct VectorExpr *l, *r;
+  const union blk *rhs = tmp;
+  I32 k = x->type;
+  U32 j;
+
+  if (x->op == LEAF) {
+    struct vec d[1];
+    vec_load(vec_init(d, x->lhs, x->type), i, n, out);
+    return;
+  }
+
+  l = CAST(const struct VectorExpr*, x->lhs);
+  xpr_eval(l, i, n, out, tmp);
+
+  if (x->op == ABS && KIND(l->type) == CPX) { // |z| is floating
+    for (j = 0; j < n; j++) out->f[j] = cabs(out->c[j]);
+    return;
+  }
+
+  blk_promote(out, KIND(l->type), k, n);
+
+  if (x->rhs) {
+    r = CAST(const struct VectorExpr*, x->rhs);
+
+    if (r->op == LEAF && r->type == k) { // read contiguous values in place
+      struct vec d[1];
+      vec_init(d, r->lhs, k);
+      if (d->stride == 1)
+        rhs = (const void*)((char*)d->val + (size_t)i*vec_esz[k]);
+    }
+
+    if (rhs == tmp) {
+      xpr_eval(r, i, n, tmp, tmp+1);
+      blk_promote(tmp, KIND(r->type), k, n);
+    }
+  }
+
+#undef  CASE
+#define CASE(OP,T) case OP*4+T-LNG
+
+  switch (x->op*4+k-LNG) {
+  CASE(ABS,LNG): KRN1(abs,I64,i,ABS_); break;
+  CASE(ABS,FLT): KRN1(abs,F64,f,ABS_); break;
+
+  CASE(NEG,LNG): KRN1(neg,I64,i,NEG_); break;
+  CASE(NEG,FLT): KRN1(neg,F64,f,NEG_); break;
+  CASE(NEG,CPX): UNR (c,NEG_)        ; break;
+
+  CASE(SQR,LNG): KRN1(sqr,I64,i,SQR_); break;
+  CASE(SQR,FLT): KRN1(sqr,F64,f,SQR_); break;
+  CASE(SQR,CPX): UNR (c,SQR_)        ; break;
+
+  CASE(INV,FLT): KRN1(inv,F64,f,INV_); break;
+  CASE(INV,CPX): UNR (c,INV_)        ; break;
+
+  CASE(ADD,LNG): KRN2(add,I64,i,+=)  ; break;
+  CASE(ADD,FLT): KRN2(add,F64,f,+=)  ; break;
+  CASE(ADD,CPX): BIN (c,+=)          ; break;
+
+  CASE(SUB,LNG): KRN2(sub,I64,i,-=)  ; break;
+  CASE(SUB,FLT): KRN2(sub,F64,f,-=)  ; break;
+  CASE(SUB,CPX): BIN (c,-=)          ; break;
+
+  CASE(MUL,LNG): KRN2(mul,I64,i,*=)  ; break;
+  CASE(MUL,FLT): KRN2(mul,F64,f,*=)  ; break;
+  CASE(MUL,CPX): BIN (c,*=)          ; break;
+
+  CASE(DIV,LNG): BIN (i,/=)          ; break;
+  CASE(DIV,FLT): KRN2(div,F64,f,/=)  ; break;
+  CASE(DIV,CPX): BIN (c,/=)          ; break;
+  }
+}
+
+// check leaves size, return YES if a leaf partially overlaps the destination
+static BOOL
+xpr_check(const struct VectorExpr *x, const struct vec *dst)
+{
+  if (x->op == LEAF) {
+    struct vec d[1];
+    vec_init(d, x->lhs, x->type);
+    ensure(d->size == x->size, "incompatible vector sizes");
+    return vec_overlap(d, dst, dst->size);
+  }
+
+  return xpr_check(CAST(const struct VectorExpr*, x->lhs), dst) |
+         (x->rhs && xpr_check(CAST(const struct VectorExpr*, x->rhs), dst));
+}
+
+// evaluate the dst->size first elements of x into dst
+static void
+xpr_assign(const struct vec *dst, const struct VectorExpr *x)
+{
+  union blk stk[4], *blk = stk;
+  void *mem = 0; EPRT(mem, free);
+  void *buf = 0; EPRT(buf, free);
+  struct vec tmp = *dst;
+  U32 i, n, size = dst->size;
+
+  ensure(size <= x->size, "source vector expression is too small");
+  ensure(KIND(dst->type) >= KIND(x->type), "incompatible vector types");
+
+  if (x->depth >= COS_ARRLEN(stk)) {
+    mem = blk = malloc((x->depth+1) * sizeof *blk);
+    if (!mem) THROW(ExBadAlloc);
+  }
+
+  if (xpr_check(x, dst)) { // evaluate in a temporary contiguous vector
+    tmp.val = buf = malloc((size_t)size * vec_esz[dst->type]);
+    tmp.stride = 1;
+    if (!buf) THROW(ExBadAlloc);
+  }
+
+  for (i = 0; i < size; i += n) {
+    n = size-i < B ? size-i : B;
+    xpr_eval(x, i, n, blk, blk+1);
+    blk_promote(blk, KIND(x->type), KIND(dst->type), n);
+    vec_store(&tmp, i, n, blk);
+  }
+
+  if (buf) {
+    for (i = 0; i < size; i += n) {
+      n = size-i < B ? size-i : B;
+      vec_load (&tmp, i, n, blk);
+      vec_store( dst, i, n, blk);
+    }
+  }
+
+  free(buf);
+  free(mem);
+  UNPRT(mem);
+}
+
+// ----- node
+
+static OBJ
+xpr_node(I32 op, OBJ _1, OBJ _2)
+{
+  struct VectorExpr *l = CAST(struct VectorExpr*, _1);
+  struct VectorExpr *r = CAST(struct VectorExpr*, _2);
+  struct VectorExpr *x;
+  I32 k = KIND(l->type);
+  I32 type;
+
+  switch (op) {
+  case ABS: type = k == CPX ? FLT : k; break;
+  case NEG:
+  case SQR: type = k; break;
+  case INV: type = MAX(k, FLT); break;
+  default :
+    ensure(l->size == r->size, "incompatible vector sizes");
+    type = MAX(k, KIND(r->type));
+  }
+
+  x = CAST(struct VectorExpr*, galloc(VectorExpr));
+  x->lhs   = gretain(_1);
+  x->rhs   = _2 ? gretain(_2) : 0;
+  x->size  = l->size;
+  x->depth = _2 ? MAX(l->depth, r->depth+1) : l->depth;
+  x->op    = op;
+  x->type  = type;
+
+  return gautoRelease((OBJ)x);
+}
+
+// ----- constructors
+
+struct VectorExpr*
+VectorExpr_init(struct VectorExpr *x, OBJ vec)
+{
+  struct vec d[1];
+
+  vec_init(d, vec, vec_type(vec));
+  x->lhs   = vec;
+  x->rhs   = 0;
+  x->size  = d->size;
+  x->depth = 0;
+  x->op    = LEAF;
+  x->type  = d->type;
+
+  return x;
+}
+
+defmethod(OBJ, ginitWith, VectorExpr, Vector) // leaf
+  VectorExpr_init(self, _2);
+  self->lhs = gretain(_2);
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, ginitWith, VectorExpr, VectorExpr) // copy
+  self->lhs   = gretain(self2->lhs);
+  self->rhs   = self2->rhs ? gretain(self2->rhs) : 0;
+  self->size  = self2->size;
+  self->depth = self2->depth;
+  self->op    = self2->op;
+  self->type  = self2->type;
+  retmethod(_1);
+endmethod
+
+// ----- destructor
+
+defmethod(OBJ, gdeinit, VectorExpr)
+  if (self->lhs) grelease(self->lhs);
+  if (self->rhs) grelease(self->rhs);
+  retmethod(_1);
+endmethod
+
+// ----- size
+
+defmethod(U32, gsize, VectorExpr)
+  retmethod(self->size);
+endmethod
+
+// ----- unary nodes
+
+#undef  DEFMETHOD
+#define DEFMETHOD(MTH,OP) \
+\
+defmethod(OBJ, MTH, VectorExpr) \
+  retmethod( xpr_node(OP,_1,0) ); \
+endmethod
+
+DEFMETHOD(gabs, ABS)
+DEFMETHOD(gneg, NEG)
+DEFMETHOD(gsqr, SQR)
+DEFMETHOD(ginv, INV)
+
+// ----- binary nodes
+
+#undef  DEFMETHOD
+#define DEFMETHOD(MTH,OP) \
+\
+defmethod(OBJ, MTH, VectorExpr, VectorExpr) \
+  retmethod( xpr_node(OP,_1,_2) ); \
+endmethod \
+\
+defmethod(OBJ, MTH, VectorExpr, Vector) \
+  retmethod( xpr_node(OP,_1,aVectorExpr(_2)) ); \
+endmethod \
+\
+defmethod(OBJ, MTH, Vector, VectorExpr) \
+  retmethod( xpr_node(OP,aVectorExpr(_1),_2) ); \
+endmethod
+
+DEFMETHOD(gadd, ADD)
+DEFMETHOD(gsub, SUB)
+DEFMETHOD(gmul, MUL)
+DEFMETHOD(gdiv, DIV)
+
+// ----- evaluation
+
+static void
+xpr_putAt(OBJ vec, const struct Slice *slc, const struct VectorExpr *x)
+{
+  struct vec dst[1];
+
+  vec_init(dst, vec, vec_type(vec));
+  ensure( Slice_first(slc) < dst->size &&
+          Slice_last (slc) < dst->size, "slice out of range" );
+
+  dst->val     = (char*)dst->val + Slice_start(slc)*dst->stride
+                                 * (ptrdiff_t)vec_esz[dst->type];
+  dst->size    = Slice_size(slc);
+  dst->stride *= Slice_stride(slc);
+  xpr_assign(dst, x);
+}
+
+static void
+xpr_putAtRange(OBJ vec, U32 size, const struct Range *rng,
+               const struct VectorExpr *x)
+{
+  // normalize in the function scope, not in a temporary of Slice_fromRange
+  struct Range *rn  = Range_normalize(Range_copy(atRange(0), rng), size);
+  struct Slice *slc = Slice_fromRange(atSlice(0), rn, 0);
+
+  xpr_putAt(vec, slc, x);
+}
+
+defmethod(OBJ, gassign, Vector, VectorExpr)
+  struct vec dst[1];
+
+  vec_init(dst, _1, vec_type(_1));
+  ensure(dst->size >= self2->size, "incompatible vector size");
+
+  dst->size = self2->size;
+  xpr_assign(dst, self2);
+
+  retmethod(_1);
+endmethod
+
+// ----- setters and constructors (more specific than element ones)
+
+#undef  DEFMETHOD
+#define DEFMETHOD(T) \
+\
+defmethod(OBJ, gputAt, T, Slice, VectorExpr) \
+  xpr_putAt(_1, self2, self3); \
+  retmethod(_1); \
+endmethod \
+\
+defmethod(OBJ, gputAt, T, Range, VectorExpr) \
+  xpr_putAtRange(_1, self->size, self2, self3); \
+  retmethod(_1); \
+endmethod \
+\
+defalias (OBJ, (ginitWith)gnewWith, pm##T, VectorExpr); \
+defmethod(OBJ,  ginitWith         , pm##T, VectorExpr) \
+  OBJ _vec = (OBJ)T##_alloc(self2->size); PRT(_vec); \
+\
+  CAST(struct T*, _vec)->size = self2->size; \
+  gassign(_vec, _2); \
+\
+  UNPRT(_vec); \
+  retmethod(_vec); \
+endmethod
+
+DEFMETHOD(ShtVector)
+DEFMETHOD(IntVector)
+DEFMETHOD(LngVector)
+DEFMETHOD(FltVector)
+DEFMETHOD(CpxVector)
@@ -56,7 +56,7 @@ defmethod(OBJ, greverse, T)
   U32  size  = self->size;
   I32  val_s = self->stride;
   VAL *val   = self->value;
-  VAL *end   = val + val_s*(size-1);
+  VAL *end   = val + val_s*(I32)(size-1);
 
   if (val_s > 0)
     while (val < end) {
@@ -0,0 +1,461 @@
+/**
+ * C Object System
+ * COS Vector template - algorithms using typed functions
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VECTOR_TMPL
+#error "this template file requires tmpl/Vector.c"
+#endif
+
+/* NOTE-INFO: typed functions
+   Specializations of the functor algorithms for the typed functions TF1..TF4
+   (e.g. FltFunction1) matching the element type of the vector: elements are
+   passed unboxed to the C function, without allocation nor dispatch per
+   element. Predicates are true when the function returns a non-zero value,
+   comparators return a negative, zero or positive value.
+*/
+
+// value type of typed functions (PF1..PF4)
+#if defined(CHRVECTOR_ONLY) || defined(SHTVECTOR_ONLY) || \
+    defined(INTVECTOR_ONLY)
+#define FVAL I32
+#elif defined(LNGVECTOR_ONLY)
+#define FVAL I64
+#elif defined(FLTVECTOR_ONLY)
+#define FVAL F64
+#elif defined(CPXVECTOR_ONLY)
+#define FVAL C64
+#else
+#error "this template file requires a numeric vector"
+#endif
+
+// predicate result, non-zero is true (without -Wfloat-equal warnings)
+static inline BOOL
+fcttrue(FVAL r)
+{
+#ifdef CPXVECTOR_ONLY
+  return creal(r) < 0 || creal(r) > 0 || cimag(r) < 0 || cimag(r) > 0;
+#else
+  return r < 0 || r > 0;
+#endif
+}
+
+// reduction result (boxed, autoreleased) and initial value (unboxed)
+static inline OBJ
+fctres(FVAL r)
+{
+#if   defined(CPXVECTOR_ONLY)
+  return gautoRelease(gclone(aComplex(r)));
+#elif defined(FLTVECTOR_ONLY)
+  return gautoRelease(gclone(aFloat(r)));
+#elif defined(LNGVECTOR_ONLY)
+  return gautoRelease(gclone(aLong(r)));
+#else
+  return gautoRelease(gclone(aInt(r)));
+#endif
+}
+
+static inline FVAL
+fctini(OBJ v)
+{
+#if   defined(CPXVECTOR_ONLY)
+  return gcpx(v);
+#elif defined(FLTVECTOR_ONLY)
+  return gflt(v);
+#elif defined(LNGVECTOR_ONLY)
+  return glng(v);
+#else
+  return gint(v);
+#endif
+}
+
+// ----- foreach, apply (in-place map)
+
+defmethod(void, gforeach, T, TF1)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self2->fct;
+
+  while (val != end) {
+    fct(*val);
+    val += val_s;
+  }
+endmethod
+
+defmethod(OBJ, gapply, TF1, T)
+  U32  size  = self2->size;
+  I32  val_s = self2->stride;
+  VAL *val   = self2->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self1->fct;
+
+  while (val != end) {
+    *val = fct(*val);
+    val += val_s;
+  }
+
+  retmethod(_2);
+endmethod
+
+// ----- map, map2, map3, map4
+
+defmethod(OBJ, gmap, TF1, T)
+  U32  size  = self2->size;
+  I32  val_s = self2->stride;
+  VAL *val   = self2->value;
+  PF1  fct   = self1->fct;
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  VAL *dst = vec->value;
+  U32  i;
+
+  if (val_s == 1)
+    for (i = 0; i < size; i++)
+      dst[i] = fct(val[i]);
+  else
+    for (i = 0; i < size; i++, val += val_s)
+      dst[i] = fct(*val);
+
+  vec->size = size;
+  retmethod(_vec);
+endmethod
+
+defmethod(OBJ, gmap2, TF2, T, T)
+  U32  size   = self2->size < self3->size ? self2->size : self3->size;
+  I32  val_s  = self2->stride;
+  VAL *val    = self2->value;
+  I32  val2_s = self3->stride;
+  VAL *val2   = self3->value;
+  PF2  fct    = self1->fct;
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  VAL *dst = vec->value;
+  U32  i;
+
+  if (val_s == 1 && val2_s == 1)
+    for (i = 0; i < size; i++)
+      dst[i] = fct(val[i], val2[i]);
+  else
+    for (i = 0; i < size; i++, val += val_s, val2 += val2_s)
+      dst[i] = fct(*val, *val2);
+
+  vec->size = size;
+  retmethod(_vec);
+endmethod
+
+defmethod(OBJ, gmap3, TF3, T, T, T)
+  U32  size   = self2->size < self3->size ? self2->size : self3->size;
+       size   = self4->size < size ? self4->size : size;
+  I32  val_s  = self2->stride;
+  VAL *val    = self2->value;
+  I32  val2_s = self3->stride;
+  VAL *val2   = self3->value;
+  I32  val3_s = self4->stride;
+  VAL *val3   = self4->value;
+  PF3  fct    = self1->fct;
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  VAL *dst = vec->value;
+  U32  i;
+
+  for (i = 0; i < size; i++) {
+    dst[i] = fct(*val, *val2, *val3);
+    val  += val_s;
+    val2 += val2_s;
+    val3 += val3_s;
+  }
+
+  vec->size = size;
+  retmethod(_vec);
+endmethod
+
+defmethod(OBJ, gmap4, TF4, T, T, T, T)
+  U32  size   = self2->size < self3->size ? self2->size : self3->size;
+       size   = self4->size < size ? self4->size : size;
+       size   = self5->size < size ? self5->size : size;
+  I32  val_s  = self2->stride;
+  VAL *val    = self2->value;
+  I32  val2_s = self3->stride;
+  VAL *val2   = self3->value;
+  I32  val3_s = self4->stride;
+  VAL *val3   = self4->value;
+  I32  val4_s = self5->stride;
+  VAL *val4   = self5->value;
+  PF4  fct    = self1->fct;
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  VAL *dst = vec->value;
+  U32  i;
+
+  for (i = 0; i < size; i++) {
+    dst[i] = fct(*val, *val2, *val3, *val4);
+    val  += val_s;
+    val2 += val2_s;
+    val3 += val3_s;
+    val4 += val4_s;
+  }
+
+  vec->size = size;
+  retmethod(_vec);
+endmethod
+
+// ----- select, reject
+
+defmethod(OBJ, gselect, T, TF1)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self2->fct;
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  U32 *dst_n = &vec->size;
+  VAL *dst   = vec->value;
+
+  while (val != end) {
+    if (fcttrue(fct(*val)))
+      *dst++ = *val, ++*dst_n;
+    val += val_s;
+  }
+
+  retmethod(_vec);
+endmethod
+
+defmethod(OBJ, greject, T, TF1)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self2->fct;
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  U32 *dst_n = &vec->size;
+  VAL *dst   = vec->value;
+
+  while (val != end) {
+    if (!fcttrue(fct(*val)))
+      *dst++ = *val, ++*dst_n;
+    val += val_s;
+  }
+
+  retmethod(_vec);
+endmethod
+
+// ----- reduce
+
+defmethod(OBJ, greduce, T, TF2)
+  ensure( self->size > 0, "empty vector" );
+
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF2  fct   = self2->fct;
+  FVAL res   = *val;
+
+  val += val_s;
+
+  while (val != end) {
+    res = fct(res, *val);
+    val += val_s;
+  }
+
+  retmethod( fctres(res) );
+endmethod
+
+defmethod(OBJ, greduce1, T, TF2, Object)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF2  fct   = self2->fct;
+  FVAL res   = fctini(_3);
+
+  while (val != end) {
+    res = fct(res, *val);
+    val += val_s;
+  }
+
+  retmethod( fctres(res) );
+endmethod
+
+// ----- accumulate
+
+defmethod(OBJ, gaccumulate, T, TF2)
+  ensure( self->size > 0, "empty vector" );
+
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  PF2  fct   = self2->fct;
+  FVAL res   = *val;
+
+  struct T* vec = T_alloc(size-1);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  VAL *dst = vec->value;
+  U32  i;
+
+  for (i = 1; i < size; i++)
+    val += val_s, *dst++ = res = fct(res, *val);
+
+  vec->size = size-1;
+  retmethod(_vec);
+endmethod
+
+defmethod(OBJ, gaccumulate1, T, TF2, Object)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  PF2  fct   = self2->fct;
+  FVAL res   = fctini(_3);
+
+  struct T* vec = T_alloc(size);
+  OBJ _vec = gautoRelease( (OBJ)vec );
+
+  VAL *dst = vec->value;
+  U32  i;
+
+  for (i = 0; i < size; i++, val += val_s)
+    *dst++ = res = fct(res, *val);
+
+  vec->size = size;
+  retmethod(_vec);
+endmethod
+
+// ----- all, any, count
+
+defmethod(OBJ, gall, T, TF1)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self2->fct;
+
+  while (val != end) {
+    if (!fcttrue(fct(*val)))
+      retmethod(False);
+    val += val_s;
+  }
+
+  retmethod(True);
+endmethod
+
+defmethod(OBJ, gany, T, TF1)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self2->fct;
+
+  while (val != end) {
+    if (fcttrue(fct(*val)))
+      retmethod(True);
+    val += val_s;
+  }
+
+  retmethod(False);
+endmethod
+
+defmethod(U32, gcount, T, TF1)
+  U32  size  = self->size;
+  I32  val_s = self->stride;
+  VAL *val   = self->value;
+  VAL *end   = val + val_s*(I32)size;
+  PF1  fct   = self2->fct;
+  U32  cnt   = 0;
+
+  while (val != end) {
+    cnt += fcttrue(fct(*val));
+    val += val_s;
+  }
+
+  retmethod(cnt);
+endmethod
+
+// ----- sorting (in place), complex numbers have no order
+
+#ifndef CPXVECTOR_ONLY
+
+// comparison result, the sign of the returned value
+static inline I32
+fctsgn(FVAL r)
+{
+  return (r > 0) - (r < 0);
+}
+
+#undef  GCMP
+#define GCMP(a,b)  fctsgn(fct(a,b))
+#define QS_NAME(n) COS_PP_CAT(n,Fct)
+#define QS_FUN     PF2 fct
+#define QS_ARG     fct
+#define QS_RES     I32
+#define QS_LT      (-1)
+#define QS_EQ      0
+
+#include "Vector_qs.c"
+
+// ----- sorting methods
+
+defmethod(OBJ, gsort, T, TF2)
+  qsortFct(self->value, self->size-1, self2->fct);
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gsort, TV, TF2)
+  struct T *vec = &self->T;
+
+  if (vec->stride == 1) {
+    qsortFct(vec->value, vec->size-1, self2->fct);
+    retmethod(_1);
+  }
+
+  if (vec->stride == -1) { // should be faster than strided sort
+    qsortFct(vec->value-vec->size+1, vec->size-1, self2->fct);
+    retmethod(greverse(_1));
+  }
+
+  qsortSFct(vec->value, vec->size-1, vec->stride, self2->fct);
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gisort, T, TF2)
+  useclass(IntVector);
+
+  OBJ _vec = gautoRelease(gnewWith(IntVector, aSlice(0,self->size,1)));
+  struct IntVector *vec = CAST(struct IntVector*, _vec);
+
+  iqsortSFct(vec->value, vec->size-1, self->value, self->stride, self2->fct);
+
+  retmethod(_vec);
+endmethod
+
+#endif // CPXVECTOR_ONLY
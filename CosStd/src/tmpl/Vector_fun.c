@@ -374,6 +374,164 @@ defmethod(OBJ, gmap4, Functor, T, T, T, T)
   retmethod(_vec);
 endmethod
 
+// ----- foreach, apply, map with message expression (elements are TE)
+
+defmethod(void, gforeach, T, MsgExpr)
+  if (self2->max != -1) // not unary
+    next_method(self, self2);
+
+  else {
+    SEL  sel   = self2->sel;
+    IMP1 fct   = cos_method_fastLookup1(sel, cos_class_id(classref(TE)));
+    U32  size  = self->size;
+    I32  val_s = self->stride;
+    VAL *val   = self->value;
+    VAL *end   = val + val_s*size;
+    OBJ  res;
+
+    while (val != end) {
+      fct(sel, VALOBJ(*val), 0, &res);
+      val += val_s;
+    }
+  }
+endmethod
+
+defmethod(void, gforeach2, T, T, MsgExpr)
+  if (self3->max != -2) // not binary
+    next_method(self, self2, self3);
+
+  else {
+    SEL  sel    = self3->sel;
+    U32  id     = cos_class_id(classref(TE));
+    IMP2 fct    = cos_method_fastLookup2(sel, id, id);
+    U32  size   = self->size < self2->size ? self->size : self2->size;
+    I32  val_s  = self->stride;
+    VAL *val    = self->value;
+    I32  val2_s = self2->stride;
+    VAL *val2   = self2->value;
+    VAL *end    = val + val_s*size;
+    OBJ  res;
+
+    while (val != end) {
+      fct(sel, VALOBJ(*val), VALOBJ(*val2), 0, &res);
+      val  += val_s;
+      val2 += val2_s;
+    }
+  }
+endmethod
+
+defmethod(OBJ, gapply, MsgExpr, T)
+  if (self->max != -1 || !COS_GEN_ORET(self->sel)) // not unary or no result
+    next_method(self, self2);
+
+  else {
+    SEL  sel   = self->sel;
+    IMP1 fct   = cos_method_fastLookup1(sel, cos_class_id(classref(TE)));
+    U32  size  = self2->size;
+    I32  val_s = self2->stride;
+    VAL *val   = self2->value;
+    VAL *end   = val + val_s*size;
+    OBJ  res, old;
+
+    while (val != end) {
+      fct(sel, old = VALOBJ(*val), 0, &res);
+      if (res != old) *val = TOVAL(res);
+      val += val_s;
+    }
+
+    retmethod(_2);
+  }
+endmethod
+
+defmethod(OBJ, gapply2, MsgExpr, T, T)
+  if (self->max != -2 || !COS_GEN_ORET(self->sel)) // not binary or no result
+    next_method(self, self2, self3);
+
+  else {
+    SEL  sel    = self->sel;
+    U32  id     = cos_class_id(classref(TE));
+    IMP2 fct    = cos_method_fastLookup2(sel, id, id);
+    U32  size   = self2->size < self3->size ? self2->size : self3->size;
+    I32  val_s  = self2->stride;
+    VAL *val    = self2->value;
+    I32  val2_s = self3->stride;
+    VAL *val2   = self3->value;
+    VAL *end    = val + val_s*size;
+    OBJ  res, old;
+
+    while (val != end) {
+      fct(sel, old = VALOBJ(*val), VALOBJ(*val2), 0, &res);
+      if (res != old) *val = TOVAL(res);
+      val  += val_s;
+      val2 += val2_s;
+    }
+
+    retmethod(_2);
+  }
+endmethod
+
+defmethod(OBJ, gmap, MsgExpr, T)
+  if (self->max != -1 || !COS_GEN_ORET(self->sel)) // not unary or no result
+    next_method(self, self2);
+
+  else {
+    SEL  sel   = self->sel;
+    IMP1 fct   = cos_method_fastLookup1(sel, cos_class_id(classref(TE)));
+    U32  size  = self2->size;
+    I32  val_s = self2->stride;
+    VAL *val   = self2->value;
+    VAL *end   = val + val_s*size;
+    OBJ  res;
+
+    struct T* vec = T_alloc(size);
+    OBJ _vec = gautoRelease( (OBJ)vec );
+
+    U32 *dst_n = &vec->size;
+    VAL *dst   = vec->value;
+
+    while (val != end) {
+      fct(sel, VALOBJ(*val), 0, &res);
+      *dst++ = TOVAL(res), ++*dst_n;
+      val += val_s;
+    }
+
+    retmethod(_vec);
+  }
+endmethod
+
+defmethod(OBJ, gmap2, MsgExpr, T, T)
+  if (self->max != -2 || !COS_GEN_ORET(self->sel)) // not binary or no result
+    next_method(self, self2, self3);
+
+  else {
+    SEL  sel    = self->sel;
+    U32  id     = cos_class_id(classref(TE));
+    IMP2 fct    = cos_method_fastLookup2(sel, id, id);
+    U32  size   = self2->size < self3->size ? self2->size : self3->size;
+    I32  val_s  = self2->stride;
+    VAL *val    = self2->value;
+    I32  val2_s = self3->stride;
+    VAL *val2   = self3->value;
+    VAL *end    = val + val_s*size;
+    OBJ  res;
+
+    struct T* vec = T_alloc(size);
+    OBJ _vec = gautoRelease( (OBJ)vec );
+
+    U32 *dst_n = &vec->size;
+    VAL *dst   = vec->value;
+
+    while (val != end) {
+      fct(sel, VALOBJ(*val), VALOBJ(*val2), 0, &res);
+      *dst++ = TOVAL(res), ++*dst_n;
+      val  += val_s;
+      val2 += val2_s;
+    }
+
+    retmethod(_vec);
+  }
+endmethod
+
 // ----- select, reject
 
 defmethod(OBJ, gselect, T, Functor)
@@ -939,9 +1097,7 @@ endmethod
   } while (0)
 
 #undef  EXCH
-#undef  SORT
 #define EXCH(a,b) (t=(a),(a)=(b),(b)=t)
-#define SORT(a,b) if (GCMP(b,a) == Lesser) EXCH(a,b)
 
 static inline U32
 pivot(void)
@@ -951,187 +1107,16 @@ pivot(void)
   return x = x * 2621124293u + 1;
 }
 
-/* from "Quicksort Is Optimal", R. Sedgwick & J. Bentley, 2002
-   plus some practical improvements.
- */
-
 #undef  GCMP
-#define GCMP(a,b) geval(fun,VALOBJ(a),VALOBJ(b))
-
-static void
-qsortFun(VAL a[], I32 r, OBJ fun)
-{
-  I32 i, j, p, q;
-  OBJ ri, rj;
-  VAL t;
-
-  // nothing to do
-  if (r <= 0) return;
-
-  // optimized sort for small sizes
-  NETSORT(a,1,r,return);
-
-  // select pivot as the median-of-three taken pseudo-randomly
-  i = pivot() % (r+1) + 0, EXCH(a[i],a[0  ]);
-  i = pivot() % (r  ) + 1, EXCH(a[i],a[r  ]);
-  i = pivot() % (r-1) + 1, EXCH(a[i],a[r-1]);
-  SORT(a[0],a[r-1]);
-  if ((ri = GCMP(a[r  ],a[0])) == Lesser) EXCH(a[r],a[0  ]);
-  if ((rj = GCMP(a[r-1],a[r])) == Lesser) EXCH(a[r],a[r-1]);
-
-  // partitioning initialization
-  i = 0, j = r-1;
-  p = ri == Equal ? i : -1;
-  q = rj == Equal ? j :  r;
-
-  // three-way partitioning
-  for (;;) {
-    while ((rj = GCMP(a[++i],a[  r])) == Lesser     ) ;
-    while ((ri = GCMP(a[  r],a[--j])) == Lesser && j) ;
-
-    if (i >= j) break;
-
-    EXCH(a[i], a[j]);
-    if (ri == Equal) ++p, EXCH(a[p],a[i]);
-    if (rj == Equal) --q, EXCH(a[q],a[j]);
-  }
-
-  // move pivot to center
-  EXCH(a[i], a[r]);
-
-  // move equal partition from borders to center
-  for (j = i-1; p-- > 0; j--) EXCH(a[p],a[j]);
-  for (i = i+1; ++q < r; i++) EXCH(a[q],a[i]);
-
-  // divide & conquer (small first)
-  VAL *small, *large;
-  
-  if (j < r-i)
-    small = a, large = a+i, p = j, q = r-i;
-  else
-    large = a, small = a+i, q = j, p = r-i;
-
-  qsortFun(small,p,fun);
-  qsortFun(large,q,fun); // tail recursion
-}
-
-static void
-qsortSFun(VAL a[], I32 r, I32 s, OBJ fun)
-{
-  I32 i, j, p, q;
-  OBJ ri, rj;
-  VAL t;
-
-  // nothing to do
-  if (r <= 0) return;
-
-  // optimized sort for small sizes
-  NETSORT(a,s,r,return);
-
-  // select pivot as the median-of-three taken pseudo-randomly
-  i = pivot() % (r+1) + 0, EXCH(a[i*s],a[ 0   *s]);
-  i = pivot() % (r  ) + 1, EXCH(a[i*s],a[ r   *s]);
-  i = pivot() % (r-1) + 1, EXCH(a[i*s],a[(r-1)*s]);
-  SORT(a[0*s],a[(r-1)*s]);
-  if ((ri = GCMP(a[ r   *s],a[0*s])) == Lesser) EXCH(a[r*s],a[ 0   *s]);
-  if ((rj = GCMP(a[(r-1)*s],a[r*s])) == Lesser) EXCH(a[r*s],a[(r-1)*s]);
-
-  // partitioning initialization
-  i = 0, j = r-1;
-  p = ri == Equal ? i : -1;
-  q = rj == Equal ? j :  r;
-
-  // three-way partitioning
-  for (;;) {
-    while ((rj = GCMP(a[++i*s],a[  r*s])) == Lesser     ) ;
-    while ((ri = GCMP(a[  r*s],a[--j*s])) == Lesser && j) ;
-
-    if (i >= j) break;
-
-    EXCH(a[i*s], a[j*s]);
-    if (ri == Equal) ++p, EXCH(a[p*s],a[i*s]);
-    if (rj == Equal) --q, EXCH(a[q*s],a[j*s]);
-  }
-
-  // move pivot to center
-  EXCH(a[i*s], a[r*s]);
-
-  // move equal partition from borders to center
-  for (j = i-1; p-- > 0; j--) EXCH(a[p*s],a[j*s]);
-  for (i = i+1; ++q < r; i++) EXCH(a[q*s],a[i*s]);
-
-  // divide & conquer (small first)
-  VAL *small, *large;
-  
-  if (j < r-i)
-    small = a, large = a+i*s, p = j, q = r-i;
-  else
-    large = a, small = a+i*s, q = j, p = r-i;
-
-  qsortSFun(small,p,s,fun);
-  qsortSFun(large,q,s,fun); // tail recursion
-}
-
-// ----- indirect sorting (return permutation)
-
-#undef  GCMP
-#define GCMP(a,b) geval(fun,VALOBJ(o[a*s]),VALOBJ(o[b*s]))
-
-static void
-iqsortSFun(I32 a[], I32 r, VAL o[], I32 s, OBJ fun)
-{
-  I32 i, j, p, q, t;
-  OBJ ri, rj;
-
-  // nothing to do
-  if (r <= 0) return;
-
-  // optimized sort for small sizes
-  NETSORT(a,1,r,return);
-
-  // select pivot as the median-of-three taken pseudo-randomly
-  i = pivot() % (r+1) + 0, EXCH(a[i],a[0  ]);
-  i = pivot() % (r  ) + 1, EXCH(a[i],a[r  ]);
-  i = pivot() % (r-1) + 1, EXCH(a[i],a[r-1]);
-  SORT(a[0],a[r-1]);
-  if ((ri = GCMP(a[r  ],a[0])) == Lesser) EXCH(a[r],a[0  ]);
-  if ((rj = GCMP(a[r-1],a[r])) == Lesser) EXCH(a[r],a[r-1]);
-
-  // partitioning initialization
-  i = 0, j = r-1;
-  p = ri == Equal ? i : -1;
-  q = rj == Equal ? j :  r;
-
-  // three-way partitioning
-  for (;;) {
-    while ((rj = GCMP(a[++i],a[  r])) == Lesser     ) ;
-    while ((ri = GCMP(a[  r],a[--j])) == Lesser && j) ;
-
-    if (i >= j) break;
-
-    EXCH(a[i], a[j]);
-    if (ri == Equal) ++p, EXCH(a[p],a[i]);
-    if (rj == Equal) --q, EXCH(a[q],a[j]);
-  }
-
-  // move pivot to center
-  EXCH(a[i], a[r]);
-
-  // move equal partition from borders to center
-  for (j = i-1; p-- > 0; j--) EXCH(a[p],a[j]);
-  for (i = i+1; ++q < r; i++) EXCH(a[q],a[i]);
-
-  // divide & conquer (small first)
-  I32 *small, *large;
-  
-  if (j < r-i)
-    small = a, large = a+i, p = j, q = r-i;
-  else
-    large = a, small = a+i, q = j, p = r-i;
-
-  iqsortSFun(small,p,o,s,fun);
-  iqsortSFun(large,q,o,s,fun); // tail recursion
-}
+#define GCMP(a,b)  geval(fun,VALOBJ(a),VALOBJ(b))
+#define QS_NAME(n) COS_PP_CAT(n,Fun)
+#define QS_FUN     OBJ fun
+#define QS_ARG     fun
+#define QS_RES     OBJ
+#define QS_LT      Lesser
+#define QS_EQ      Equal
+
+#include "Vector_qs.c"
 
 // ----- sorting methods
 
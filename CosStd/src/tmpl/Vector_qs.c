@@ -0,0 +1,226 @@
+/**
+ * C Object System
+ * COS Vector template - quicksort with comparator
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VECTOR_TMPL
+#error "this template file requires tmpl/Vector.c"
+#endif
+
+/* NOTE-INFO: quicksort template
+   Included by tmpl/Vector_fun.c (functors) and tmpl/Vector_fct.c (typed
+   functions) after defining:
+   - GCMP(a,b)      the comparison of the values a and b,
+   - QS_LT, QS_EQ   its lesser and equal results of type QS_RES,
+   - QS_FUN, QS_ARG the comparator parameter and its name,
+   - QS_NAME(n)     the name of the instance of n (qsort, qsortS, iqsortS).
+   NETSORT, EXCH and pivot come from tmpl/Vector_fun.c. GCMP and the QS_
+   macros are undefined at the end.
+*/
+
+#undef  SORT
+#define SORT(a,b) if (GCMP(b,a) == QS_LT) EXCH(a,b)
+
+/* from "Quicksort Is Optimal", R. Sedgwick & J. Bentley, 2002
+   plus some practical improvements.
+ */
+
+static void
+QS_NAME(qsort)(VAL a[], I32 r, QS_FUN)
+{
+  I32 i, j, p, q;
+  QS_RES ri, rj;
+  VAL t;
+
+  // nothing to do
+  if (r <= 0) return;
+
+  // optimized sort for small sizes
+  NETSORT(a,1,r,return);
+
+  // select pivot as the median-of-three taken pseudo-randomly
+  i = pivot() % (r+1) + 0, EXCH(a[i],a[0  ]);
+  i = pivot() % (r  ) + 1, EXCH(a[i],a[r  ]);
+  i = pivot() % (r-1) + 1, EXCH(a[i],a[r-1]);
+  SORT(a[0],a[r-1]);
+  if ((ri = GCMP(a[r  ],a[0])) == QS_LT) EXCH(a[r],a[0  ]);
+  if ((rj = GCMP(a[r-1],a[r])) == QS_LT) EXCH(a[r],a[r-1]);
+
+  // partitioning initialization
+  i = 0, j = r-1;
+  p = ri == QS_EQ ? i : -1;
+  q = rj == QS_EQ ? j :  r;
+
+  // three-way partitioning
+  for (;;) {
+    while ((rj = GCMP(a[++i],a[  r])) == QS_LT     ) ;
+    while ((ri = GCMP(a[  r],a[--j])) == QS_LT && j) ;
+
+    if (i >= j) break;
+
+    EXCH(a[i], a[j]);
+    if (ri == QS_EQ) ++p, EXCH(a[p],a[i]);
+    if (rj == QS_EQ) --q, EXCH(a[q],a[j]);
+  }
+
+  // move pivot to center
+  EXCH(a[i], a[r]);
+
+  // move equal partition from borders to center
+  for (j = i-1; p-- > 0; j--) EXCH(a[p],a[j]);
+  for (i = i+1; ++q < r; i++) EXCH(a[q],a[i]);
+
+  // divide & conquer (small first)
+  VAL *small, *large;
+
+  if (j < r-i)
+    small = a, large = a+i, p = j, q = r-i;
+  else
+    large = a, small = a+i, q = j, p = r-i;
+
+  QS_NAME(qsort)(small,p,QS_ARG);
+  QS_NAME(qsort)(large,q,QS_ARG); // tail recursion
+}
+
+static void
+QS_NAME(qsortS)(VAL a[], I32 r, I32 s, QS_FUN)
+{
+  I32 i, j, p, q;
+  QS_RES ri, rj;
+  VAL t;
+
+  // nothing to do
+  if (r <= 0) return;
+
+  // optimized sort for small sizes
+  NETSORT(a,s,r,return);
+
+  // select pivot as the median-of-three taken pseudo-randomly
+  i = pivot() % (r+1) + 0, EXCH(a[i*s],a[ 0   *s]);
+  i = pivot() % (r  ) + 1, EXCH(a[i*s],a[ r   *s]);
+  i = pivot() % (r-1) + 1, EXCH(a[i*s],a[(r-1)*s]);
+  SORT(a[0*s],a[(r-1)*s]);
+  if ((ri = GCMP(a[ r   *s],a[0*s])) == QS_LT) EXCH(a[r*s],a[ 0   *s]);
+  if ((rj = GCMP(a[(r-1)*s],a[r*s])) == QS_LT) EXCH(a[r*s],a[(r-1)*s]);
+
+  // partitioning initialization
+  i = 0, j = r-1;
+  p = ri == QS_EQ ? i : -1;
+  q = rj == QS_EQ ? j :  r;
+
+  // three-way partitioning
+  for (;;) {
+    while ((rj = GCMP(a[++i*s],a[  r*s])) == QS_LT     ) ;
+    while ((ri = GCMP(a[  r*s],a[--j*s])) == QS_LT && j) ;
+
+    if (i >= j) break;
+
+    EXCH(a[i*s], a[j*s]);
+    if (ri == QS_EQ) ++p, EXCH(a[p*s],a[i*s]);
+    if (rj == QS_EQ) --q, EXCH(a[q*s],a[j*s]);
+  }
+
+  // move pivot to center
+  EXCH(a[i*s], a[r*s]);
+
+  // move equal partition from borders to center
+  for (j = i-1; p-- > 0; j--) EXCH(a[p*s],a[j*s]);
+  for (i = i+1; ++q < r; i++) EXCH(a[q*s],a[i*s]);
+
+  // divide & conquer (small first)
+  VAL *small, *large;
+
+  if (j < r-i)
+    small = a, large = a+i*s, p = j, q = r-i;
+  else
+    large = a, small = a+i*s, q = j, p = r-i;
+
+  QS_NAME(qsortS)(small,p,s,QS_ARG);
+  QS_NAME(qsortS)(large,q,s,QS_ARG); // tail recursion
+}
+
+// ----- indirect sorting (return permutation)
+
+#undef  ICMP
+#undef  SORT
+#define ICMP(a,b) GCMP(o[(a)*s],o[(b)*s])
+#define SORT(a,b) if (ICMP(b,a) == QS_LT) EXCH(a,b)
+
+static void
+QS_NAME(iqsortS)(I32 a[], I32 r, VAL o[], I32 s, QS_FUN)
+{
+  I32 i, j, p, q, t;
+  QS_RES ri, rj;
+
+  // nothing to do
+  if (r <= 0) return;
+
+  // optimized sort for small sizes
+  NETSORT(a,1,r,return);
+
+  // select pivot as the median-of-three taken pseudo-randomly
+  i = pivot() % (r+1) + 0, EXCH(a[i],a[0  ]);
+  i = pivot() % (r  ) + 1, EXCH(a[i],a[r  ]);
+  i = pivot() % (r-1) + 1, EXCH(a[i],a[r-1]);
+  SORT(a[0],a[r-1]);
+  if ((ri = ICMP(a[r  ],a[0])) == QS_LT) EXCH(a[r],a[0  ]);
+  if ((rj = ICMP(a[r-1],a[r])) == QS_LT) EXCH(a[r],a[r-1]);
+
+  // partitioning initialization
+  i = 0, j = r-1;
+  p = ri == QS_EQ ? i : -1;
+  q = rj == QS_EQ ? j :  r;
+
+  // three-way partitioning
+  for (;;) {
+    while ((rj = ICMP(a[++i],a[  r])) == QS_LT     ) ;
+    while ((ri = ICMP(a[  r],a[--j])) == QS_LT && j) ;
+
+    if (i >= j) break;
+
+    EXCH(a[i], a[j]);
+    if (ri == QS_EQ) ++p, EXCH(a[p],a[i]);
+    if (rj == QS_EQ) --q, EXCH(a[q],a[j]);
+  }
+
+  // move pivot to center
+  EXCH(a[i], a[r]);
+
+  // move equal partition from borders to center
+  for (j = i-1; p-- > 0; j--) EXCH(a[p],a[j]);
+  for (i = i+1; ++q < r; i++) EXCH(a[q],a[i]);
+
+  // divide & conquer (small first)
+  I32 *small, *large;
+
+  if (j < r-i)
+    small = a, large = a+i, p = j, q = r-i;
+  else
+    large = a, small = a+i, q = j, p = r-i;
+
+  QS_NAME(iqsortS)(small,p,o,s,QS_ARG);
+  QS_NAME(iqsortS)(large,q,o,s,QS_ARG); // tail recursion
+}
+
+#undef ICMP
+#undef GCMP
+#undef QS_NAME
+#undef QS_FUN
+#undef QS_ARG
+#undef QS_RES
+#undef QS_LT
+#undef QS_EQ
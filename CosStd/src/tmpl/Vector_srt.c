@@ -0,0 +1,217 @@
+/**
+ * C Object System
+ * COS Vector template - sorting without comparator
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VECTOR_TMPL
+#error "this template file requires tmpl/Vector.c"
+#endif
+
+/* NOTE-INFO: sorting without comparator
+   gsort(vec,Lesser) and gsort(vec,Greater) sort the elements in increasing
+   and decreasing order, gisort returns the permutation as an IntVector.
+   Elements are mapped to unsigned keys preserving their order and sorted by
+   a LSD radix sort (one pass per byte, passes on constant bytes are skipped),
+   small vectors use an insertion sort. Both are stable, so equal elements
+   keep their relative order in the permutation. For floating vectors, the
+   keys are the IEEE bits with the sign folded: -0 is lesser than +0 and NaN
+   are greater than +inf (the sign of NaN is lost).
+*/
+
+#include <cos/Ordered.h>
+
+// unsigned key type
+#if defined(CHRVECTOR_ONLY)
+#define SKEY U8
+#elif defined(SHTVECTOR_ONLY)
+#define SKEY U16
+#elif defined(INTVECTOR_ONLY)
+#define SKEY U32
+#elif defined(LNGVECTOR_ONLY) || defined(FLTVECTOR_ONLY)
+#define SKEY U64
+#else
+#error "this template file requires a real numeric vector"
+#endif
+
+#define SKEY_SGN ((SKEY)1 << (8*sizeof(SKEY)-1))
+
+// ----- keys
+
+static inline SKEY
+tokey(VAL v)
+{
+#ifdef FLTVECTOR_ONLY
+  union { F64 f; U64 u; } c = { v };
+
+  if (isnan(v)) c.u &= ~SKEY_SGN;
+
+  return c.u & SKEY_SGN ? ~c.u : c.u | SKEY_SGN;
+#else
+  return (SKEY)v ^ SKEY_SGN;
+#endif
+}
+
+static inline VAL
+toval(SKEY k)
+{
+#ifdef FLTVECTOR_ONLY
+  union { U64 u; F64 f; } c = { k & SKEY_SGN ? k & ~SKEY_SGN : ~k };
+
+  return c.f;
+#else
+  return (VAL)(k ^ SKEY_SGN);
+#endif
+}
+
+// ----- stable key sort (idx is optional)
+
+static void
+ksort(SKEY *key, SKEY *key2, I32 *idx, I32 *idx2, U32 n)
+{
+  enum { B = sizeof(SKEY), N = 32 };
+  SKEY *key0 = key, *ktmp;
+  I32  *idx0 = idx, *itmp;
+  U32   cnt[B][256];
+  U32   i, j, b, d, s, t;
+
+  // small sizes, insertion sort
+  if (n < N) {
+    for (i = 1; i < n; i++) {
+      SKEY k = key[i];
+      I32  x = idx ? idx[i] : 0;
+
+      for (j = i; j > 0 && key[j-1] > k; j--) {
+        key[j] = key[j-1];
+        if (idx) idx[j] = idx[j-1];
+      }
+      key[j] = k;
+      if (idx) idx[j] = x;
+    }
+    return;
+  }
+
+  // histograms of all the bytes in one pass
+  memset(cnt, 0, sizeof cnt);
+
+  for (i = 0; i < n; i++)
+    for (b = 0; b < B; b++)
+      cnt[b][(key[i] >> 8*b) & 0xFF]++;
+
+  // one stable counting pass per byte, from the least significant
+  for (b = 0; b < B; b++) {
+    U32 *c = cnt[b];
+
+    if (c[(key[0] >> 8*b) & 0xFF] == n) // constant byte
+      continue;
+
+    for (s = d = 0; d < 256; d++)
+      t = c[d], c[d] = s, s += t;
+
+    if (idx)
+      for (i = 0; i < n; i++) {
+        d = (key[i] >> 8*b) & 0xFF;
+        key2[c[d]] = key[i];
+        idx2[c[d]++] = idx[i];
+      }
+    else
+      for (i = 0; i < n; i++) {
+        d = (key[i] >> 8*b) & 0xFF;
+        key2[c[d]++] = key[i];
+      }
+
+    ktmp = key, key = key2, key2 = ktmp;
+    itmp = idx, idx = idx2, idx2 = itmp;
+  }
+
+  if (key != key0) {
+    memcpy(key0, key, n * sizeof *key);
+    if (idx) memcpy(idx0, idx, n * sizeof *idx);
+  }
+}
+
+// ----- sorting
+
+static void
+vsort(VAL *val, I32 val_s, U32 size, SKEY msk)
+{
+  SKEY *key;
+  U32 i;
+
+  if (size < 2) return;
+
+  key = malloc(2 * (size_t)size * sizeof *key);
+  if (!key) THROW(ExBadAlloc);
+
+  for (i = 0; i < size; i++)
+    key[i] = tokey(val[(I32)i*val_s]) ^ msk;
+
+  ksort(key, key+size, 0, 0, size);
+
+  for (i = 0; i < size; i++)
+    val[(I32)i*val_s] = toval(key[i] ^ msk);
+
+  free(key);
+}
+
+static OBJ
+visort(VAL *val, I32 val_s, U32 size, SKEY msk)
+{
+  useclass(IntVector);
+
+  OBJ _vec = gautoRelease(gnewWith(IntVector, aSlice(0,size,1)));
+  struct IntVector *vec = CAST(struct IntVector*, _vec);
+  SKEY *key;
+  I32  *idx;
+  U32 i;
+
+  if (size < 2) return _vec;
+
+  key = malloc((size_t)size * (2*sizeof *key + sizeof *idx));
+  if (!key) THROW(ExBadAlloc);
+  idx = (I32*)(key + 2*size);
+
+  for (i = 0; i < size; i++)
+    key[i] = tokey(val[(I32)i*val_s]) ^ msk;
+
+  ksort(key, key+size, vec->value, idx, size);
+
+  free(key);
+  return _vec;
+}
+
+// ----- sorting methods
+
+defmethod(OBJ, gsort, T, pmLesser)
+  vsort(self->value, self->stride, self->size, 0);
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gsort, T, pmGreater)
+  vsort(self->value, self->stride, self->size, (SKEY)~(SKEY)0);
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gisort, T, pmLesser)
+  retmethod(visort(self->value, self->stride, self->size, 0));
+endmethod
+
+defmethod(OBJ, gisort, T, pmGreater)
+  retmethod(visort(self->value, self->stride, self->size, (SKEY)~(SKEY)0));
+endmethod
+
+#undef SKEY
+#undef SKEY_SGN
@@ -0,0 +1,16 @@
+/*
+ * -----------------------------
+ * COS generics
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosgen
+ * Sun Oct 18 12:19:54 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Object.h>
+
+#include "tests.h"
+
+
+makgeneric(OBJ, gprint, _1);
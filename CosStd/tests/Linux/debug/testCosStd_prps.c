@@ -0,0 +1,14 @@
+/*
+ * -----------------------------
+ * COS properties
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cosprp
+ * Sun Oct 18 12:19:54 UTC 2026
+ * -----------------------------
+ */
+
+#include <cos/Property.h>
+
+
+
@@ -0,0 +1,58 @@
+/*
+ * -----------------------------
+ * COS symbols
+ *
+ * DO NOT EDIT - DO NOT EDIT - DO NOT EDIT
+ * This file was automatically generated by cossym
+ * Sun Oct 18 12:19:54 UTC 2026
+ * -----------------------------
+ */
+
+extern struct Any cos_c_LckProbe;
+extern struct Any cos_c_mLckProbe;
+extern struct Any cos_c_pmLckProbe;
+extern struct Any cos_g_gprint;
+extern struct Any cos_m_gchr__LckProbe;
+extern struct Any cos_m_gdeinit__LckProbe;
+extern struct Any cos_m_ginit__LckProbe;
+extern struct Any cos_m_gint__LckProbe;
+extern struct Any cos_m_gprint__Array;
+extern struct Any cos_m_gprint__Int;
+extern struct Any cos_m_greverse__LckProbe;
+extern struct Any cos_m_gsht__LckProbe;
+extern struct Any cos_m_gsize__LckProbe;
+
+static struct Any* symtbl[] = {
+  &cos_c_LckProbe,
+  &cos_c_mLckProbe,
+  &cos_c_pmLckProbe,
+  &cos_g_gprint,
+  &cos_m_gchr__LckProbe,
+  &cos_m_gdeinit__LckProbe,
+  &cos_m_ginit__LckProbe,
+  &cos_m_gint__LckProbe,
+  &cos_m_gprint__Array,
+  &cos_m_gprint__Int,
+  &cos_m_greverse__LckProbe,
+  &cos_m_gsht__LckProbe,
+  &cos_m_gsize__LckProbe,
+  0
+};
+
+void cos_symbol_register(struct Any**, const char*);
+
+void cos_symbol_initCosStd(void);
+void cos_symbol_initCosBase(void);
+
+void cos_symbol_init(void);
+void cos_symbol_init(void)
+{
+   static int done = 0;
+   
+   if (!done) {
+     done = 1;
+     cos_symbol_initCosStd();
+     cos_symbol_initCosBase();
+     cos_symbol_register(symtbl,"testCosStd");
+   }
+}
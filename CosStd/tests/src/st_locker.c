@@ -0,0 +1,89 @@
+/**
+ * C Object System
+ * COS speed tests - lockers
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Array.h>
+#include <cos/Locker.h>
+#include <cos/Number.h>
+
+#include <cos/gen/object.h>
+#include <cos/gen/sequence.h>
+#include <cos/gen/value.h>
+
+#include <cos/utest.h>
+
+#include "tests.h"
+
+#include <stdio.h>
+#include <pthread.h>
+
+enum { T = 4, N = 2000000, W = 16 }; // one write (greverse) every W messages
+
+static void*
+messages(void *lck)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    if (i % W)
+      gsize(lck);
+    else
+      greverse(lck);
+
+  return 0;
+}
+
+static void
+st_locker(OBJ cls)
+{
+  OBJ arr = aArray(aInt(0),aInt(1),aInt(2),aInt(3),aInt(4),aInt(5),aInt(6),aInt(7));
+  OBJ lck = gnewWith(cls, arr);
+  struct cos_stest_info info[1];
+  pthread_t thr[T];
+  char str[64];
+  int i, n, err = 0;
+
+  // contention of a shared locker, rates are per CPU second
+  for (n = 1; n <= T; n *= 2) {
+    sprintf(str, "%s (%d thread%s, 1/%d writes)", gstr(cls), n, n > 1 ? "s" : "", W);
+    cos_stest_init(info, str, (long)n*N);
+
+    for (i = 0; i < n; i++)
+      err |= pthread_create(thr+i, 0, messages, lck);
+
+    for (i = 0; i < n; i++)
+      err |= pthread_join(thr[i], 0);
+
+    cos_stest_fini(info);
+  }
+
+  ensure( !err );
+  ensure( gsize(lck) == 8 && gint(gfirst(lck)) + gint(glast(lck)) == 7 );
+
+  grelease(lck);
+}
+
+void
+st_lockers(void)
+{
+  useclass(Locker, RWLocker, SpinLocker);
+
+  st_locker(Locker);
+  st_locker(RWLocker);
+  st_locker(SpinLocker);
+}
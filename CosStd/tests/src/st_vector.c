@@ -0,0 +1,264 @@
+/**
+ * C Object System
+ * COS speed tests - vector kernels
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/IntVector.h>
+#include <cos/FltVector.h>
+#include <cos/Function.h>
+#include <cos/Number.h>
+#include <cos/VectorExpr.h>
+
+#include <cos/gen/algorithm.h>
+#include <cos/gen/collection.h>
+#include <cos/gen/floatop.h>
+#include <cos/gen/numop.h>
+#include <cos/gen/object.h>
+#include <cos/gen/relop.h>
+#include <cos/gen/value.h>
+#include <cos/gen/vectop.h>
+
+#include <cos/utest.h>
+
+#include "tests.h"
+
+#include <stdio.h>
+#include <string.h>
+
+enum { E = 100000000 }; // elements per test
+
+static void
+st_vector(STR str, OBJ cls, OBJ val, U32 n, int lvl)
+{
+  OBJ vec1 = gnewWith2(cls, aInt(n), val);
+  OBJ vec2 = gnewWith2(cls, aInt(n), val);
+  struct cos_stest_info info[1];
+  char name[64];
+  U32 i;
+
+  Vector_simdLevel(lvl);
+
+  sprintf(name, "%s %s (n=%u, simd %d)", gstr(cls), str, n, lvl);
+  cos_stest_init(info, name, E/n*n);
+
+  if (!strcmp(str, "gaddTo"))
+    for (i = 0; i < E/n; i++) gaddTo(vec1, vec2);
+  else
+    for (i = 0; i < E/n; i++) gsqroot(vec1);
+
+  cos_stest_fini(info);
+
+  grelease(vec1);
+  grelease(vec2);
+}
+
+static void
+st_vector_expr(U32 n, BOOL fused)
+{
+  useclass(FltVector, AutoRelease);
+
+  OBJ a = gnewWith2(FltVector, aInt(n), aFloat(0));
+  OBJ b = gnewWith2(FltVector, aInt(n), aFloat(1.5));
+  OBJ c = gnewWith2(FltVector, aInt(n), aFloat(2));
+  OBJ d = gnewWith2(FltVector, aInt(n), aFloat(0.5));
+  OBJ x = gadd(gmul(aVectorExpr(b),c),d);
+  OBJ pool = gnew(AutoRelease);
+  U32 k = n < 4096 ? 4096/n : 1;
+  struct cos_stest_info info[1];
+  char name[64];
+  U32 i;
+
+  sprintf(name, "FltVector b*c+d %s (n=%u)", fused ? "fused" : "temporaries", n);
+  cos_stest_init(info, name, E/n*n);
+
+  if (fused)
+    for (i = 0; i < E/n; i++) gassign(a, x);
+  else
+    for (i = 0; i < E/n; i++) {
+      gadd(gmul(b,c),d);
+      if (i % k == k-1) grelease(pool), pool = gnew(AutoRelease);
+    }
+
+  cos_stest_fini(info);
+
+  grelease(pool);
+  grelease(a);
+  grelease(b);
+  grelease(c);
+  grelease(d);
+}
+
+static void
+st_vector_blas(STR str, U32 n, int lvl)
+{
+  useclass(FltVector, AutoRelease);
+
+  OBJ x = gnewWith2(FltVector, aInt(n), aFloat(0.5));
+  OBJ y = gnewWith2(FltVector, aInt(n), aFloat(1));
+  OBJ a = aFloat(1e-9);
+  OBJ pool = gnew(AutoRelease);
+  U32 k = n < 4096 ? 4096/n : 1;
+  struct cos_stest_info info[1];
+  char name[64];
+  U32 i;
+
+  Vector_simdLevel(lvl);
+
+  sprintf(name, "FltVector %s (n=%u, simd %d)", str, n, lvl);
+  cos_stest_init(info, name, E/n*n);
+
+  if (!strcmp(str, "gdot"))
+    for (i = 0; i < E/n; i++) {
+      gdot(x, y);
+      if (i % k == k-1) grelease(pool), pool = gnew(AutoRelease);
+    }
+  else
+    for (i = 0; i < E/n; i++) gaxpy(y, a, x);
+
+  cos_stest_fini(info);
+
+  grelease(pool);
+  grelease(x);
+  grelease(y);
+}
+
+static F64
+fcmp(F64 x, F64 y)
+{
+  return x - y;
+}
+
+static void
+st_vector_sort(STR str, U32 n)
+{
+  useclass(FltVector, AutoRelease, Lesser);
+
+  OBJ a = gnewWith2(FltVector, aInt(n), aFloat(0));
+  OBJ b = gnewWith2(FltVector, aInt(n), aFloat(0));
+  F64 *va = CAST(struct FltVector*, a)->value;
+  F64 *vb = CAST(struct FltVector*, b)->value;
+  OBJ f = !strcmp(str, "Functor"    ) ? aFun(gcompare, __1, __2) :
+          !strcmp(str, "FltFunction") ? aFltFct(fcmp, x, y) : Lesser;
+  OBJ pool = gnew(AutoRelease);
+  U32 m = E/100, seed = 1;
+  struct cos_stest_info info[1];
+  char name[64];
+  U32 i;
+
+  for (i = 0; i < n; i++)
+    seed = seed*1103515245 + 12345, vb[i] = seed / 1e3;
+
+  sprintf(name, "FltVector gsort %s (n=%u)", str, n);
+  cos_stest_init(info, name, m/n*n);
+
+  for (i = 0; i < m/n; i++) {
+    memcpy(va, vb, n * sizeof *va);
+    gsort(a, f);
+  }
+
+  cos_stest_fini(info);
+
+  sprintf(name, "FltVector gisort %s (n=%u)", str, n);
+  cos_stest_init(info, name, m/n*n);
+
+  for (i = 0; i < m/n; i++) {
+    gisort(b, f);
+    grelease(pool), pool = gnew(AutoRelease);
+  }
+
+  cos_stest_fini(info);
+
+  grelease(pool);
+  grelease(a);
+  grelease(b);
+}
+
+static F64
+fneg(F64 x)
+{
+  return -x;
+}
+
+static void
+st_vector_function(U32 n, BOOL typed)
+{
+  useclass(FltVector, AutoRelease);
+
+  OBJ a = gnewWith2(FltVector, aInt(n), aFloat(1.5));
+  OBJ f = typed ? aFltFct(fneg, x) : aFun(gneg, __1);
+  OBJ pool = gnew(AutoRelease);
+  U32 m = E/10;
+  U32 k = n < 4096 ? 4096/n : 1;
+  struct cos_stest_info info[1];
+  char name[64];
+  U32 i;
+
+  sprintf(name, "FltVector gmap %s (n=%u)", typed ? "FltFunction" : "Functor", n);
+  cos_stest_init(info, name, m/n*n);
+
+  for (i = 0; i < m/n; i++) {
+    gmap(f, a);
+    if (i % k == k-1) grelease(pool), pool = gnew(AutoRelease);
+  }
+
+  cos_stest_fini(info);
+
+  grelease(pool);
+  grelease(a);
+}
+
+void
+st_vectors(void)
+{
+  useclass(IntVector, FltVector);
+
+  U32 size [] = { 16, 1000, 100000, 10000000 };
+  U32 xsize[] = { 16, 1000, 100000,  1000000 };
+  int lvl, max = Vector_simdLevel(-1);
+  U32 i;
+
+  for (i = 0; i < COS_ARRLEN(size); i++)
+    for (lvl = 0; lvl <= max; lvl++) {
+      st_vector("gaddTo" , IntVector, aInt(1)    , size[i], lvl);
+      st_vector("gaddTo" , FltVector, aFloat(1)  , size[i], lvl);
+      st_vector("gsqroot", FltVector, aFloat(1.5), size[i], lvl);
+    }
+
+  for (i = 0; i < COS_ARRLEN(xsize); i++)
+    for (lvl = 0; lvl <= max; lvl++) {
+      st_vector_blas("gdot" , xsize[i], lvl);
+      st_vector_blas("gaxpy", xsize[i], lvl);
+    }
+
+  Vector_simdLevel(max);
+
+  for (i = 0; i < COS_ARRLEN(xsize); i++) {
+    st_vector_expr(xsize[i], NO );
+    st_vector_expr(xsize[i], YES);
+  }
+
+  for (i = 0; i < COS_ARRLEN(xsize); i++) {
+    st_vector_function(xsize[i], NO );
+    st_vector_function(xsize[i], YES);
+  }
+
+  for (i = 0; i < COS_ARRLEN(xsize); i++) {
+    st_vector_sort("Functor"    , xsize[i]);
+    st_vector_sort("FltFunction", xsize[i]);
+    st_vector_sort("Lesser"     , xsize[i]);
+  }
+}
@@ -42,6 +42,8 @@ int main(int argc, char *argv[])
   int debug_sym = NO;
   int alloc_trc = NO;
   int cache_trc = NO;
+  double dur;
+  STR str;
   int i;
 
   cos_logmsg_setLevel(COS_LOGMSG_DEBUG);
@@ -70,6 +72,8 @@ int main(int argc, char *argv[])
     atexit(on_exit);
     cos_init(); // explicit initialization for measurement
     printf("** COS init duration: %.3f s\n", cos_initDuration());
+    for (i = 0; (str = cos_initPhase(i, &dur)); i++)
+      printf("**   %-20s: %.6f s\n", str, dur);
   } else
     cos_init();
 
@@ -96,6 +100,12 @@ int main(int argc, char *argv[])
   ut_string();
   ut_array_basics();
   ut_array_functor();
+  ut_vector_kernels();
+  ut_vector_blas();
+  ut_vector_expr();
+  ut_vector_functions();
+  ut_vector_sort();
+  ut_locker();
 
   cos_utest_stat();
 
@@ -103,7 +113,8 @@ int main(int argc, char *argv[])
   if (speed_tst) {
     printf("\n** C Object System Library Speed Testsuite (%d bits) **\n", bits);
 
-    // TODO
+    st_lockers();
+    st_vectors();
 
     cos_stest_stat();
   }
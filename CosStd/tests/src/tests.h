@@ -26,6 +26,15 @@ void ut_xrange(void);
 void ut_string(void);
 void ut_array_basics(void);
 void ut_array_functor(void);
+void ut_vector_kernels(void);
+void ut_vector_blas(void);
+void ut_vector_expr(void);
+void ut_vector_functions(void);
+void ut_vector_sort(void);
+void ut_locker(void);
+
+void st_lockers(void);
+void st_vectors(void);
 
 defgeneric(OBJ, gprint, _1);
 
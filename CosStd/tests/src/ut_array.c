@@ -19,6 +19,7 @@
 
 #include <cos/Array.h>
 #include <cos/Functor.h>
+#include <cos/IntVector.h>
 #include <cos/Number.h>
 #include <cos/XRange.h>
 
@@ -200,6 +201,31 @@ ut_array_functor(void)
   arr = gmap(incr, aArray(aInt(0,1,2,3)));
   UTEST( gisEqual(arr, aArray(aInt(0,1,2,3))) == False );
 
+  // message expression (batched send)
+  arr = gmap(aMsg(gsqr), aArrayRef(buf,0));
+  UTEST( gisEqual(arr, aArrayRef(buf,0)) == True );
+
+  arr = gmap(aMsg(gsqr), aArray(aInt(1,2,3)));
+  UTEST( gisEqual(arr, aArray(aInt(1,4,9))) == True );
+
+  arr = gmap(aMsg(gsqr), aArray(aInt(1), aLong(2), aLong(3), aInt(4)));
+  UTEST( gisEqual(arr, aArray(aInt(1), aLong(4), aLong(9), aInt(16))) == True );
+
+  arr = gmap2(aMsg(gadd), aArray(aInt(1,2,3)), aArray(aInt(3,2,1,0)));
+  UTEST( gisEqual(arr, aArray(aInt(4,4,4))) == True );
+
+  gapply(aMsg(gsqr), arr = aArray(aInt(1,2,3)));
+  UTEST( gisEqual(arr, aArray(aInt(1,4,9))) == True );
+
+  gapply2(aMsg(gadd), arr = aArray(aInt(1,2,3)), aArray(aInt(1,1,1)));
+  UTEST( gisEqual(arr, aArray(aInt(2,3,4))) == True );
+
+  arr = gmap(aMsg(gsqr), aIntVector(1,2,3));
+  UTEST( gisEqual(arr, aIntVector(1,4,9)) == True );
+
+  arr = gmap2(aMsg(gadd), aIntVector(1,2,3), aIntVector(3,2,1));
+  UTEST( gisEqual(arr, aIntVector(4,4,4)) == True );
+
   // select
   arr = gselect(aArrayRef(buf,0), gt);
   UTEST( gisEqual(arr, aArrayRef(buf,0)) == True );
@@ -0,0 +1,305 @@
+/**
+ * C Object System
+ * COS testsuites - lockers
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/Array.h>
+#include <cos/Locker.h>
+#include <cos/Number.h>
+
+#include <cos/gen/accessor.h>
+#include <cos/gen/object.h>
+#include <cos/gen/relop.h>
+#include <cos/gen/sequence.h>
+#include <cos/gen/value.h>
+
+#include <cos/utest.h>
+
+#include "tests.h"
+
+#include <pthread.h>
+#include <time.h>
+
+/* NOTE-INFO: locker probe
+   The probe counts the threads inside its read messages (gsize, gint, gsht)
+   and write message (greverse), and the violations of the read/write
+   exclusion. gsize and gsht wait (up to WAIT ms) for a second reader to
+   enter, so two threads sending them at once overlap iff the locker shares
+   the lock. gchr throws ExBadValue.
+*/
+
+enum { WAIT = 100, T = 4, N = 100, W = 4 }; // one write every W messages
+
+defclass(LckProbe,Object)
+  pthread_mutex_t mtx;
+  pthread_cond_t  cnd;
+  int rd, wr, rdmax, err;
+endclass
+
+makclass(LckProbe,Object);
+
+useclass(ExBadValue, mExBadValue);
+
+defmethod(OBJ, ginit, LckProbe)
+  pthread_mutex_init(&self->mtx,0);
+  pthread_cond_init (&self->cnd,0);
+  self->rd = self->wr = self->rdmax = self->err = 0;
+  retmethod(_1);
+endmethod
+
+defmethod(OBJ, gdeinit, LckProbe)
+  pthread_cond_destroy (&self->cnd);
+  pthread_mutex_destroy(&self->mtx);
+  retmethod(_1);
+endmethod
+
+static void
+nap(void)
+{
+  struct timespec ts = { 0, 100000 };
+  nanosleep(&ts, 0);
+}
+
+static void
+enter(struct LckProbe *p, BOOL write, BOOL wait)
+{
+  pthread_mutex_lock(&p->mtx);
+
+  if (write) {
+    if (p->rd || p->wr) ++p->err;
+    ++p->wr;
+  } else {
+    if (p->wr) ++p->err;
+    if (++p->rd > p->rdmax) p->rdmax = p->rd;
+    pthread_cond_broadcast(&p->cnd);
+  }
+
+  if (wait) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_nsec += WAIT * 1000000L;
+    ts.tv_sec  += ts.tv_nsec / 1000000000L;
+    ts.tv_nsec %= 1000000000L;
+
+    while (p->rd < 2)
+      if (pthread_cond_timedwait(&p->cnd, &p->mtx, &ts))
+        break;
+  }
+
+  pthread_mutex_unlock(&p->mtx);
+}
+
+static void
+leave(struct LckProbe *p, BOOL write)
+{
+  pthread_mutex_lock(&p->mtx);
+  if (write) --p->wr; else --p->rd;
+  pthread_mutex_unlock(&p->mtx);
+}
+
+defmethod(U32, gsize, LckProbe)
+  enter(self, NO, YES);
+  leave(self, NO);
+  retmethod(0);
+endmethod
+
+defmethod(I32, gsht, LckProbe)
+  enter(self, NO, YES);
+  leave(self, NO);
+  retmethod(0);
+endmethod
+
+defmethod(I32, gint, LckProbe)
+  enter(self, NO, NO);
+  nap();
+  leave(self, NO);
+  retmethod(0);
+endmethod
+
+defmethod(OBJ, greverse, LckProbe)
+  enter(self, YES, NO);
+  nap();
+  leave(self, YES);
+  retmethod(_1);
+endmethod
+
+defmethod(I32, gchr, LckProbe)
+  THROW(ExBadValue);
+  retmethod(0);
+endmethod
+
+// ----- threads
+
+static void*
+sizes(void *lck)
+{
+  gsize(lck);
+  return 0;
+}
+
+static void*
+shorts(void *lck)
+{
+  gsht(lck);
+  return 0;
+}
+
+static void*
+messages(void *lck)
+{
+  int i;
+
+  for (i = 0; i < N; i++)
+    if (i % W)
+      gint(lck);
+    else
+      greverse(lck);
+
+  return 0;
+}
+
+static int
+run(void* (*fun)(void*), OBJ lck, int n)
+{
+  pthread_t thr[T];
+  int i, err = 0;
+
+  for (i = 0; i < n; i++)
+    err |= pthread_create(thr+i, 0, fun, lck);
+
+  for (i = 0; i < n; i++)
+    err |= pthread_join(thr[i], 0);
+
+  return err;
+}
+
+static BOOL
+overlap(void* (*fun)(void*), OBJ cls)
+{
+  useclass(LckProbe);
+
+  OBJ prb = gnew(LckProbe);
+  OBJ lck = gnewWith(cls, prb);
+  struct LckProbe *p = CAST(struct LckProbe*, prb);
+  int err = run(fun, lck, 2);
+  BOOL res = !err && !p->err && p->rdmax == 2;
+
+  grelease(lck);
+  grelease(prb);
+  return res;
+}
+
+static BOOL
+exclusion(OBJ cls)
+{
+  useclass(LckProbe);
+
+  OBJ prb = gnew(LckProbe);
+  OBJ lck = gnewWith(cls, prb);
+  struct LckProbe *p = CAST(struct LckProbe*, prb);
+  int err = run(messages, lck, T);
+  BOOL res = !err && !p->err && !p->rd && !p->wr;
+
+  grelease(lck);
+  grelease(prb);
+  return res;
+}
+
+static BOOL
+unlocked(OBJ cls)
+{
+  useclass(LckProbe);
+
+  OBJ prb = gnew(LckProbe);
+  OBJ lck = gnewWith(cls, prb);
+  BOOL res = NO;
+
+  TRY
+    gchr(lck);
+  CATCH(mExBadValue)
+    res = YES;
+  ENDTRY
+
+  // the lock must have been released by the exception
+  res = res && greverse(lck) == lck && gint(lck) == 0;
+
+  grelease(lck);
+  grelease(prb);
+  return res;
+}
+
+void
+ut_locker(void)
+{
+  useclass(Locker, RWLocker, SpinLocker);
+  useclass(AutoRelease);
+
+  OBJ pool = gnew(AutoRelease);
+  OBJ arr  = aArray(aInt(0),aInt(1),aInt(2));
+  OBJ lck1 = gnewWith(Locker    , arr);
+  OBJ lck2 = gnewWith(RWLocker  , arr);
+  OBJ lck3 = gnewWith(SpinLocker, arr);
+
+  UTEST_START("Locker")
+
+    // forwarding
+    UTEST( gsize(lck1) == 3 && gsize(lck2) == 3 && gsize(lck3) == 3 );
+    UTEST( gint(gfirst(lck1)) == 0 && gint(glast(lck2)) == 2 );
+    UTEST( gint(ggetAt(lck3, aInt(1))) == 1 );
+    UTEST( gisEqual(lck1, arr) == True && gisEqual(arr, lck2) == True );
+    UTEST( gisEqual(lck1, lck3) == True && gisEqual(lck2, lck2) == True );
+    UTEST( greverse(lck2) == lck2 && gint(gfirst(lck2)) == 2 );
+    UTEST( greverse(lck3) == lck3 && gint(gfirst(lck3)) == 2 );
+    UTEST( gisEqual(lck2, lck3) == True && gisEqual(lck1, lck2) == False );
+
+    // read-only messages
+    UTEST( Locker_isReadOnly(genericref(gsize)) == YES );
+    UTEST( Locker_isReadOnly(genericref(gint )) == YES );
+    UTEST( Locker_isReadOnly(genericref(greverse)) == NO );
+
+    // read/write exclusion
+    UTEST( exclusion(Locker) );
+    UTEST( exclusion(RWLocker) );
+    UTEST( exclusion(SpinLocker) );
+
+    // only RWLocker shares the read-only messages
+    UTEST( !overlap(sizes, Locker) );
+    UTEST(  overlap(sizes, RWLocker) );
+    UTEST( !overlap(sizes, SpinLocker) );
+
+    // registered read-only messages
+    UTEST( Locker_isReadOnly(genericref(gsht)) == NO );
+    UTEST( !overlap(shorts, RWLocker) );
+    Locker_readOnly(genericref(gsht));
+    Locker_readOnly(genericref(gsht));
+    UTEST( Locker_isReadOnly(genericref(gsht)) == YES );
+    UTEST(  overlap(shorts, RWLocker) );
+    UTEST( !overlap(shorts, Locker) );
+
+    // exceptions release the locks
+    UTEST( unlocked(Locker) );
+    UTEST( unlocked(RWLocker) );
+    UTEST( unlocked(SpinLocker) );
+
+  UTEST_END
+
+  grelease(lck1);
+  grelease(lck2);
+  grelease(lck3);
+  grelease(pool);
+}
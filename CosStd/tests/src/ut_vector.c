@@ -0,0 +1,464 @@
+/**
+ * C Object System
+ * COS testsuites - vector
+ *
+ * Copyright 2006+ Laurent Deniau <laurent.deniau@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cos/ShtVector.h>
+#include <cos/IntVector.h>
+#include <cos/LngVector.h>
+#include <cos/FltVector.h>
+#include <cos/CpxVector.h>
+#include <cos/VectorExpr.h>
+#include <cos/Function.h>
+#include <cos/Number.h>
+#include <cos/Range.h>
+#include <cos/Slice.h>
+#include <cos/XRange.h>
+#include <cos/View.h>
+
+#include <cos/gen/accessor.h>
+#include <cos/gen/algorithm.h>
+#include <cos/gen/collection.h>
+
+#include <cos/gen/floatop.h>
+#include <cos/gen/numop.h>
+#include <cos/gen/object.h>
+#include <cos/gen/relop.h>
+#include <cos/gen/sequence.h>
+#include <cos/gen/value.h>
+#include <cos/gen/vectop.h>
+
+#include <cos/utest.h>
+
+#include <complex.h>
+#include <math.h>
+
+#include "tests.h"
+
+static BOOL
+isEq(OBJ vec, OBJ ref)
+{
+  return gisEqual(vec, ref) == True;
+}
+
+void
+ut_vector_kernels(void)
+{
+  int lvl, max = Vector_simdLevel(-1);
+
+  UTEST_START("Vector kernels")
+
+    for (lvl = max; lvl >= 0; lvl--) {
+      UTEST( Vector_simdLevel(lvl) == lvl );
+
+      // unary (odd sizes to exercise the tails)
+      UTEST( isEq(gabsolute(aIntVector(-1,2,-3,4,-5,6,-7,8,-9)),
+                            aIntVector( 1,2, 3,4, 5,6, 7,8, 9)) );
+      UTEST( isEq(gnegate  (aLngVector(-1,2,-3,4,-5,6,-7,8,-9)),
+                            aLngVector( 1,-2,3,-4,5,-6,7,-8,9)) );
+      UTEST( isEq(gsquare  (aFltVector(-1,2,-3,4,-5,6,-7,8,-9)),
+                            aFltVector( 1,4, 9,16,25,36,49,64,81)) );
+      UTEST( isEq(ginvert  (aFltVector(1,2,4,8,0.5,0.25,-1,-2,-4)),
+                            aFltVector(1,0.5,0.25,0.125,2,4,-1,-0.5,-0.25)) );
+      UTEST( isEq(gsqroot  (aFltVector(1,4,9,16,25,36,49,64,81)),
+                            aFltVector(1,2,3,4,5,6,7,8,9)) );
+
+      // binary
+      UTEST( isEq(gaddTo(aIntVector(1,2,3,4,5,6,7,8,9), aIntVector(9,8,7,6,5,4,3,2,1)),
+                         aIntVector(10,10,10,10,10,10,10,10,10)) );
+      UTEST( isEq(gsubTo(aLngVector(1,2,3,4,5,6,7,8,9), aLngVector(1,1,1,1,1,1,1,1,1)),
+                         aLngVector(0,1,2,3,4,5,6,7,8)) );
+      UTEST( isEq(gmulBy(aIntVector(1,2,3,4,5,6,7,8,9), aIntVector(2,2,2,2,2,2,2,2,2)),
+                         aIntVector(2,4,6,8,10,12,14,16,18)) );
+      UTEST( isEq(gdivBy(aFltVector(2,4,6,8,10,12,14,16,18), aFltVector(2,2,2,2,2,2,2,2,2)),
+                         aFltVector(1,2,3,4,5,6,7,8,9)) );
+
+      // aliased and overlapping arguments
+      { OBJ v = aFltVector(1,2,3,4,5,6,7,8,9);
+        UTEST( isEq(gaddTo(v,v), aFltVector(2,4,6,8,10,12,14,16,18)) );
+      }
+      { struct FltVector *v = atFltVector(1,1,1,1,1,1,1,1,1,1);
+        gaddTo(aFltVectorView(v,atSlice(1,9)), aFltVectorView(v,atSlice(0,9)));
+        UTEST( isEq((OBJ)v, aFltVector(1,2,3,4,5,6,7,8,9,10)) );
+      }
+
+      // strided
+      { struct IntVector *v = atIntVector(-1,-2,-3,-4,-5,-6);
+        gnegate(aIntVectorView(v,atSlice(0,3,2)));
+        UTEST( isEq((OBJ)v, aIntVector(1,-2,3,-4,5,-6)) );
+      }
+    }
+
+    UTEST( Vector_simdLevel(max) == max );
+
+  UTEST_END
+}
+
+void
+ut_vector_blas(void)
+{
+  useclass(FltVector, Nil);
+
+  int lvl, max = Vector_simdLevel(-1);
+
+  UTEST_START("Vector BLAS-1")
+
+    for (lvl = max; lvl >= 0; lvl--) {
+      Vector_simdLevel(lvl);
+
+      // compensated sums (the naive sum is off by ~1e-12)
+      { OBJ v = gnewWith2(FltVector, aInt(1003), aFloat(0.1));
+        UTEST( fabs(gflt(gsum(v)) - 100.3) < 1e-13 );
+        UTEST( fabs(gflt(gdot(v, v)) - 10.03) < 1e-14 );
+        UTEST( fabs(gflt(gnorm2(v)) - sqrt(10.03)) < 1e-15 );
+        grelease(v);
+      }
+      UTEST( isEq(gsum(aCpxVector(1+I,2-3*I,0.5)), aComplex(3.5,-2)) );
+
+      // dot, norm2
+      UTEST( isEq(gdot(aFltVector(1,2,3), aFltVector(4,5,6)), aFloat(32)) );
+      UTEST( isEq(gdot(aCpxVector(1+2*I,3), aCpxVector(I,2)), aComplex(4,1)) );
+      UTEST( isEq(gnorm2(aFltVector(3,4)), aFloat(5)) );
+      UTEST( fabs(gflt(gnorm2(aFltVector(3e200,-4e200))) / 5e200 - 1) < 1e-15 );
+      UTEST( fabs(gflt(gnorm2(aFltVector(3e-200,4e-200))) / 5e-200 - 1) < 1e-15 );
+      UTEST( isEq(gnorm2(aFltVector(0,0,0)), aFloat(0)) );
+      UTEST( isEq(gnorm2(aCpxVector(3+4*I)), aFloat(5)) );
+      UTEST( fabs(gflt(gnorm2(aCpxVector(3e200+4e200*I))) / 5e200 - 1) < 1e-15 );
+
+      // axpy, scal
+      UTEST( isEq(gaxpy(aFltVector(1,2,3), aFloat(2), aFltVector(1,1,1)),
+                  aFltVector(3,4,5)) );
+      UTEST( isEq(gaxpy(aCpxVector(1,I), aComplex(0,1), aCpxVector(1,1)),
+                  aCpxVector(1+I,2*I)) );
+      UTEST( isEq(gscal(aFltVector(1,2,3), aFloat(2)), aFltVector(2,4,6)) );
+      UTEST( isEq(gscal(aCpxVector(1,I), aComplex(0,1)), aCpxVector(I,-1)) );
+      UTEST( isEq(gscal(aCpxVector(1,I), aFloat(2)), aCpxVector(2,2*I)) );
+      UTEST( isEq(gaxpy(aFltVector(1,2,3), aInt(-1), aFltVector(1,1,1)),
+                  aFltVector(0,1,2)) );
+      UTEST( isEq(gscal(aFltVector(1,2,3), aInt(2)), aFltVector(2,4,6)) );
+      UTEST( isEq(gscal(aCpxVector(1,I), aLong(3)), aCpxVector(3,3*I)) );
+
+      // minmax, iamax
+      UTEST( isEq(gminmax(aFltVector(3,-1,NAN,7,2)), aFltVector(-1,7)) );
+      UTEST( isnan(gflt(gfirst(gminmax(aFltVector(NAN,NAN))))) );
+      UTEST( gint(giamax(aFltVector(1,-5,5,NAN,3))) == 1 );
+      UTEST( gint(giamax(aFltVector(0,0))) == 0 );
+      UTEST( giamax(gautoRelease(gnewWith2(FltVector, aInt(0), aFloat(0)))) == Nil );
+      UTEST( giamax(aFltVector(NAN)) == Nil );
+      UTEST( gint(giamax(aCpxVector(1+I,-2,1-1.5*I))) == 2 );
+
+      // strided views
+      { struct FltVector *v = atFltVector(1,9,2,9,3,9);
+        OBJ w = aFltVectorView(v,atSlice(0,3,2));
+        OBJ r = aFltVectorView(v,atSlice(4,3,-2));
+        UTEST( isEq(gsum(w), aFloat(6)) );
+        UTEST( isEq(gdot(w, r), aFloat(10)) );
+        UTEST( isEq(gnorm2(w), aFloat(sqrt(14))) );
+        UTEST( isEq(gminmax(r), aFltVector(1,3)) );
+        UTEST( gint(giamax(r)) == 0 );
+        gaxpy(w, aFloat(-1), aFltVector(1,2,3));
+        UTEST( isEq((OBJ)v, aFltVector(0,9,0,9,0,9)) );
+      }
+      { struct CpxVector *v = atCpxVector(1,9,I,9);
+        OBJ w = aCpxVectorView(v,atSlice(0,2,2));
+        UTEST( isEq(gsum(w), aComplex(1,1)) );
+        UTEST( isEq(gdot(w, w), aComplex(0,0)) );
+        UTEST( isEq(gnorm2(w), aFloat(sqrt(2))) );
+        gscal(w, aComplex(0,1));
+        UTEST( isEq((OBJ)v, aCpxVector(I,9,-1,9)) );
+      }
+    }
+
+    Vector_simdLevel(max);
+
+  UTEST_END
+}
+
+void
+ut_vector_expr(void)
+{
+  useclass(IntVector, LngVector, FltVector, CpxVector, VectorExpr, View);
+
+  int lvl, max = Vector_simdLevel(-1);
+
+  UTEST_START("Vector expression")
+
+    for (lvl = max; lvl >= 0; lvl--) {
+      Vector_simdLevel(lvl);
+
+      // fused vs temporaries (several blocks with a tail)
+      { OBJ a = gnewWith2(FltVector, aInt(1000), aFloat(0));
+        OBJ b = gnewWith (FltVector, aXRange(1,1000));
+        OBJ c = gnewWith2(FltVector, aInt(1000), aFloat(0.5));
+        OBJ d = gnewWith (FltVector, aXRange(1000,1,-1));
+        OBJ e = gautoRelease(gnewWith(VectorExpr, b));
+        OBJ r;
+
+        UTEST( gsize(e) == 1000 );
+        UTEST( isEq(gassign(a, gadd(gmul(e,c),d)), gadd(gmul(b,c),d)) );
+        UTEST( isEq(gnewWith(FltVector, gsub(gdiv(e,c),gneg(aVectorExpr(d)))),
+                    gsub(gdiv(b,c),gneg(d))) );
+
+        // destination as operand and shared subexpression
+        r = gmul(b,a);
+        UTEST( isEq(gassign(a, gmul(aVectorExpr(a),e)), r) );
+        e = gsqr(e);
+        UTEST( isEq(gassign(a, gadd(e,e)), gadd(gsqr(b),gsqr(b))) );
+
+        grelease(a); grelease(b); grelease(c); grelease(d);
+      }
+
+      // promotion
+      UTEST( isEq(gnewWith(FltVector, gadd(gmul(aVectorExpr(aIntVector(1,2,3)),
+                                                 aFltVector(0.5,0.5,0.5)),
+                                            aShtVector(1,1,1))),
+                  aFltVector(1.5,2,2.5)) );
+      UTEST( isEq(gnewWith(IntVector, gdiv(aVectorExpr(aIntVector(7,8,9)),
+                                           aShtVector(2,2,2))),
+                  aIntVector(3,4,4)) );
+      UTEST( isEq(gnewWith(FltVector, ginv(aVectorExpr(aIntVector(1,2,4)))),
+                  aFltVector(1,0.5,0.25)) );
+      UTEST( isEq(gnewWith(FltVector, gabs(aVectorExpr(aCpxVector(3+4*I,-5)))),
+                  aFltVector(5,5)) );
+      UTEST( isEq(gnewWith(CpxVector, gsqr(aVectorExpr(aCpxVector(1*I,2*I)))),
+                  aCpxVector(-1,-4)) );
+      UTEST( isEq(gnewWith(LngVector, gabs(gneg(aVectorExpr(aIntVector(1,-2,3))))),
+                  aLngVector(1,2,3)) );
+
+      // deep expression (evaluation blocks on the heap)
+      { OBJ v = aIntVector(1,2,3);
+        UTEST( isEq(gnewWith(IntVector,
+                      gadd(v,gadd(v,gadd(v,gadd(v,gadd(v,aVectorExpr(v))))))),
+                    aIntVector(6,12,18)) );
+      }
+
+      // slices, strides and overlaps
+      { OBJ v = aIntVector(0,0,0,0,0,0);
+        gputAt(v, aSlice(1,3,2), gmul(aVectorExpr(aIntVector(1,2,3)),aIntVector(2,2,2)));
+        UTEST( isEq(v, aIntVector(0,2,0,4,0,6)) );
+        gputAt(v, aRange(-5,-1,2), gadd(aVectorExpr(aIntVector(1,2,3)),aIntVector(1,1,1)));
+        UTEST( isEq(v, aIntVector(0,2,0,3,0,4)) );
+      }
+      { OBJ v = gnewWith(FltVector, aXRange(1,1000));
+        OBJ w = gnewWith(FltVector, aXRange(0,1998,2));
+        OBJ u = gautoRelease(gnewWith2(View, v, aSlice(0,999)));
+        struct FltVector *vec = CAST(struct FltVector*, v);
+
+        gputAt(w, aInt(0), aFloat(1));
+        gputAt(v, aSlice(1,999), gadd(aVectorExpr(u), u));
+        UTEST( isEq(v, w) );
+
+        gassign(w, aVectorExpr(gautoRelease(gnewWith(FltVector, aXRange(-1000,-1)))));
+        gassign(v, aVectorExpr(gautoRelease(gnewWith(FltVector, aXRange(1,1000)))));
+        gassign(aFltVectorView(vec,atSlice(999,1000,-1)), gneg(aVectorExpr(v)));
+        UTEST( isEq(v, w) );
+
+        grelease(v); grelease(w);
+      }
+    }
+
+    Vector_simdLevel(max);
+
+  UTEST_END
+}
+
+static I32 isOdd (I32 a)               { return a & 1; }
+static I32 iadd  (I32 a, I32 b)        { return a + b; }
+static I32 icmp  (I32 a, I32 b)        { return (a > b) - (a < b); }
+static I32 icmpr (I32 a, I32 b)        { return (a < b) - (a > b); }
+static I64 lmax  (I64 a, I64 b)        { return a > b ? a : b; }
+static I64 ltwice(I64 a)               { return 2*a; }
+static F64 fsqr  (F64 a)               { return a*a; }
+static F64 fmadd (F64 a, F64 b, F64 c) { return a*b+c; }
+static F64 fsum4 (F64 a, F64 b, F64 c, F64 d) { return a+b+c+d; }
+static F64 fneg  (F64 a)               { return a < 0; }
+static F64 fcmp  (F64 a, F64 b)        { return a - b; }
+static C64 cconj (C64 a)               { return conj(a); }
+static C64 cmul  (C64 a, C64 b)        { return a * b; }
+
+void
+ut_vector_functions(void)
+{
+  useclass(IntVector);
+
+  UTEST_START("Vector typed functions")
+
+    // map, apply
+    UTEST( isEq(gmap (aFltFct(fsqr,x), aFltVector(1,-2,3)), aFltVector(1,4,9)) );
+    UTEST( isEq(gmap (aLngFct(ltwice,x), aLngVector(1,2,3)), aLngVector(2,4,6)) );
+    UTEST( isEq(gmap (aCpxFct(cconj,x), aCpxVector(1+I,2-I)), aCpxVector(1-I,2+I)) );
+    UTEST( isEq(gmap2(aIntFct(iadd,x,y), aShtVector(1,2,3), aShtVector(3,2,1,0)),
+                aShtVector(4,4,4)) );
+    UTEST( isEq(gmap3(aFltFct(fmadd,x,y,z), aFltVector(1,2), aFltVector(3,4), aFltVector(1,1)),
+                aFltVector(4,9)) );
+    UTEST( isEq(gmap4(aFltFct(fsum4,x,y,z,t), aFltVector(1,2), aFltVector(3,4),
+                      aFltVector(5,6), aFltVector(7,8)),
+                aFltVector(16,20)) );
+    UTEST( isEq(gapply(aFltFct(fsqr,x), aFltVector(1,-2,3)), aFltVector(1,4,9)) );
+
+    // strided
+    { struct IntVector *v = atIntVector(1,2,3,4,5,6);
+      OBJ w = aIntVectorView(v,atSlice(0,3,2));
+      UTEST( isEq(gmap2(aIntFct(iadd,x,y), w, w), aIntVector(2,6,10)) );
+      UTEST( isEq(gselect(aIntVectorView(v,atSlice(5,6,-1)), aIntFct(isOdd,x)),
+                  aIntVector(5,3,1)) );
+    }
+
+    // select, reject, all, any, count
+    UTEST( isEq(gselect(aIntVector(1,2,3,4,5), aIntFct(isOdd,x)), aIntVector(1,3,5)) );
+    UTEST( isEq(greject(aIntVector(1,2,3,4,5), aIntFct(isOdd,x)), aIntVector(2,4)) );
+    UTEST( gall  (aFltVector(-1,-2), aFltFct(fneg,x)) == True  );
+    UTEST( gall  (aFltVector(-1, 2), aFltFct(fneg,x)) == False );
+    UTEST( gany  (aFltVector( 1,-2), aFltFct(fneg,x)) == True  );
+    UTEST( gany  (aFltVector( 1, 2), aFltFct(fneg,x)) == False );
+    UTEST( gcount(aIntVector(1,2,3,4,5), aIntFct(isOdd,x)) == 3 );
+
+    // reduce, accumulate
+    UTEST( gint(greduce (aShtVector(1,2,3,4), aIntFct(iadd,x,y))) == 10 );
+    UTEST( gint(greduce (aShtVector(20000,20000,20000), aIntFct(iadd,x,y))) == 60000 );
+    UTEST( glng(greduce1(aLngVector(1,5,3), aLngFct(lmax,x,y), aLong(4))) == 5 );
+    UTEST( isEq(greduce(aCpxVector(I,I), aCpxFct(cmul,x,y)), aComplex(-1)) );
+    UTEST( isEq(gaccumulate (aIntVector(1,2,3,4), aIntFct(iadd,x,y)), aIntVector(3,6,10)) );
+    UTEST( isEq(gaccumulate1(aIntVector(1,2,3), aIntFct(iadd,x,y), aInt(1)), aIntVector(2,4,7)) );
+
+    // sort (contiguous, reversed and strided views, indirect)
+    { OBJ v = gnewWith(IntVector, aRange(1000,1,-7));
+      OBJ r = gautoRelease(gclone(v));
+      gsort(r, aIntFct(icmp,x,y));
+      UTEST( isEq(r, greverse(v)) );
+      gsort(r, aIntFct(icmpr,x,y));
+      UTEST( isEq(r, greverse(v)) );
+      grelease(v);
+    }
+    UTEST( isEq(gsort(aFltVector(3,-1,2,0.5), aFltFct(fcmp,x,y)), aFltVector(-1,0.5,2,3)) );
+    { struct FltVector *v = atFltVector(3,9,-1,8,2,7,0.5,6);
+      gsort(aFltVectorView(v,atSlice(0,4,2)), aFltFct(fcmp,x,y));
+      UTEST( isEq((OBJ)v, aFltVector(-1,9,0.5,8,2,7,3,6)) );
+      gsort(aFltVectorView(v,atSlice(6,4,-2)), aFltFct(fcmp,x,y));
+      UTEST( isEq((OBJ)v, aFltVector(3,9,2,8,0.5,7,-1,6)) );
+    }
+    { struct IntVector *v = atIntVector(5,1,4,2,3);
+      gsort(aIntVectorView(v,atSlice(4,5,-1)), aIntFct(icmp,x,y));
+      UTEST( isEq((OBJ)v, aIntVector(5,4,3,2,1)) );
+    }
+    UTEST( isEq(gisort(aIntVector(30,10,20), aIntFct(icmp,x,y)), aIntVector(1,2,0)) );
+
+  UTEST_END
+}
+
+// ----- sorting without comparator
+
+static U32 seed = 12345;
+
+static I32
+irand(void)
+{
+  seed = seed*1103515245 + 12345;
+  return (I32)(seed >> 1) - (I32)0x40000000;
+}
+
+static BOOL
+isStable(OBJ vec, OBJ idx, OBJ ord)
+{ // elements of vec at idx are ordered, equal elements have increasing idx
+  useclass(Equal);
+
+  U32 i, n = gsize(idx);
+
+  for (i = 1; i < n; i++) {
+    OBJ a = ggetAt(vec, ggetAt(idx, aInt(i-1)));
+    OBJ b = ggetAt(vec, ggetAt(idx, aInt(i  )));
+    OBJ r = gcompare(b, a);
+
+    if (r == ord) return NO;
+    if (r == Equal &&
+        gint(ggetAt(idx, aInt(i-1))) > gint(ggetAt(idx, aInt(i)))) return NO;
+  }
+  return YES;
+}
+
+static OBJ
+sorted(OBJ vec, OBJ fun)
+{
+  return gsort(gautoRelease(gclone(vec)), fun);
+}
+
+void
+ut_vector_sort(void)
+{
+  useclass(ShtVector, IntVector, LngVector, FltVector, Lesser, Greater);
+
+  UTEST_START("Vector sort without comparator")
+
+    // small and large sizes (insertion and radix sort) against functors
+    { U32 n, k, size[] = { 0, 1, 5, 31, 32, 1000 };
+      for (k = 0; k < COS_ARRLEN(size); k++) {
+        OBJ sv = gnewWith2(ShtVector, aInt(size[k]), aShort(0));
+        OBJ iv = gnewWith2(IntVector, aInt(size[k]), aInt(0));
+        OBJ lv = gnewWith2(LngVector, aInt(size[k]), aLong(0));
+        OBJ fv = gnewWith2(FltVector, aInt(size[k]), aFloat(0));
+        for (n = 0; n < size[k]; n++) {
+          I32 r = irand();
+          CAST(struct ShtVector*, sv)->value[n] = (I16)(r % 100);
+          CAST(struct IntVector*, iv)->value[n] = r;
+          CAST(struct LngVector*, lv)->value[n] = (I64)r * 12345;
+          CAST(struct FltVector*, fv)->value[n] = r / 1e6;
+        }
+        UTEST( isEq(sorted(sv, Lesser), sorted(sv, aIntFct(icmp,x,y))) );
+        UTEST( isEq(sorted(iv, Greater), sorted(iv, aIntFct(icmpr,x,y))) );
+        UTEST( isEq(sorted(lv, Lesser), sorted(lv, aFun(gcompare,__1,__2))) );
+        UTEST( isEq(sorted(fv, Lesser), sorted(fv, aFltFct(fcmp,x,y))) );
+        UTEST( isStable(sv, gisort(sv, Lesser ), Lesser ) );
+        UTEST( isStable(sv, gisort(sv, Greater), Greater) );
+        UTEST( isStable(fv, gisort(fv, Lesser ), Lesser ) );
+        grelease(sv), grelease(iv), grelease(lv), grelease(fv);
+      }
+    }
+
+    // extreme values
+    UTEST( isEq(gsort(aShtVector(0,32767,-1,-32768,1), Lesser),
+                aShtVector(-32768,-1,0,1,32767)) );
+    UTEST( isEq(gsort(aLngVector(0,-9000000000000000000LL,-1,9000000000000000000LL), Greater),
+                aLngVector(9000000000000000000LL,0,-1,-9000000000000000000LL)) );
+
+    // floating order (-0 < +0 and NaN last)
+    { struct FltVector *v = atFltVector(NAN,1,0.0,-INFINITY,-0.0,INFINITY,-2);
+      F64 *r = v->value;
+      gsort((OBJ)v, Lesser);
+      UTEST( isinf(r[0]) && r[0] < 0 && r[1] < -1 && signbit(r[2]) && !signbit(r[3]) );
+      UTEST( r[4] > 0 && isinf(r[5]) && r[5] > 0 && isnan(r[6]) );
+      gsort((OBJ)v, Greater);
+      UTEST( isnan(r[0]) && isinf(r[1]) && !signbit(r[3]) && signbit(r[4]) );
+    }
+
+    // stable permutations
+    UTEST( isEq(gisort(aIntVector(2,1,2,1,0), Lesser ), aIntVector(4,1,3,0,2)) );
+    UTEST( isEq(gisort(aIntVector(2,1,2,1,0), Greater), aIntVector(0,2,1,3,4)) );
+    UTEST( isEq(gisort(aFltVector(0.5,-0.5,0.5), Lesser), aIntVector(1,0,2)) );
+
+    // strided and reversed views
+    { struct IntVector *v = atIntVector(5,1,4,2,3);
+      gsort(aIntVectorView(v,atSlice(4,5,-1)), Lesser);
+      UTEST( isEq((OBJ)v, aIntVector(5,4,3,2,1)) );
+    }
+    { struct FltVector *v = atFltVector(3,9,-1,8,2,7,0.5,6);
+      gsort(aFltVectorView(v,atSlice(0,4,2)), Lesser);
+      UTEST( isEq((OBJ)v, aFltVector(-1,9,0.5,8,2,7,3,6)) );
+      UTEST( isEq(gisort(aFltVectorView(v,atSlice(1,4,2)), Lesser), aIntVector(3,2,1,0)) );
+    }
+
+  UTEST_END
+}